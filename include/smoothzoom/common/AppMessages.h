@@ -21,6 +21,9 @@ static constexpr UINT WM_OPEN_SETTINGS = WM_APP + 1;
 static constexpr UINT WM_TRAYICON      = WM_APP + 2;
 static constexpr UINT WM_GRACEFUL_EXIT = WM_APP + 3;
 static constexpr UINT WM_UPDATE_TRAY_ICON = WM_APP + 4;
+// Input thread → main: hook service time nears the OS timeout (R-05).
+// wParam = HookEventKind, lParam = the triggering callback's service time (µs).
+static constexpr UINT WM_HOOK_SERVICE_ALARM = WM_APP + 5;
 
 // Context menu command IDs
 static constexpr UINT IDM_SETTINGS     = 40001;
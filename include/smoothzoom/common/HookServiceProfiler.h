@@ -0,0 +1,230 @@
+#pragma once
+// =============================================================================
+// SmoothZoom — HookServiceProfiler
+// Per-event-type service time of the LL hook callbacks, slow-callback counts
+// and an early warning before the OS hook timeout. Doc 3 §2.5, §3.1 (R-05)
+//
+// Windows silently removes an LL hook whose callback exceeds
+// LowLevelHooksTimeout (~300 ms by default). The watchdog only notices
+// afterwards, from input arriving without callbacks. The input thread records
+// every callback's service time here: into a LatencyHistogram per event type,
+// into counters for callbacks at or above each configured threshold (1, 10
+// and 100 ms by default), and into a smoothed trend. record() returns true
+// — once, until the condition clears — when a single callback reaches a third
+// of the timeout or the trend reaches a sixteenth of it, so the hook can post
+// the main thread a warning while the hook is still installed.
+//
+// One writer (the input thread): record() and configure(). Any thread may
+// take a snapshot(); values are relaxed atomics read individually, like
+// LatencyHistogram's, except that configure() publishes its reset of the slow
+// counts SeqLock-style (odd generation while writing), so a snapshot never
+// pairs one generation with the other's counts.
+//
+// Pure logic — no Win32 API dependencies (CI-safe, unit-tested).
+// =============================================================================
+
+#include "smoothzoom/common/LatencyHistogram.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace SmoothZoom
+{
+
+enum class HookEventKind : uint8_t
+{
+    MouseMove,
+    MouseButton,  // buttons, X buttons — anything but moves and wheels
+    MouseWheel,   // WM_MOUSEWHEEL / WM_MOUSEHWHEEL
+    Keyboard,
+};
+
+class HookServiceProfiler
+{
+public:
+    static constexpr int kKinds = 4;
+    static constexpr int kMaxThresholds = 4;
+    static constexpr uint32_t kDefaultTimeoutUs = 300000;
+
+    struct Snapshot
+    {
+        std::array<LatencyHistogram::Counts, kKinds> byKind{};
+        std::array<uint64_t, kMaxThresholds> slow{};      // callbacks ≥ thresholdsUs[i]
+        std::array<uint32_t, kMaxThresholds> thresholdsUs{};
+        int thresholdCount = 0;
+        uint32_t timeoutUs = kDefaultTimeoutUs;
+        uint32_t trendUs = 0;    // smoothed service time at the snapshot
+        uint32_t worstUs = 0;    // slowest callback since start
+        uint64_t alarms = 0;
+        uint32_t generation = 0; // bumped by configure() (slow counts restart)
+
+        const LatencyHistogram::Counts& kind(HookEventKind k) const
+        {
+            return byKind[static_cast<size_t>(k)];
+        }
+
+        LatencyHistogram::Counts total() const
+        {
+            LatencyHistogram::Counts t;
+            for (const auto& c : byKind)
+                for (size_t b = 0; b < t.n.size(); ++b)
+                    t.n[b] += c.n[b];
+            return t;
+        }
+
+        // Counts recorded after `earlier`. Slow counts restart on configure(),
+        // so across a generation change they are taken as they are.
+        Snapshot since(const Snapshot& earlier) const
+        {
+            Snapshot d = *this;
+            for (size_t k = 0; k < byKind.size(); ++k)
+                d.byKind[k] = byKind[k].since(earlier.byKind[k]);
+            if (generation == earlier.generation)
+                for (size_t i = 0; i < slow.size(); ++i)
+                    d.slow[i] = slow[i] - earlier.slow[i];
+            d.alarms = alarms - earlier.alarms;
+            return d;
+        }
+    };
+
+    HookServiceProfiler()
+    {
+        const uint32_t defaults[] = {1000, 10000, 100000};
+        configure(defaults, 3, kDefaultTimeoutUs);
+    }
+
+    // Slow-callback thresholds (µs; zero and repeated values dropped, sorted,
+    // at most kMaxThresholds) and the OS hook timeout the warning levels
+    // derive from (0: kDefaultTimeoutUs). Restarts the slow counts — only if
+    // either actually changed, so unrelated settings changes keep the field
+    // statistics. Returns whether it did.
+    bool configure(const uint32_t* thresholdsUs, int count, uint32_t timeoutUs)
+    {
+        std::array<uint32_t, kMaxThresholds> t{};
+        int n = 0;
+        for (int i = 0; i < count && n < kMaxThresholds; ++i)
+            if (thresholdsUs[i] != 0 && std::find(t.begin(), t.begin() + n, thresholdsUs[i]) == t.begin() + n)
+                t[static_cast<size_t>(n++)] = thresholdsUs[i];
+        std::sort(t.begin(), t.begin() + n);
+
+        const uint32_t timeout = timeoutUs != 0 ? timeoutUs : kDefaultTimeoutUs;
+        if (configured_ && n == thresholdCount_ && t == thresholds_ && timeout == timeoutUs_)
+            return false;
+        configured_ = true;
+
+        // Odd while the reset is in progress (snapshot() retries).
+        const uint32_t gen = generation_.load(std::memory_order_relaxed);
+        generation_.store(gen + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        thresholdCount_ = n;
+        for (int i = 0; i < kMaxThresholds; ++i)
+        {
+            thresholds_[static_cast<size_t>(i)] = t[static_cast<size_t>(i)];
+            publishedThresholds_[static_cast<size_t>(i)].store(t[static_cast<size_t>(i)], std::memory_order_relaxed);
+            slow_[static_cast<size_t>(i)].store(0, std::memory_order_relaxed);
+        }
+        publishedThresholdCount_.store(n, std::memory_order_relaxed);
+
+        timeoutUs_ = timeout;
+        publishedTimeoutUs_.store(timeoutUs_, std::memory_order_relaxed);
+        spikeUs_ = timeoutUs_ / 3;
+        trendAlarmUs_ = timeoutUs_ / 16;
+        trendRearmUs_ = timeoutUs_ / 64;
+        generation_.store(gen + 2, std::memory_order_release);
+        return true;
+    }
+
+    // One callback's service time. Returns true when it raises the early
+    // warning: a spike to a third of the timeout, or the trend (an EWMA over
+    // ~16 callbacks) at a sixteenth. Re-arms once the trend falls to 1/64.
+    bool record(HookEventKind kind, uint32_t us)
+    {
+        byKind_[static_cast<size_t>(kind)].record(us);
+        for (int i = 0; i < thresholdCount_ && us >= thresholds_[static_cast<size_t>(i)]; ++i)
+            slow_[static_cast<size_t>(i)].fetch_add(1, std::memory_order_relaxed);
+        if (us > worstUs_)
+        {
+            worstUs_ = us;
+            publishedWorstUs_.store(us, std::memory_order_relaxed);
+        }
+
+        // Trend in 1/16 µs: ewma += (v − ewma) / 16.
+        trend16_ += static_cast<int64_t>(us) - (trend16_ >> 4);
+        const uint32_t trendUs = static_cast<uint32_t>(trend16_ >> 4);
+        publishedTrendUs_.store(trendUs, std::memory_order_relaxed);
+
+        if (armed_)
+        {
+            if (us >= spikeUs_ || trendUs >= trendAlarmUs_)
+            {
+                armed_ = false;
+                alarms_.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        else if (trendUs < trendRearmUs_ && us < spikeUs_)
+        {
+            armed_ = true;
+        }
+        return false;
+    }
+
+    Snapshot snapshot() const
+    {
+        Snapshot s;
+        for (size_t k = 0; k < byKind_.size(); ++k)
+            s.byKind[k] = byKind_[k].snapshot();
+        // Slow counts, thresholds and timeout come from one configuration.
+        for (;;)
+        {
+            const uint32_t gen0 = generation_.load(std::memory_order_acquire);
+            s.thresholdCount = publishedThresholdCount_.load(std::memory_order_relaxed);
+            for (size_t i = 0; i < slow_.size(); ++i)
+            {
+                s.slow[i] = slow_[i].load(std::memory_order_relaxed);
+                s.thresholdsUs[i] = publishedThresholds_[i].load(std::memory_order_relaxed);
+            }
+            s.timeoutUs = publishedTimeoutUs_.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const uint32_t gen1 = generation_.load(std::memory_order_relaxed);
+            if ((gen0 & 1u) == 0 && gen0 == gen1)
+            {
+                s.generation = gen0;
+                break;
+            }
+        }
+        s.trendUs = publishedTrendUs_.load(std::memory_order_relaxed);
+        s.worstUs = publishedWorstUs_.load(std::memory_order_relaxed);
+        s.alarms = alarms_.load(std::memory_order_relaxed);
+        return s;
+    }
+
+private:
+    std::array<LatencyHistogram, kKinds> byKind_;
+    std::array<std::atomic<uint64_t>, kMaxThresholds> slow_{};
+    std::atomic<uint64_t> alarms_{0};
+
+    // Writer-side copies (no atomic loads on the record() path).
+    std::array<uint32_t, kMaxThresholds> thresholds_{};
+    int thresholdCount_ = 0;
+    uint32_t timeoutUs_ = kDefaultTimeoutUs;
+    uint32_t spikeUs_ = 0;
+    uint32_t trendAlarmUs_ = 0;
+    uint32_t trendRearmUs_ = 0;
+    uint32_t worstUs_ = 0;
+    int64_t trend16_ = 0;
+    bool armed_ = true;
+    bool configured_ = false;
+
+    // Published for snapshot().
+    std::array<std::atomic<uint32_t>, kMaxThresholds> publishedThresholds_{};
+    std::atomic<int> publishedThresholdCount_{0};
+    std::atomic<uint32_t> publishedTimeoutUs_{kDefaultTimeoutUs};
+    std::atomic<uint32_t> publishedTrendUs_{0};
+    std::atomic<uint32_t> publishedWorstUs_{0};
+    std::atomic<uint32_t> generation_{0}; // +2 per configure(); odd while it runs
+};
+
+} // namespace SmoothZoom
@@ -0,0 +1,127 @@
+#pragma once
+// =============================================================================
+// SmoothZoom — LatencyHistogram
+// Log2-bucketed latency counts, written by one thread and read by another.
+// Doc 3 §3.1 (R-05)
+//
+// The hook thread records how long each LL hook callback took and how late it
+// was delivered; the main thread snapshots the counts and logs the interval
+// since its previous snapshot. record() is a bit scan plus one relaxed atomic
+// increment — hook-safe. Bucket b > 0 holds values in [2^(b-1), 2^b); bucket 0
+// holds 0; the last bucket also absorbs everything above it. Units are the
+// caller's (the hook thread uses µs for service time, ms for delivery delay).
+//
+// Pure logic — no Win32 API dependencies (CI-safe, unit-tested).
+// =============================================================================
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace SmoothZoom
+{
+
+class LatencyHistogram
+{
+public:
+    static constexpr int kBuckets = 24; // last bucket: ≥ 2^22
+
+    struct Counts
+    {
+        std::array<uint64_t, kBuckets> n{};
+
+        uint64_t total() const
+        {
+            uint64_t t = 0;
+            for (uint64_t c : n)
+                t += c;
+            return t;
+        }
+
+        // Exclusive upper bound of the bucket holding the q-quantile sample
+        // (0 ≤ q ≤ 1); 0 when empty. Bucket resolution: at most 2× pessimistic.
+        uint32_t quantileBound(double q) const
+        {
+            const uint64_t t = total();
+            if (t == 0)
+                return 0;
+            uint64_t rank = static_cast<uint64_t>(q * static_cast<double>(t));
+            if (rank >= t)
+                rank = t - 1;
+            uint64_t seen = 0;
+            for (int b = 0; b < kBuckets; ++b)
+            {
+                seen += n[static_cast<size_t>(b)];
+                if (seen > rank)
+                    return upperBound(b);
+            }
+            return upperBound(kBuckets - 1);
+        }
+
+        // Bound of the highest non-empty bucket; 0 when empty.
+        uint32_t maxBound() const
+        {
+            for (int b = kBuckets - 1; b >= 0; --b)
+                if (n[static_cast<size_t>(b)] != 0)
+                    return upperBound(b);
+            return 0;
+        }
+
+        // Counts recorded after `earlier` (a previous snapshot of the same histogram).
+        Counts since(const Counts& earlier) const
+        {
+            Counts d;
+            for (size_t b = 0; b < n.size(); ++b)
+                d.n[b] = n[b] - earlier.n[b];
+            return d;
+        }
+    };
+
+    // floor(log2 v) + 1 by one bit-scan instruction, clamped to the last bucket.
+    static int bucketOf(uint32_t v)
+    {
+        if (v == 0)
+            return 0;
+#if defined(_MSC_VER)
+        unsigned long msb;
+        _BitScanReverse(&msb, v);
+        const int b = static_cast<int>(msb) + 1;
+#else
+        const int b = 32 - __builtin_clz(v);
+#endif
+        return b < kBuckets - 1 ? b : kBuckets - 1;
+    }
+
+    // Exclusive upper bound of bucket b (UINT32_MAX for the overflow bucket).
+    static uint32_t upperBound(int b)
+    {
+        if (b >= kBuckets - 1)
+            return UINT32_MAX;
+        return b == 0 ? 1u : (1u << b);
+    }
+
+    // Single writer.
+    void record(uint32_t v)
+    {
+        counts_[static_cast<size_t>(bucketOf(v))].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Any thread. Buckets are read individually, so a snapshot taken during
+    // record() may miss that one sample — never corrupts the others.
+    Counts snapshot() const
+    {
+        Counts c;
+        for (size_t b = 0; b < counts_.size(); ++b)
+            c.n[b] = counts_[b].load(std::memory_order_relaxed);
+        return c;
+    }
+
+private:
+    std::array<std::atomic<uint64_t>, kBuckets> counts_{};
+};
+
+} // namespace SmoothZoom
@@ -1,8 +1,8 @@
 #pragma once
 // =============================================================================
 // SmoothZoom — Lock-Free Queue
-// SPSC (single-producer, single-consumer) queue for ZoomCommand.
-// Producer: main thread (hook callbacks). Consumer: render thread.
+// SPSC (single-producer, single-consumer) queue for ZoomCommand / ScrollEvent.
+// One producer thread per queue (see SharedState). Consumer: render thread.
 // Doc 3 §2.4
 // =============================================================================
 
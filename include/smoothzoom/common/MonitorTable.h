@@ -0,0 +1,96 @@
+#pragma once
+// =============================================================================
+// SmoothZoom — Monitor Table
+// Cached monitor rectangles for per-frame monitor lookup. Doc 3 §3.6, AC-MM.04
+//
+// The main thread rebuilds the table (EnumDisplayMonitors) when the display
+// layout changes (WM_DISPLAYCHANGE, WM_DPICHANGED) and publishes it through a
+// SeqLock. The render thread keeps a copy and answers "which monitor is this
+// point on?" from it, instead of calling MonitorFromPoint + GetMonitorInfo for
+// the pointer, focus and caret every frame.
+//
+// indexAt mirrors MONITOR_DEFAULTTONEAREST: the monitor containing the point,
+// else the one nearest to it (a point in a gap between monitors of different
+// sizes, or a stale rect from a just-unplugged display).
+//
+// Fixed capacity and trivially copyable, as SeqLock requires.
+// Pure logic — no Win32 API dependencies (CI-safe, unit-tested).
+// =============================================================================
+
+#include "smoothzoom/common/Types.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace SmoothZoom
+{
+
+struct MonitorTable
+{
+    static constexpr size_t kMaxMonitors = 16;
+
+    std::array<ScreenRect, kMaxMonitors> rects{};
+    uint32_t count = 0;
+
+    void clear() { count = 0; }
+
+    // Append a monitor; false (ignored) when full or the rect is empty.
+    bool add(const ScreenRect& r)
+    {
+        if (count >= kMaxMonitors || r.width() <= 0 || r.height() <= 0)
+            return false;
+        rects[count++] = r;
+        return true;
+    }
+
+    // Monitor containing (x, y) (right/bottom exclusive), else the nearest one;
+    // -1 when the table is empty.
+    int indexAt(int32_t x, int32_t y) const
+    {
+        int best = -1;
+        int64_t bestDist = INT64_MAX;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const ScreenRect& r = rects[i];
+            const int64_t dx = (x < r.left) ? int64_t(r.left) - x
+                             : (x >= r.right) ? int64_t(x) - (r.right - 1) : 0;
+            const int64_t dy = (y < r.top) ? int64_t(r.top) - y
+                             : (y >= r.bottom) ? int64_t(y) - (r.bottom - 1) : 0;
+            const int64_t d = dx * dx + dy * dy;
+            if (d == 0)
+                return static_cast<int>(i);
+            if (d < bestDist)
+            {
+                bestDist = d;
+                best = static_cast<int>(i);
+            }
+        }
+        return best;
+    }
+
+    // Rect of the monitor at (x, y), or `fallback` when the table is empty.
+    ScreenRect monitorAt(int32_t x, int32_t y, const ScreenRect& fallback) const
+    {
+        const int i = indexAt(x, y);
+        return i >= 0 ? rects[static_cast<size_t>(i)] : fallback;
+    }
+
+    // Bounding box of all monitors (the virtual desktop); empty if no monitors.
+    ScreenRect bounds() const
+    {
+        if (count == 0)
+            return {};
+        ScreenRect b = rects[0];
+        for (uint32_t i = 1; i < count; ++i)
+        {
+            const ScreenRect& r = rects[i];
+            b.left = r.left < b.left ? r.left : b.left;
+            b.top = r.top < b.top ? r.top : b.top;
+            b.right = r.right > b.right ? r.right : b.right;
+            b.bottom = r.bottom > b.bottom ? r.bottom : b.bottom;
+        }
+        return b;
+    }
+};
+
+} // namespace SmoothZoom
@@ -0,0 +1,127 @@
+#pragma once
+// =============================================================================
+// SmoothZoom — PointerSampleRing
+// Timestamped pointer samples from one producer thread to the render thread,
+// overwriting the oldest on overflow. Doc 3 §2.7, §3.7
+//
+// The render thread reads the pointer once per frame (GetCursorPos), so it
+// sees a 1000–8000 Hz mouse at 60 Hz and cannot tell speed within a frame.
+// With the optional pointer sample stream enabled, the LL mouse hook pushes
+// every WM_MOUSEMOVE position and the Raw Input worker its relative motion per
+// batch, each into its own ring; the render thread drains both once per frame
+// (PointerMotionEstimator).
+//
+// Unlike LockFreeQueue, a full ring never refuses a sample: a stalled render
+// thread must not make the hook drop the newest motion, so push() overwrites
+// the oldest slot. Each slot carries a sequence number (odd while written, as
+// SeqLock), so drain() can tell a slot the producer lapped while it was being
+// copied; every sample overwritten before it was read is counted in lost().
+// Payload fields are relaxed atomics — race-free under the C++ memory model.
+//
+// push() is wait-free: four relaxed stores, a fence and two release stores,
+// no loads of consumer state.
+//
+// Pure logic — no Win32 API dependencies (CI-safe, unit-tested).
+// =============================================================================
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace SmoothZoom
+{
+
+struct PointerSample
+{
+    int64_t timeUs = 0;  // steady_clock µs (same base as ScrollEvent)
+    int32_t x = 0;       // absolute: screen px; relative: counts since the last sample
+    int32_t y = 0;
+};
+
+template <size_t Capacity = 256>
+class PointerSampleRing
+{
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be power of 2");
+
+public:
+    static constexpr size_t kCapacity = Capacity;
+
+    // Single producer.
+    void push(const PointerSample& s)
+    {
+        const uint64_t n = written_; // producer-local copy of head_
+        Slot& slot = slots_[n & (Capacity - 1)];
+        slot.seq.store(2 * n + 1, std::memory_order_relaxed); // odd = being written
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.timeUs.store(s.timeUs, std::memory_order_relaxed);
+        slot.x.store(s.x, std::memory_order_relaxed);
+        slot.y.store(s.y, std::memory_order_relaxed);
+        slot.seq.store(2 * n + 2, std::memory_order_release);
+        written_ = n + 1;
+        head_.store(n + 1, std::memory_order_release);
+    }
+
+    // Single consumer. Copies the unread samples, oldest first, into `out`
+    // (at most `max`; older ones beyond that are skipped and counted lost).
+    // Returns the number copied.
+    int drain(PointerSample* out, int max)
+    {
+        const uint64_t head = head_.load(std::memory_order_acquire);
+        uint64_t from = read_;
+        const uint64_t window = max < static_cast<int>(Capacity) ? static_cast<uint64_t>(max) : Capacity;
+        if (head - from > window)
+        {
+            lost_.fetch_add(head - from - window, std::memory_order_relaxed);
+            from = head - window;
+        }
+
+        int count = 0;
+        for (uint64_t n = from; n < head; ++n)
+        {
+            const Slot& slot = slots_[n & (Capacity - 1)];
+            const uint64_t seq0 = slot.seq.load(std::memory_order_acquire);
+            PointerSample s;
+            s.timeUs = slot.timeUs.load(std::memory_order_relaxed);
+            s.x = slot.x.load(std::memory_order_relaxed);
+            s.y = slot.y.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const uint64_t seq1 = slot.seq.load(std::memory_order_relaxed);
+            if (seq0 != 2 * n + 2 || seq1 != seq0)
+            {
+                // Lapped during the copy: this sample (and its successors up
+                // to the producer's position) is gone — stop, count it lost.
+                lost_.fetch_add(head - n, std::memory_order_relaxed);
+                break;
+            }
+            out[count++] = s;
+        }
+        read_ = head;
+        return count;
+    }
+
+    // Single consumer. Skips everything unread without counting it lost —
+    // for a consumer resuming after it chose not to read (idle, frozen).
+    void discard() { read_ = head_.load(std::memory_order_acquire); }
+
+    // Samples pushed so far (any thread).
+    uint64_t pushed() const { return head_.load(std::memory_order_relaxed); }
+    // Samples overwritten before the consumer read them (any thread).
+    uint64_t lost() const { return lost_.load(std::memory_order_relaxed); }
+
+private:
+    struct Slot
+    {
+        std::atomic<uint64_t> seq{0};
+        std::atomic<int64_t> timeUs{0};
+        std::atomic<int32_t> x{0};
+        std::atomic<int32_t> y{0};
+    };
+
+    Slot slots_[Capacity];
+    alignas(64) std::atomic<uint64_t> head_{0};
+    uint64_t written_ = 0;           // producer only
+    alignas(64) uint64_t read_ = 0;  // consumer only
+    std::atomic<uint64_t> lost_{0};
+};
+
+} // namespace SmoothZoom
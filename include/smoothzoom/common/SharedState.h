@@ -2,11 +2,15 @@
 // =============================================================================
 // SmoothZoom — Shared State
 // All inter-thread shared data in one place. Doc 3 §2.4.
-// Written by hook callbacks (main thread) and UIA thread.
+// Written by hook callbacks (input thread), main thread and UIA thread.
 // Read by render thread — no mutexes on hot path.
 // =============================================================================
 
 #include "smoothzoom/common/Types.h"
+#include "smoothzoom/common/HookServiceProfiler.h"
+#include "smoothzoom/common/LatencyHistogram.h"
+#include "smoothzoom/common/MonitorTable.h"
+#include "smoothzoom/common/PointerSampleRing.h"
 #include "smoothzoom/common/SeqLock.h"
 #include "smoothzoom/common/LockFreeQueue.h"
 #include "smoothzoom/support/SettingsManager.h"
@@ -18,11 +22,19 @@ namespace SmoothZoom
 
 struct SharedState
 {
-    // -- Written by main thread (hook callbacks) --
-    std::atomic<int32_t> scrollAccumulator{0};
+    // -- Written by hook callbacks (input thread, InputInterceptor) --
     std::atomic<bool>    toggleState{false};
     std::atomic<int64_t> lastKeyboardInputTime{0};
-    std::atomic<int64_t> lastLLHookScrollTime{0};  // Dedup: LL hook scroll timestamp (GetTickCount64)
+    // R-05 evidence: callback service time (µs, entry to return, per event
+    // type, with slow counts and the timeout early warning) and delivery delay
+    // (ms, event timestamp to callback entry). Logged by the main thread.
+    HookServiceProfiler hookService;
+    LatencyHistogram hookDeliveryMs;
+
+    // -- Written by main thread, read by the input thread --
+    // Bumped when hook-derived held-key state must be discarded (session
+    // unlock, resume): key-ups were delivered to the secure desktop or lost.
+    std::atomic<uint32_t> inputResetRequests{0};
 
     // -- Written by UIA thread (focus) / caret thread (caret) --
     SeqLock<ScreenRect>  focusRect;
@@ -40,6 +52,10 @@ struct SharedState
     // Virtual screen origin (SM_XVIRTUALSCREEN / SM_YVIRTUALSCREEN — can be negative)
     std::atomic<int32_t> screenOriginX{0};
     std::atomic<int32_t> screenOriginY{0};
+    // Monitor rectangles (EnumDisplayMonitors). The render thread re-reads the
+    // table only when monitorTableVersion changes.
+    SeqLock<MonitorTable> monitorTable;
+    std::atomic<uint64_t> monitorTableVersion{0};
 
     // -- Written by render thread, read by main thread --
     std::atomic<float> currentZoomLevel{1.0f};
@@ -48,8 +64,25 @@ struct SharedState
     // hot path (render-loop invariants forbid I/O). Polled by the tray timer.
     std::atomic<bool>  colorInversionActive{false};
 
-    // -- Command queue: main thread → render thread --
-    LockFreeQueue<ZoomCommand> commandQueue;
+    // -- Command queues → render thread. SPSC: one queue per producer thread --
+    LockFreeQueue<ZoomCommand> commandQueue;    // input thread (hook shortcuts)
+    LockFreeQueue<ZoomCommand> uiCommandQueue;  // main thread (tray menu, settings window)
+
+    // -- Scroll event queues → render thread, merged in time order through
+    //    ScrollDeduplicator (one source per gesture). SPSC per producer --
+    LockFreeQueue<ScrollEvent, 256> hookScrollQueue; // input thread (LL mouse hook)
+    LockFreeQueue<ScrollEvent, 256> rawScrollQueue;  // Raw Input worker (mouse, PTP)
+
+    // -- Pointer sample stream → render thread (pointerSampleStream setting).
+    //    Overwrite-oldest rings, one per producer; lost() counts overflow --
+    PointerSampleRing<> hookPointerSamples; // input thread: WM_MOUSEMOVE screen px
+    PointerSampleRing<> rawPointerSamples;  // Raw Input worker: relative counts per batch
+
+    // -- Written by render thread (ScrollDeduplicator stats), logged by main --
+    std::atomic<uint64_t> scrollEventsAccepted{0};
+    std::atomic<uint64_t> scrollEventsDuplicate{0};
+    std::atomic<uint64_t> scrollEventsSuppressed{0};
+    std::atomic<uint64_t> scrollSourceHandovers{0};
 
     // -- Settings snapshot: written by main thread, read by all --
     // Render thread checks settingsVersion (one atomic int) per frame.
@@ -4,6 +4,7 @@
 // Shared data structures, constants, and type aliases.
 // =============================================================================
 
+#include <cstddef>
 #include <cstdint>
 #include <atomic>
 
@@ -42,6 +43,36 @@ enum class ZoomCommand : uint8_t
     OpenSettings,   // Win+Ctrl+M (Phase 5, AC-2.8.11)
     TrayToggle,     // Phase 5C: one-shot tray toggle (AC-2.9.15)
     ToggleInvert,   // Ctrl+Alt+I (Phase 6, AC-2.10.01)
+    JumpToPreset1,  // Modifier+Numpad1..6 — must stay contiguous (index = cmd - JumpToPreset1)
+    JumpToPreset2,
+    JumpToPreset3,
+    JumpToPreset4,
+    JumpToPreset5,
+    JumpToPreset6,
+    CyclePreset,    // Modifier+Numpad0
+    ToggleDetach,   // Modifier+Numpad . — freeze / re-attach the viewport (ViewportDetach.h)
+};
+
+// Scroll input producers (ScrollDeduplicator.h, Doc 3 §3.1)
+enum class ScrollSource : uint8_t
+{
+    LLHook,     // WM_MOUSEWHEEL / WM_MOUSEHWHEEL in the LL mouse hook
+    RawMouse,   // Raw Input RAWMOUSE wheel
+    PtpHid,     // Precision Touchpad HID reports (scroll / pinch)
+};
+
+// One scroll event, posted via lock-free queue from the input thread or the
+// Raw Input worker to the render thread. Time, device, sign and magnitude are
+// the fingerprint ScrollDeduplicator matches across sources.
+struct ScrollEvent
+{
+    int64_t timeUs = 0;    // steady_clock µs at receipt (QPC-backed)
+    uint64_t device = 0;   // Raw Input device handle; 0 for the LL hook
+    int32_t delta = 0;     // wheel-equivalent units (120 = one notch), + = zoom in
+    ScrollSource source = ScrollSource::LLHook;
+    // PTP pinch: ln of the zoom ratio, applied as is (no scroll sensitivity,
+    // soft bounds or glide). Not part of the fingerprint.
+    float logZoom = 0.0f;
 };
 
 // Viewport tracking source priority (Doc 3 §3.6 — ViewportTracker)
@@ -52,4 +83,24 @@ enum class TrackingSource : uint8_t
     Caret,      // UIA text caret / GTTI poll
 };
 
+// Number of TrackingSource values (SourceArbiter policy/candidate tables).
+inline constexpr size_t kTrackingSourceCount = 3;
+
+// How the viewport follows the pointer (Doc 3 §3.6; research §3.5).
+// Stored as an int in SettingsSnapshot::pointerTrackingMode.
+enum class PointerTrackingMode : uint8_t
+{
+    Continuous, // Proportional mapping: every pointer move pans the viewport
+    EdgePush,   // Viewport holds still until the pointer pushes into an edge margin
+    Centered,   // Desktop scrolls under a pointer held at the monitor center
+};
+
+// What the viewport is confined to (Doc 3 §3.6, AC-MM.04). Stored as an int
+// in SettingsSnapshot::zoomScope.
+enum class ZoomScope : uint8_t
+{
+    Unified,        // All displays form one surface: pointer tracking clamps to the virtual desktop
+    ActiveMonitor,  // Each source's view stays on its own monitor (pointer's, focus's, caret's)
+};
+
 } // namespace SmoothZoom
@@ -1,7 +1,8 @@
 #pragma once
 // =============================================================================
 // SmoothZoom — InputInterceptor
-// Installs WH_MOUSE_LL and WH_KEYBOARD_LL hooks, routes events.
+// Installs WH_MOUSE_LL and WH_KEYBOARD_LL hooks on a dedicated input thread
+// and routes events. Talks to the rest of the app through SharedState.
 // Doc 3 §3.1
 // =============================================================================
 
@@ -11,12 +12,14 @@ namespace SmoothZoom
 {
 
 struct SharedState;
-class SettingsManager;
 
 class InputInterceptor
 {
 public:
+    // Starts the input thread and waits until both hooks are installed (or
+    // failed). Configured keys come from SharedState's settings snapshot.
     bool install(SharedState& state);
+    // Unhooks and joins the input thread.
     void uninstall();
     bool isHealthy() const;
 
@@ -35,13 +38,10 @@ public:
 
     // Clear all held/engaged key state derived from hook events (Win key state
     // machine, modifier/toggle flags). Call when key-ups may have been missed:
-    // secure-desktop lock/unlock (AC-ERR.04) and hook reinstall.
+    // secure-desktop lock/unlock (AC-ERR.04), resume. Applied asynchronously
+    // on the input thread (SharedState::inputResetRequests).
     static void resetTransientKeyState();
 
-    // Phase 5B: Register for settings change notifications (AC-2.9.04).
-    // Callback updates configurable modifier/toggle keys on main thread.
-    static void registerSettingsObserver(SettingsManager& mgr);
-
     // Phase 5B: Store message window handle for Win+Ctrl+M posting (AC-2.8.11).
     // Uses void* to avoid pulling in windows.h in the header.
     static void setMessageWindow(void* hWnd);
@@ -0,0 +1,145 @@
+#pragma once
+// =============================================================================
+// SmoothZoom — InputRouter
+// Platform-free decision logic of the low-level mouse / keyboard hooks.
+// Doc 3 §3.1, §3.2
+//
+// InputInterceptor's hook procedures translate each event into an InputEvent,
+// call route() with a view of the physical key state, and carry out the
+// returned RouterActions (consume or pass on, enqueue commands, accumulate the
+// scroll delta, stamp timestamps, post messages). Everything in between —
+// modifier detection, the WM_MOUSEHWHEEL sign flip, the Shift-mode consume
+// rule, the toggle chord, the edge filters, Win-chord Start-Menu suppression
+// and zoom-key consumption — lives here, so it is unit-tested and benchmarked
+// off Windows.
+//
+// Dispatch is table-driven: configure() precomputes a 256-entry role table
+// from the configured keys and compiles the key bindings into a
+// KeyBindingTable, so each event is a couple of table loads plus a few flag
+// tests (O(1), no allocation, no I/O — R-05). The router tracks which
+// modifiers are held from the hook's own key events; a keystroke is matched
+// against that mask, and physical key state (KeyStateView, GetAsyncKeyState
+// on Windows) is read only to confirm the modifiers of a binding that matched
+// — a key with no binding never queries it.
+// =============================================================================
+
+#include "smoothzoom/common/Types.h"
+#include "smoothzoom/input/KeyBindings.h"
+#include "smoothzoom/input/ModifierUtils.h"
+#include "smoothzoom/input/WinKeyManager.h"
+#include <array>
+#include <cstdint>
+
+namespace SmoothZoom
+{
+
+enum class InputEventType : uint8_t
+{
+    KeyDown,    // WM_KEYDOWN / WM_SYSKEYDOWN
+    KeyUp,      // WM_KEYUP / WM_SYSKEYUP
+    Wheel,      // WM_MOUSEWHEEL
+    HWheel,     // WM_MOUSEHWHEEL
+};
+
+struct InputEvent
+{
+    InputEventType type = InputEventType::KeyDown;
+    uint32_t vk = 0;         // key events
+    int16_t wheelDelta = 0;  // wheel events: HIWORD(mouseData)
+};
+
+// Physical key state (GetAsyncKeyState on Windows, a script in tests).
+struct KeyStateView
+{
+    bool (*isDown)(int vk, void* ctx) = nullptr;
+    void* ctx = nullptr;
+
+    bool down(int vk) const { return isDown != nullptr && isDown(vk, ctx); }
+};
+
+struct RouterActions
+{
+    static constexpr int kMaxCommands = 2;
+
+    bool consume = false;            // swallow the event (else CallNextHookEx)
+    bool scroll = false;             // post scrollDelta as an LL hook ScrollEvent
+    int32_t scrollDelta = 0;         // vertical-wheel convention: + = zoom in
+    bool keyboardActivity = false;   // stamp lastKeyboardInputTime (caret priority)
+    bool suppressStartMenu = false;  // inject WinKeyManager's suppression keystroke
+    bool openSettings = false;       // post WM_OPEN_SETTINGS
+    uint8_t commandCount = 0;
+    ZoomCommand commands[kMaxCommands] = {};
+
+    void push(ZoomCommand c)
+    {
+        if (commandCount < kMaxCommands)
+            commands[commandCount++] = c;
+    }
+};
+
+class InputRouter
+{
+public:
+    InputRouter() { configure(VK_LWIN, VK_LCONTROL, VK_LMENU); }
+
+    // Configured keys (AC-2.1.19, AC-2.1.20, AC-2.7.x) and key bindings
+    // (nullptr: kDefaultKeyBindings). Rebuilds the dispatch tables and clears
+    // the modifier state, as a settings change should.
+    void configure(int modifierVK, int toggleKey1VK, int toggleKey2VK,
+                   const KeyBinding* bindings = nullptr, int bindingCount = 0);
+
+    // Win+Ctrl+M is honored only once a window exists to receive it.
+    void setSettingsShortcutEnabled(bool enabled) { settingsShortcut_ = enabled; }
+
+    RouterActions route(const InputEvent& ev, const KeyStateView& keys);
+
+    // Forget every held/engaged flag (key-ups missed across the secure desktop
+    // or a hook outage). Returns ToggleRelease in the actions if a toggle was
+    // engaged.
+    RouterActions resetTransient();
+
+    // Configured modifier held: Win via the state machine cross-checked with
+    // the physical keys; others via the hook-tracked flag or the physical key.
+    bool modifierHeld(const KeyStateView& keys) const;
+
+    const WinKeyManager& winKeys() const { return winKeys_; }
+    int modifierVK() const { return modifierVK_; }
+
+private:
+    // Role bits per VK (dispatch table).
+    enum : uint8_t
+    {
+        kRoleWin          = 1u << 0,  // LWin / RWin
+        kRoleModifierKey  = 1u << 1,  // any Ctrl/Alt/Shift/Win (no caret activity)
+        kRoleConfigMod    = 1u << 2,  // configured non-Win modifier family
+        kRoleToggle1      = 1u << 3,
+        kRoleToggle2      = 1u << 4,
+    };
+
+    RouterActions routeKey(const InputEvent& ev, const KeyStateView& keys);
+    RouterActions routeWheel(const InputEvent& ev, const KeyStateView& keys);
+    const KeyBindingTable::Entry* matchBinding(uint32_t vk, const KeyStateView& keys);
+    bool winModifier() const { return modifierVK_ == VK_LWIN || modifierVK_ == VK_RWIN; }
+
+    std::array<uint8_t, 256> role_{};
+    KeyBindingTable bindings_;
+
+    WinKeyManager winKeys_;
+    int modifierVK_ = VK_LWIN;
+    bool shiftModifier_ = false;
+    bool settingsShortcut_ = false;
+
+    bool nonWinModifierHeld_ = false;
+    bool toggle1Held_ = false;
+    bool toggle2Held_ = false;
+    bool toggleEngaged_ = false;
+    // Held modifier keys per side (kSide* bits), from the hook's own events.
+    uint8_t modSides_ = 0;
+    // Edge filter for edge-triggered bindings: LL hooks receive typematic
+    // auto-repeats and KBDLLHOOKSTRUCT carries no repeat flag, so holding
+    // Modifier+Numpad0 would cycle at the repeat rate (and Ctrl+Alt+I strobe
+    // inversion). Holds the VK whose binding fired; 0 = none.
+    uint32_t edgeKeyDownVK_ = 0;
+};
+
+} // namespace SmoothZoom
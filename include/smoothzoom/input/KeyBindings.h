@@ -0,0 +1,378 @@
+#pragma once
+// =============================================================================
+// SmoothZoom — KeyBindings
+// User-configurable keyboard shortcuts and the compiled table the keyboard
+// hook matches them against. Doc 3 §3.1, §3.9
+//
+// A binding is a command plus a chord: one key and the modifier families that
+// must be held (Ctrl, Alt, Shift, Win, or "Modifier" — the configured zoom
+// modifier, whatever it is). config.json stores them per command as strings
+// such as "Modifier+Plus" or "Win+Ctrl+M"; parseKeyChord / formatKeyChord
+// convert, and kDefaultKeyBindings is the shipped set.
+//
+// KeyBindingTable::compile() runs at settings time. It resolves "Modifier" and
+// fills a dense [VK][held-modifier mask] table: a chord matches whenever its
+// modifiers are a subset of those held (Win+Shift+Plus still zooms in), and
+// where several chords cover the same mask the one requiring more modifiers
+// wins. The hook then matches a keystroke with a single table read against the
+// modifier mask it tracks itself; a key with no binding never reaches
+// GetAsyncKeyState (InputRouter verifies only a hit's modifiers).
+//
+// Pure logic — no Win32 API dependencies (CI-safe, unit-tested).
+// =============================================================================
+
+#include "smoothzoom/common/Types.h"
+#include "smoothzoom/input/ModifierUtils.h"
+#include <array>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+namespace SmoothZoom
+{
+
+// Modifier families, as held-modifier mask bits.
+inline constexpr uint8_t kKeyModCtrl = 1u << 0;
+inline constexpr uint8_t kKeyModAlt = 1u << 1;
+inline constexpr uint8_t kKeyModShift = 1u << 2;
+inline constexpr uint8_t kKeyModWin = 1u << 3;
+inline constexpr int kKeyModMasks = 16;
+// Binding-only: the configured zoom modifier (resolved by compile()).
+inline constexpr uint8_t kKeyModZoom = 1u << 4;
+
+inline constexpr int kMaxKeyBindings = 32;
+
+struct KeyBinding
+{
+    ZoomCommand command = ZoomCommand::None;
+    uint8_t vk = 0;
+    uint8_t mods = 0;   // kKeyMod* bits, kKeyModZoom allowed
+
+    bool operator==(const KeyBinding& o) const
+    {
+        return command == o.command && vk == o.vk && mods == o.mods;
+    }
+};
+
+// Modifier family bit of a VK (L/R and generic variants); 0 for other keys.
+inline uint8_t keyModOfVK(int vk)
+{
+    switch (vk)
+    {
+    case 0x11: case 0xA2: case 0xA3: return kKeyModCtrl;  // VK_CONTROL, VK_L/RCONTROL
+    case 0x12: case 0xA4: case 0xA5: return kKeyModAlt;   // VK_MENU, VK_L/RMENU
+    case 0x10: case 0xA0: case 0xA1: return kKeyModShift; // VK_SHIFT, VK_L/RSHIFT
+    case 0x5B: case 0x5C:            return kKeyModWin;   // VK_LWIN, VK_RWIN
+    default: return 0;
+    }
+}
+
+// Shipped shortcuts (AC-2.8.01–AC-2.8.11, AC-2.10.01). Zoom presets use the
+// numpad: Win+1..9 is the shell's taskbar-launch shortcut.
+inline constexpr KeyBinding kDefaultKeyBindings[] = {
+    {ZoomCommand::ZoomIn, 0xBB, kKeyModZoom},          // Plus ('=' / '+', main keyboard)
+    {ZoomCommand::ZoomIn, 0x6B, kKeyModZoom},          // NumpadAdd
+    {ZoomCommand::ZoomOut, 0xBD, kKeyModZoom},         // Minus
+    {ZoomCommand::ZoomOut, 0x6D, kKeyModZoom},         // NumpadSubtract
+    {ZoomCommand::ResetZoom, 0x1B, kKeyModZoom},       // Esc
+    {ZoomCommand::CyclePreset, 0x60, kKeyModZoom},     // Numpad0
+    {ZoomCommand::JumpToPreset1, 0x61, kKeyModZoom},
+    {ZoomCommand::JumpToPreset2, 0x62, kKeyModZoom},
+    {ZoomCommand::JumpToPreset3, 0x63, kKeyModZoom},
+    {ZoomCommand::JumpToPreset4, 0x64, kKeyModZoom},
+    {ZoomCommand::JumpToPreset5, 0x65, kKeyModZoom},
+    {ZoomCommand::JumpToPreset6, 0x66, kKeyModZoom},
+    {ZoomCommand::ToggleDetach, 0x6E, kKeyModZoom},    // NumpadDecimal
+    {ZoomCommand::OpenSettings, 'M', kKeyModWin | kKeyModCtrl},
+    {ZoomCommand::ToggleInvert, 'I', kKeyModCtrl | kKeyModAlt},
+};
+inline constexpr int kDefaultKeyBindingCount =
+    static_cast<int>(sizeof(kDefaultKeyBindings) / sizeof(kDefaultKeyBindings[0]));
+
+// kDefaultKeyBindings in SettingsSnapshot's fixed-capacity form.
+inline std::array<KeyBinding, kMaxKeyBindings> defaultKeyBindingArray()
+{
+    std::array<KeyBinding, kMaxKeyBindings> a{};
+    for (int i = 0; i < kDefaultKeyBindingCount; ++i)
+        a[static_cast<size_t>(i)] = kDefaultKeyBindings[i];
+    return a;
+}
+
+// ── Commands ─────────────────────────────────────────────────────────────────
+
+// Commands a key can be bound to, with their config.json names.
+struct KeyCommandInfo
+{
+    ZoomCommand command;
+    const char* name;
+    bool edge;     // fires once per press (auto-repeat ignored)
+    bool consume;  // swallowed on down and up while matched (it would type)
+};
+
+inline constexpr KeyCommandInfo kKeyCommands[] = {
+    {ZoomCommand::ZoomIn, "zoomIn", false, true},
+    {ZoomCommand::ZoomOut, "zoomOut", false, true},
+    // Esc produces no character and applications need it.
+    {ZoomCommand::ResetZoom, "resetZoom", false, false},
+    {ZoomCommand::CyclePreset, "cyclePreset", true, true},
+    {ZoomCommand::JumpToPreset1, "jumpToPreset1", true, true},
+    {ZoomCommand::JumpToPreset2, "jumpToPreset2", true, true},
+    {ZoomCommand::JumpToPreset3, "jumpToPreset3", true, true},
+    {ZoomCommand::JumpToPreset4, "jumpToPreset4", true, true},
+    {ZoomCommand::JumpToPreset5, "jumpToPreset5", true, true},
+    {ZoomCommand::JumpToPreset6, "jumpToPreset6", true, true},
+    {ZoomCommand::ToggleDetach, "toggleDetach", true, true},
+    {ZoomCommand::OpenSettings, "openSettings", true, false},
+    // Edge-triggered: auto-repeat would strobe full-screen inversion — a
+    // photosensitivity hazard.
+    {ZoomCommand::ToggleInvert, "toggleInvert", true, false},
+};
+
+inline const KeyCommandInfo* keyCommandInfo(ZoomCommand c)
+{
+    for (const KeyCommandInfo& k : kKeyCommands)
+        if (k.command == c)
+            return &k;
+    return nullptr;
+}
+
+namespace KeyBindingDetail
+{
+
+inline bool equalsNoCase(const char* a, size_t n, const char* b)
+{
+    if (std::strlen(b) != n)
+        return false;
+    for (size_t i = 0; i < n; ++i)
+        if (std::tolower(static_cast<unsigned char>(a[i])) != std::tolower(static_cast<unsigned char>(b[i])))
+            return false;
+    return true;
+}
+
+struct KeyName
+{
+    uint8_t vk;
+    const char* name;
+};
+
+// Named keys besides A–Z, 0–9 and F1–F24.
+inline constexpr KeyName kKeyNames[] = {
+    {0xBB, "Plus"}, {0xBD, "Minus"}, {0xBC, "Comma"}, {0xBE, "Period"},
+    {0x6B, "NumpadAdd"}, {0x6D, "NumpadSubtract"}, {0x6A, "NumpadMultiply"},
+    {0x6F, "NumpadDivide"}, {0x6E, "NumpadDecimal"},
+    {0x1B, "Esc"}, {0x20, "Space"}, {0x09, "Tab"}, {0x0D, "Enter"}, {0x08, "Backspace"},
+    {0x2D, "Insert"}, {0x2E, "Delete"}, {0x24, "Home"}, {0x23, "End"},
+    {0x21, "PageUp"}, {0x22, "PageDown"},
+    {0x25, "Left"}, {0x26, "Up"}, {0x27, "Right"}, {0x28, "Down"},
+};
+
+inline bool parseKeyName(const char* s, size_t n, uint8_t& vk)
+{
+    if (n == 1 && std::isalnum(static_cast<unsigned char>(s[0])))
+    {
+        vk = static_cast<uint8_t>(std::toupper(static_cast<unsigned char>(s[0])));
+        return true;
+    }
+    for (const KeyName& k : kKeyNames)
+        if (equalsNoCase(s, n, k.name))
+        {
+            vk = k.vk;
+            return true;
+        }
+    if (n == 7 && equalsNoCase(s, 6, "Numpad") && std::isdigit(static_cast<unsigned char>(s[6])))
+    {
+        vk = static_cast<uint8_t>(0x60 + (s[6] - '0'));
+        return true;
+    }
+    if ((n == 2 || n == 3) && (s[0] == 'F' || s[0] == 'f'))
+    {
+        int f = 0;
+        for (size_t i = 1; i < n; ++i)
+        {
+            if (!std::isdigit(static_cast<unsigned char>(s[i])))
+                return false;
+            f = f * 10 + (s[i] - '0');
+        }
+        if (f < 1 || f > 24)
+            return false;
+        vk = static_cast<uint8_t>(0x70 + f - 1);
+        return true;
+    }
+    if (n > 2 && n <= 4 && s[0] == '0' && (s[1] == 'x' || s[1] == 'X'))
+    {
+        unsigned v = 0;
+        for (size_t i = 2; i < n; ++i)
+        {
+            const int c = std::tolower(static_cast<unsigned char>(s[i]));
+            if (!std::isxdigit(c))
+                return false;
+            v = v * 16 + static_cast<unsigned>(c <= '9' ? c - '0' : c - 'a' + 10);
+        }
+        if (v == 0)
+            return false;
+        vk = static_cast<uint8_t>(v);
+        return true;
+    }
+    return false;
+}
+
+} // namespace KeyBindingDetail
+
+// Command by config.json name (case-insensitive); ZoomCommand::None if unknown.
+inline ZoomCommand parseKeyCommand(const char* name)
+{
+    for (const KeyCommandInfo& k : kKeyCommands)
+        if (KeyBindingDetail::equalsNoCase(name, std::strlen(name), k.name))
+            return k.command;
+    return ZoomCommand::None;
+}
+
+// Chord from "Mod+Mod+Key" (case-insensitive; modifiers Ctrl, Alt, Shift, Win,
+// Modifier). Sets out.vk and out.mods. Rejects a chord without a modifier (it
+// would hijack typing) or whose key is itself a modifier.
+inline bool parseKeyChord(const std::string& chord, KeyBinding& out)
+{
+    using KeyBindingDetail::equalsNoCase;
+    uint8_t mods = 0;
+    uint8_t vk = 0;
+    size_t start = 0;
+    for (;;)
+    {
+        const size_t end = chord.find('+', start);
+        const char* tok = chord.c_str() + start;
+        const size_t n = (end == std::string::npos ? chord.size() : end) - start;
+        if (n == 0)
+            return false;
+        if (end == std::string::npos)
+        {
+            if (!KeyBindingDetail::parseKeyName(tok, n, vk))
+                return false;
+            break;
+        }
+        if (equalsNoCase(tok, n, "Ctrl") || equalsNoCase(tok, n, "Control"))
+            mods |= kKeyModCtrl;
+        else if (equalsNoCase(tok, n, "Alt"))
+            mods |= kKeyModAlt;
+        else if (equalsNoCase(tok, n, "Shift"))
+            mods |= kKeyModShift;
+        else if (equalsNoCase(tok, n, "Win"))
+            mods |= kKeyModWin;
+        else if (equalsNoCase(tok, n, "Modifier"))
+            mods |= kKeyModZoom;
+        else
+            return false;
+        start = end + 1;
+    }
+    if (mods == 0 || keyModOfVK(vk) != 0)
+        return false;
+    out.vk = vk;
+    out.mods = mods;
+    return true;
+}
+
+// Inverse of parseKeyChord (modifiers in Modifier, Win, Ctrl, Alt, Shift order).
+inline std::string formatKeyChord(const KeyBinding& b)
+{
+    std::string s;
+    if (b.mods & kKeyModZoom)  s += "Modifier+";
+    if (b.mods & kKeyModWin)   s += "Win+";
+    if (b.mods & kKeyModCtrl)  s += "Ctrl+";
+    if (b.mods & kKeyModAlt)   s += "Alt+";
+    if (b.mods & kKeyModShift) s += "Shift+";
+    const int vk = b.vk;
+    if ((vk >= 'A' && vk <= 'Z') || (vk >= '0' && vk <= '9'))
+        return s + static_cast<char>(vk);
+    if (vk >= 0x60 && vk <= 0x69)
+        return s + "Numpad" + static_cast<char>('0' + vk - 0x60);
+    if (vk >= 0x70 && vk <= 0x87)
+        return s + "F" + std::to_string(vk - 0x70 + 1);
+    for (const auto& k : KeyBindingDetail::kKeyNames)
+        if (k.vk == vk)
+            return s + k.name;
+    char hex[8];
+    std::snprintf(hex, sizeof(hex), "0x%02X", static_cast<unsigned>(vk));
+    return s + hex;
+}
+
+// ── Compiled table ───────────────────────────────────────────────────────────
+
+class KeyBindingTable
+{
+public:
+    struct Entry
+    {
+        ZoomCommand command = ZoomCommand::None;
+        uint8_t mods = 0;     // required families (kKeyModZoom resolved)
+        bool edge = false;
+        bool consume = false;
+    };
+
+    KeyBindingTable() { compile(kDefaultKeyBindings, kDefaultKeyBindingCount, VK_LWIN); }
+
+    // Rebuild from a binding list; `zoomModifierVK` resolves kKeyModZoom (Win
+    // if it is not a modifier). Bindings to unbindable commands, to modifier
+    // keys or without modifiers are skipped; past kMaxKeyBindings, ignored.
+    void compile(const KeyBinding* bindings, int count, int zoomModifierVK)
+    {
+        std::memset(slot_, 0, sizeof(slot_));
+        entryCount_ = 0;
+        const uint8_t zoomMod = keyModOfVK(zoomModifierVK) ? keyModOfVK(zoomModifierVK) : kKeyModWin;
+
+        for (int i = 0; i < count && entryCount_ < kMaxKeyBindings; ++i)
+        {
+            const KeyBinding& b = bindings[i];
+            const KeyCommandInfo* info = keyCommandInfo(b.command);
+            const uint8_t req = static_cast<uint8_t>(
+                (b.mods & (kKeyModMasks - 1)) | ((b.mods & kKeyModZoom) ? zoomMod : 0));
+            if (info == nullptr || req == 0 || b.vk == 0 || keyModOfVK(b.vk) != 0)
+                continue;
+
+            entries_[entryCount_] = Entry{b.command, req, info->edge, info->consume};
+            const auto index = static_cast<uint8_t>(++entryCount_); // slot 0 = none
+            for (int m = 0; m < kKeyModMasks; ++m)
+            {
+                if ((m & req) != req)
+                    continue;
+                uint8_t& s = slot_[b.vk][m];
+                if (s == 0 || modCount(entries_[s - 1].mods) < modCount(req))
+                    s = index;
+            }
+        }
+    }
+
+    // The binding for a key under the held-modifier mask, or nullptr.
+    const Entry* match(uint32_t vk, uint8_t heldMods) const
+    {
+        if (vk > 0xFF)
+            return nullptr;
+        const uint8_t s = slot_[vk][heldMods & (kKeyModMasks - 1)];
+        return s == 0 ? nullptr : &entries_[s - 1];
+    }
+
+    // Any binding uses this key (under some modifier mask).
+    bool bound(uint32_t vk) const
+    {
+        if (vk > 0xFF)
+            return false;
+        for (int m = 1; m < kKeyModMasks; ++m)
+            if (slot_[vk][m] != 0)
+                return true;
+        return false;
+    }
+
+    int size() const { return entryCount_; }
+
+private:
+    static int modCount(uint8_t m)
+    {
+        return (m & 1) + ((m >> 1) & 1) + ((m >> 2) & 1) + ((m >> 3) & 1);
+    }
+
+    uint8_t slot_[256][kKeyModMasks] = {};   // entry index + 1; 0 = none
+    Entry entries_[kMaxKeyBindings] = {};
+    int entryCount_ = 0;
+};
+
+} // namespace SmoothZoom
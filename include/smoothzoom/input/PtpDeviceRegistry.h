@@ -0,0 +1,235 @@
+#pragma once
+// =============================================================================
+// SmoothZoom — PtpDeviceRegistry
+// Per-device Precision Touchpad state keyed by Raw Input device handle, with
+// VID:PID-matched profiles. Doc 3 §3.1, R-08
+//
+// RawInputProcessor used to hold one compiled layout and reload it (preparsed
+// data, caps, bit probing) whenever a report came from a different handle, so
+// a docked laptop with an external touchpad re-initialized on every switch
+// between the two pads. The registry keeps every known device instead: its
+// compiled PtpReportLayout, gesture recognizer, sub-notch remainder and the
+// profile applied to it. Entries are added and removed when Raw Input reports
+// WM_INPUT_DEVICE_CHANGE (or on a device's first packet, if that comes before
+// the notification); the report path only looks them up.
+//
+// Lookup is constant time and allocation-free: a fixed table of kMaxDevices
+// entries indexed by an open-addressed bucket array (linear probing, backward-
+// shift deletion, so there are no tombstones to skip). Devices that are not a
+// usable PTP get an entry too, so their packets are ignored without reloading.
+// The registry belongs to the Raw Input worker thread — no locks, no atomics.
+//
+// Pure logic — no Win32 API dependencies (CI-safe, unit-tested).
+// =============================================================================
+
+#include "smoothzoom/input/PtpGestureRecognizer.h"
+#include "smoothzoom/input/PtpReportLayout.h"
+#include "smoothzoom/input/ScrollNormalizer.h"
+#include "smoothzoom/support/SettingsManager.h"
+#include <cstdint>
+
+namespace SmoothZoom
+{
+
+// What the device loader reports for a handle (loadPtpReportLayout + RIDI_DEVICEINFO).
+struct PtpDeviceInfo
+{
+    PtpReportLayout layout;
+    uint16_t vendorId = 0;
+    uint16_t productId = 0;
+};
+
+struct PtpDevice
+{
+    uint64_t handle = 0;
+    uint16_t vendorId = 0;
+    uint16_t productId = 0;
+    bool usable = false;        // false: not a PTP or the load failed — ignored
+    bool hasProfile = false;    // a PtpDeviceProfile matched VID:PID
+    PtpReportLayout layout;
+    PtpAxisScale yScale;        // layout range × profile axisScale
+    float sensitivity = 1.0f;   // profile multiplier on wheel-equivalent output
+    bool invertNaturalScroll = false;
+    PtpGestureRecognizer gestures;
+    // Fractional wheel-equivalent remainder (120 units/notch) carried across
+    // reports so continuous touchpad motion produces continuous, sub-notch zoom.
+    float remainder = 0.0f;
+    int charSamples = 0;        // characterization samples logged so far
+};
+
+class PtpDeviceRegistry
+{
+public:
+    static constexpr int kMaxDevices = 8;
+    static constexpr int kBuckets = 16; // power of two, ≥ 2 × kMaxDevices
+
+    PtpDeviceRegistry() { clear(); }
+
+    // Entry for a handle, or nullptr. Handle 0 (injected input) is never stored.
+    PtpDevice* find(uint64_t handle)
+    {
+        const int b = findBucket(handle);
+        return b < 0 ? nullptr : &devices_[buckets_[b]];
+    }
+    const PtpDevice* find(uint64_t handle) const
+    {
+        return const_cast<PtpDeviceRegistry*>(this)->find(handle);
+    }
+
+    // Add or replace the entry for a handle; `info` nullptr records a device
+    // that is not a usable PTP. When the table is full an unusable entry is
+    // evicted; with kMaxDevices usable pads, returns nullptr.
+    PtpDevice* insert(uint64_t handle, const PtpDeviceInfo* info)
+    {
+        if (handle == 0)
+            return nullptr;
+        PtpDevice* d = find(handle);
+        if (d == nullptr)
+        {
+            int slot = freeSlot();
+            if (slot < 0)
+            {
+                for (int i = 0; i < kMaxDevices && slot < 0; ++i)
+                    if (!devices_[i].usable)
+                    {
+                        remove(devices_[i].handle);
+                        slot = i;
+                    }
+                if (slot < 0)
+                    return nullptr;
+            }
+            int b = home(handle);
+            while (buckets_[b] >= 0)
+                b = (b + 1) & (kBuckets - 1);
+            buckets_[b] = static_cast<int8_t>(slot);
+            used_[slot] = true;
+            ++count_;
+            d = &devices_[slot];
+        }
+
+        *d = PtpDevice{};
+        d->handle = handle;
+        if (info != nullptr)
+        {
+            d->usable = info->layout.valid;
+            d->vendorId = info->vendorId;
+            d->productId = info->productId;
+            d->layout = info->layout;
+            d->gestures.configure(d->layout);
+        }
+        applyProfile(*d);
+        return d;
+    }
+
+    // Forget a handle (device removed). False if it was not known.
+    bool remove(uint64_t handle)
+    {
+        int b = findBucket(handle);
+        if (b < 0)
+            return false;
+        const int slot = buckets_[b];
+        used_[slot] = false;
+        devices_[slot].handle = 0;
+        --count_;
+
+        // Backward-shift: pull later members of the probe run into the hole so
+        // every remaining handle stays reachable from its home bucket.
+        buckets_[b] = -1;
+        int hole = b;
+        for (int i = (b + 1) & (kBuckets - 1); buckets_[i] >= 0; i = (i + 1) & (kBuckets - 1))
+        {
+            const int h = home(devices_[buckets_[i]].handle);
+            // Movable if its home is not in the cyclic range (hole, i].
+            if (((i - h) & (kBuckets - 1)) >= ((i - hole) & (kBuckets - 1)))
+            {
+                buckets_[hole] = buckets_[i];
+                buckets_[i] = -1;
+                hole = i;
+            }
+        }
+        return true;
+    }
+
+    void clear()
+    {
+        for (auto& b : buckets_)
+            b = -1;
+        for (int i = 0; i < kMaxDevices; ++i)
+        {
+            used_[i] = false;
+            devices_[i].handle = 0;
+        }
+        count_ = 0;
+    }
+
+    int size() const { return count_; }
+
+    // Replace the profile list (settings changed) and re-apply it to every
+    // entry. Gesture state is kept; only tuning changes.
+    void setProfiles(const PtpDeviceProfile* profiles, int count)
+    {
+        profileCount_ = 0;
+        for (int i = 0; i < count && profileCount_ < kMaxPtpDeviceProfiles; ++i)
+            profiles_[profileCount_++] = profiles[i];
+        for (int i = 0; i < kMaxDevices; ++i)
+            if (used_[i])
+                applyProfile(devices_[i]);
+    }
+
+    // Profile for a VID:PID, or nullptr.
+    const PtpDeviceProfile* profileFor(uint16_t vendorId, uint16_t productId) const
+    {
+        for (int i = 0; i < profileCount_; ++i)
+            if (profiles_[i].vendorId == vendorId && profiles_[i].productId == productId)
+                return &profiles_[i];
+        return nullptr;
+    }
+
+private:
+    static int home(uint64_t handle)
+    {
+        // Handles are pointer-like (low bits mostly zero); Fibonacci hashing
+        // spreads them from the high bits of the product.
+        return static_cast<int>((handle * 0x9E3779B97F4A7C15ull) >> 60) & (kBuckets - 1);
+    }
+
+    int findBucket(uint64_t handle) const
+    {
+        if (handle == 0)
+            return -1;
+        for (int n = 0, b = home(handle); n < kBuckets; ++n, b = (b + 1) & (kBuckets - 1))
+        {
+            if (buckets_[b] < 0)
+                return -1;
+            if (devices_[buckets_[b]].handle == handle)
+                return b;
+        }
+        return -1;
+    }
+
+    int freeSlot() const
+    {
+        for (int i = 0; i < kMaxDevices; ++i)
+            if (!used_[i])
+                return i;
+        return -1;
+    }
+
+    void applyProfile(PtpDevice& d) const
+    {
+        const PtpDeviceProfile* p = d.usable ? profileFor(d.vendorId, d.productId) : nullptr;
+        d.hasProfile = p != nullptr;
+        d.yScale = PtpAxisScale{d.layout.logicalRangeY, p ? p->axisScale : 1.0f};
+        d.sensitivity = p ? p->sensitivity : 1.0f;
+        d.invertNaturalScroll = p ? p->invertNaturalScroll : false;
+    }
+
+    PtpDevice devices_[kMaxDevices];
+    bool used_[kMaxDevices] = {};
+    int8_t buckets_[kBuckets] = {};
+    int count_ = 0;
+    PtpDeviceProfile profiles_[kMaxPtpDeviceProfiles] = {};
+    int profileCount_ = 0;
+};
+
+} // namespace SmoothZoom
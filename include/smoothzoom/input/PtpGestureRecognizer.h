@@ -0,0 +1,275 @@
+#pragma once
+// =============================================================================
+// SmoothZoom — PtpGestureRecognizer
+// Two-finger Precision Touchpad gestures from decoded contact frames: vertical
+// scroll and pinch / spread. Doc 3 §3.1, R-08
+//
+// Contacts are tracked per slot (X, Y, tip, confidence); low-confidence
+// contacts (palms) never count as fingers. The first two fingers that were
+// already down last report form the gesture pair, and two kinds of evidence
+// are accumulated for it:
+//   scroll — vertical travel of the pair's centroid
+//   pinch  — change in the distance between the two fingers
+// A fresh pair starts Undecided and commits to the kind whose net evidence
+// since touchdown reaches enterFraction of the pad height while exceeding the
+// other by `dominance`; the travel made while undecided is then released at
+// once so no input is lost. A committed gesture only switches when the other
+// kind's *recent* evidence (exponentially decayed per report) reaches the
+// larger breakoutFraction with the same dominance — a scroll with slightly
+// uneven fingers stays a scroll, and a pinch with some drift stays a pinch.
+// Lifting a finger or changing the pair resets to None.
+//
+// A pinch maps finger distance straight to log-zoom: ln(d / dPrev) per report,
+// so spreading the fingers to twice their distance zooms 2× whatever the pad
+// size, anchored at the finger centroid (reported as a fraction of the pad).
+// Device X and Y units are treated as the same physical size, as PTP
+// descriptors are in practice; thresholds scale with the pad's Y range.
+//
+// Pure logic — no Win32 API dependencies (CI-safe, unit-tested).
+// =============================================================================
+
+#include "smoothzoom/input/PtpReportLayout.h"
+#include "smoothzoom/input/ScrollNormalizer.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace SmoothZoom
+{
+
+enum class PtpGesture : uint8_t
+{
+    None,       // fewer than two fingers with a previous sample
+    Undecided,  // two fingers, not enough evidence yet
+    Scroll,
+    Pinch,
+};
+
+struct PtpGestureParams
+{
+    float enterFraction = 0.02f;         // net travel (× pad height) to classify a new pair
+    float breakoutFraction = 0.06f;      // recent travel (× pad height) to switch kinds
+    float dominance = 1.5f;              // winner must exceed the other kind by this ratio
+    float evidenceDecay = 0.9f;          // per report once committed (~10-report window)
+    float minSeparationFraction = 0.02f; // closer fingers give no usable distance ratio
+};
+
+// Result of one report.
+struct PtpGestureFrame
+{
+    int fingers = 0;           // active contacts with a previous sample (max 2 used)
+    int32_t avgDeltaY = 0;     // two-finger average Y delta, device units, + = down
+    PtpGesture gesture = PtpGesture::None;
+    int32_t scrollDeltaY = 0;  // device units to scroll (Scroll; catch-up on commit)
+    float logZoomDelta = 0.0f; // Pinch: ln(distance ratio), + = spread
+    float anchorX = 0.5f;      // Pinch: finger centroid, fraction of the pad [0, 1]
+    float anchorY = 0.5f;
+};
+
+class PtpGestureRecognizer
+{
+public:
+    PtpGestureRecognizer() = default;
+    explicit PtpGestureRecognizer(const PtpGestureParams& params) : params_(params) {}
+
+    // Take the pad extents from a compiled layout and forget all contacts.
+    void configure(const PtpReportLayout& layout)
+    {
+        rangeX_ = layout.logicalRangeX;
+        rangeY_ = layout.logicalRangeY;
+        reset();
+    }
+
+    // Forget contacts and the current gesture (pad extents are kept).
+    void reset()
+    {
+        for (Contact& c : contacts_)
+            c = Contact{};
+        gesture_ = PtpGesture::None;
+    }
+
+    PtpGesture gesture() const { return gesture_; }
+
+    // Fold one decoded report in. Scroll and zoom output needs contactCount ≥ 2
+    // and two fingers that were already down last report; hybrid-mode
+    // continuation reports (contactCount 0) only update contacts.
+    PtpGestureFrame update(const PtpContactFrame& frame)
+    {
+        for (int s = 0; s < frame.numSlots; ++s)
+        {
+            Contact& c = contacts_[s];
+            const PtpContactFrame::Slot& in = frame.slots[s];
+            if (in.tip && in.confident)
+            {
+                c.prevX = c.x;
+                c.prevY = c.y;
+                c.hasPrev = c.active; // valid prev only if already active
+                c.x = static_cast<int32_t>(in.x);
+                c.y = static_cast<int32_t>(in.y);
+                c.active = true;
+            }
+            else
+            {
+                c.active = false;
+                c.hasPrev = false;
+            }
+        }
+
+        PtpGestureFrame out;
+        if (frame.contactCount < 2)
+        {
+            if (frame.contactCount == 1)
+                gesture_ = PtpGesture::None;
+            out.gesture = gesture_;
+            return out;
+        }
+
+        int pair[2] = {-1, -1};
+        for (int i = 0; i < PtpContactFrame::kMaxSlots && out.fingers < 2; ++i)
+            if (contacts_[i].active && contacts_[i].hasPrev)
+                pair[out.fingers++] = i;
+        if (out.fingers < 2)
+        {
+            gesture_ = PtpGesture::None;
+            return out;
+        }
+
+        const Contact& a = contacts_[pair[0]];
+        const Contact& b = contacts_[pair[1]];
+        const int32_t dyA = a.y - a.prevY;
+        const int32_t dyB = b.y - b.prevY;
+        out.avgDeltaY = (dyA + dyB) / 2;
+
+        const float extent = padExtent();
+        const float minSeparation = params_.minSeparationFraction * extent;
+        const float centroidDy = 0.5f * static_cast<float>(dyA + dyB);
+        const float dist = distance(a.x - b.x, a.y - b.y);
+        const float prevDist = distance(a.prevX - b.prevX, a.prevY - b.prevY);
+
+        if (gesture_ == PtpGesture::None || pair[0] != pair_[0] || pair[1] != pair_[1])
+        {
+            // New pair: evidence starts at its previous sample, so this report's
+            // motion already counts.
+            pair_[0] = pair[0];
+            pair_[1] = pair[1];
+            gesture_ = PtpGesture::Undecided;
+            startDistance_ = prevDist;
+            scrollEvidence_ = 0.0f;
+            pendingScrollY_ = 0;
+        }
+
+        if (gesture_ == PtpGesture::Undecided)
+        {
+            scrollEvidence_ += centroidDy;
+            pendingScrollY_ += out.avgDeltaY;
+            const float pinchEvidence = dist - startDistance_;
+            if (wins(pinchEvidence, scrollEvidence_, params_.enterFraction * extent))
+            {
+                gesture_ = PtpGesture::Pinch;
+                out.logZoomDelta = logRatio(dist, startDistance_, minSeparation);
+                beginLocked();
+            }
+            else if (wins(scrollEvidence_, pinchEvidence, params_.enterFraction * extent))
+            {
+                gesture_ = PtpGesture::Scroll;
+                out.scrollDeltaY = pendingScrollY_;
+                beginLocked();
+            }
+        }
+        else
+        {
+            scrollEvidence_ = scrollEvidence_ * params_.evidenceDecay + centroidDy;
+            pinchEvidence_ = pinchEvidence_ * params_.evidenceDecay + (dist - prevDist);
+            const float breakout = params_.breakoutFraction * extent;
+            if (gesture_ == PtpGesture::Scroll && wins(pinchEvidence_, scrollEvidence_, breakout))
+            {
+                gesture_ = PtpGesture::Pinch;
+                beginLocked();
+            }
+            else if (gesture_ == PtpGesture::Pinch && wins(scrollEvidence_, pinchEvidence_, breakout))
+            {
+                gesture_ = PtpGesture::Scroll;
+                beginLocked();
+            }
+
+            if (gesture_ == PtpGesture::Scroll)
+                out.scrollDeltaY = out.avgDeltaY;
+            else
+                out.logZoomDelta = logRatio(dist, prevDist, minSeparation);
+        }
+
+        out.gesture = gesture_;
+        if (gesture_ == PtpGesture::Pinch)
+        {
+            out.anchorX = padFraction(a.x + b.x, rangeX_);
+            out.anchorY = padFraction(a.y + b.y, rangeY_);
+        }
+        return out;
+    }
+
+private:
+    struct Contact
+    {
+        bool active = false;
+        bool hasPrev = false;
+        int32_t x = 0;
+        int32_t y = 0;
+        int32_t prevX = 0;
+        int32_t prevY = 0;
+    };
+
+    // Pad height in device units; without a descriptor range, the extent the
+    // scroll fallback implies (kPtpFallbackUnitsPerNotch per notch).
+    float padExtent() const
+    {
+        return rangeY_ > 0 ? static_cast<float>(rangeY_)
+                           : kPtpFallbackUnitsPerNotch / kPtpSurfaceFractionPerNotch;
+    }
+
+    bool wins(float evidence, float other, float threshold) const
+    {
+        const float e = std::abs(evidence);
+        return e >= threshold && e >= params_.dominance * std::abs(other);
+    }
+
+    void beginLocked()
+    {
+        scrollEvidence_ = 0.0f;
+        pinchEvidence_ = 0.0f;
+    }
+
+    static float distance(int32_t dx, int32_t dy)
+    {
+        const auto fx = static_cast<float>(dx);
+        const auto fy = static_cast<float>(dy);
+        return std::sqrt(fx * fx + fy * fy);
+    }
+
+    static float logRatio(float dist, float from, float minSeparation)
+    {
+        if (dist < minSeparation || from < minSeparation)
+            return 0.0f;
+        return std::log(dist / from);
+    }
+
+    // Midpoint (given as the sum of two coordinates) as a fraction of the axis.
+    static float padFraction(int32_t sum, int32_t range)
+    {
+        if (range <= 0)
+            return 0.5f;
+        return std::clamp(0.5f * static_cast<float>(sum) / static_cast<float>(range), 0.0f, 1.0f);
+    }
+
+    PtpGestureParams params_;
+    int32_t rangeX_ = 0;
+    int32_t rangeY_ = 0;
+    Contact contacts_[PtpContactFrame::kMaxSlots] = {};
+    PtpGesture gesture_ = PtpGesture::None;
+    int pair_[2] = {-1, -1};
+    float startDistance_ = 0.0f;  // Undecided: pair distance at touchdown
+    float scrollEvidence_ = 0.0f; // Undecided: net since touchdown; then decayed
+    float pinchEvidence_ = 0.0f;  // decayed, once committed
+    int32_t pendingScrollY_ = 0;  // Undecided: summed avgDeltaY, released on commit
+};
+
+} // namespace SmoothZoom
@@ -0,0 +1,249 @@
+#pragma once
+// =============================================================================
+// SmoothZoom — PtpReportLayout
+// Precompiled Precision Touchpad (PTP) HID input-report layout and decoder.
+// Doc 3 §3.1 (Raw Input fallback), R-08
+//
+// PTP drivers deliver two-finger scroll via WM_MOUSEWHEEL directly to the
+// foreground window, bypassing LL mouse hooks for Desktop/Edge, so the Raw
+// Input worker parses the raw HID contact reports. Calling HidP_GetUsageValue /
+// HidP_GetUsages per field walks the preparsed data on every call — several
+// calls per contact, 125–250 reports/s during a gesture. Instead, the layout
+// is compiled once per device: the bit offset and size of contact count and of
+// each contact slot's ID, tip switch, confidence, X and Y, keyed by link
+// collection. A
+// report is then decoded by straight bit extraction from a zero-padded copy
+// (no bounds branches per field; absent fields have size 0 and read as 0).
+//
+// compile() and decode() are pure logic — CI-safe, tested with synthetic
+// descriptors and report dumps. loadPtpReportLayout() (Win32 only) builds the
+// field list from a device's preparsed data, probing each field's bit position
+// with HidP_SetUsageValue / HidP_SetUsages, since HIDP_VALUE_CAPS does not
+// expose it.
+// =============================================================================
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace SmoothZoom
+{
+
+// HID usages used by the PTP parser.
+inline constexpr uint16_t kHidPageGenericDesktop = 0x01;
+inline constexpr uint16_t kHidPageDigitizer      = 0x0D;
+inline constexpr uint16_t kHidUsageX             = 0x30;
+inline constexpr uint16_t kHidUsageY             = 0x31;
+inline constexpr uint16_t kHidUsageTipSwitch     = 0x42;
+inline constexpr uint16_t kHidUsageConfidence    = 0x47;
+inline constexpr uint16_t kHidUsageContactId     = 0x51;
+inline constexpr uint16_t kHidUsageContactCount  = 0x54;
+
+// Location of one field in an input report. Bit 0 is the LSB of byte 0 (the
+// report ID byte when the device uses report IDs); HID fields are little-endian.
+struct PtpField
+{
+    uint16_t bitOffset = 0;
+    uint8_t bitSize = 0;     // 0 = absent (reads 0); at most 32
+
+    bool present() const { return bitSize != 0; }
+};
+
+// One value or button field as described by the device (the portable subset
+// of HIDP_VALUE_CAPS / HIDP_BUTTON_CAPS plus the probed position).
+struct PtpFieldDesc
+{
+    uint16_t usagePage = 0;
+    uint16_t usage = 0;
+    uint16_t linkCollection = 0;
+    uint8_t reportId = 0;
+    PtpField field;
+    int32_t logicalMin = 0;
+    int32_t logicalMax = 0;
+};
+
+struct PtpSlotLayout
+{
+    uint16_t linkCollection = 0;
+    PtpField contactId;
+    PtpField tipSwitch;
+    PtpField confidence;
+    PtpField x;
+    PtpField y;
+};
+
+// One decoded report.
+struct PtpContactFrame
+{
+    static constexpr int kMaxSlots = 5;
+
+    uint32_t contactCount = 0;  // 0 in hybrid-mode continuation reports
+    int numSlots = 0;
+    struct Slot
+    {
+        uint32_t contactId = 0;
+        bool tip = false;
+        bool confident = true;  // false = palm / unintended touch (absent field: true)
+        uint32_t x = 0;
+        uint32_t y = 0;
+    } slots[kMaxSlots] = {};
+};
+
+struct PtpReportLayout
+{
+    static constexpr int kMaxSlots = PtpContactFrame::kMaxSlots; // max 5 per PTP spec
+    // Largest report decoded; also bounds the padded copy in decode().
+    static constexpr size_t kMaxReportBytes = 256;
+
+    bool valid = false;
+    bool usesReportId = false;   // first byte is the report ID
+    uint8_t reportId = 0;        // the contact report's ID (contact count's report)
+    uint16_t contactCountLC = 0; // diagnostics
+    PtpField contactCount;
+    int numSlots = 0;
+    PtpSlotLayout slots[kMaxSlots] = {};
+    int32_t logicalRangeX = 0;   // largest X logical extent (gesture anchor); 0 = unknown
+    int32_t logicalRangeY = 0;   // largest Y logical extent (A1 normalization); 0 = unknown
+    uint16_t spanBytes = 0;      // bytes decode() reads: last field's first byte + 8
+
+    // Build from the device's fields. Needs Contact Count and at least one
+    // Contact ID; slots follow Contact ID order (link collection is stable for
+    // a contact's lifetime). Fields outside the contact report are ignored.
+    // Returns valid.
+    bool compile(const PtpFieldDesc* fields, size_t count, bool deviceUsesReportIds)
+    {
+        *this = PtpReportLayout{};
+        usesReportId = deviceUsesReportIds;
+
+        const PtpFieldDesc* cc = nullptr;
+        for (size_t i = 0; i < count; ++i)
+            if (fields[i].usagePage == kHidPageDigitizer
+                && fields[i].usage == kHidUsageContactCount && usable(fields[i].field))
+            {
+                cc = &fields[i];
+                break;
+            }
+        if (cc == nullptr)
+            return false;
+        reportId = cc->reportId;
+        contactCountLC = cc->linkCollection;
+        contactCount = cc->field;
+
+        for (size_t i = 0; i < count && numSlots < kMaxSlots; ++i)
+        {
+            const PtpFieldDesc& f = fields[i];
+            if (f.usagePage == kHidPageDigitizer && f.usage == kHidUsageContactId
+                && f.reportId == reportId && usable(f.field))
+            {
+                slots[numSlots].linkCollection = f.linkCollection;
+                slots[numSlots].contactId = f.field;
+                ++numSlots;
+            }
+        }
+        if (numSlots == 0)
+            return false;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const PtpFieldDesc& f = fields[i];
+            if (f.usagePage == kHidPageGenericDesktop && f.logicalMax > f.logicalMin)
+            {
+                // Largest across contact collections
+                const int32_t range = f.logicalMax - f.logicalMin;
+                if (f.usage == kHidUsageX && range > logicalRangeX)
+                    logicalRangeX = range;
+                else if (f.usage == kHidUsageY && range > logicalRangeY)
+                    logicalRangeY = range;
+            }
+            if (f.reportId != reportId || !usable(f.field))
+                continue;
+            for (int s = 0; s < numSlots; ++s)
+            {
+                PtpSlotLayout& slot = slots[s];
+                if (f.linkCollection != slot.linkCollection)
+                    continue;
+                if (f.usagePage == kHidPageDigitizer && f.usage == kHidUsageTipSwitch)
+                    slot.tipSwitch = f.field;
+                else if (f.usagePage == kHidPageDigitizer && f.usage == kHidUsageConfidence)
+                    slot.confidence = f.field;
+                else if (f.usagePage == kHidPageGenericDesktop && f.usage == kHidUsageX)
+                    slot.x = f.field;
+                else if (f.usagePage == kHidPageGenericDesktop && f.usage == kHidUsageY)
+                    slot.y = f.field;
+            }
+        }
+        auto widen = [this](PtpField f) {
+            if (span(f) > spanBytes)
+                spanBytes = span(f);
+        };
+        widen(contactCount);
+        for (int s = 0; s < numSlots; ++s)
+        {
+            widen(slots[s].contactId);
+            widen(slots[s].tipSwitch);
+            widen(slots[s].confidence);
+            widen(slots[s].x);
+            widen(slots[s].y);
+        }
+        valid = true;
+        return true;
+    }
+
+    // Decode one report. False for another report ID (feature / mouse-mode
+    // reports share the device) or when the layout is not valid.
+    bool decode(const uint8_t* report, size_t size, PtpContactFrame& out) const
+    {
+        if (!valid || size == 0 || (usesReportId && report[0] != reportId))
+            return false;
+
+        // Zero-padded copy of just the bytes the fields span: every field reads
+        // 8 bytes from its first byte with no per-field bounds check; bytes past
+        // the report read as 0.
+        uint8_t buf[kMaxReportBytes + 8];
+        const size_t n = size < spanBytes ? size : spanBytes;
+        std::memcpy(buf, report, n);
+        std::memset(buf + n, 0, spanBytes - n);
+
+        out.contactCount = extract(buf, contactCount);
+        out.numSlots = numSlots;
+        for (int s = 0; s < numSlots; ++s)
+        {
+            const PtpSlotLayout& l = slots[s];
+            PtpContactFrame::Slot& c = out.slots[s];
+            c.contactId = extract(buf, l.contactId);
+            c.tip = extract(buf, l.tipSwitch) != 0;
+            c.confident = !l.confidence.present() || extract(buf, l.confidence) != 0;
+            c.x = extract(buf, l.x);
+            c.y = extract(buf, l.y);
+        }
+        return true;
+    }
+
+    // Decodable: present, at most 32 bits, starting inside kMaxReportBytes.
+    static bool usable(PtpField f)
+    {
+        return f.present() && f.bitSize <= 32 && (f.bitOffset >> 3) < kMaxReportBytes;
+    }
+
+    // Bytes extract() reads for a field (absent fields read byte 0).
+    static uint16_t span(PtpField f) { return static_cast<uint16_t>((f.bitOffset >> 3) + 8); }
+
+    // Unsigned little-endian field read; buf must have 8 readable bytes past
+    // the field's first byte.
+    static uint32_t extract(const uint8_t* buf, PtpField f)
+    {
+        const uint8_t* p = buf + (f.bitOffset >> 3);
+        uint64_t w = 0;
+        for (int i = 0; i < 8; ++i) // compiles to one unaligned load on x86/ARM
+            w |= static_cast<uint64_t>(p[i]) << (8 * i);
+        const uint64_t mask = (uint64_t{1} << f.bitSize) - 1; // bitSize ≤ 32
+        return static_cast<uint32_t>((w >> (f.bitOffset & 7)) & mask);
+    }
+};
+
+// Win32: build the layout for a Raw Input HID device (RIDI_PREPARSEDDATA +
+// HidP_GetCaps / value and button caps + bit-position probing). Logs the
+// descriptor at INFO once per device. hDevice is a HANDLE.
+bool loadPtpReportLayout(void* hDevice, PtpReportLayout& out);
+
+} // namespace SmoothZoom
@@ -0,0 +1,180 @@
+#pragma once
+// =============================================================================
+// SmoothZoom — RawInputProcessor
+// Bulk processing of Raw Input packets: mouse wheel and Precision Touchpad HID
+// reports (two-finger scroll and pinch) → fingerprinted ScrollEvents for the
+// render thread's ScrollDeduplicator. Doc 3 §3.1, R-08
+//
+// RawInputWorker drains the Raw Input queue with GetRawInputBuffer into a
+// preallocated arena and hands the whole batch here. Packets are walked in the
+// Win32 wire layout (RAWINPUTHEADER + RAWMOUSE / RAWHID, 8-byte aligned as
+// NEXTRAWINPUTBLOCK), mirrored below so the same code replays recorded buffers
+// in CI. The modifier gate and the event timestamp are sampled once per batch
+// by the caller; PTP gesture recognition still sees every report while gated,
+// so a delta never spans a gap. Each wheel packet becomes its own event (so it
+// can be matched 1:1 against the LL hook's copy); PTP travel is one event per
+// device run within the batch. A pinch travels as the event's log-zoom, not
+// as wheel units, so the finger-distance ratio is the zoom ratio. With the
+// pointer sample stream on, relative mouse motion is summed per batch for the
+// worker to publish.
+//
+// Touchpads are kept in a PtpDeviceRegistry: the worker adds and removes them
+// on WM_INPUT_DEVICE_CHANGE, and a packet from an unknown handle (one that
+// beat its notification) registers it once. Switching between pads reuses
+// their compiled layouts and gesture state.
+//
+// Pure logic — no Win32 API dependencies (CI-safe, unit-tested). Devices are
+// loaded through a callback (loadPtpReportLayout + RIDI_DEVICEINFO on Windows).
+// =============================================================================
+
+#include "smoothzoom/common/Types.h"
+#include "smoothzoom/input/PtpDeviceRegistry.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace SmoothZoom
+{
+
+// ── Win32 Raw Input wire layout (x64) ────────────────────────────────────────
+// RawInputWorker.cpp static_asserts these against RAWINPUTHEADER / RAWMOUSE /
+// RAWHID. x64 only (see CMakeLists.txt) — the WOW64 layout differs.
+inline constexpr uint32_t kRawTypeMouse = 0;        // RIM_TYPEMOUSE
+inline constexpr uint32_t kRawTypeKeyboard = 1;     // RIM_TYPEKEYBOARD
+inline constexpr uint32_t kRawTypeHid = 2;          // RIM_TYPEHID
+inline constexpr uint16_t kRawMouseWheel = 0x0400;  // RI_MOUSE_WHEEL
+inline constexpr uint16_t kRawMouseHWheel = 0x0800; // RI_MOUSE_HWHEEL
+inline constexpr uint16_t kRawMouseMoveAbsolute = 0x0001; // MOUSE_MOVE_ABSOLUTE (RAWMOUSE::usFlags)
+inline constexpr size_t kRawPacketAlign = 8;        // NEXTRAWINPUTBLOCK (QWORD)
+
+struct RawPacketHeader
+{
+    uint32_t type;
+    uint32_t size;       // whole packet, header included
+    uint64_t device;     // HANDLE
+    uint64_t wParam;
+};
+
+struct RawMousePacket
+{
+    uint16_t flags;
+    uint16_t reserved;   // union alignment padding
+    uint16_t buttonFlags;
+    uint16_t buttonData; // signed wheel delta when buttonFlags has a wheel bit
+    uint32_t rawButtons;
+    int32_t lastX;
+    int32_t lastY;
+    uint32_t extraInformation;
+};
+
+struct RawHidPacket
+{
+    uint32_t sizeHid;    // bytes per report
+    uint32_t count;      // reports that follow
+};
+
+inline constexpr size_t kRawMouseOffset = sizeof(RawPacketHeader);
+inline constexpr size_t kRawHidDataOffset = sizeof(RawPacketHeader) + sizeof(RawHidPacket);
+
+// Offset of the packet after one of `size` bytes at `offset`.
+inline size_t nextRawPacket(size_t offset, uint32_t size)
+{
+    return (offset + size + kRawPacketAlign - 1) & ~(kRawPacketAlign - 1);
+}
+
+// Per-batch system state, sampled by the caller when the batch was drained.
+struct RawInputGate
+{
+    bool modifierHeld = false;      // configured zoom modifier is down
+    bool naturalScrolling = false;  // OS touchpad ScrollDirection = natural
+    int64_t timeUs = 0;             // steady_clock µs at drain — stamps the events
+    bool pointerMotion = false;     // sum relative motion (pointerSampleStream)
+};
+
+// One two-finger PTP sample for the per-device characterization log.
+struct PtpCharSample
+{
+    uint64_t device = 0;
+    int index = 0;          // 1-based, per device
+    uint32_t contacts = 0;
+    int fingers = 0;
+    int32_t avgDeltaY = 0;  // raw device units, before direction adjustment
+    float wheelEquiv = 0.0f;
+};
+
+struct RawInputBatchStats
+{
+    static constexpr int kMaxCharSamples = 8;
+    static constexpr int kMaxEvents = 32;
+    static constexpr int kMaxLoaded = 4;
+
+    uint32_t packets = 0;
+    uint32_t wheelPackets = 0;   // mouse packets carrying a wheel delta
+    uint32_t hidReports = 0;     // PTP reports decoded
+    uint32_t pinchReports = 0;   // PTP reports that zoomed by pinch (not gated)
+    uint32_t ignored = 0;        // other types, malformed, foreign reports, no layout
+    int32_t scrollDelta = 0;     // sum of the events' deltas (0 while gated)
+    float pinchLogZoom = 0.0f;   // sum of the events' log-zoom (pinch; 0 while gated)
+    // Relative mouse motion in device counts (gate.pointerMotion only).
+    // Absolute-mode packets (tablets, remote sessions) are left out.
+    uint32_t motionPackets = 0;
+    int32_t motionX = 0;
+    int32_t motionY = 0;
+    // Devices registered from a packet (no device-change notification yet),
+    // for the worker to log. Past kMaxLoaded they are only counted.
+    int loadedCount = 0;
+    uint64_t loaded[kMaxLoaded] = {};
+    int charSampleCount = 0;
+    PtpCharSample charSamples[kMaxCharSamples] = {};
+    // Scroll events to post. Past kMaxEvents, a delta joins the newest event
+    // of its source and device (fingerprints of a flood are moot).
+    int eventCount = 0;
+    ScrollEvent events[kMaxEvents] = {};
+
+    void emit(ScrollSource source, uint64_t device, int64_t timeUs, int32_t delta,
+              float logZoom = 0.0f);
+};
+
+class RawInputProcessor
+{
+public:
+    // Samples logged per device for characterization (R-08).
+    static constexpr int kCharSamplesPerDevice = RawInputBatchStats::kMaxCharSamples;
+
+    // Builds the layout and IDs for a HID device handle; false if it is not a
+    // usable PTP. Called only when a device is registered.
+    using DeviceLoader = bool (*)(void* ctx, uint64_t device, PtpDeviceInfo& out);
+
+    void setDeviceLoader(DeviceLoader loader, void* ctx);
+
+    // WM_INPUT_DEVICE_CHANGE. Arrival loads the device unless it is already
+    // registered as a usable PTP; returns its entry (nullptr if the registry
+    // is full). Removal forgets it.
+    const PtpDevice* deviceArrived(uint64_t device);
+    void deviceRemoved(uint64_t device);
+
+    // Per-device profiles (settings changed); applied to known devices at once.
+    void setDeviceProfiles(const PtpDeviceProfile* profiles, int count);
+
+    // Process `count` packets from a GetRawInputBuffer batch (or fewer, if
+    // `bytes` runs out first). Stats are accumulated into `stats`.
+    void process(const uint8_t* batch, size_t bytes, uint32_t count,
+                 const RawInputGate& gate, RawInputBatchStats& stats);
+
+    // Forget every device (profiles are kept).
+    void reset();
+
+    const PtpDeviceRegistry& ptpDevices() const { return devices_; }
+
+private:
+    void processHid(const RawPacketHeader& h, const uint8_t* packet, size_t size,
+                    const RawInputGate& gate, RawInputBatchStats& stats);
+    void processPtpReport(PtpDevice& d, const uint8_t* report, size_t size,
+                          const RawInputGate& gate, RawInputBatchStats& stats);
+    PtpDevice* load(uint64_t device);
+
+    DeviceLoader loader_ = nullptr;
+    void* loaderCtx_ = nullptr;
+    PtpDeviceRegistry devices_;
+};
+
+} // namespace SmoothZoom
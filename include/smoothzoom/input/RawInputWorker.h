@@ -0,0 +1,47 @@
+#pragma once
+// =============================================================================
+// SmoothZoom — RawInputWorker
+// Raw Input (mouse wheel + Precision Touchpad) on a dedicated worker thread,
+// drained in batches with GetRawInputBuffer. Doc 3 §3.1, R-08
+//
+// Raw Input catches scroll that bypasses the LL mouse hook (PTP drivers deliver
+// two-finger scroll to pointer-aware foreground windows directly). The worker
+// owns a message-only window that Raw Input is registered to, so WM_INPUT never
+// queues behind the main thread's tray, settings or timer work. Batches go
+// through the platform-free RawInputProcessor; the resulting scroll events are
+// posted to SharedState::rawScrollQueue, where the render thread deduplicates
+// them against the LL hook's (ScrollDeduplicator).
+// =============================================================================
+
+#include <atomic>
+
+namespace SmoothZoom
+{
+
+struct SharedState;
+
+class RawInputWorker
+{
+public:
+    ~RawInputWorker();
+
+    // Start the worker thread and register mouse + touchpad Raw Input to its
+    // window. Returns false if the thread or window could not be created.
+    // Failure is non-fatal: LL hook scrolling still works.
+    bool start(SharedState& state);
+
+    // Unregister Raw Input and join the worker thread.
+    void stop();
+
+    // Windows touchpad "natural scrolling" setting (read by the main thread on
+    // startup and WM_SETTINGCHANGE; the worker's message-only window does not
+    // receive broadcasts).
+    void setNaturalScrolling(bool natural);
+
+private:
+    struct Impl;
+    Impl* impl_ = nullptr;
+    std::atomic<bool> running_{false};
+};
+
+} // namespace SmoothZoom
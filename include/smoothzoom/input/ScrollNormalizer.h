@@ -11,6 +11,9 @@
 //   - Raw Input mouse (RAWMOUSE.usButtonData)          — already wheel units (identity)
 //   - Precision Touchpad HID two-finger scroll         — device-range normalized
 //
+// A PTP pinch is not normalized here: it is already a zoom ratio and reaches
+// ZoomController as log-zoom (ScrollEvent::logZoom, applyPinchLogZoom).
+//
 // Pure logic — no Win32 API dependencies (CI-safe, unit-tested).
 // =============================================================================
 
@@ -38,10 +41,12 @@ inline int32_t mouseWheelToWheelEquiv(int32_t rawWheelDelta)
 // logical Y range makes a given fraction-of-pad swipe produce the same zoom on
 // any touchpad, independent of the device's raw resolution.
 
-// Y-axis logical extent for a touchpad, captured from its HID report descriptor.
+// Y-axis logical extent for a touchpad, captured from its HID report descriptor,
+// and an optional per-device correction from its profile (PtpDeviceProfile).
 struct PtpAxisScale
 {
     int32_t logicalRange = 0;  // logicalMax - logicalMin (device units)
+    float axisScale = 1.0f;    // × units per notch (pads that misreport their range)
     bool valid() const { return logicalRange > 0; }
 };
 
@@ -60,13 +65,14 @@ inline constexpr float kPtpFallbackUnitsPerNotch = 25.0f;
 // Device units of finger Y travel that equal one notch, for a given device.
 inline float ptpUnitsPerNotch(const PtpAxisScale& scale)
 {
+    const float k = scale.axisScale > 0.0f ? scale.axisScale : 1.0f;
     if (scale.valid())
     {
         float u = static_cast<float>(scale.logicalRange) * kPtpSurfaceFractionPerNotch;
         if (u >= 1.0f)
-            return u;
+            return u * k;
     }
-    return kPtpFallbackUnitsPerNotch;
+    return kPtpFallbackUnitsPerNotch * k;
 }
 
 // Convert an averaged PTP finger Y delta (device units) to wheel-equivalent
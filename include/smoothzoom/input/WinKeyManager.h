@@ -19,6 +19,11 @@ public:
 
     void onWinKeyDown();
     void onWinKeyUp();
+    // Win key-up without the suppression keystroke: returns whether Start-Menu
+    // suppression is due (the caller injects it) and returns to Idle.
+    bool release();
+    // The Start-Menu suppression keystroke (Ctrl press+release; no-op in tests).
+    static void injectStartMenuSuppression();
     void markUsedForZoom();
     // AC-2.1.18: the Win key was pressed in a non-SmoothZoom chord (e.g. Win+E/D/L).
     // In that case onWinKeyUp() must NOT inject the Start-Menu-suppression Ctrl, or a
@@ -0,0 +1,181 @@
+#pragma once
+// =============================================================================
+// SmoothZoom — Caret Motion Model
+// Infers typing direction and caret speed from successive caret rects, and
+// turns them into a lookahead for caret following (AC-2.6.06). Doc 3 §3.6
+//
+// The fixed lookahead always reserved 15% of the viewport to the right of the
+// caret: wrong for right-to-left scripts, for arrowing backwards, and useless
+// when moving down through lines. The model keeps two exponentially weighted
+// velocity estimates per axis, built from caret displacements:
+//
+//     v ← v · e^(−dt/τ) + Δ/τ
+//
+// (steady typing at r chars/s with step s converges to v = s·r, and the result
+// doesn't depend on how often it is sampled).
+//
+// • fast (velocityTauMs): the current motion — typing or arrowing either way.
+// • slow (scriptTauMs, horizontal only): the typing direction of the text, so
+//   an RTL document keeps its lookahead to the left once the caret pauses.
+//
+// Steps are classified by size in caret heights h (≈ font size):
+// • same line (|Δy| < h/2): horizontal motion.
+// • line change (|Δy| ≥ h/2): vertical motion only — the horizontal jump of a
+//   wrap or Enter says nothing about typing direction.
+// • jump (> jumpLineHeights · h, a click, Home/End or search): no motion at
+//   all; fast velocities reset, the script direction is kept.
+//
+// Lookahead grows with speed (in caret heights/s) from minLookahead to
+// maxLookahead of the viewport extent, signed toward the motion; with the
+// caret at rest it falls back to the script direction horizontally and to
+// none vertically.
+//
+// Pure logic — no Win32 API dependencies (CI-safe, unit-tested).
+// =============================================================================
+
+#include "smoothzoom/common/Types.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace SmoothZoom
+{
+
+// Signed lookahead as fractions of the viewport extent: +x reserves space to
+// the right of the caret, −x to the left, +y below, −y above.
+struct CaretLookahead
+{
+    float x = 0.0f;
+    float y = 0.0f;
+};
+
+class CaretMotionModel
+{
+public:
+    struct Params
+    {
+        float velocityTauMs = 500.0f;    // current-motion memory (> keystroke interval)
+        float scriptTauMs = 4000.0f;     // typing-direction memory
+        float jumpLineHeights = 12.0f;   // larger steps are jumps, not motion
+        int64_t staleMs = 1500;          // sample gap that resets current motion
+        float minLookahead = 0.10f;      // at the slowest motion
+        float maxLookahead = 0.30f;      // horizontal, at fast typing
+        float maxVerticalLookahead = 0.25f;
+        float lookaheadPerSpeed = 0.02f; // per caret height/s of speed
+        float moveThreshold = 0.5f;      // caret heights/s counted as motion
+    };
+
+    void setParams(const Params& p) { params_ = p; }
+    const Params& params() const { return params_; }
+
+    void reset()
+    {
+        vx_ = vy_ = scriptX_ = 0.0f;
+        valid_ = false;
+    }
+
+    // Feed the caret rect seen at `timestampMs` (call every frame while the
+    // caret is valid; an unchanged rect lets the motion decay).
+    void update(const ScreenRect& caret, int64_t timestampMs)
+    {
+        const float cx = 0.5f * static_cast<float>(caret.left + caret.right);
+        const float cy = 0.5f * static_cast<float>(caret.top + caret.bottom);
+        const float h = static_cast<float>(std::max<int32_t>(caret.height(), 1));
+        if (!valid_)
+        {
+            x_ = cx;
+            y_ = cy;
+            h_ = h;
+            lastMs_ = timestampMs;
+            valid_ = true;
+            return;
+        }
+
+        const int64_t gap = timestampMs - lastMs_;
+        if (gap < 0)
+            return;
+        if (gap > params_.staleMs)
+            vx_ = vy_ = 0.0f;
+
+        const float dt = static_cast<float>(gap);
+        const float decay = std::exp(-dt / params_.velocityTauMs);
+        const float scriptDecay = std::exp(-dt / params_.scriptTauMs);
+        vx_ *= decay;
+        vy_ *= decay;
+        scriptX_ *= scriptDecay;
+
+        const float dx = cx - x_;
+        const float dy = cy - y_;
+        const float lineH = std::max(h, h_);
+        if (std::abs(dx) > params_.jumpLineHeights * lineH
+            || std::abs(dy) > params_.jumpLineHeights * lineH)
+        {
+            vx_ = vy_ = 0.0f; // jump: no motion information
+        }
+        else if (std::abs(dy) >= 0.5f * lineH)
+        {
+            vy_ += dy / (lineH * params_.velocityTauMs) * 1000.0f;
+        }
+        else if (dx != 0.0f)
+        {
+            vx_ += dx / (lineH * params_.velocityTauMs) * 1000.0f;
+            scriptX_ += dx / (lineH * params_.scriptTauMs) * 1000.0f;
+        }
+
+        x_ = cx;
+        y_ = cy;
+        h_ = h;
+        lastMs_ = timestampMs;
+    }
+
+    // Current motion in caret heights per second (signed).
+    float velocityX() const { return vx_; }
+    float velocityY() const { return vy_; }
+
+    // Typing direction: true once the text's long-run caret motion is leftward.
+    bool rightToLeft() const { return scriptX_ < 0.0f; }
+
+    // +1 / −1 toward the current (or, at rest, the typical) horizontal motion;
+    // 0 before any horizontal motion has been seen.
+    int horizontalDirection() const
+    {
+        if (std::abs(vx_) >= params_.moveThreshold)
+            return vx_ > 0.0f ? 1 : -1;
+        if (scriptX_ != 0.0f)
+            return scriptX_ > 0.0f ? 1 : -1;
+        return 0;
+    }
+
+    int verticalDirection() const
+    {
+        if (std::abs(vy_) >= params_.moveThreshold)
+            return vy_ > 0.0f ? 1 : -1;
+        return 0;
+    }
+
+    CaretLookahead lookahead() const
+    {
+        CaretLookahead la;
+        const Params& p = params_;
+        la.x = static_cast<float>(horizontalDirection())
+             * std::clamp(p.minLookahead + p.lookaheadPerSpeed * std::abs(vx_),
+                          p.minLookahead, p.maxLookahead);
+        la.y = static_cast<float>(verticalDirection())
+             * std::clamp(p.minLookahead + p.lookaheadPerSpeed * std::abs(vy_),
+                          p.minLookahead, p.maxVerticalLookahead);
+        return la;
+    }
+
+private:
+    Params params_;
+    float x_ = 0.0f;
+    float y_ = 0.0f;
+    float h_ = 1.0f;
+    float vx_ = 0.0f;     // caret heights/s
+    float vy_ = 0.0f;
+    float scriptX_ = 0.0f;
+    int64_t lastMs_ = 0;
+    bool valid_ = false;
+};
+
+} // namespace SmoothZoom
@@ -0,0 +1,152 @@
+#pragma once
+// =============================================================================
+// SmoothZoom — Pointer Damper
+// Speed-dependent damping between the filtered (committed) pointer and the
+// proportional mapping at high zoom (R-19). Doc 3 §3.6, Doc 5 R-19
+//
+// Under proportional mapping a pointer moving s desktop px/s pans the screen
+// at s·(Z−1) px/s, so a fast flick at 8–10× "teleports" the view. The damper
+// feeds computePointerOffset a damped pointer D that chases the committed
+// pointer P. The gap g = |P − D| closes at
+//
+//     dg/dt = −(knee + rate·g)
+//
+// • Slow movement (pointer speed ≤ knee) never opens a gap: D == P, so the
+//   mapping stays exactly linear with no added lag (AC-2.4.07, AC-2.4.10).
+// • A fast flick opens a gap that closes at a speed proportional to it, so
+//   the pan spreads over ~1/rate seconds instead of a frame or two.
+// • Once the pointer stops, the gap reaches exactly zero within
+//   ln(1 + rate·g₀/knee)/rate seconds — zero steady-state offset error.
+//
+// Trade-off: the pointer shows at physX = Z·P − (Z−1)·D, so mid-flick the
+// cursor can run past the screen edge; it is back once the gap closes. Keeping
+// it pinned on screen instead forces the view to pan at Z× pointer speed —
+// faster than undamped — which defeats the damping, so it is opt-in
+// (pointerDamping setting).
+//
+// For a pointer held still during a frame the ODE integrates exactly:
+//   g(dt) = max(0, (g₀ + knee/rate)·e^(−rate·dt) − knee/rate)
+// so damping takes the same wall time at any refresh rate.
+//
+// knee (screen px/s, converted to desktop px/s via Z−1) and rate come from a
+// small zoom-indexed table, linearly interpolated. Below the first row the
+// damper is a pass-through.
+//
+// Pure logic — no Win32 API dependencies (CI-safe, unit-tested).
+// =============================================================================
+
+#include "smoothzoom/common/Types.h"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace SmoothZoom
+{
+
+struct PointerDampingCurve
+{
+    float zoom;          // table row zoom level
+    float kneeScreenPx;  // pan speed (screen px/s) below which mapping is linear
+    float ratePerSec;    // gap closing rate above the knee (1/time constant)
+};
+
+// Zoom-indexed damping table. Below 4× the mapping is untouched; by 10× a
+// flick's pan is spread over ~100 ms.
+inline constexpr PointerDampingCurve kPointerDampingTable[] = {
+    { 4.0f, 12000.0f, 40.0f},
+    { 6.0f,  6000.0f, 22.0f},
+    { 8.0f,  4000.0f, 14.0f},
+    {10.0f,  3000.0f, 10.0f},
+};
+
+// Curve parameters at `zoom`: linear interpolation between table rows, clamped
+// to the last row above it. Returns false (no damping) below the first row.
+inline bool pointerDampingAt(float zoom, float& kneeDesktopPx, float& ratePerSec)
+{
+    constexpr size_t n = sizeof(kPointerDampingTable) / sizeof(kPointerDampingTable[0]);
+    if (zoom < kPointerDampingTable[0].zoom)
+        return false;
+
+    float knee = kPointerDampingTable[n - 1].kneeScreenPx;
+    float rate = kPointerDampingTable[n - 1].ratePerSec;
+    for (size_t i = 1; i < n; ++i)
+    {
+        const PointerDampingCurve& a = kPointerDampingTable[i - 1];
+        const PointerDampingCurve& b = kPointerDampingTable[i];
+        if (zoom <= b.zoom)
+        {
+            const float u = (zoom - a.zoom) / (b.zoom - a.zoom);
+            knee = a.kneeScreenPx + (b.kneeScreenPx - a.kneeScreenPx) * u;
+            rate = a.ratePerSec + (b.ratePerSec - a.ratePerSec) * u;
+            break;
+        }
+    }
+
+    // Screen pan speed is pointer speed × (Z−1) under proportional mapping.
+    kneeDesktopPx = knee / (zoom - 1.0f);
+    ratePerSec = rate;
+    return true;
+}
+
+class PointerDamper
+{
+public:
+    // Snap the damped pointer onto (x, y) — no glide.
+    void reset(int32_t x, int32_t y)
+    {
+        x_ = static_cast<float>(x);
+        y_ = static_cast<float>(y);
+        valid_ = true;
+    }
+
+    // Advance one frame toward the committed pointer (x, y) and return the
+    // damped position to feed computePointerOffset (whole desktop pixels).
+    ScreenPoint update(int32_t x, int32_t y, float zoom, float dtSeconds)
+    {
+        const float px = static_cast<float>(x);
+        const float py = static_cast<float>(y);
+        float knee = 0.0f, rate = 0.0f;
+        if (!valid_ || !enabled_ || !pointerDampingAt(zoom, knee, rate))
+        {
+            reset(x, y);
+            return {x, y};
+        }
+
+        const float gx = px - x_, gy = py - y_;
+        const float gap = std::sqrt(gx * gx + gy * gy);
+        if (gap > 0.0f)
+        {
+            const float dt = (dtSeconds > 0.0f) ? dtSeconds : 0.0f;
+            const float c = knee / rate;
+            float left = (gap + c) * std::exp(-rate * dt) - c;
+            if (left < kSettlePx)
+                left = 0.0f;
+            const float k = left / gap;
+            x_ = px - gx * k;
+            y_ = py - gy * k;
+        }
+        return {static_cast<int32_t>(std::lround(x_)), static_cast<int32_t>(std::lround(y_))};
+    }
+
+    void setEnabled(bool enabled) { enabled_ = enabled; }
+    bool enabled() const { return enabled_; }
+
+    // True when the damped pointer sits on the committed pointer.
+    bool settled(int32_t x, int32_t y) const
+    {
+        return valid_ && x_ == static_cast<float>(x) && y_ == static_cast<float>(y);
+    }
+
+    // Gap (desktop px) below which the damped pointer lands on the pointer.
+    // One whole pixel: pointer steps per frame are integers, so a frame that
+    // catches an extra pixel is quantization, not speed, and must not lag.
+    static constexpr float kSettlePx = 1.0f;
+
+private:
+    float x_ = 0.0f;
+    float y_ = 0.0f;
+    bool valid_ = false;
+    bool enabled_ = false;
+};
+
+} // namespace SmoothZoom
@@ -0,0 +1,121 @@
+#pragma once
+// =============================================================================
+// SmoothZoom — Pointer Filter
+// Adaptive low-pass (One-Euro) on the pointer stream feeding viewport
+// tracking. Replaces the fixed 3 px deadzone (AC-2.4.09–AC-2.4.11). Doc 3 §3.6
+//
+// A hard deadzone holds the viewport until the pointer is > N px away, then
+// jumps N px: at high zoom a slow move pans in visible N·Z px stair-steps, and
+// jitter just above N still gets through. The One-Euro filter (Casiez et al.,
+// CHI 2012) is an exponential smoother whose cutoff rises with pointer speed:
+//
+//     fc = minCutoffHz + beta · |speed|
+//     α  = 1 − e^(−2π · fc · dt)
+//
+// • Hand tremor at rest → fc ≈ minCutoffHz → strong smoothing, no jitter.
+// • Slow deliberate motion → smooth sub-pixel output, no stair-steps.
+// • Fast motion → fc high, α → 1 → effectively transparent.
+//
+// Speed is the magnitude of the (separately smoothed) 2-D velocity, so both
+// axes share one cutoff and diagonal motion isn't filtered anisotropically.
+// The velocity is differenced per frame, or measured from the sub-frame
+// pointer sample stream when the caller has it (PointerMotionEstimator).
+// Per-monitor scaling: speeds are measured in 1080p-equivalent px (divided by
+// monHeight/1080), so the same hand motion filters the same on a 4K panel.
+//
+// α is the exact discretisation of a first-order low-pass (the paper's
+// r/(r+1) form over-smooths long frames), so smoothing is defined in wall
+// time, not frames; only the inherent half-frame sampling delay differs. Output
+// is rounded to whole pixels; at rest it converges onto the raw pointer
+// exactly (zero steady-state error).
+//
+// Pure logic — no Win32 API dependencies (CI-safe, unit-tested).
+// =============================================================================
+
+#include "smoothzoom/common/Types.h"
+#include <cmath>
+#include <cstdint>
+
+namespace SmoothZoom
+{
+
+class PointerFilter
+{
+public:
+    struct Params
+    {
+        float minCutoffHz = 1.0f;    // cutoff at rest: lower = steadier, laggier
+        float beta = 0.02f;          // cutoff gain per 1080p-px/s of speed
+        float derivCutoffHz = 1.0f;  // smoothing of the speed estimate itself
+    };
+
+    // Smoothing factor for an exponential filter with cutoff `hz` over `dt`.
+    static float alpha(float hz, float dt)
+    {
+        return 1.0f - std::exp(-6.2831853f * hz * dt);
+    }
+
+    void setParams(const Params& p) { params_ = p; }
+    const Params& params() const { return params_; }
+
+    // Snap onto (x, y) with zero velocity.
+    void reset(int32_t x, int32_t y)
+    {
+        x_ = static_cast<float>(x);
+        y_ = static_cast<float>(y);
+        vx_ = vy_ = 0.0f;
+        valid_ = true;
+    }
+
+    // Filter one frame's raw pointer sample. `scale` is monHeight / 1080
+    // (per-monitor scaling, AC-MM.04). Returns the filtered whole-pixel position.
+    ScreenPoint update(int32_t x, int32_t y, float dtSeconds, float scale = 1.0f)
+    {
+        return step(x, y, dtSeconds, scale, nullptr);
+    }
+
+    // As above, with the speed term driven by a measured velocity (screen
+    // px/s) instead of the per-frame difference.
+    ScreenPoint update(int32_t x, int32_t y, float dtSeconds, float scale,
+                       float measuredVx, float measuredVy)
+    {
+        const float v[2] = {measuredVx, measuredVy};
+        return step(x, y, dtSeconds, scale, v);
+    }
+
+    float filteredX() const { return x_; }
+    float filteredY() const { return y_; }
+
+private:
+    ScreenPoint step(int32_t x, int32_t y, float dtSeconds, float scale, const float* measured)
+    {
+        const float rx = static_cast<float>(x);
+        const float ry = static_cast<float>(y);
+        if (!valid_)
+        {
+            reset(x, y);
+            return {x, y};
+        }
+        if (dtSeconds > 0.0f)
+        {
+            const float s = (scale > 0.0f) ? scale : 1.0f;
+            const float ad = alpha(params_.derivCutoffHz, dtSeconds);
+            vx_ += ad * ((measured ? measured[0] : (rx - x_) / dtSeconds) - vx_);
+            vy_ += ad * ((measured ? measured[1] : (ry - y_) / dtSeconds) - vy_);
+            const float speed = std::sqrt(vx_ * vx_ + vy_ * vy_) / s;
+            const float a = alpha(params_.minCutoffHz + params_.beta * speed, dtSeconds);
+            x_ += a * (rx - x_);
+            y_ += a * (ry - y_);
+        }
+        return {static_cast<int32_t>(std::lround(x_)), static_cast<int32_t>(std::lround(y_))};
+    }
+
+    Params params_;
+    float x_ = 0.0f;
+    float y_ = 0.0f;
+    float vx_ = 0.0f;
+    float vy_ = 0.0f;
+    bool valid_ = false;
+};
+
+} // namespace SmoothZoom
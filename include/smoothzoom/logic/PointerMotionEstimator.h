@@ -0,0 +1,154 @@
+#pragma once
+// =============================================================================
+// SmoothZoom — Pointer Motion Estimator
+// Pointer velocity from the sub-frame sample stream (PointerSampleRing), for
+// the pointer filter's speed term. Doc 3 §3.6, §3.7
+//
+// The render thread reads GetCursorPos once per frame. PointerFilter then
+// estimates speed from the gap between that sample and its own (lagging)
+// output, so a hand that starts, stops or reverses between two frames is seen
+// a frame late and aliased by the frame period. With the pointer sample
+// stream enabled, the render thread feeds this estimator every sample the
+// producers published since the last frame:
+//
+// • Absolute samples (LL hook WM_MOUSEMOVE, screen px) — preferred. Velocity
+//   is the displacement over the last kWindowUs, ending at the newest sample.
+// • Relative samples (Raw Input, device counts per batch) — used when the
+//   hook is silent, as it can be while the fullscreen magnifier is active.
+//   Counts become px through a gain learned each frame from the GetCursorPos
+//   displacement, which folds in the user's pointer speed and acceleration.
+//
+// velocity() answers false when neither stream has a sample within kStaleUs,
+// or fewer than two within it; the filter then falls back to its per-frame
+// difference. GetCursorPos stays the position of record either way — the
+// stream only supplies speed.
+//
+// Pure logic — no Win32 API dependencies (CI-safe, unit-tested).
+// =============================================================================
+
+#include "smoothzoom/common/PointerSampleRing.h"
+#include <cstdint>
+#include <cstdlib>
+
+namespace SmoothZoom
+{
+
+class PointerMotionEstimator
+{
+public:
+    // 8 kHz over the window with headroom.
+    static constexpr int kHistory = 128;
+    static constexpr int64_t kWindowUs = 12000;
+    static constexpr int64_t kStaleUs = 30000;
+    // Relative counts a frame needs before it updates the gain.
+    static constexpr int32_t kMinCalibrationCounts = 8;
+
+    void reset()
+    {
+        abs_.clear();
+        rel_.clear();
+        pendingX_ = pendingY_ = 0;
+    }
+
+    void addAbsolute(const PointerSample& s) { abs_.add(s); }
+
+    void addRelative(const PointerSample& s)
+    {
+        rel_.add(s);
+        pendingX_ += s.x;
+        pendingY_ += s.y;
+    }
+
+    // Once per frame: the GetCursorPos displacement since the previous frame,
+    // against the relative counts added since the previous call. Frames where
+    // the pointer barely moved, or did not move (pinned at a screen edge),
+    // leave the gain as it was.
+    void calibrate(int32_t dxPx, int32_t dyPx)
+    {
+        const int32_t counts = std::abs(pendingX_) + std::abs(pendingY_);
+        const int32_t px = std::abs(dxPx) + std::abs(dyPx);
+        pendingX_ = pendingY_ = 0;
+        if (counts < kMinCalibrationCounts || px == 0)
+            return;
+        const float ratio = static_cast<float>(px) / static_cast<float>(counts);
+        gain_ = (gain_ > 0.0f) ? gain_ + 0.25f * (ratio - gain_) : ratio;
+    }
+
+    // Velocity in screen px/s ending at the newest fresh sample.
+    bool velocity(int64_t nowUs, float& vx, float& vy) const
+    {
+        if (abs_.estimate(nowUs, false, vx, vy))
+            return true;
+        if (gain_ > 0.0f && rel_.estimate(nowUs, true, vx, vy))
+        {
+            vx *= gain_;
+            vy *= gain_;
+            return true;
+        }
+        return false;
+    }
+
+    float gain() const { return gain_; }
+
+private:
+    struct Track
+    {
+        PointerSample s[kHistory];
+        int next = 0;
+        int count = 0;
+
+        void clear() { next = count = 0; }
+
+        void add(const PointerSample& v)
+        {
+            s[next] = v;
+            next = (next + 1) % kHistory;
+            if (count < kHistory)
+                ++count;
+        }
+
+        // i = 0 is the newest.
+        const PointerSample& back(int i) const { return s[(next - 1 - i + kHistory) % kHistory]; }
+
+        // Absolute: displacement between the newest sample and the reference
+        // (the newest sample at least kWindowUs older, else the oldest kept).
+        // Relative: the counts after the reference, summed.
+        bool estimate(int64_t nowUs, bool relative, float& vx, float& vy) const
+        {
+            if (count < 2)
+                return false;
+            const PointerSample& head = back(0);
+            if (nowUs - head.timeUs > kStaleUs)
+                return false;
+
+            int64_t sumX = relative ? head.x : 0;
+            int64_t sumY = relative ? head.y : 0;
+            int ref = 1;
+            for (; ref < count - 1 && head.timeUs - back(ref).timeUs < kWindowUs; ++ref)
+            {
+                sumX += back(ref).x;
+                sumY += back(ref).y;
+            }
+            const PointerSample& r = back(ref);
+            const int64_t span = head.timeUs - r.timeUs;
+            if (span <= 0 || span > kStaleUs)
+                return false;
+            if (!relative)
+            {
+                sumX = static_cast<int64_t>(head.x) - r.x;
+                sumY = static_cast<int64_t>(head.y) - r.y;
+            }
+            vx = static_cast<float>(sumX) * 1e6f / static_cast<float>(span);
+            vy = static_cast<float>(sumY) * 1e6f / static_cast<float>(span);
+            return true;
+        }
+    };
+
+    Track abs_;
+    Track rel_;
+    int32_t pendingX_ = 0;
+    int32_t pendingY_ = 0;
+    float gain_ = 0.0f; // screen px per count; 0 until calibrated
+};
+
+} // namespace SmoothZoom
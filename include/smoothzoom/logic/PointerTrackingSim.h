@@ -0,0 +1,82 @@
+#pragma once
+// =============================================================================
+// SmoothZoom — PointerTrackingSim
+// Offline replay of pointer traces through the viewport tracking policies.
+// Doc 3 §3.6
+//
+// Mirrors the pointer path of RenderLoop::frameTick at a constant zoom:
+// PointerFilter → PointerDamper → ViewportTracker::trackPointer →
+// "changed?" gate → apply.
+// Counts the setTransform calls that gate lets through and how far the
+// viewport travels on screen, so tracking modes and their parameters can be
+// compared on the same synthetic hand motion.
+//
+// Pure logic — no Win32 API dependencies (CI-safe, unit-tested).
+// =============================================================================
+
+#include "smoothzoom/common/Types.h"
+#include "smoothzoom/logic/PointerDamper.h"
+#include "smoothzoom/logic/PointerFilter.h"
+#include "smoothzoom/logic/ViewportTracker.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace SmoothZoom
+{
+
+// One render frame's cursor position (GetCursorPos, desktop px).
+struct PointerSample
+{
+    float   timeSec = 0.0f;
+    int32_t x = 0;
+    int32_t y = 0;
+};
+
+enum class PointerTraceKind : uint8_t
+{
+    Precision,  // short strokes and pauses in a small area, with hand tremor
+    Reading,    // steady left-to-right line sweeps with carriage returns
+    Sweep,      // long fast moves across the whole screen
+};
+
+// Deterministic synthetic pointer trace at `hz` for `seconds`.
+std::vector<PointerSample> synthesizePointerTrace(PointerTraceKind kind, float hz,
+                                                  float seconds, int32_t screenW,
+                                                  int32_t screenH, uint32_t seed = 1);
+
+// Mouse trace as a `dpi` sensor reports it: minimum-jerk hand reaches of
+// 0.3–3 inches (some quick flicks) separated by pauses, integrated as whole
+// counts at a 1 kHz report rate with 1:1 pointer speed (6/11, no
+// acceleration), then sampled per frame at `hz`. The same seed gives the same
+// hand motion at every DPI.
+std::vector<PointerSample> synthesizeMouseTrace(int32_t dpi, float hz, float seconds,
+                                                int32_t screenW, int32_t screenH,
+                                                uint32_t seed = 1);
+
+struct PointerTrackingSimParams
+{
+    PointerTrackingMode mode = PointerTrackingMode::Continuous;
+    ViewportTracker::EdgePushParams edgePush;
+    ViewportTracker::CenteredParams centered;
+    bool    damping = false;       // R-19 pointer damping (Continuous mode)
+    float   zoom = 4.0f;
+    int32_t screenW = 1920;
+    int32_t screenH = 1080;
+};
+
+struct PointerTrackingStats
+{
+    int   frames = 0;
+    int   transformCalls = 0;      // frames whose transform changed
+    float transformsPerSec = 0.0f;
+    float viewportTravelPx = 0.0f; // total pan, screen px
+    float maxFramePanPx = 0.0f;    // largest single-frame pan, screen px
+    int   pointerOffscreenFrames = 0;
+    float meanCenterErrorPx = 0.0f; // pointer distance from screen center, screen px
+};
+
+PointerTrackingStats simulatePointerTracking(const PointerSample* samples, size_t count,
+                                             const PointerTrackingSimParams& params);
+
+} // namespace SmoothZoom
@@ -0,0 +1,222 @@
+#pragma once
+// =============================================================================
+// SmoothZoom — Scroll Deduplicator
+// One authoritative scroll source per gesture across the LL hook, Raw Input
+// mouse and Precision Touchpad HID paths. Doc 3 §3.1, R-08
+//
+// The same physical scroll can reach SmoothZoom twice: a wheel notch arrives
+// both as WM_MOUSEWHEEL in the LL hook and as a RAWMOUSE packet; a PTP gesture
+// arrives as driver-synthesized WM_MOUSEWHEEL (when the foreground window lets
+// the hook see it) and as HID contact reports. Each producer stamps its events
+// with a steady-clock µs time and posts them to the render thread, which
+// merges the queues in time order and submits every event here.
+//
+// A gesture is a run of scroll events from any source with no gap longer than
+// gestureGapUs. Its first event's source (kind + device handle) becomes
+// authoritative and is passed through. An event from any other source is
+//   duplicate  — if it matches an event of another source by fingerprint:
+//                same sign and magnitude, |Δt| ≤ matchWindowUs (one notch
+//                seen by two paths, in either order; each event matches once)
+//   suppressed — otherwise; it is held in a short history.
+// If the authority falls silent for handoverUs while another source keeps
+// delivering (e.g. focus moved to a window that hides wheel messages from the
+// hook), that source takes over and its held events newer than the old
+// authority's last event are released, so the switch neither drops nor
+// double-counts travel.
+//
+// Every event ends up in exactly one of accepted / duplicates / suppressed
+// (a held event moves on release or late match). A PTP pinch's log-zoom
+// follows its event's fate; an event with no wheel travel (pinch only) never
+// matches by fingerprint, since only one path reports it.
+//
+// Pure logic — no Win32 API dependencies (CI-safe, unit-tested).
+// =============================================================================
+
+#include "smoothzoom/common/Types.h"
+#include <cstdint>
+#include <cstdlib>
+
+namespace SmoothZoom
+{
+
+struct ScrollDedupParams
+{
+    int64_t gestureGapUs = 150000; // silence from every source that ends a gesture
+    int64_t matchWindowUs = 40000; // one notch's arrival skew between two paths
+    int64_t handoverUs = 60000;    // authority silence before another source takes over
+};
+
+struct ScrollDedupStats
+{
+    uint64_t events = 0;
+    uint64_t accepted = 0;    // applied (authoritative, incl. released at handover)
+    uint64_t duplicates = 0;  // matched another source's event
+    uint64_t suppressed = 0;  // non-authoritative, never released
+    uint64_t released = 0;    // subset of accepted: held events released at handover
+    uint64_t handovers = 0;   // authority switches within a gesture
+    uint64_t gestures = 0;
+};
+
+class ScrollDeduplicator
+{
+public:
+    // Events kept for matching and release. At ≤1 kHz per source this covers
+    // well beyond matchWindowUs.
+    static constexpr int kHistory = 32;
+
+    ScrollDeduplicator() = default;
+    explicit ScrollDeduplicator(const ScrollDedupParams& params) : params_(params) {}
+
+    // Submit one event (in roughly time order; skew within matchWindowUs is
+    // fine). Returns the delta to apply now: the event's own if authoritative,
+    // released held travel on a handover, otherwise 0. The log-zoom accepted
+    // alongside it (pinch) is added to *logZoom.
+    int32_t submit(const ScrollEvent& e, float* logZoom = nullptr)
+    {
+        ++stats_.events;
+        if (!active_ || e.timeUs - lastEventUs_ > params_.gestureGapUs)
+        {
+            active_ = true;
+            authority_ = keyOf(e);
+            lastAuthorityUs_ = e.timeUs;
+            lastEventUs_ = e.timeUs;
+            count_ = 0;
+            ++stats_.gestures;
+        }
+        if (e.timeUs > lastEventUs_)
+            lastEventUs_ = e.timeUs;
+
+        Entry& n = record(e);
+        if (n.key == authority_)
+        {
+            n.authoritative = true;
+            if (e.timeUs > lastAuthorityUs_)
+                lastAuthorityUs_ = e.timeUs;
+            // This notch may already have come in through another path.
+            if (Entry* held = findMatch(n, false))
+            {
+                held->matched = n.matched = true;
+                --stats_.suppressed;
+                ++stats_.duplicates;
+            }
+            ++stats_.accepted;
+            if (logZoom)
+                *logZoom += e.logZoom;
+            return e.delta;
+        }
+
+        if (Entry* m = findMatch(n, true))
+        {
+            m->matched = n.matched = true;
+            ++stats_.duplicates;
+            return 0;
+        }
+        ++stats_.suppressed;
+        if (e.timeUs - lastAuthorityUs_ < params_.handoverUs)
+            return 0;
+
+        // Handover: release this source's held travel since the old authority
+        // last delivered.
+        int32_t released = 0;
+        for (int i = 0; i < count_; ++i)
+        {
+            Entry& h = history_[(head_ + i) % kHistory];
+            if (h.key == n.key && !h.authoritative && !h.matched && h.timeUs > lastAuthorityUs_)
+            {
+                h.authoritative = true;
+                released += h.delta;
+                if (logZoom)
+                    *logZoom += h.logZoom;
+                --stats_.suppressed;
+                ++stats_.accepted;
+                ++stats_.released;
+            }
+        }
+        authority_ = n.key;
+        lastAuthorityUs_ = e.timeUs;
+        ++stats_.handovers;
+        return released;
+    }
+
+    // End the gesture and forget history (stats are kept).
+    void reset()
+    {
+        active_ = false;
+        count_ = 0;
+    }
+
+    const ScrollDedupStats& stats() const { return stats_; }
+    bool hasAuthority() const { return active_; }
+    ScrollSource authoritySource() const { return authority_.source; }
+    uint64_t authorityDevice() const { return authority_.device; }
+
+private:
+    struct Key
+    {
+        ScrollSource source = ScrollSource::LLHook;
+        uint64_t device = 0;
+
+        bool operator==(const Key& o) const { return source == o.source && device == o.device; }
+    };
+
+    struct Entry
+    {
+        int64_t timeUs = 0;
+        int32_t delta = 0;
+        float logZoom = 0.0f;
+        Key key;
+        bool authoritative = false;
+        bool matched = false;
+    };
+
+    static Key keyOf(const ScrollEvent& e) { return {e.source, e.device}; }
+
+    Entry& record(const ScrollEvent& e)
+    {
+        int slot;
+        if (count_ < kHistory)
+            slot = (head_ + count_++) % kHistory;
+        else
+        {
+            slot = head_; // overwrite the oldest
+            head_ = (head_ + 1) % kHistory;
+        }
+        history_[slot] = Entry{e.timeUs, e.delta, e.logZoom, keyOf(e), false, false};
+        return history_[slot];
+    }
+
+    // Closest unmatched event from another source with the same fingerprint.
+    Entry* findMatch(const Entry& n, bool authoritative)
+    {
+        if (n.delta == 0)
+            return nullptr;
+        Entry* best = nullptr;
+        int64_t bestDt = params_.matchWindowUs + 1;
+        for (int i = 0; i < count_; ++i)
+        {
+            Entry& h = history_[(head_ + i) % kHistory];
+            if (&h == &n || h.matched || h.authoritative != authoritative || h.key == n.key
+                || h.delta != n.delta)
+                continue;
+            const int64_t dt = std::llabs(h.timeUs - n.timeUs);
+            if (dt < bestDt)
+            {
+                best = &h;
+                bestDt = dt;
+            }
+        }
+        return best;
+    }
+
+    ScrollDedupParams params_;
+    ScrollDedupStats stats_;
+    bool active_ = false;
+    Key authority_;
+    int64_t lastAuthorityUs_ = 0;
+    int64_t lastEventUs_ = 0;
+    Entry history_[kHistory] = {};
+    int head_ = 0;
+    int count_ = 0;
+};
+
+} // namespace SmoothZoom
@@ -0,0 +1,178 @@
+#pragma once
+// =============================================================================
+// SmoothZoom — Source Arbiter
+// Scored, table-driven arbitration between viewport tracking sources.
+// Doc 3 §3.4, §3.6
+//
+// Each source publishes one candidate per frame: the rect it wants shown, the
+// timestamp of the user action behind it (keystroke, focus change, pointer
+// move) and a confidence in [0, 1]. A policy row per source turns that into a
+// score:
+//
+//     eligible  ⇔ confidence > 0, timestamp > 0,
+//                 settleMs ≤ age < expireMs (0 = no bound),
+//                 and — if yieldsToPointer — no pointer move since timestamp
+//     score     = confidence · (priority + recencyBonus · e^(−age / recencyTauMs))
+//
+// The fallback row (Pointer) is always eligible. The highest score wins.
+// Recency breaks near-ties toward the most recent action; yieldsToPointer
+// encodes intent (moving the mouse means "stop following focus").
+//
+// Hysteresis: a challenger replaces the active source only if it outscores it
+// by switchMargin and the active source has held for minDwellMs. An active
+// source that stops being eligible is replaced immediately, so dwell never
+// keeps the view on a stale target.
+//
+// The default table reproduces the fixed Caret > Focus > Pointer chain
+// (AC-2.5.07, AC-2.5.10–12, AC-2.6.07–09). New sources or per-application
+// overrides are a new enum value and a policy row, not new control flow.
+//
+// Pure logic — no Win32 API dependencies (CI-safe, unit-tested).
+// =============================================================================
+
+#include "smoothzoom/common/Types.h"
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace SmoothZoom
+{
+
+struct SourceCandidate
+{
+    ScreenRect rect;
+    int64_t timestampMs = 0;   // user action behind the candidate (0 = never)
+    float confidence = 0.0f;   // 0 = no candidate this frame, 1 = certain
+};
+
+struct SourcePolicy
+{
+    float priority = 0.0f;        // base score at full confidence
+    int64_t settleMs = 0;         // debounce: too new to win before this age
+    int64_t expireMs = 0;         // stops competing at this age (0 = never)
+    float recencyBonus = 0.0f;    // extra score for a fresh action...
+    float recencyTauMs = 1000.0f; // ...decaying with this time constant
+    bool yieldsToPointer = false; // ineligible once the pointer moves after it
+    bool fallback = false;        // always eligible (the default source)
+};
+
+// Caret while typing (500 ms idle timeout), then focus once debounced (100 ms)
+// and newer than the last pointer move, else pointer. Priorities are a whole
+// point apart so the recency bonus only orders sources of equal priority.
+inline constexpr int64_t kCaretIdleTimeoutMs = 500;   // AC-2.6.07
+inline constexpr int64_t kFocusDebounceMs = 100;      // AC-2.5.07
+
+inline constexpr std::array<SourcePolicy, kTrackingSourceCount> kDefaultSourcePolicy = {{
+    // priority settle            expire               bonus  tau      yields fallback
+    {1.0f,      0,                0,                   0.5f,  1000.0f, false, true},  // Pointer
+    {2.0f,      kFocusDebounceMs, 0,                   0.5f,  1000.0f, true,  false}, // Focus
+    {3.0f,      0,                kCaretIdleTimeoutMs, 0.5f,  1000.0f, false, false}, // Caret
+}};
+
+class SourceArbiter
+{
+public:
+    struct Params
+    {
+        float switchMargin = 0.25f; // score lead a challenger needs to take over
+        int64_t minDwellMs = 0;     // hold before an eligible source can be displaced
+    };
+
+    SourceArbiter() : policy_(kDefaultSourcePolicy) {}
+
+    void setPolicy(TrackingSource s, const SourcePolicy& p) { policy_[index(s)] = p; }
+    const SourcePolicy& policy(TrackingSource s) const { return policy_[index(s)]; }
+    void setParams(const Params& p) { params_ = p; }
+    const Params& params() const { return params_; }
+
+    // Replace the source's candidate for this frame (confidence 0 withdraws it).
+    void publish(TrackingSource s, const SourceCandidate& c) { candidates_[index(s)] = c; }
+    const SourceCandidate& candidate(TrackingSource s) const { return candidates_[index(s)]; }
+
+    // Score of a source's current candidate at `nowMs`; negative if ineligible.
+    float score(TrackingSource s, int64_t nowMs) const
+    {
+        const SourcePolicy& p = policy_[index(s)];
+        const SourceCandidate& c = candidates_[index(s)];
+        const int64_t age = nowMs - c.timestampMs;
+        if (p.fallback)
+            return p.priority + (c.timestampMs > 0 ? recency(p, age) : 0.0f);
+
+        if (c.confidence <= 0.0f || c.timestampMs <= 0)
+            return -1.0f;
+        if ((p.settleMs > 0 && age < p.settleMs) || (p.expireMs > 0 && age >= p.expireMs))
+            return -1.0f;
+        if (p.yieldsToPointer && pointerTimestamp() >= c.timestampMs)
+            return -1.0f;
+        return c.confidence * (p.priority + recency(p, age));
+    }
+
+    // Highest-scoring eligible source, ignoring hysteresis (ties keep the
+    // lower-numbered source).
+    TrackingSource evaluate(int64_t nowMs, float* bestScore = nullptr) const
+    {
+        TrackingSource best = TrackingSource::Pointer;
+        float top = -1.0f;
+        for (size_t i = 0; i < kTrackingSourceCount; ++i)
+        {
+            const float s = score(static_cast<TrackingSource>(i), nowMs);
+            if (s > top)
+            {
+                top = s;
+                best = static_cast<TrackingSource>(i);
+            }
+        }
+        if (bestScore)
+            *bestScore = top;
+        return best;
+    }
+
+    // Per-frame decision with hysteresis; returns (and remembers) the active source.
+    TrackingSource arbitrate(int64_t nowMs)
+    {
+        float bestScore = 0.0f;
+        const TrackingSource best = evaluate(nowMs, &bestScore);
+        if (best == active_)
+            return active_;
+
+        const float held = score(active_, nowMs);
+        const bool activeGone = held < 0.0f;
+        const bool outscored = bestScore > held + params_.switchMargin
+                            && nowMs - activeSinceMs_ >= params_.minDwellMs;
+        if (activeGone || outscored)
+            setActive(best, nowMs);
+        return active_;
+    }
+
+    // Force the active source (e.g. pointer movement cancelling a transition).
+    void setActive(TrackingSource s, int64_t nowMs)
+    {
+        active_ = s;
+        activeSinceMs_ = nowMs;
+    }
+    TrackingSource active() const { return active_; }
+
+private:
+    static size_t index(TrackingSource s) { return static_cast<size_t>(s); }
+
+    static float recency(const SourcePolicy& p, int64_t ageMs)
+    {
+        if (p.recencyBonus <= 0.0f || p.recencyTauMs <= 0.0f || ageMs < 0)
+            return 0.0f;
+        return p.recencyBonus * std::exp(-static_cast<float>(ageMs) / p.recencyTauMs);
+    }
+
+    int64_t pointerTimestamp() const
+    {
+        return candidates_[index(TrackingSource::Pointer)].timestampMs;
+    }
+
+    std::array<SourcePolicy, kTrackingSourceCount> policy_;
+    std::array<SourceCandidate, kTrackingSourceCount> candidates_{};
+    Params params_;
+    TrackingSource active_ = TrackingSource::Pointer;
+    int64_t activeSinceMs_ = 0;
+};
+
+} // namespace SmoothZoom
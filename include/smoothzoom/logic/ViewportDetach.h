@@ -0,0 +1,109 @@
+#pragma once
+// =============================================================================
+// SmoothZoom — Viewport Detach
+// Freeze the zoomed viewport while the pointer keeps moving, then glide back
+// to the pointer. docs/research Priority 7.
+//
+// ToggleDetach (Modifier+Numpad .) freezes the view where it is: RenderLoop
+// then skips all per-frame tracking work and setTransform calls — the cheapest
+// zoomed state there is, suited to reading static content at high zoom. The
+// pointer moves freely (and may leave the view) meanwhile.
+//
+// The view re-attaches on a second ToggleDetach, or on its own as soon as the
+// zoom level changes (scroll, keyboard step, preset, reset, toggle peek):
+// zooming a frozen view around a pointer it no longer follows would be
+// disorienting. Re-attaching hands RenderLoop a PanAnimator pan from the
+// frozen offset — zero velocity, so the motion is velocity-continuous — to the
+// pointer's current target, which it keeps chasing while it moves.
+//
+// A ToggleDetach that arrives while the zoom is still moving (animation,
+// wheel glide, scroll gesture) is deferred until the controller is Idle:
+// freezing mid-animation would either stall the animation on screen or let
+// its next step read as a zoom change and re-attach at once. The view keeps
+// tracking until then; a second ToggleDetach meanwhile cancels the request.
+//
+// Detaching is ignored at 1.0× (nothing to freeze), including when a deferred
+// detach settles there.
+//
+// Pure logic — no Win32 API dependencies (CI-safe, unit-tested).
+// =============================================================================
+
+namespace SmoothZoom
+{
+
+class ViewportDetach
+{
+public:
+    enum class Frame
+    {
+        Tracking,  // attached: normal per-frame tracking
+        Frozen,    // detached: keep the applied transform, skip tracking
+        Reattach,  // first attached frame: pan from the frozen view to the pointer
+    };
+
+    // ToggleDetach command. Detaches a zoomed view at `zoom` (deferred while
+    // `zoomSettled` is false), or requests re-attach when already detached.
+    // Returns true if now (still) detached or a detach is pending.
+    bool toggle(float zoom, bool zoomSettled = true)
+    {
+        if (detached_)
+        {
+            reattachRequested_ = true;
+            return true;
+        }
+        if (pending_)
+        {
+            pending_ = false;
+            return false;
+        }
+        if (!zoomSettled)
+        {
+            pending_ = true;
+            return true;
+        }
+        return detach(zoom);
+    }
+
+    // Per-frame decision, after the zoom animation has ticked. A pending
+    // detach takes effect on the first settled frame, which still tracks so
+    // the final zoom step reaches the screen; the freeze starts next frame.
+    Frame frame(float zoom, bool zoomSettled = true)
+    {
+        if (pending_ && zoomSettled)
+        {
+            pending_ = false;
+            detach(zoom);
+            return Frame::Tracking;
+        }
+        if (!detached_)
+            return Frame::Tracking;
+        if (reattachRequested_ || zoom != frozenZoom_)
+        {
+            detached_ = false;
+            reattachRequested_ = false;
+            return Frame::Reattach;
+        }
+        return Frame::Frozen;
+    }
+
+    bool detached() const { return detached_; }
+    bool pending() const { return pending_; }
+
+private:
+    bool detach(float zoom)
+    {
+        if (zoom <= 1.0f)
+            return false;
+        detached_ = true;
+        reattachRequested_ = false;
+        frozenZoom_ = zoom;
+        return true;
+    }
+
+    float frozenZoom_ = 1.0f;
+    bool detached_ = false;
+    bool pending_ = false;
+    bool reattachRequested_ = false;
+};
+
+} // namespace SmoothZoom
@@ -5,7 +5,11 @@
 // Doc 3 §3.6
 // =============================================================================
 
+#include "smoothzoom/common/MonitorTable.h"
 #include "smoothzoom/common/Types.h"
+#include "smoothzoom/logic/CaretMotionModel.h"
+#include "smoothzoom/logic/SourceArbiter.h"
+#include <cstddef>
 
 namespace SmoothZoom
 {
@@ -19,6 +23,155 @@ public:
         float y = 0.0f;
     };
 
+    // Valid offset range for a screen region at a zoom: the region's physical
+    // area may only show its own virtual area (no panning past desktop edges).
+    struct OffsetBounds
+    {
+        float minX = 0.0f;
+        float minY = 0.0f;
+        float maxX = 0.0f;
+        float maxY = 0.0f;
+    };
+
+    static OffsetBounds offsetBounds(float zoom, int32_t screenW, int32_t screenH,
+                                     int32_t originX = 0, int32_t originY = 0);
+    static Offset clampOffset(const Offset& offset, const OffsetBounds& bounds);
+
+    // Region a source targeting (x, y) is confined to under `scope`: the
+    // virtual desktop (Unified) or the monitor containing / nearest (x, y)
+    // (ActiveMonitor). Falls back to `virtualDesktop` with no monitors cached.
+    static ScreenRect scopeRegion(ZoomScope scope, const MonitorTable& monitors,
+                                  const ScreenRect& virtualDesktop, int32_t x, int32_t y);
+
+    // Pan between tracking sources (Doc 3 §3.4): when the active source
+    // changes, the viewport moves from where it was to the new source's target
+    // instead of snapping. Duration grows with the log of the on-screen distance,
+    // so a 20 px hop is quick and a jump across monitors isn't disorienting.
+    // The path is a cubic Hermite in closed form (no integration), evaluated on
+    // accumulated frame dt, so it is identical at any refresh rate. A pan that
+    // interrupts another starts with that pan's velocity, so the view never
+    // jerks; the carried velocity is limited so the path stays monotone (no
+    // overshoot past the target, no reversal past the start).
+    class PanAnimator
+    {
+    public:
+        // duration = kMinDurationMs + kMsPerDoubling · log2(1 + d / kDistanceRefPx),
+        // d in screen px, clamped to [kMinDurationMs, kMaxDurationMs].
+        static constexpr float kMinDurationMs = 80.0f;
+        static constexpr float kMaxDurationMs = 400.0f;
+        static constexpr float kMsPerDoubling = 40.0f;
+        static constexpr float kDistanceRefPx = 25.0f;
+
+        static float durationForDistance(float screenDistancePx);
+
+        // Start a pan from `from` toward `target` (offsets in virtual px); the
+        // distance is measured in screen px at `zoom`. An active pan's current
+        // velocity carries over.
+        void begin(const Offset& from, const Offset& target, float zoom);
+        void cancel() { active_ = false; }
+        bool active() const { return active_; }
+        float durationMs() const { return durationMs_; }
+
+        // Advance by dtSeconds and return the offset toward `target` (which may
+        // move while the pan runs). Returns `target` unchanged (and ends the
+        // pan) once complete.
+        Offset advance(const Offset& target, float dtSeconds);
+
+        // Velocity (virtual px/s) at the last advance(); zero when idle.
+        Offset velocity() const;
+
+    private:
+        Offset from_;
+        Offset carry_;      // carried velocity × duration (virtual px)
+        Offset lastTarget_;
+        float elapsedMs_ = 0.0f;
+        float durationMs_ = kMinDurationMs;
+        bool active_ = false;
+    };
+
+    // Edge-push tracking parameters (PointerTrackingMode::EdgePush).
+    struct EdgePushParams
+    {
+        // Inset band on each side, as a fraction of the screen dimension. The
+        // viewport is still while the pointer stays inside the band's inner edge.
+        float marginFraction = 0.1f;
+        // Pan speed (screen px/s) with the pointer at the outer screen edge;
+        // proportional to how deep the pointer is into the band.
+        float pushSpeedPx = 2000.0f;
+    };
+
+    // Sub-pixel remainder (screen px) at which an edge push finishes exactly on
+    // the band edge instead of creeping toward it, so the viewport comes to rest.
+    static constexpr float kEdgePushSettlePx = 0.5f;
+
+    // Keep-pointer-centered parameters (PointerTrackingMode::Centered).
+    struct CenteredParams
+    {
+        // Critically damped follow: time for the view to cover 95% of a pointer
+        // jump. Absorbs single-count mouse jitter; 0 locks the view to the pointer.
+        float followSec = 0.12f;
+    };
+
+    // ωt at which a critically damped step response reaches 95%:
+    // (1 + ωt)·e^(−ωt) = 0.05.
+    static constexpr float kCenteredFollowOmegaT = 4.744f;
+
+    // Screen-px error (and error per time constant of velocity) below which the
+    // centered follow snaps onto its goal and stops, so the view comes to rest.
+    static constexpr float kCenteredSettlePx = 0.5f;
+
+    // Offset plus velocity (virtual px/s) of a smoothed follow.
+    struct FollowState
+    {
+        Offset offset;
+        Offset velocity;
+    };
+
+    void setPointerTracking(PointerTrackingMode mode, const EdgePushParams& params)
+    {
+        pointerMode_ = mode;
+        edgePush_ = params;
+    }
+    void setCenteredFollow(const CenteredParams& params) { centered_ = params; }
+    PointerTrackingMode pointerTrackingMode() const { return pointerMode_; }
+
+    // Pointer-source offset for this frame under the configured tracking mode.
+    // `applied`/`appliedZoom` describe the transform currently on screen:
+    // Continuous ignores them; EdgePush and Centered continue from them
+    // (re-anchored across a zoom change) and return whole-source-pixel offsets.
+    // `monitor` is the pointer's monitor; Centered centers on it and keeps it
+    // showing only its own content (null: the whole screen region).
+    Offset trackPointer(int32_t pointerX, int32_t pointerY, float zoom,
+                        const Offset& applied, float appliedZoom, float dtSeconds,
+                        int32_t screenW, int32_t screenH,
+                        int32_t originX = 0, int32_t originY = 0,
+                        const ScreenRect* monitor = nullptr);
+
+    // Keep-pointer-centered step: follow the offset that puts the pointer at the
+    // monitor center with a critically damped spring (closed form, exact for any
+    // dt), clamped to both the screen-region and monitor offset bounds. Velocity
+    // along a clamped axis is dropped so the view doesn't stick to the edge.
+    static FollowState computeCenteredOffset(const FollowState& current,
+                                             int32_t pointerX, int32_t pointerY,
+                                             float zoom, const CenteredParams& params,
+                                             float dtSeconds, int32_t screenW, int32_t screenH,
+                                             int32_t originX = 0, int32_t originY = 0,
+                                             const ScreenRect* monitor = nullptr);
+
+    // Edge-push step: keep `current` while the pointer's screen position is
+    // inside the inset band; otherwise pan toward the band edge (never letting
+    // the pointer leave the screen). Frame-rate independent (closed-form decay).
+    static Offset computeEdgePushOffset(const Offset& current,
+                                        int32_t pointerX, int32_t pointerY,
+                                        float zoom, const EdgePushParams& params,
+                                        float dtSeconds, int32_t screenW, int32_t screenH,
+                                        int32_t originX = 0, int32_t originY = 0);
+
+    // Offset at `toZoom` that keeps the pointer's screen position (and so the
+    // desktop content under it) where it was at `fromZoom` with `current`.
+    static Offset reanchorOffset(const Offset& current, int32_t pointerX, int32_t pointerY,
+                                 float fromZoom, float toZoom);
+
     // Core proportional mapping: desktopX under pointer == pointerX (Doc 3 §3.6)
     // originX/originY: virtual screen origin (SM_XVIRTUALSCREEN, SM_YVIRTUALSCREEN)
     static Offset computePointerOffset(int32_t pointerX, int32_t pointerY,
@@ -39,8 +192,14 @@ public:
                                      float zoom, int32_t screenW, int32_t screenH,
                                      int32_t originX = 0, int32_t originY = 0);
 
-    // Determine active tracking source based on timestamps and priorities (Doc 3 §3.4)
-    // Priority: Caret (if typing within caretIdleMs) > Focus (if recent, debounced) > Pointer
+    // Scored multi-source arbitration with hysteresis (Doc 3 §3.4). RenderLoop
+    // publishes one candidate per source each frame and calls arbitrate().
+    SourceArbiter& arbiter() { return arbiter_; }
+    const SourceArbiter& arbiter() const { return arbiter_; }
+
+    // Stateless arbitration of the three built-in sources under the current
+    // policy table (no hysteresis). With the default table:
+    // Caret (if typing within caretIdleMs) > Focus (if recent, debounced) > Pointer
     TrackingSource determineActiveSource(int64_t now,
                                           int64_t lastPointerMoveTime,
                                           int64_t lastFocusChangeTime,
@@ -49,14 +208,70 @@ public:
                                           bool caretRectValid) const;
 
     // Caret offset with lookahead margin (AC-2.6.06)
-    // Shifts target ahead of caret in typing direction so user can see upcoming text.
+    // Re-centers on the caret, shifted a fixed kCaretLookaheadFraction to the right.
     static Offset computeCaretOffset(const ScreenRect& caretRect,
                                       float zoom, int32_t screenW, int32_t screenH,
                                       int32_t originX = 0, int32_t originY = 0);
 
+    // ── Batch kernels (ViewportTrackerBatch.cpp) ──
+    // Structure-of-arrays variants of the offset functions above for many
+    // points / rects against one zoom and screen region (candidate scoring,
+    // offline analysis). Per-call constants (1/zoom, bounds, monitor center)
+    // are computed once; elements are evaluated 8 (AVX2) or 4 (SSE2) at a
+    // time, remainder and non-x86 builds through the scalar functions. Results
+    // are bit-identical to the scalar functions element for element.
+    struct PointBatch
+    {
+        const int32_t* x = nullptr;
+        const int32_t* y = nullptr;
+        size_t count = 0;
+    };
+    struct RectBatch
+    {
+        const int32_t* left = nullptr;
+        const int32_t* top = nullptr;
+        const int32_t* right = nullptr;
+        const int32_t* bottom = nullptr;
+        size_t count = 0;
+    };
+    struct OffsetBatch
+    {
+        float* x = nullptr; // `count` entries each
+        float* y = nullptr;
+    };
+
+    static void computePointerOffsets(const PointBatch& points, float zoom,
+                                      int32_t screenW, int32_t screenH,
+                                      int32_t originX, int32_t originY, const OffsetBatch& out);
+    static void computeElementOffsets(const RectBatch& rects, float zoom,
+                                      int32_t screenW, int32_t screenH,
+                                      int32_t originX, int32_t originY, const OffsetBatch& out);
+    static void computeFocusOffsets(float currentOffsetX, float currentOffsetY,
+                                    const RectBatch& rects, float zoom,
+                                    int32_t screenW, int32_t screenH,
+                                    int32_t originX, int32_t originY, const OffsetBatch& out);
+    static void computeCaretOffsets(const RectBatch& rects, float zoom,
+                                    int32_t screenW, int32_t screenH,
+                                    int32_t originX, int32_t originY, const OffsetBatch& out);
+
+    // Instruction set the batch kernels were compiled for: "avx2", "sse2" or "scalar".
+    static const char* batchKernelIsa();
+
+    // Edge-triggered caret follow (AC-2.6.06): keeps `current` while the caret
+    // is on screen and at least |lookahead| of the viewport from the edge it is
+    // moving toward; otherwise re-centers on it, shifted by `lookahead` (from
+    // CaretMotionModel) so the space ahead of the caret is revealed. Each axis
+    // is decided separately; the result is clamped to the monitor's bounds.
+    static Offset computeCaretFollowOffset(float currentOffsetX, float currentOffsetY,
+                                           const ScreenRect& caretRect,
+                                           const CaretLookahead& lookahead,
+                                           float zoom, int32_t screenW, int32_t screenH,
+                                           int32_t originX = 0, int32_t originY = 0);
+
     // Tunable thresholds (milliseconds)
-    static constexpr int64_t kCaretIdleTimeoutMs = 500;   // AC-2.6.07: caret priority while typing
-    static constexpr int64_t kFocusDebounceMs    = 100;   // AC-2.5.07: debounce rapid focus changes
+    // (defaults of the SourceArbiter policy table)
+    static constexpr int64_t kCaretIdleTimeoutMs = SmoothZoom::kCaretIdleTimeoutMs; // AC-2.6.07: caret priority while typing
+    static constexpr int64_t kFocusDebounceMs    = SmoothZoom::kFocusDebounceMs;    // AC-2.5.07: debounce rapid focus changes
 
     // Lookahead margin: fraction of viewport width ahead of caret (AC-2.6.06)
     static constexpr float kCaretLookaheadFraction = 0.15f; // ~15% of viewport width
@@ -64,6 +279,14 @@ public:
     // Reveal margin when panning a clipped focus element into view (AC-2.5.06).
     // Virtual (pre-zoom) pixels kept between the element edge and the screen edge.
     static constexpr float kFocusRevealMarginPx = 40.0f;
+
+private:
+    PointerTrackingMode pointerMode_ = PointerTrackingMode::Continuous;
+    EdgePushParams edgePush_;
+    CenteredParams centered_;
+    FollowState followState_;     // unrounded edge-push/centered state from last frame
+    bool followStateValid_ = false;
+    SourceArbiter arbiter_;
 };
 
 } // namespace SmoothZoom
@@ -22,12 +22,25 @@ public:
     // Scroll-gesture zoom: consume accumulated delta, compute new level
     void applyScrollDelta(int32_t accumulatedDelta);
 
+    // Touchpad pinch: multiply the zoom by e^logZoomDelta (finger-distance
+    // ratio = zoom ratio). Enters Scrolling like a scroll, but bypasses the
+    // scroll sensitivity, soft-margin attenuation and wheel glide — only the
+    // hard bounds and snap apply.
+    void applyPinchLogZoom(float logZoomDelta);
+
     // End an active scroll gesture: Scrolling → Idle (no-op in Idle/Animating).
     // Called by RenderLoop on a frame with no scroll input so the controller
     // settles into Idle, enabling the 1.0× idle short-circuit (AC-2.3.13, R-18).
     // A subsequent scroll re-enters Scrolling via applyScrollDelta().
+    // With wheel smoothing, waits until the notch glide has reached its target.
     void endScroll();
 
+    // Optional notched-wheel smoothing (ZoomCurve.h). When enabled, whole-notch
+    // deltas glide to an accumulating target within latencySec (clamped to
+    // 8–50 ms); sub-notch touchpad deltas stay direct. Set by the render thread
+    // alongside applySettings().
+    void setWheelSmoothing(bool enabled, float latencySec);
+
     // Keyboard step: set animation target (+1 = zoom in, -1 = zoom out)
     void applyKeyboardStep(int direction);
 
@@ -38,6 +51,24 @@ public:
     // Animate to an arbitrary target zoom (Win+Esc → 1.0×, Phase 4 toggle, etc.)
     void animateToZoom(float target);
 
+    // Shared animation entry point. durationSec == 0 → exponential ease-out
+    // (animateToZoom); > 0 → one planned log-space segment of that duration
+    // (preset jumps). Clamps/snaps the target; no-op if already there.
+    void beginAnimation(float target, float durationSec);
+
+    // Zoom presets (SettingsSnapshot::zoomPresets). Copied into a fixed array —
+    // no allocation. Entries beyond kMaxPresets are ignored.
+    static constexpr int kMaxPresets = 6;
+    void setZoomPresets(const float* presets, int count);
+
+    // Jump to preset `index` (0-based) as a single planned animation whose
+    // duration scales with the log-distance (ZoomCurve.h planDurationSec).
+    void jumpToPreset(int index);
+
+    // Advance to the next preset: from a preset, the next table entry (wrapping);
+    // otherwise the smallest preset above the current target (else the first).
+    void cyclePreset();
+
     // Phase 4: Temporary toggle (hold-to-peek) — AC-2.7.01 through AC-2.7.10
     void engageToggle();
     void releaseToggle();
@@ -55,6 +86,20 @@ public:
                        float defaultZoomLevel, int animationSpeed,
                        float scrollSensitivity = 1.0f);
 
+    // Output-pixel-aware quantization (optional, default off). Set by the render
+    // thread alongside applySettings(). integerTolerance: snap to an integer
+    // factor when within this distance of it (see ZoomQuantizer.h).
+    void setQuantization(bool enabled, float integerTolerance);
+
+    // Quantization tick: call once per frame after tick()/endScroll() with the
+    // active monitor's output width. After kQuantizeSettleDelaySec at rest,
+    // glides currentZoom onto the grid in sub-pixel steps. Never runs while
+    // Scrolling/Animating. Returns true if zoom changed this frame.
+    bool tickQuantize(float dtSeconds, int32_t extentPx);
+
+    // True when resting on the quantization grid (offsets may be snapped too).
+    bool isQuantized() const { return quantized_; }
+
     // Reset to 1.0× instantly (shutdown path)
     void reset();
 
@@ -73,6 +118,16 @@ private:
 
     // Animation ease-out rate (configurable via animationSpeed setting)
     double easeOutRate_ = 0.15;  // Default: normal speed
+    int animationSpeed_ = 1;     // 0=slow, 1=normal, 2=fast (plan durations)
+
+    // Planned segment (preset jumps). planDuration_ == 0 → exponential ease-out.
+    float planFromZoom_ = 1.0f;
+    float planElapsed_ = 0.0f;
+    float planDuration_ = 0.0f;
+
+    // Zoom presets
+    float presets_[kMaxPresets] = {1.0f, 2.5f, 6.0f};
+    int presetCount_ = 3;
 
     // Scroll-gesture sensitivity multiplier (configurable via settings, A3).
     // Scales the normalized scroll delta before the logarithmic zoom model so
@@ -80,10 +135,22 @@ private:
     // touchpad feel). 1.0 = default.
     float scrollSensitivity_ = 1.0f;
 
+    // Notched-wheel glide latency budget (seconds); 0 = direct (default).
+    // While gliding, targetZoom_ is the accumulated scroll target.
+    float wheelSmoothingSec_ = 0.0f;
+
     // Phase 4: Toggle state
     bool isToggled_ = false;
     float savedZoomForToggle_ = 1.0f;
     float lastUsedZoom_ = 2.0f;  // Default per AC-2.7.05
+
+    // Resting-zoom quantization (ZoomQuantizer.h)
+    bool quantizeEnabled_ = false;
+    float quantizeIntegerTolerance_ = 0.05f;
+    float quantizeIdleSec_ = 0.0f;     // time at rest since last input
+    float quantizeTarget_ = 0.0f;      // grid zoom being glided to (0 = none yet)
+    int32_t quantizeExtentPx_ = 0;     // extent the target was computed for
+    bool quantized_ = false;
 };
 
 } // namespace SmoothZoom
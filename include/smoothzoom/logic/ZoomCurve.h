@@ -0,0 +1,212 @@
+#pragma once
+// =============================================================================
+// SmoothZoom — Zoom Curve
+// Tuning constants and the pure per-step math behind ZoomController. Doc 3 §3.5
+//
+// Single source of truth for the zoom curve: ZoomController (live, one
+// instance on the render thread) and ZoomSimulation (offline batch, many
+// parameter sets at once) both evaluate these inline functions, so a curve
+// tuned in the simulator behaves identically in the shipped controller.
+//
+// Pure logic — no Win32 API dependencies (CI-safe, unit-tested).
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace SmoothZoom
+{
+
+// One standard wheel notch in WHEEL_DELTA units.
+inline constexpr float kZoomWheelDelta = 120.0f;
+
+// Logarithmic zoom factor per notch (AC-2.1.06): newZoom = currentZoom * pow(kScrollZoomBase, normalizedDelta)
+// 1.1 = 10% per notch at any zoom level. 1×→2× requires same scroll effort as 5×→10×.
+inline constexpr float kScrollZoomBase = 1.1f;
+
+// Epsilon for snapping to 1.0× and maxZoom (R-17)
+inline constexpr float kSnapEpsilon = 0.005f;
+
+// Exponential ease-out reference rate (render-loop.md, AC-2.2.05)
+// Used as: alpha = 1.0 - pow(1.0 - easeOutRate, dt * kReferenceHz)
+// Speed variants: slow=0.08, normal=0.15, fast=0.25
+inline constexpr double kEaseOutRateSlow   = 0.08;
+inline constexpr double kEaseOutRateNormal = 0.15;
+inline constexpr double kEaseOutRateFast   = 0.25;
+inline constexpr double kReferenceHz = 60.0;
+
+// Soft-approach margin as fraction of log-range near bounds (AC-2.1.15)
+inline constexpr float kSoftMarginFraction = 0.15f;
+
+// Every tunable that shapes the zoom curve. Defaults are the shipped values;
+// ZoomController carries the settings-driven fields (bounds, step, rate,
+// sensitivity) itself and uses the compile-time constants for the rest.
+struct ZoomCurveParams
+{
+    float  scrollZoomBase     = kScrollZoomBase;
+    float  softMarginFraction = kSoftMarginFraction;
+    float  snapEpsilon        = kSnapEpsilon;
+    double easeOutRate        = kEaseOutRateNormal;
+    float  minZoom            = 1.0f;
+    float  maxZoom            = 10.0f;
+    float  keyboardStep       = 0.25f;
+    float  scrollSensitivity  = 1.0f;
+    float  wheelSmoothingSec  = 0.0f;  // notch glide latency budget; 0 = direct
+};
+
+// Clamp to [minZoom, maxZoom] and snap within epsilon of 1.0× and max (R-17).
+inline float clampSnapZoom(float zoom, float minZoom, float maxZoom, float snapEpsilon)
+{
+    zoom = std::clamp(zoom, minZoom, maxZoom);
+    if (std::abs(zoom - 1.0f) < snapEpsilon)
+        zoom = 1.0f;
+    if (std::abs(zoom - maxZoom) < snapEpsilon)
+        zoom = maxZoom;
+    return zoom;
+}
+
+// Scroll-gesture step: apply an accumulated wheel delta to `currentZoom`.
+// Logarithmic model (AC-2.1.06) with soft-approach attenuation near the bounds
+// (AC-2.1.15), then hard clamp + snap (R-17).
+inline float scrollZoomStep(float currentZoom, int32_t accumulatedDelta,
+                            float minZoom, float maxZoom, float scrollSensitivity,
+                            float scrollZoomBase, float softMarginFraction,
+                            float snapEpsilon)
+{
+    // Each 120-unit notch multiplies zoom by scrollZoomBase. Sub-notch deltas
+    // (Precision Touchpad) scale proportionally. scrollSensitivity scales the
+    // effective input so users can tune zoom rate across devices (A3).
+    float normalizedDelta =
+        static_cast<float>(accumulatedDelta) / kZoomWheelDelta * scrollSensitivity;
+
+    // Soft-approach bounds attenuation (AC-2.1.15):
+    // As zoom nears min or max, attenuate the delta to decelerate smoothly.
+    float logMin = std::log(minZoom);
+    float logMax = std::log(maxZoom);
+    float logRange = logMax - logMin;
+    float margin = logRange * softMarginFraction;
+    float logCurrent = std::log(currentZoom);
+
+    if (normalizedDelta > 0.0f && logCurrent > logMax - margin)
+    {
+        // Approaching upper bound — attenuate
+        float t = (logCurrent - (logMax - margin)) / margin;
+        t = std::clamp(t, 0.0f, 1.0f);
+        float attenuation = 1.0f - t * t; // quadratic ease to zero
+        normalizedDelta *= attenuation;
+    }
+    else if (normalizedDelta < 0.0f && logCurrent < logMin + margin)
+    {
+        // Approaching lower bound — attenuate
+        float t = ((logMin + margin) - logCurrent) / margin;
+        t = std::clamp(t, 0.0f, 1.0f);
+        float attenuation = 1.0f - t * t;
+        normalizedDelta *= attenuation;
+    }
+
+    float newZoom = currentZoom * std::pow(scrollZoomBase, normalizedDelta);
+
+    // Hard clamp to bounds (safety net after soft approach) + snap (R-17)
+    return clampSnapZoom(newZoom, minZoom, maxZoom, snapEpsilon);
+}
+
+// Keyboard step target: multiplicative step for logarithmic consistency
+// (AC-2.1.06, AC-2.2.06, AC-2.8.07). direction=+1 → target *= (1 + step),
+// direction=-1 → target /= (1 + step).
+inline float keyboardStepTarget(float targetZoom, int direction, float keyboardStep,
+                                float minZoom, float maxZoom, float snapEpsilon)
+{
+    float newTarget = targetZoom * std::pow(1.0f + keyboardStep, static_cast<float>(direction));
+    return clampSnapZoom(newTarget, minZoom, maxZoom, snapEpsilon);
+}
+
+// Frame-rate-independent ease-out blend factor (render-loop.md, AC-2.2.05):
+// at 60fps alpha≈easeOutRate, at 144fps alpha≈0.065 for the normal rate.
+// Non-positive dt falls back to one reference frame; dt is clamped to 100 ms to
+// avoid huge jumps (debugger break, system sleep).
+inline double easeOutAlpha(double easeOutRate, double dt)
+{
+    if (dt <= 0.0)
+        dt = 1.0 / kReferenceHz;
+    if (dt > 0.1)
+        dt = 0.1;
+    return 1.0 - std::pow(1.0 - easeOutRate, dt * kReferenceHz);
+}
+
+// Notched-wheel smoothing (optional). A whole-notch delta (multiple of 120)
+// moves the scroll target; currentZoom glides toward it in log space with
+// alpha = 1 − exp(−dt/τ), τ = budget/3, so ≥95% of each notch is shown within
+// the latency budget at any refresh rate. Sub-notch (touchpad / hi-res) deltas
+// stay direct.
+inline constexpr float kWheelSmoothingDefaultSec = 0.033f; // ~2 frames @60Hz
+inline constexpr float kWheelSmoothingMinSec     = 0.008f;
+inline constexpr float kWheelSmoothingMaxSec     = 0.050f;
+
+inline bool isNotchedDelta(int32_t accumulatedDelta)
+{
+    return accumulatedDelta != 0
+        && accumulatedDelta % static_cast<int32_t>(kZoomWheelDelta) == 0;
+}
+
+// Glide blend factor for a latency budget. Same dt fallback/clamp as easeOutAlpha.
+inline double wheelGlideAlpha(double budgetSec, double dt)
+{
+    if (dt <= 0.0)
+        dt = 1.0 / kReferenceHz;
+    if (dt > 0.1)
+        dt = 0.1;
+    return 1.0 - std::exp(-dt * 3.0 / budgetSec);
+}
+
+// One glide step in log space; lands exactly on target within snapEpsilon.
+inline float wheelGlideStep(float currentZoom, float targetZoom, double alpha, float snapEpsilon)
+{
+    double logCur = std::log(static_cast<double>(currentZoom));
+    double logTgt = std::log(static_cast<double>(targetZoom));
+    double next = std::exp(logCur + (logTgt - logCur) * alpha);
+    if (std::abs(next - static_cast<double>(targetZoom)) < static_cast<double>(snapEpsilon))
+        return targetZoom;
+    return static_cast<float>(next);
+}
+
+// Planned (fixed-duration) transitions — preset jumps. Doc 3 §3.5
+// A multi-level jump is one log-space ease-out segment whose duration grows with
+// the log-distance covered, so 1×→6× takes visibly longer than 2×→2.5× but far
+// less than the equivalent chain of keyboard steps.
+inline constexpr float kPlanBaseSec       = 0.12f;  // floor for tiny jumps
+inline constexpr float kPlanSecPerLogUnit = 0.12f;  // + per unit of |ln(to/from)|
+inline constexpr float kPlanMaxSec        = 0.6f;   // cap (1×→10× at slow speed)
+
+// Duration of a planned transition from→to at the given animationSpeed
+// (0=slow, 1=normal, 2=fast).
+inline float planDurationSec(float fromZoom, float toZoom, int animationSpeed)
+{
+    float logDistance = std::abs(std::log(toZoom / fromZoom));
+    float scale = (animationSpeed == 0) ? 1.5f : (animationSpeed == 2) ? 0.6f : 1.0f;
+    return std::min((kPlanBaseSec + kPlanSecPerLogUnit * logDistance) * scale, kPlanMaxSec);
+}
+
+// Planned-segment progress → zoom: cubic ease-out applied in log space, so the
+// perceived zoom rate is uniform across levels (AC-2.1.06). t in [0, 1].
+inline float planZoomAt(float fromZoom, float toZoom, float t)
+{
+    t = std::clamp(t, 0.0f, 1.0f);
+    float u = 1.0f - t;
+    float eased = 1.0f - u * u * u;
+    float logFrom = std::log(fromZoom);
+    return std::exp(logFrom + (std::log(toZoom) - logFrom) * eased);
+}
+
+// Map the animationSpeed setting (0=slow, 1=normal, 2=fast) to an ease-out rate.
+inline double easeOutRateForSpeed(int animationSpeed)
+{
+    switch (animationSpeed)
+    {
+    case 0:  return kEaseOutRateSlow;
+    case 2:  return kEaseOutRateFast;
+    default: return kEaseOutRateNormal;
+    }
+}
+
+} // namespace SmoothZoom
@@ -0,0 +1,123 @@
+#pragma once
+// =============================================================================
+// SmoothZoom — Zoom Quantizer
+// Output-pixel-aware resting zoom. Doc 3 §3.5
+//
+// A resting zoom of e.g. 3.4172× resamples text unevenly (shimmer as the
+// pointer pans) and never reproduces the same transform twice. Once zoom has
+// settled, the quantizer picks a nearby "grid" zoom at which a whole number
+// of source pixels exactly spans the monitor's output extent — i.e. source
+// pixels map to the rational extent/span output pixels — preferring an
+// integer factor when one is within the user tolerance.
+//
+// The move onto the grid is a glide, never a snap: each frame the zoom may
+// change only by an amount that displaces any on-screen pixel by at most
+// kQuantizeMaxStepPx (proof: a desktop point at screen distance d from the
+// zoom anchor moves by d·Δz/z, and d ≤ extent). The budget is paid out per
+// reference-rate frame (quantizeStepBudgetPx), so the glide takes the same
+// wall time on a 60 Hz and a 240 Hz display.
+//
+// Pure logic — no Win32 API dependencies (CI-safe, unit-tested).
+// =============================================================================
+
+#include "smoothzoom/logic/ZoomCurve.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace SmoothZoom
+{
+
+// Largest per-frame on-screen displacement (output px) a quantization glide may
+// cause. Well under one pixel, so the correction is invisible.
+inline constexpr float kQuantizeMaxStepPx = 0.25f;
+
+// Zoom must have been at rest this long before quantization starts, so it never
+// competes with a scroll gesture or ease-out that is still in progress.
+inline constexpr float kQuantizeSettleDelaySec = 0.15f;
+
+// Nearest grid zoom for a monitor `extentPx` output pixels wide.
+// Integer factors win when within integerTolerance; otherwise the zoom at which
+// the visible source span is a whole number of pixels. Result is kept within
+// [minZoom, maxZoom]; 1.0× (and any zoom ≤ 1) is returned unchanged.
+inline float quantizeZoom(float zoom, int32_t extentPx, float integerTolerance,
+                          float minZoom, float maxZoom)
+{
+    if (zoom <= 1.0f || extentPx <= 0)
+        return zoom;
+
+    float nearestInt = std::round(zoom);
+    if (std::abs(zoom - nearestInt) <= integerTolerance
+        && nearestInt >= minZoom && nearestInt <= maxZoom)
+    {
+        return nearestInt;
+    }
+
+    const float extent = static_cast<float>(extentPx);
+    float span = std::round(extent / zoom);
+    if (span < 1.0f)
+        span = 1.0f;
+    float grid = extent / span;
+
+    // Keep inside bounds: step the span by one pixel back toward the range.
+    if (grid > maxZoom)
+        grid = extent / (span + 1.0f);
+    if (grid < minZoom && span > 1.0f)
+        grid = extent / (span - 1.0f);
+    if (grid < minZoom || grid > maxZoom)
+        return zoom;
+    return grid;
+}
+
+// Per-frame displacement budget for a frame of dtSeconds: kQuantizeMaxStepPx per
+// reference (60 Hz) frame, pro rata. Capped at one reference frame's worth, so
+// a slower display or a stalled frame glides slower rather than stepping
+// visibly. dt ≤ 0 (first frame) moves nothing.
+inline float quantizeStepBudgetPx(float dtSeconds)
+{
+    if (dtSeconds <= 0.0f)
+        return 0.0f;
+    float frames = dtSeconds * static_cast<float>(kReferenceHz);
+    return kQuantizeMaxStepPx * std::min(frames, 1.0f);
+}
+
+// Largest zoom change allowed this frame at `zoom` so that no pixel of an
+// `extentPx`-wide view moves more than maxStepPx.
+inline float quantizeMaxZoomStep(float zoom, int32_t extentPx, float maxStepPx)
+{
+    if (extentPx <= 0)
+        return 0.0f;
+    return maxStepPx * zoom / static_cast<float>(extentPx);
+}
+
+// Worst-case on-screen displacement (output px) of changing zoom from→to on an
+// `extentPx`-wide view, for any anchor inside the view.
+inline float quantizeDisplacementPx(float fromZoom, float toZoom, int32_t extentPx)
+{
+    float lo = std::min(fromZoom, toZoom);
+    return static_cast<float>(extentPx) * std::abs(toZoom - fromZoom) / lo;
+}
+
+// One glide step from `zoom` toward `grid`, bounded by kQuantizeMaxStepPx
+// (evaluated at the smaller of the two zooms, so the bound holds both ways).
+inline float quantizeStepToward(float zoom, float grid, int32_t extentPx,
+                                float maxStepPx = kQuantizeMaxStepPx)
+{
+    float maxStep = quantizeMaxZoomStep(std::min(zoom, grid), extentPx, maxStepPx);
+    // Land exactly on the grid value once within one step.
+    if (std::abs(grid - zoom) <= maxStep)
+        return grid;
+    return (grid > zoom) ? zoom + maxStep : zoom - maxStep;
+}
+
+// Resting offset on the integer source-pixel grid the Magnification API applies
+// (MagSetFullscreenTransform takes int offsets; MagBridge truncates). Snapping the
+// float here produces the identical on-screen result — no jump — while giving the
+// render loop a stable value, so sub-pixel noise no longer re-issues an
+// unchanged transform.
+inline float quantizeOffset(float offset)
+{
+    return std::trunc(offset);
+}
+
+} // namespace SmoothZoom
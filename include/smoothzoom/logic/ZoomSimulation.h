@@ -0,0 +1,81 @@
+#pragma once
+// =============================================================================
+// SmoothZoom — ZoomSimulation
+// Offline batch simulation of the zoom curve for tuning. Doc 3 §3.5
+//
+// Replays one timestamped input stream (scroll deltas, keyboard steps, reset /
+// toggle commands) against many ZoomCurveParams sets at once and writes the
+// per-frame zoom trajectory of every set. Per-frame semantics mirror
+// RenderLoop::frameTick + ZoomController exactly (commands → scroll → tick →
+// endScroll) and the math is the shared ZoomCurve.h code, so with default
+// parameters a lane reproduces the live controller bit-for-bit.
+//
+// State is kept structure-of-arrays across parameter sets: the inner loop of
+// every frame runs over lanes with no virtual calls and select-style updates,
+// which keeps it auto-vectorizable.
+//
+// Pure logic — no Win32 API dependencies (CI-safe, unit-tested).
+// =============================================================================
+
+#include "smoothzoom/logic/ZoomCurve.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace SmoothZoom
+{
+
+// Discrete commands carried by a simulated frame (bit flags). Applied in this
+// bit order, before the frame's scroll delta — the order RenderLoop drains them.
+enum ZoomSimCommand : uint8_t
+{
+    kZoomSimNone          = 0,
+    kZoomSimReset         = 1u << 0,  // Win+Esc → animateToZoom(1.0)
+    kZoomSimToggleEngage  = 1u << 1,  // Ctrl+Alt press
+    kZoomSimToggleRelease = 1u << 2,  // Ctrl+Alt release
+    kZoomSimTrayToggle    = 1u << 3,  // tray one-shot toggle
+};
+
+// One render frame of simulated input. dt for a frame is the difference to the
+// previous frame's timeSec (the first frame measures from t = 0).
+struct ZoomSimEvent
+{
+    float   timeSec     = 0.0f;
+    int32_t scrollDelta = 0;   // accumulated wheel units this frame (0 = none)
+    int8_t  keyStep     = 0;   // +1 zoom-in step, -1 zoom-out step, 0 = none
+    uint8_t commands    = kZoomSimNone;
+};
+
+// Parameter set for one simulated lane. Extends the curve tunables with the
+// settings fields that influence a session but are not part of the curve.
+struct ZoomSimParams
+{
+    ZoomCurveParams curve;
+    float defaultZoomLevel = 2.0f;  // toggle-from-1.0× target (AC-2.7.05)
+};
+
+// Simulate every parameter set over the same event stream.
+// trajectory must hold eventCount * paramCount floats and is written
+// frame-major: trajectory[frame * paramCount + lane] = zoom after that frame.
+void simulateZoomBatch(const ZoomSimEvent* events, size_t eventCount,
+                       const ZoomSimParams* params, size_t paramCount,
+                       float* trajectory);
+
+// Summary metrics for one lane's trajectory, used by the sweep tool to compare
+// curves quantitatively instead of by feel.
+struct ZoomSimMetrics
+{
+    float finalZoom       = 1.0f;
+    float peakZoom        = 1.0f;
+    // Seconds from the last input frame to the frame the zoom last changed
+    // (the final snap to target). 0 when nothing moved after the last input.
+    float settleTimeSec   = 0.0f;
+    // Largest single-frame |log(zoom) change| — the visible "jerk" of a curve.
+    float maxFrameLogStep = 0.0f;
+};
+
+// Summarize lane `lane` of a frame-major trajectory produced by simulateZoomBatch.
+ZoomSimMetrics summarizeZoomTrajectory(const ZoomSimEvent* events, size_t eventCount,
+                                       const float* trajectory, size_t paramCount,
+                                       size_t lane);
+
+} // namespace SmoothZoom
@@ -6,6 +6,8 @@
 // Phase 5A: JSON persistence, validation, atomic snapshot distribution.
 // =============================================================================
 
+#include "smoothzoom/input/KeyBindings.h"
+#include <array>
 #include <atomic>
 #include <cstdint>
 #include <memory>
@@ -22,6 +24,27 @@ namespace SmoothZoom
 // default of changed fields.)
 inline constexpr int kSettingsSchemaVersion = 1;
 
+// Maximum number of zoom presets (Modifier+Numpad1..6).
+inline constexpr int kMaxZoomPresets = 6;
+
+// Maximum number of hook slow-callback thresholds (HookServiceProfiler).
+inline constexpr int kMaxHookSlowThresholds = 4;
+
+// Maximum number of per-device touchpad profiles.
+inline constexpr int kMaxPtpDeviceProfiles = 8;
+
+// Per-touchpad tuning, matched by USB/Bluetooth VID:PID when the device arrives
+// (PtpDeviceRegistry.h). config.json stores an array of objects; vendorId and
+// productId take an integer or a "0x06CB"-style hex string.
+struct PtpDeviceProfile
+{
+    uint16_t vendorId           = 0;
+    uint16_t productId          = 0;
+    float    axisScale          = 1.0f;  // × device units per notch (0.25–4; >1 = less zoom per swipe)
+    float    sensitivity        = 1.0f;  // × this pad's scroll output (0.1–5); pinch is 1:1
+    bool     invertNaturalScroll = false; // driver pre-flips raw HID too: undo the natural-scroll sign fix
+};
+
 struct SettingsSnapshot
 {
     // Schema version this snapshot was loaded from (kSettingsSchemaVersion for a
@@ -46,6 +69,67 @@ struct SettingsSnapshot
     float   scrollSensitivity   = 1.0f;  // multiplier on scroll-gesture zoom rate
     bool    momentumZoom        = true;  // allow inertial/momentum scroll to drive zoom
 
+    // Notched-wheel smoothing: whole-notch deltas glide to their target within
+    // the latency budget instead of stepping in one frame. Touchpad stays direct.
+    bool    smoothWheelZoom     = false;
+    int     wheelSmoothingLatencyMs = 33;    // 8–50 ms (~1–3 frames)
+
+    // Zoom presets: Modifier+Numpad1..N jumps to entry N, Modifier+Numpad0
+    // cycles. config.json stores a plain array of 1–6 zoom levels.
+    std::array<float, kMaxZoomPresets> zoomPresets = {1.0f, 2.5f, 6.0f};
+    int     zoomPresetCount     = 3;
+
+    // Keyboard shortcuts (KeyBindings.h). config.json maps each command name
+    // to an array of chords ("zoomIn": ["Modifier+Plus", ...]); a listed
+    // command replaces its default chords, an empty array unbinds it.
+    std::array<KeyBinding, kMaxKeyBindings> keyBindings = defaultKeyBindingArray();
+    int     keyBindingCount     = kDefaultKeyBindingCount;
+
+    // Per-device touchpad profiles (first kMaxPtpDeviceProfiles valid entries;
+    // a later duplicate VID:PID is skipped).
+    std::array<PtpDeviceProfile, kMaxPtpDeviceProfiles> ptpDeviceProfiles = {};
+    int     ptpDeviceProfileCount = 0;
+
+    // Resting-zoom quantization (ZoomQuantizer.h): once settled, glide zoom onto
+    // an output-pixel grid, preferring integer factors within the tolerance.
+    bool    zoomQuantization    = false;
+    float   quantizeIntegerTolerance = 0.05f; // |zoom − round(zoom)|, 0–0.5
+
+    // Pointer tracking mode — mirrors PointerTrackingMode (0=Continuous,
+    // 1=EdgePush, 2=Centered). config.json stores "continuous"/"edge"/
+    // "centered"; an integer is also accepted. Edge push holds the viewport
+    // still until the pointer enters a margin band (percent of the screen per
+    // side), then pans at up to edgePushSpeedPx screen px/s. Centered keeps
+    // the pointer at the monitor center, following within centeredFollowMs
+    // (0 = locked, no smoothing).
+    int     pointerTrackingMode = 0;
+    int     edgePushMarginPct   = 10;    // 0–40
+    int     edgePushSpeedPx     = 2000;  // 200–20000
+    int     centeredFollowMs    = 120;   // 0–500
+
+    // R-19: speed-dependent damping of continuous pointer tracking at 4×+ so
+    // fast moves glide instead of teleporting. Opt-in: mid-flick the cursor
+    // may briefly leave the screen.
+    bool    pointerDamping      = false;
+
+    // Sub-frame pointer samples: the LL hook's moves and Raw Input's relative
+    // motion are published to the render thread, whose pointer filter then
+    // takes its speed from them instead of from once-per-frame positions.
+    // Off by default: adds work to every mouse move on the input threads.
+    bool    pointerSampleStream = false;
+
+    // Zoom scope — mirrors ZoomScope (0=Unified, 1=ActiveMonitor). config.json
+    // stores "unified"/"active"; an integer is also accepted. Unified treats all
+    // displays as one surface; active confines the view to the monitor under
+    // the pointer (or the focused element / caret) with per-monitor clamps.
+    int     zoomScope           = 0;
+
+    // Diagnostics: LL hook callbacks at or above each threshold are counted
+    // and logged with the hook latency (R-05). config.json stores a plain
+    // array of 1–4 values in ms (1–1000).
+    std::array<int, kMaxHookSlowThresholds> hookSlowThresholdsMs = {1, 10, 100};
+    int     hookSlowThresholdCount = 3;
+
     // Diagnostics: file/debug log verbosity. 0=Debug 1=Info 2=Warn 3=Error —
     // mirrors LogLevel in Logger.h (cast directly). config.json stores the
     // human-friendly string form ("debug"/"info"/"warn"/"error"); an integer
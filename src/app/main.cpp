@@ -35,8 +35,7 @@
 #include "smoothzoom/support/SettingsManager.h"
 #include "smoothzoom/support/TrayUI.h"
 #include "smoothzoom/support/Logger.h"
-#include "smoothzoom/input/ModifierUtils.h"
-#include "smoothzoom/input/ScrollNormalizer.h"
+#include "smoothzoom/input/RawInputWorker.h"
 
 #include <filesystem>
 #include <fstream>
@@ -47,13 +46,6 @@
 
 #pragma comment(lib, "Wtsapi32.lib")
 
-// Precision Touchpad HID report parsing (device-independent via HidP_* APIs)
-extern "C" {
-#include <hidusage.h>
-#include <hidpi.h>
-}
-#pragma comment(lib, "Hid.lib")
-
 // Global shared state — single instance, lifetime = application
 static SmoothZoom::SharedState g_sharedState;
 
@@ -62,6 +54,7 @@ static SmoothZoom::InputInterceptor g_inputInterceptor;
 static SmoothZoom::RenderLoop g_renderLoop;
 static SmoothZoom::FocusMonitor g_focusMonitor;   // Phase 3: UIA focus tracking
 static SmoothZoom::CaretMonitor g_caretMonitor;    // Phase 3: text caret tracking
+static SmoothZoom::RawInputWorker g_rawInputWorker; // Raw Input scroll fallback (PTP + mouse)
 static SmoothZoom::SettingsManager g_settingsManager; // Phase 5: config persistence
 static SmoothZoom::TrayUI g_trayUI;                    // Phase 5C: tray icon + settings
 static std::string g_configPath;                      // Resolved at startup
@@ -77,6 +70,10 @@ static constexpr UINT kTrayIconIntervalMs = 250;
 // Hook failure notification flag (AC-ERR.03) — suppress repeated balloons
 static bool s_hookFailureNotified = false;
 
+// Hook latency log cadence (R-05 evidence): every watchdog tick while the
+// settings window is open, otherwise once a minute.
+static constexpr int kHookLatencyLogTicks = 12;
+
 // Session lock state (AC-ERR.04) — suppress hook-failure balloons during lock/UAC
 static bool s_sessionLocked = false;
 
@@ -86,55 +83,13 @@ static bool s_trayIconShowsZoomed = false;
 // Sentinel path for dirty-shutdown detection (R-14, E6.11)
 static std::filesystem::path s_sentinelPath;
 
-// ── Precision Touchpad (PTP) HID Parsing State ──────────────────────────────
-// Parses raw HID contact reports to detect two-finger vertical pan gestures.
-// Needed because PTP drivers deliver scroll via WM_MOUSEWHEEL directly to the
-// foreground window, bypassing LL mouse hooks for Desktop/Edge.
-
-struct PtpContactSlot {
-    USHORT linkCollection;  // HID link collection index for this contact
-};
-
-struct PtpDeviceInfo {
-    PHIDP_PREPARSED_DATA preparsedData = nullptr;
-    bool valid = false;
-    USHORT contactCountLC = 0;     // Link collection for Contact Count (0x0D:0x54)
-    PtpContactSlot slots[5] = {};  // Contact slots (max 5 per PTP spec)
-    int numSlots = 0;
-    int32_t logicalRangeY = 0;     // Y-axis logical extent (device units) for A1 normalization
-};
-
-struct PtpContactState {
-    bool active = false;
-    LONG y = 0;
-    LONG prevY = 0;
-    bool hasPrev = false;  // true if previous Y is valid (contact was active last frame)
-};
-
-static PtpDeviceInfo s_ptpDevice = {};
-static HANDLE s_ptpDeviceHandle = nullptr;
-static PtpContactState s_ptpContacts[5] = {};
-// Fractional wheel-equivalent remainder (120 units/notch) carried across HID
-// reports so continuous touchpad motion produces continuous, sub-notch zoom.
-// Device-unit→wheel-equivalent normalization lives in ScrollNormalizer (A1).
-static float s_ptpWheelRemainder = 0.0f;
-
-// One-shot per-device PTP characterization. Logs the first few normalized
-// two-finger-scroll samples at INFO so a new touchpad can be fingerprinted from
-// the shipped log (Info-level, no Debug build needed) — the descriptor itself is
-// already logged at INFO in initPtpDevice. Bounded sample count keeps this OFF
-// the per-event hot path (R-05). Reset on device (re)init. Turns "diagnose blind
-// over several rebuilds" into "read one file." (R-08; see hardware handoff §8.)
-static int s_ptpCharSamplesLogged = 0;
-static constexpr int kPtpCharSampleCount = 8;
-
 // Windows touchpad "natural scrolling" direction setting.
 // When true, the OS flips WM_MOUSEWHEEL deltas for touchpad gestures before
 // they reach the LL hook — but raw HID reports are unaffected. The PTP path
-// must compensate to match the LL hook's (already-flipped) convention.
+// (RawInputWorker) must compensate to match the LL hook's (already-flipped)
+// convention. Read here because only top-level windows get WM_SETTINGCHANGE.
 // Registry: HKCU\SOFTWARE\Microsoft\Windows\CurrentVersion\PrecisionTouchPad
 //   ScrollDirection = 0 → natural (reverse), 1 or absent → traditional.
-static bool s_ptpNaturalScrolling = false;
 
 static bool queryTouchpadNaturalScrolling()
 {
@@ -278,6 +233,7 @@ using SmoothZoom::WM_OPEN_SETTINGS;
 using SmoothZoom::WM_TRAYICON;
 using SmoothZoom::WM_GRACEFUL_EXIT;
 using SmoothZoom::WM_UPDATE_TRAY_ICON;
+using SmoothZoom::WM_HOOK_SERVICE_ALARM;
 using SmoothZoom::IDM_SETTINGS;
 using SmoothZoom::IDM_TOGGLE_ZOOM;
 using SmoothZoom::IDM_EXIT;
@@ -428,374 +384,187 @@ static void armShutdownWatchdog()
             GetLastError());
 }
 
-// ── PTP HID Device Initialization ────────────────────────────────────────────
-// Called once per device when the first HID report arrives. Parses the device's
-// HID report descriptor to discover contact slot link collections.
+// Hidden message-only window for receiving WM_TIMER and WM_ENDSESSION
+static HWND g_msgWindow = nullptr;
 
-static bool initPtpDevice(HANDLE hDevice)
+static BOOL CALLBACK collectMonitor(HMONITOR, HDC, LPRECT rc, LPARAM data)
 {
-    // One-shot guard: log detailed diagnostics only on first failure per device
-    static bool s_ptpInitDiagLogged = false;
-
-    UINT ppSize = 0;
-    if (GetRawInputDeviceInfoW(hDevice, RIDI_PREPARSEDDATA, nullptr, &ppSize) != 0)
-    {
-        if (!s_ptpInitDiagLogged)
-            SZ_LOG_WARN("PTP", L"initPtpDevice: GetRawInputDeviceInfoW size query failed (GetLastError=%lu)", GetLastError());
-        s_ptpInitDiagLogged = true;
-        return false;
-    }
-    if (ppSize == 0 || ppSize > 65536)
-    {
-        if (!s_ptpInitDiagLogged)
-            SZ_LOG_WARN("PTP", L"initPtpDevice: preparsed data size out of range (ppSize=%u)", ppSize);
-        s_ptpInitDiagLogged = true;
-        return false;
-    }
-
-    auto* ppd = static_cast<PHIDP_PREPARSED_DATA>(
-        HeapAlloc(GetProcessHeap(), 0, ppSize));
-    if (!ppd)
-    {
-        if (!s_ptpInitDiagLogged)
-            SZ_LOG_WARN("PTP", L"initPtpDevice: HeapAlloc for preparsed data failed (size=%u)", ppSize);
-        s_ptpInitDiagLogged = true;
-        return false;
-    }
-
-    if (GetRawInputDeviceInfoW(hDevice, RIDI_PREPARSEDDATA, ppd, &ppSize) == UINT(-1))
-    {
-        if (!s_ptpInitDiagLogged)
-            SZ_LOG_WARN("PTP", L"initPtpDevice: GetRawInputDeviceInfoW data retrieval failed (GetLastError=%lu)", GetLastError());
-        s_ptpInitDiagLogged = true;
-        HeapFree(GetProcessHeap(), 0, ppd);
-        return false;
-    }
-
-    HIDP_CAPS caps = {};
-    NTSTATUS capsStatus = HidP_GetCaps(ppd, &caps);
-    if (capsStatus != HIDP_STATUS_SUCCESS)
-    {
-        if (!s_ptpInitDiagLogged)
-            SZ_LOG_WARN("PTP", L"initPtpDevice: HidP_GetCaps failed (NTSTATUS=0x%08lX)", static_cast<unsigned long>(capsStatus));
-        s_ptpInitDiagLogged = true;
-        HeapFree(GetProcessHeap(), 0, ppd);
-        return false;
-    }
-
-    // Enumerate input value caps to find Contact Count and Contact ID locations
-    USHORT numValCaps = caps.NumberInputValueCaps;
-    if (numValCaps == 0 || numValCaps > 256)
-    {
-        if (!s_ptpInitDiagLogged)
-            SZ_LOG_WARN("PTP", L"initPtpDevice: NumberInputValueCaps out of range (numValCaps=%u, UsagePage=0x%04X, Usage=0x%04X)",
-                        numValCaps, caps.UsagePage, caps.Usage);
-        s_ptpInitDiagLogged = true;
-        HeapFree(GetProcessHeap(), 0, ppd);
-        return false;
-    }
-
-    auto* valCaps = static_cast<HIDP_VALUE_CAPS*>(
-        HeapAlloc(GetProcessHeap(), 0, numValCaps * sizeof(HIDP_VALUE_CAPS)));
-    if (!valCaps)
-    {
-        if (!s_ptpInitDiagLogged)
-            SZ_LOG_WARN("PTP", L"initPtpDevice: HeapAlloc for value caps failed (count=%u)", numValCaps);
-        s_ptpInitDiagLogged = true;
-        HeapFree(GetProcessHeap(), 0, ppd);
-        return false;
-    }
-
-    NTSTATUS valStatus = HidP_GetValueCaps(HidP_Input, valCaps, &numValCaps, ppd);
-    if (valStatus != HIDP_STATUS_SUCCESS)
-    {
-        if (!s_ptpInitDiagLogged)
-            SZ_LOG_WARN("PTP", L"initPtpDevice: HidP_GetValueCaps failed (NTSTATUS=0x%08lX)", static_cast<unsigned long>(valStatus));
-        s_ptpInitDiagLogged = true;
-        HeapFree(GetProcessHeap(), 0, valCaps);
-        HeapFree(GetProcessHeap(), 0, ppd);
-        return false;
-    }
-
-    if (!s_ptpInitDiagLogged)
-    {
-        SZ_LOG_INFO("PTP", L"initPtpDevice: HID caps — UsagePage=0x%04X, Usage=0x%04X, InputValueCaps=%u, InputButtonCaps=%u",
-                    caps.UsagePage, caps.Usage, caps.NumberInputValueCaps, caps.NumberInputButtonCaps);
-    }
-
-    bool foundCC = false;
-    USHORT contactCountLC = 0;
-    int numSlots = 0;
-    USHORT slotLCs[5] = {};
-    int32_t logicalRangeY = 0;  // A1: largest Y logical extent across contacts
-
-    for (USHORT i = 0; i < numValCaps; i++)
-    {
-        USAGE usage = valCaps[i].IsRange
-            ? valCaps[i].Range.UsageMin
-            : valCaps[i].NotRange.Usage;
-        USAGE page = valCaps[i].UsagePage;
-
-        // Log each value cap on first attempt for diagnostics
-        if (!s_ptpInitDiagLogged)
-        {
-            SZ_LOG_INFO("PTP", L"  ValCap[%u]: UsagePage=0x%04X, Usage=0x%04X, LinkCollection=%u, IsRange=%d, BitSize=%u",
-                        i, page, usage, valCaps[i].LinkCollection, valCaps[i].IsRange, valCaps[i].BitSize);
-        }
-
-        if (page == 0x0D && usage == 0x54) // Contact Count
-        {
-            contactCountLC = valCaps[i].LinkCollection;
-            foundCC = true;
-        }
-        if (page == 0x0D && usage == 0x51) // Contact ID — one per contact slot
-        {
-            if (numSlots < 5)
-                slotLCs[numSlots++] = valCaps[i].LinkCollection;
-        }
-        if (page == 0x01 && usage == 0x31) // Generic Desktop : Y (A1 normalization)
-        {
-            LONG lo = valCaps[i].LogicalMin;
-            LONG hi = valCaps[i].LogicalMax;
-            if (hi > lo)
-            {
-                int32_t range = static_cast<int32_t>(hi - lo);
-                if (range > logicalRangeY)
-                    logicalRangeY = range; // largest across contact collections
-            }
-        }
-    }
-
-    HeapFree(GetProcessHeap(), 0, valCaps);
-
-    if (!foundCC || numSlots == 0)
-    {
-        if (!s_ptpInitDiagLogged)
-            SZ_LOG_WARN("PTP", L"initPtpDevice: No Contact Count (foundCC=%d) or Contact ID (numSlots=%d) found in %u value caps — device is not a PTP or uses unexpected descriptor",
-                        foundCC ? 1 : 0, numSlots, numValCaps);
-        s_ptpInitDiagLogged = true;
-        HeapFree(GetProcessHeap(), 0, ppd);
-        return false;
-    }
-
-    // Store device info (clean up previous if switching devices)
-    if (s_ptpDevice.preparsedData)
-        HeapFree(GetProcessHeap(), 0, s_ptpDevice.preparsedData);
-
-    s_ptpDevice.preparsedData = ppd;
-    s_ptpDevice.valid = true;
-    s_ptpDevice.contactCountLC = contactCountLC;
-    s_ptpDevice.numSlots = numSlots;
-    for (int i = 0; i < numSlots; i++)
-        s_ptpDevice.slots[i].linkCollection = slotLCs[i];
-    s_ptpDevice.logicalRangeY = logicalRangeY;  // A1: 0 if not found → normalizer falls back
-    s_ptpDeviceHandle = hDevice;
-
-    // Reset tracking state and diagnostics flag (allow logging for future device changes)
-    for (auto& c : s_ptpContacts) c = {};
-    s_ptpWheelRemainder = 0.0f;
-    s_ptpCharSamplesLogged = 0;  // re-characterize whenever the active device changes
-    s_ptpInitDiagLogged = false;
-
-    SZ_LOG_INFO("Main", L"PTP device initialized: %d contact slot(s), contactCountLC=%u, logicalRangeY=%d",
-                numSlots, contactCountLC, logicalRangeY);
-    return true;
+    auto* table = reinterpret_cast<SmoothZoom::MonitorTable*>(data);
+    table->add({rc->left, rc->top, rc->right, rc->bottom});
+    return TRUE;
 }
 
-// ── PTP HID Report Processing ────────────────────────────────────────────────
-// Extracts contact data from each report, detects two-finger vertical pan,
-// and converts to scroll delta when modifier key is held.
-
-static void handlePtpHidReport(const BYTE* reportData, DWORD reportSize)
+// Re-read the virtual-desktop bounds and the monitor table into SharedState
+// (physical pixels, can have a negative origin). Called on any event that can
+// change the display layout: resolution/monitor change, DPI/scaling change,
+// and resume-from-sleep.
+static void refreshVirtualScreenMetrics()
 {
-    auto* ppd = s_ptpDevice.preparsedData;
-    // HidP functions take non-const PCHAR — they don't modify the buffer
-    auto* report = reinterpret_cast<PCHAR>(const_cast<BYTE*>(reportData));
-
-    // Extract contact count (present in end-of-frame report, or every report)
-    ULONG contactCount = 0;
-    [[maybe_unused]] NTSTATUS ccStatus =
-        HidP_GetUsageValue(HidP_Input, 0x0D, s_ptpDevice.contactCountLC, 0x54,
-                           &contactCount, ppd, report, reportSize);
-    SZ_LOG_DEBUG("PTP", L"handlePtpHidReport: contactCount=%lu (status=0x%08lX, reportSize=%lu)",
-                 contactCount, static_cast<unsigned long>(ccStatus), reportSize);
-
-    // Extract data from each contact slot in this report
-    for (int slot = 0; slot < s_ptpDevice.numSlots; slot++)
-    {
-        USHORT lc = s_ptpDevice.slots[slot].linkCollection;
-
-        // Contact ID (best-effort; diagnostics only — tracking is keyed by slot)
-        ULONG contactId = 0;
-        HidP_GetUsageValue(HidP_Input, 0x0D, lc, 0x51, &contactId, ppd,
-                           report, reportSize);
-
-        // Tip Switch (button usage 0x42 on digitizer page)
-        USAGE usages[8] = {};
-        ULONG usageLen = 8;
-        bool tipSwitch = false;
-        if (HidP_GetUsages(HidP_Input, 0x0D, lc, usages, &usageLen, ppd,
-                           report, reportSize) == HIDP_STATUS_SUCCESS)
-        {
-            for (ULONG u = 0; u < usageLen; u++)
-            {
-                if (usages[u] == 0x42) { tipSwitch = true; break; }
-            }
-        }
-
-        // Y position (Generic Desktop page 0x01, same link collection as contact)
-        ULONG y = 0;
-        HidP_GetUsageValue(HidP_Input, 0x01, lc, 0x31, &y, ppd, report, reportSize);
-
-        SZ_LOG_DEBUG("PTP", L"  slot=%d lc=%u contactId=%lu tip=%d y=%lu",
-                     slot, lc, contactId, tipSwitch ? 1 : 0, y);
-
-        // Track state per *slot*, not per contactId. Inactive PTP slots commonly
-        // report contactId=0, so indexing by contactId let an empty slot overwrite
-        // the real finger holding id 0 — capping scrollFingers at 1 and breaking
-        // two-finger scroll (observed on Synaptics/Elan laptop trackpads). A slot's
-        // link collection is stable for a contact's lifetime, so slot indexing
-        // tracks the same finger across reports.
-        auto& cs = s_ptpContacts[slot];
-        if (tipSwitch)
-        {
-            cs.prevY = cs.y;
-            cs.hasPrev = cs.active; // Valid prev only if was already active
-            cs.y = static_cast<LONG>(y);
-            cs.active = true;
-        }
-        else
-        {
-            cs.active = false;
-            cs.hasPrev = false;
-        }
-    }
+    g_sharedState.screenWidth.store(GetSystemMetrics(SM_CXVIRTUALSCREEN), std::memory_order_relaxed);
+    g_sharedState.screenHeight.store(GetSystemMetrics(SM_CYVIRTUALSCREEN), std::memory_order_relaxed);
+    g_sharedState.screenOriginX.store(GetSystemMetrics(SM_XVIRTUALSCREEN), std::memory_order_relaxed);
+    g_sharedState.screenOriginY.store(GetSystemMetrics(SM_YVIRTUALSCREEN), std::memory_order_relaxed);
 
-    // Only process when we have a complete frame with 2+ contacts
-    if (contactCount < 2)
-    {
-        SZ_LOG_DEBUG("PTP", L"handlePtpHidReport: skipping, contactCount=%lu < 2", contactCount);
-        return;
-    }
+    SmoothZoom::MonitorTable table;
+    EnumDisplayMonitors(nullptr, nullptr, collectMonitor, reinterpret_cast<LPARAM>(&table));
+    g_sharedState.monitorTable.write(table);
+    g_sharedState.monitorTableVersion.fetch_add(1, std::memory_order_release);
+}
 
-    // Find first two active contacts with valid Y deltas
-    int scrollFingers = 0;
-    LONG totalDeltaY = 0;
+// System-wide CPU load (%) since the previous call, from GetSystemTimes; -1
+// on the first call or failure. Logged beside hook latency so slow callbacks
+// can be told apart from a loaded machine.
+static int systemCpuLoadSinceLastCall()
+{
+    static ULONGLONG s_prevIdle = 0, s_prevBusy = 0;
+    FILETIME idle, kernel, user;
+    if (!GetSystemTimes(&idle, &kernel, &user))
+        return -1;
+    auto ticks = [](const FILETIME& f) {
+        return (static_cast<ULONGLONG>(f.dwHighDateTime) << 32) | f.dwLowDateTime;
+    };
+    const ULONGLONG idleNow = ticks(idle);
+    const ULONGLONG busyNow = ticks(kernel) + ticks(user); // kernel time includes idle
+    const ULONGLONG dIdle = idleNow - s_prevIdle;
+    const ULONGLONG dTotal = busyNow - s_prevBusy;
+    const bool first = s_prevBusy == 0;
+    s_prevIdle = idleNow;
+    s_prevBusy = busyNow;
+    if (first || dTotal == 0 || dIdle > dTotal)
+        return -1;
+    return static_cast<int>((dTotal - dIdle) * 100 / dTotal);
+}
 
-    for (int i = 0; i < 5 && scrollFingers < 2; i++)
+// "≥1ms:3 ≥10ms:0 ≥100ms:0" for a profiler snapshot (or interval).
+static void formatSlowCounts(const SmoothZoom::HookServiceProfiler::Snapshot& s,
+                             wchar_t* buf, size_t len)
+{
+    buf[0] = L'\0';
+    size_t used = 0;
+    for (int i = 0; i < s.thresholdCount && used < len; ++i)
     {
-        auto& c = s_ptpContacts[i];
-        if (c.active && c.hasPrev)
-        {
-            totalDeltaY += (c.y - c.prevY);
-            scrollFingers++;
-        }
+        const int n = swprintf_s(buf + used, len - used, L"%s>=%lums:%llu", i ? L" " : L"",
+                                 static_cast<unsigned long>(s.thresholdsUs[i] / 1000),
+                                 static_cast<unsigned long long>(s.slow[i]));
+        if (n < 0)
+            break;
+        used += static_cast<size_t>(n);
     }
+}
 
-    if (scrollFingers < 2)
-    {
-        SZ_LOG_DEBUG("PTP", L"handlePtpHidReport: scrollFingers=%d < 2 (contactCount=%lu)",
-                     scrollFingers, contactCount);
+// Log the input thread's hook service time / delivery delay since the last
+// call. Proves hook service stays bounded whatever the main thread is doing
+// (settings window, modal dialogs, config writes); the per-event-type p99,
+// slow-callback counts and CPU load correlate outliers with machine load.
+static void logHookLatency()
+{
+    using SmoothZoom::HookEventKind;
+    static SmoothZoom::HookServiceProfiler::Snapshot s_prevService;
+    static SmoothZoom::LatencyHistogram::Counts s_prevDelivery;
+    static int s_ticks = 0;
+    const bool settingsOpen = g_trayUI.settingsHwnd() != nullptr;
+    if (++s_ticks < kHookLatencyLogTicks && !settingsOpen)
         return;
-    }
-
-    LONG avgDeltaY = totalDeltaY / scrollFingers;
-    SZ_LOG_DEBUG("PTP", L"handlePtpHidReport: scrollFingers=%d, totalDeltaY=%ld, avgDeltaY=%ld",
-                 scrollFingers, totalDeltaY, avgDeltaY);
-    if (avgDeltaY == 0)
+    s_ticks = 0;
+
+    const auto service = g_sharedState.hookService.snapshot();
+    const auto delivery = g_sharedState.hookDeliveryMs.snapshot();
+    const auto interval = service.since(s_prevService);
+    const auto ds = interval.total();
+    const auto dd = delivery.since(s_prevDelivery);
+    s_prevService = service;
+    s_prevDelivery = delivery;
+    const int cpu = systemCpuLoadSinceLastCall();
+    if (ds.total() == 0)
         return;
+    wchar_t slow[96];
+    formatSlowCounts(interval, slow, sizeof(slow) / sizeof(slow[0]));
+    SZ_LOG_INFO("Main",
+                L"Hook latency%s: n=%llu service p50<%luus p99<%luus max<%luus "
+                L"(p99 move<%luus button<%luus wheel<%luus key<%luus; slow %s; trend %luus), "
+                L"delivery p99<%lums max<%lums, cpu %d%%",
+                settingsOpen ? L" (settings open)" : L"",
+                static_cast<unsigned long long>(ds.total()),
+                static_cast<unsigned long>(ds.quantileBound(0.5)),
+                static_cast<unsigned long>(ds.quantileBound(0.99)),
+                static_cast<unsigned long>(ds.maxBound()),
+                static_cast<unsigned long>(interval.kind(HookEventKind::MouseMove).quantileBound(0.99)),
+                static_cast<unsigned long>(interval.kind(HookEventKind::MouseButton).quantileBound(0.99)),
+                static_cast<unsigned long>(interval.kind(HookEventKind::MouseWheel).quantileBound(0.99)),
+                static_cast<unsigned long>(interval.kind(HookEventKind::Keyboard).quantileBound(0.99)),
+                slow,
+                static_cast<unsigned long>(service.trendUs),
+                static_cast<unsigned long>(dd.quantileBound(0.99)),
+                static_cast<unsigned long>(dd.maxBound()),
+                cpu);
+}
 
-    // One-shot device characterization (INFO): capture the first few normalized
-    // samples so a new touchpad's feel can be fingerprinted from the shipped log.
-    // Placed before the dedup/modifier gates so it fires on real two-finger motion
-    // regardless of modifier state; the bounded count keeps it off the per-event
-    // hot path (R-05). avgDeltaY is the device's raw (pre-direction-adjust) output;
-    // wheelEquiv is what ScrollNormalizer derives from it. (R-08, AC-2.1.05)
-    if (s_ptpCharSamplesLogged < kPtpCharSampleCount)
-    {
-        SmoothZoom::PtpAxisScale charScale{ s_ptpDevice.logicalRangeY };
-        SZ_LOG_INFO("PTP-Char",
-            L"sample %d/%d: contacts=%lu fingers=%d avgDeltaY=%ld logicalRangeY=%d "
-            L"unitsPerNotch=%.1f wheelEquiv=%.2f naturalScroll=%d",
-            s_ptpCharSamplesLogged + 1, kPtpCharSampleCount, contactCount, scrollFingers,
-            avgDeltaY, s_ptpDevice.logicalRangeY,
-            SmoothZoom::ptpUnitsPerNotch(charScale),
-            SmoothZoom::ptpDeltaToWheelEquiv(static_cast<float>(avgDeltaY), charScale),
-            s_ptpNaturalScrolling ? 1 : 0);
-        s_ptpCharSamplesLogged++;
-    }
+// Early warning from the input thread (R-05): a hook callback took a third of
+// LowLevelHooksTimeout, or the service-time trend is a sixteenth of it. The
+// hook is still installed; log the evidence before the OS removes it.
+static void logHookServiceAlarm(WPARAM kind, LPARAM us)
+{
+    static const wchar_t* const kKindNames[] = {L"move", L"button", L"wheel", L"key"};
+    const auto s = g_sharedState.hookService.snapshot();
+    wchar_t slow[96];
+    formatSlowCounts(s, slow, sizeof(slow) / sizeof(slow[0]));
+    SZ_LOG_WARN("Main",
+                L"Hook service time nearing the %lums OS timeout: %s callback %lluus, "
+                L"trend %luus, worst %luus, slow %s, alarm #%llu, cpu %d%%",
+                static_cast<unsigned long>(s.timeoutUs / 1000),
+                kind < 4 ? kKindNames[kind] : L"?",
+                static_cast<unsigned long long>(us),
+                static_cast<unsigned long>(s.trendUs),
+                static_cast<unsigned long>(s.worstUs),
+                slow,
+                static_cast<unsigned long long>(s.alarms),
+                systemCpuLoadSinceLastCall());
+}
 
-    // Dedup with LL hook: skip if hook handled scroll recently
-    int64_t lastLL = g_sharedState.lastLLHookScrollTime.load(std::memory_order_relaxed);
-    int64_t now = static_cast<int64_t>(GetTickCount64());
-    if (now - lastLL < 50)
-    {
-        SZ_LOG_DEBUG("PTP", L"handlePtpHidReport: dedup suppressed (now-lastLL=%lld ms)",
-                     now - lastLL);
+// Log scroll dedup counters (render thread's ScrollDeduplicator), on the hook
+// latency cadence and only when anything was suppressed or handed over since
+// the last log — evidence that LL hook / Raw Input overlap counts once.
+static void logScrollDedup()
+{
+    static uint64_t s_prevDuplicate = 0, s_prevSuppressed = 0, s_prevHandovers = 0;
+    static int s_ticks = 0;
+    if (++s_ticks < kHookLatencyLogTicks)
         return;
-    }
+    s_ticks = 0;
 
-    // Check modifier key
-    auto snap = std::atomic_load(&g_sharedState.settingsSnapshot);
-    int modVK = snap ? snap->modifierKeyVK : VK_LWIN;
-    int genericVK = SmoothZoom::toGenericVK(modVK);
-    bool modHeld = (GetAsyncKeyState(genericVK) & 0x8000) != 0;
-    SZ_LOG_DEBUG("PTP", L"handlePtpHidReport: modVK=0x%X, genericVK=0x%X, modHeld=%d, asyncState=0x%04X",
-                 modVK, genericVK, modHeld ? 1 : 0,
-                 static_cast<unsigned>(GetAsyncKeyState(genericVK) & 0xFFFF));
-    if (!modHeld)
+    const uint64_t accepted = g_sharedState.scrollEventsAccepted.load(std::memory_order_relaxed);
+    const uint64_t duplicate = g_sharedState.scrollEventsDuplicate.load(std::memory_order_relaxed);
+    const uint64_t suppressed = g_sharedState.scrollEventsSuppressed.load(std::memory_order_relaxed);
+    const uint64_t handovers = g_sharedState.scrollSourceHandovers.load(std::memory_order_relaxed);
+    if (duplicate == s_prevDuplicate && suppressed == s_prevSuppressed && handovers == s_prevHandovers)
         return;
-
-    // Convert PTP device-unit Y delta to WHEEL_DELTA (120) units.
-    // PTP Y increases downward. Fingers moving down = positive avgDeltaY = scroll down.
-    // WHEEL_DELTA positive = scroll up. Negate for traditional Windows scroll direction.
-    //
-    // Natural scrolling compensation: when the OS "natural scrolling" setting is ON,
-    // the LL hook's WM_MOUSEWHEEL delta is pre-flipped by Windows — but raw HID data
-    // is not. Without this check, the PTP path produces the opposite direction from
-    // the LL hook path when natural scrolling is enabled.
-    // Natural OFF: negate (traditional: fingers down → scroll up → positive WHEEL_DELTA)
-    // Natural ON:  don't negate (OS already flips LL hook; match that convention)
-    int32_t adjustedDeltaY = s_ptpNaturalScrolling ? avgDeltaY : -avgDeltaY;
-
-    // A1: normalize device-unit Y delta to wheel-equivalent units (120/notch)
-    // using the device's own logical Y range, so a given fraction-of-pad swipe
-    // produces the same zoom on any touchpad. Falls back to a fixed constant
-    // when the descriptor lacked a usable Y range.
-    SmoothZoom::PtpAxisScale yScale{ s_ptpDevice.logicalRangeY };
-    s_ptpWheelRemainder +=
-        SmoothZoom::ptpDeltaToWheelEquiv(static_cast<float>(adjustedDeltaY), yScale);
-
-    int32_t whole = static_cast<int32_t>(s_ptpWheelRemainder); // truncate toward zero
-    SZ_LOG_DEBUG("PTP", L"handlePtpHidReport: remainder=%.2f, whole=%d, unitsPerNotch=%.1f",
-                 s_ptpWheelRemainder, whole, SmoothZoom::ptpUnitsPerNotch(yScale));
-    if (whole != 0)
-    {
-        s_ptpWheelRemainder -= static_cast<float>(whole);
-
-        // Clamp to int16 range (single-report deltas are tiny; guard anyway).
-        if (whole > 32767) whole = 32767;
-        else if (whole < -32768) whole = -32768;
-        int16_t delta = static_cast<int16_t>(whole);
-
-        SZ_LOG_DEBUG("Main", L"PTP scroll: avgDY=%d wheelEquiv=%d",
-                     avgDeltaY, static_cast<int>(delta));
-        g_sharedState.scrollAccumulator.fetch_add(delta, std::memory_order_release);
-    }
+    s_prevDuplicate = duplicate;
+    s_prevSuppressed = suppressed;
+    s_prevHandovers = handovers;
+    SZ_LOG_INFO("Main", L"Scroll dedup: accepted=%llu duplicate=%llu suppressed=%llu handovers=%llu",
+                static_cast<unsigned long long>(accepted), static_cast<unsigned long long>(duplicate),
+                static_cast<unsigned long long>(suppressed), static_cast<unsigned long long>(handovers));
 }
 
-// Hidden message-only window for receiving WM_TIMER and WM_ENDSESSION
-static HWND g_msgWindow = nullptr;
-
-// Re-read the virtual-desktop bounds into SharedState (physical pixels, can have
-// a negative origin). Called on any event that can change the display layout:
-// resolution/monitor change, DPI/scaling change, and resume-from-sleep.
-static void refreshVirtualScreenMetrics()
+// Log pointer sample stream overflow (samples the render thread did not read
+// before the producer overwrote them), on the same cadence, only when it grew.
+static void logPointerSampleLoss()
 {
-    g_sharedState.screenWidth.store(GetSystemMetrics(SM_CXVIRTUALSCREEN), std::memory_order_relaxed);
-    g_sharedState.screenHeight.store(GetSystemMetrics(SM_CYVIRTUALSCREEN), std::memory_order_relaxed);
-    g_sharedState.screenOriginX.store(GetSystemMetrics(SM_XVIRTUALSCREEN), std::memory_order_relaxed);
-    g_sharedState.screenOriginY.store(GetSystemMetrics(SM_YVIRTUALSCREEN), std::memory_order_relaxed);
+    static uint64_t s_prevLost = 0;
+    static int s_ticks = 0;
+    if (++s_ticks < kHookLatencyLogTicks)
+        return;
+    s_ticks = 0;
+
+    const SmoothZoom::PointerSampleRing<>& hook = g_sharedState.hookPointerSamples;
+    const SmoothZoom::PointerSampleRing<>& raw = g_sharedState.rawPointerSamples;
+    const uint64_t lost = hook.lost() + raw.lost();
+    if (lost == s_prevLost)
+        return;
+    s_prevLost = lost;
+    SZ_LOG_INFO("Main", L"Pointer samples: hook pushed=%llu lost=%llu, raw pushed=%llu lost=%llu",
+                static_cast<unsigned long long>(hook.pushed()), static_cast<unsigned long long>(hook.lost()),
+                static_cast<unsigned long long>(raw.pushed()), static_cast<unsigned long long>(raw.lost()));
 }
 
 static LRESULT CALLBACK msgWndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam)
@@ -830,6 +599,9 @@ static LRESULT CALLBACK msgWndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lP
                     needReinstall = (lastInput64 - lastCallback) > 2000;
                 }
             }
+            logHookLatency();
+            logScrollDedup();
+            logPointerSampleLoss();
             if (needReinstall)
             {
                 SZ_LOG_WARN("Main", L"Hook deregistration detected, reinstalling...");
@@ -900,6 +672,10 @@ static LRESULT CALLBACK msgWndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lP
         g_trayUI.showSettingsWindow();
         return 0;
 
+    case WM_HOOK_SERVICE_ALARM:
+        logHookServiceAlarm(wParam, lParam);
+        return 0;
+
     case WM_TRAYICON:
         g_trayUI.onTrayMessage(lParam);
         return 0;
@@ -916,7 +692,7 @@ static LRESULT CALLBACK msgWndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lP
         switch (LOWORD(wParam))
         {
         case IDM_SETTINGS:    g_trayUI.showSettingsWindow(); return 0;
-        case IDM_TOGGLE_ZOOM: g_sharedState.commandQueue.push(SmoothZoom::ZoomCommand::TrayToggle); return 0;
+        case IDM_TOGGLE_ZOOM: g_sharedState.uiCommandQueue.push(SmoothZoom::ZoomCommand::TrayToggle); return 0;
         case IDM_EXIT:        g_trayUI.requestGracefulExit(); return 0;
         }
         break;
@@ -985,12 +761,15 @@ static LRESULT CALLBACK msgWndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lP
         return TRUE;
 
     case WM_SETTINGCHANGE:
+    {
         // Refresh touchpad natural scrolling setting when user changes it in Windows Settings.
         // WM_SETTINGCHANGE is broadcast system-wide on control panel / Settings changes.
-        s_ptpNaturalScrolling = queryTouchpadNaturalScrolling();
+        const bool natural = queryTouchpadNaturalScrolling();
+        g_rawInputWorker.setNaturalScrolling(natural);
         SZ_LOG_DEBUG("Main", L"WM_SETTINGCHANGE: touchpad natural scrolling now %s",
-                     s_ptpNaturalScrolling ? L"ON" : L"OFF");
+                     natural ? L"ON" : L"OFF");
         return 0;
+    }
 
     case WM_ENDSESSION:
         if (wParam)
@@ -1010,6 +789,7 @@ static LRESULT CALLBACK msgWndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lP
                 // Render thread reset zoom to 1.0× before clearing running_.
                 g_renderLoop.finalizeShutdown();
                 g_inputInterceptor.uninstall();
+                g_rawInputWorker.stop();
                 removeSentinel(s_sentinelPath);
             }
             else if (emergencyResetMagnification())
@@ -1022,95 +802,6 @@ static LRESULT CALLBACK msgWndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lP
         }
         return 0;
 
-    case WM_INPUT:
-    {
-        // Raw Input fallback for scroll events that bypass LL mouse hooks.
-        // Some touchpad drivers (Precision Touchpad) deliver scroll via WM_POINTER
-        // to pointer-aware foreground windows (Desktop, Edge), skipping LL hooks.
-        SZ_LOG_DEBUG("PTP", L"WM_INPUT received (wParam=0x%X)", static_cast<unsigned>(wParam));
-
-        UINT dwSize = 0;
-        GetRawInputData(reinterpret_cast<HRAWINPUT>(lParam), RID_INPUT,
-                        nullptr, &dwSize, sizeof(RAWINPUTHEADER));
-        if (dwSize == 0)
-        {
-            SZ_LOG_DEBUG("PTP", L"WM_INPUT: dwSize=0, skipping");
-            return DefWindowProcW(hWnd, msg, wParam, lParam);
-        }
-
-        // Stack buffer — RAWINPUT is ~48 bytes for mouse, but HID can be larger
-        alignas(8) BYTE buf[512];
-        if (dwSize > sizeof(buf))
-            return DefWindowProcW(hWnd, msg, wParam, lParam);
-        if (GetRawInputData(reinterpret_cast<HRAWINPUT>(lParam), RID_INPUT,
-                            buf, &dwSize, sizeof(RAWINPUTHEADER)) == UINT(-1))
-            return DefWindowProcW(hWnd, msg, wParam, lParam);
-
-        auto* raw = reinterpret_cast<RAWINPUT*>(buf);
-
-        SZ_LOG_DEBUG("PTP", L"WM_INPUT: dwType=%lu, dwSize=%u",
-                     raw->header.dwType, dwSize);
-
-        if (raw->header.dwType == RIM_TYPEHID)
-        {
-            // Precision Touchpad HID report — parse for two-finger scroll
-            HANDLE hDevice = raw->header.hDevice;
-            SZ_LOG_DEBUG("PTP", L"RIM_TYPEHID: hDevice=0x%p, count=%lu, sizeHid=%lu",
-                         hDevice, raw->data.hid.dwCount, raw->data.hid.dwSizeHid);
-
-            // One-time device init: parse report descriptor for contact slots
-            if (hDevice != s_ptpDeviceHandle || !s_ptpDevice.valid)
-            {
-                if (!initPtpDevice(hDevice))
-                    return DefWindowProcW(hWnd, msg, wParam, lParam);
-            }
-
-            // Process each HID report in this WM_INPUT message
-            DWORD count = raw->data.hid.dwCount;
-            DWORD size  = raw->data.hid.dwSizeHid;
-            const BYTE* data = raw->data.hid.bRawData;
-            for (DWORD r = 0; r < count; r++)
-                handlePtpHidReport(data + r * size, size);
-
-            return DefWindowProcW(hWnd, msg, wParam, lParam);
-        }
-
-        if (raw->header.dwType != RIM_TYPEMOUSE)
-            return DefWindowProcW(hWnd, msg, wParam, lParam);
-
-        const RAWMOUSE& rm = raw->data.mouse;
-        int16_t delta = 0;
-        if (rm.usButtonFlags & RI_MOUSE_WHEEL)
-            delta = static_cast<int16_t>(rm.usButtonData);
-        else if (rm.usButtonFlags & RI_MOUSE_HWHEEL)
-            delta = static_cast<int16_t>(rm.usButtonData);
-
-        if (delta == 0)
-            return DefWindowProcW(hWnd, msg, wParam, lParam);
-
-        // Dedup: skip if LL hook already handled a scroll within 50ms
-        int64_t lastLL = g_sharedState.lastLLHookScrollTime.load(std::memory_order_relaxed);
-        int64_t now = static_cast<int64_t>(GetTickCount64());
-        if (now - lastLL < 50)
-            return DefWindowProcW(hWnd, msg, wParam, lParam);
-
-        // Check modifier via GetAsyncKeyState (can't access WinKeyManager from here)
-        auto snap = std::atomic_load(&g_sharedState.settingsSnapshot);
-        int modVK = snap ? snap->modifierKeyVK : VK_LWIN;
-        int genericVK = SmoothZoom::toGenericVK(modVK);
-        bool modHeld = (GetAsyncKeyState(genericVK) & 0x8000) != 0;
-
-        if (modHeld)
-        {
-            // Debug, not Info: this fires per qualifying scroll event on the
-            // main thread, and the logger flushes synchronously per line (R-05).
-            SZ_LOG_DEBUG("Main", L"Raw Input scroll fallback: delta=%d", delta);
-            g_sharedState.scrollAccumulator.fetch_add(delta, std::memory_order_release);
-        }
-
-        return DefWindowProcW(hWnd, msg, wParam, lParam);
-    }
-
     default:
         // Explorer restart: re-add tray icon
         if (WM_TASKBAR_CREATED && msg == WM_TASKBAR_CREATED)
@@ -1254,7 +945,6 @@ int WINAPI wWinMain(
     // ── 0c. Load settings (Phase 5B: AC-2.9.01, AC-2.9.02) ─────────────────
     // Register observers BEFORE loading so the initial load triggers them.
     g_settingsManager.addObserver(publishToSharedState, &g_sharedState);
-    SmoothZoom::InputInterceptor::registerSettingsObserver(g_settingsManager);
     g_configPath = SmoothZoom::SettingsManager::getDefaultConfigPath();
 
     // ── 0c½. Initialize file logging alongside config.json ──────────────────
@@ -1290,11 +980,9 @@ int WINAPI wWinMain(
                 static_cast<int>(SmoothZoom::logLevelFilter()),
                 envLogLevelSet ? L"env" : L"config");
 
-    // Initialize virtual screen dimensions in shared state (read by render thread)
-    g_sharedState.screenWidth.store(GetSystemMetrics(SM_CXVIRTUALSCREEN), std::memory_order_relaxed);
-    g_sharedState.screenHeight.store(GetSystemMetrics(SM_CYVIRTUALSCREEN), std::memory_order_relaxed);
-    g_sharedState.screenOriginX.store(GetSystemMetrics(SM_XVIRTUALSCREEN), std::memory_order_relaxed);
-    g_sharedState.screenOriginY.store(GetSystemMetrics(SM_YVIRTUALSCREEN), std::memory_order_relaxed);
+    // Initialize virtual screen dimensions and the monitor table in shared
+    // state (read by render thread)
+    refreshVirtualScreenMetrics();
 
     // ── 0e. Conflict detection (AC-ERR.01, E6.8) ─────────────────────────────
     {
@@ -1330,7 +1018,7 @@ int WINAPI wWinMain(
         }
     }
 
-    // ── 1. Install input hooks (must be on a thread with a message pump) ────
+    // ── 1. Install input hooks (on their own input thread and pump) ─────────
     if (!g_inputInterceptor.install(g_sharedState))
     {
         MessageBoxW(nullptr,
@@ -1391,6 +1079,16 @@ int WINAPI wWinMain(
     g_focusMonitor.start(g_sharedState);
     g_caretMonitor.start(g_sharedState);
 
+    // Raw Input fallback for scroll that bypasses the LL hooks (Precision
+    // Touchpad two-finger pan). Runs on its own worker thread, drained in
+    // batches. Failure is non-fatal — LL hook scrolling still works.
+    if (!g_rawInputWorker.start(g_sharedState))
+        SZ_LOG_WARN("Main", L"Raw Input worker failed to start — touchpad scroll fallback disabled");
+    // Query Windows touchpad scroll direction for PTP natural scrolling compensation
+    const bool naturalScrolling = queryTouchpadNaturalScrolling();
+    g_rawInputWorker.setNaturalScrolling(naturalScrolling);
+    SZ_LOG_INFO("Main", L"Touchpad natural scrolling: %s", naturalScrolling ? L"ON" : L"OFF");
+
     // ── 2c. Create message window for watchdog timer + WM_ENDSESSION ────────
     g_msgWindow = createMessageWindow(hInstance);
     if (g_msgWindow)
@@ -1400,40 +1098,11 @@ int WINAPI wWinMain(
         SmoothZoom::InputInterceptor::setMessageWindow(g_msgWindow);
         // Phase 6: Register for session lock/unlock notifications (AC-ERR.04, E6.10)
         WTSRegisterSessionNotification(g_msgWindow, NOTIFY_FOR_THIS_SESSION);
-
-        // Query Windows touchpad scroll direction for PTP natural scrolling compensation
-        s_ptpNaturalScrolling = queryTouchpadNaturalScrolling();
-        SZ_LOG_INFO("Main", L"Touchpad natural scrolling: %s",
-                    s_ptpNaturalScrolling ? L"ON" : L"OFF");
-
-        // Raw Input fallback: catch touchpad scroll events that bypass LL hooks
-        RAWINPUTDEVICE rids[2] = {};
-        // 1. Generic mouse — catches external mouse wheel events
-        rids[0].usUsagePage = 0x01;  // HID_USAGE_PAGE_GENERIC
-        rids[0].usUsage     = 0x02;  // HID_USAGE_GENERIC_MOUSE
-        rids[0].dwFlags     = RIDEV_INPUTSINK;
-        rids[0].hwndTarget  = g_msgWindow;
-        // 2. Precision Touchpad — HID digitizer page
-        rids[1].usUsagePage = 0x0D;  // HID_USAGE_PAGE_DIGITIZER
-        rids[1].usUsage     = 0x05;  // HID_USAGE_GENERIC_TOUCHPAD
-        rids[1].dwFlags     = RIDEV_INPUTSINK;
-        rids[1].hwndTarget  = g_msgWindow;
-        if (!RegisterRawInputDevices(rids, 2, sizeof(RAWINPUTDEVICE)))
-        {
-            // Touchpad registration may fail if no PTP device — try mouse only
-            SZ_LOG_WARN("Main", L"RegisterRawInputDevices (mouse+touchpad) failed, trying mouse only");
-            if (!RegisterRawInputDevices(rids, 1, sizeof(RAWINPUTDEVICE)))
-                SZ_LOG_WARN("Main", L"RegisterRawInputDevices (mouse only) also failed");
-            else
-                SZ_LOG_INFO("Main", L"RegisterRawInputDevices (mouse only) succeeded");
-        }
-        else
-            SZ_LOG_INFO("Main", L"RegisterRawInputDevices (mouse+touchpad) succeeded");
     }
     else
     {
-        SZ_LOG_ERROR("Main", L"Message window is NULL — raw input (touchpad/mouse), watchdog, "
-                             L"Win+Ctrl+M, and display-change handling are DISABLED");
+        SZ_LOG_ERROR("Main", L"Message window is NULL — watchdog, Win+Ctrl+M, "
+                             L"and display-change handling are DISABLED");
     }
 
     // Phase 5C: Register TaskbarCreated for Explorer restart detection
@@ -1451,11 +1120,12 @@ int WINAPI wWinMain(
     {
         auto snap = g_settingsManager.snapshot();
         if (snap && snap->startZoomed && snap->defaultZoomLevel > 1.0f)
-            g_sharedState.commandQueue.push(SmoothZoom::ZoomCommand::TrayToggle);
+            g_sharedState.uiCommandQueue.push(SmoothZoom::ZoomCommand::TrayToggle);
     }
 
     // ── 3. Run Win32 message pump ───────────────────────────────────────────
-    // Low-level hooks require a message pump on the installing thread.
+    // Tray, settings window and timers. The LL hooks and Raw Input have their
+    // own pumps on worker threads, so nothing here can stall them (R-05).
     // The pump runs until WM_QUIT is posted (by Ctrl+Q via InputInterceptor).
     MSG msg;
     while (GetMessageW(&msg, nullptr, 0, 0) > 0)
@@ -1525,12 +1195,8 @@ int WINAPI wWinMain(
 
     g_inputInterceptor.uninstall();
 
-    // ── 4b. Clean up PTP HID state ──────────────────────────────────────────
-    if (s_ptpDevice.preparsedData)
-    {
-        HeapFree(GetProcessHeap(), 0, s_ptpDevice.preparsedData);
-        s_ptpDevice.preparsedData = nullptr;
-    }
+    // ── 4b. Stop the Raw Input worker (unregisters its devices) ─────────────
+    g_rawInputWorker.stop();
 
     // ── 4c. Remove sentinel ONLY on a verified-clean shutdown (R-14, E6.11) ──
     // If the render thread hung, the screen may still be magnified — attempt a
@@ -7,17 +7,25 @@
 // Callbacks: read event → update atomic or post message → return.
 // No computation, no I/O, no allocation.
 //
+// The hooks live on a dedicated input thread with its own message pump at
+// TIME_CRITICAL priority. LL hook callbacks are dispatched on the installing
+// thread, so while they shared the main thread a modal dialog, the settings
+// window or a slow config write delayed every mouse event system-wide. The
+// input thread talks to the rest of the app only through SharedState
+// (settings version, reset requests, command queue, scroll accumulator) plus
+// one PostMessage for Win+Ctrl+M.
+//
 // Phase 1: WinKeyManager integration for Start Menu suppression (AC-2.1.16).
 // Phase 5B: Configurable modifier/toggle keys, Win+Ctrl+M shortcut.
 // =============================================================================
 
 #include "smoothzoom/input/InputInterceptor.h"
+#include "smoothzoom/input/InputRouter.h"
 #include "smoothzoom/input/WinKeyManager.h"
 #include "smoothzoom/input/ModifierUtils.h"
 #include "smoothzoom/common/AppMessages.h"
 #include "smoothzoom/common/SharedState.h"
 #include "smoothzoom/common/Types.h"
-#include "smoothzoom/support/SettingsManager.h"
 #include "smoothzoom/support/Logger.h"
 
 #ifndef UNICODE
@@ -28,22 +36,45 @@
 #endif
 
 #include <windows.h>
+#include <atomic>
 #include <chrono>
+#include <thread>
 
 namespace SmoothZoom
 {
 
 // Static state — hook callbacks are static C functions, can't use `this`.
+// Everything below except the atomics is touched only by the input thread.
 static SharedState* s_state = nullptr;
-static HHOOK s_mouseHook = nullptr;
-static HHOOK s_keyboardHook = nullptr;
-static WinKeyManager s_winKeyMgr;
+static std::atomic<HHOOK> s_mouseHook{nullptr};
+static std::atomic<HHOOK> s_keyboardHook{nullptr};
+
+// Input thread: installs the hooks and pumps messages for them.
+static std::thread s_inputThread;
+static std::atomic<DWORD> s_inputThreadId{0};
+static std::atomic<bool> s_inputThreadReady{false};
+static int64_t s_qpcFrequency = 1;
+// LowLevelHooksTimeout (µs) the service-time warning levels derive from.
+static uint32_t s_hookTimeoutUs = HookServiceProfiler::kDefaultTimeoutUs;
+
+// Decision logic (modifier tracking, toggle chord, edge filters, Start-Menu
+// suppression, consume rules) lives in the platform-free InputRouter; the hook
+// procedures below only translate events in and carry out its actions. Both
+// hooks run on the input thread — no synchronization needed.
+static InputRouter s_router;
+static std::atomic<HWND> s_msgWindow{nullptr};
+
+// SharedState versions last applied on the input thread.
+static uint64_t s_cachedSettingsVersion = 0;
+static uint32_t s_cachedResetRequests = 0;
+// pointerSampleStream: publish WM_MOUSEMOVE positions to the render thread.
+static bool s_pointerSampleStream = false;
 
 // Hook liveness stamp for the R-05 watchdog (GetTickCount64 domain).
 // Silent OS deregistration leaves the HHOOK non-null, so handle checks alone
-// cannot detect it — the watchdog compares this against GetLastInputInfo.
-// Hooks and watchdog both run on the main thread: plain int64_t, no atomic.
-static int64_t s_lastHookCallbackTick = 0;
+// cannot detect it — the watchdog (main thread) compares this against
+// GetLastInputInfo.
+static std::atomic<int64_t> s_lastHookCallbackTick{0};
 
 // Steady-clock ms — same time base as RenderLoop's currentTimeMs() and
 // FocusMonitor's lastFocusChangeTime. KBDLLHOOKSTRUCT::time is in the
@@ -56,363 +87,291 @@ static int64_t steadyNowMs()
     return duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
 }
 
-// Phase 5B: Configurable keys — updated by settings observer on main thread.
-// Safe to read from hook callbacks (same thread). (AC-2.1.19, AC-2.1.20)
-static int s_modifierKeyVK = VK_LWIN;
-static int s_toggleKey1VK  = VK_LCONTROL;
-static int s_toggleKey2VK  = VK_LMENU;
-static HWND s_msgWindow    = nullptr;
-
-// Tracks non-Win modifier key state via keyboard hook for reliable detection
-// in mouse hook. Both hooks run on the main thread — no synchronization needed.
-static bool s_nonWinModifierHeld = false;
+// Same clock in µs — the scroll event stamp, compared against the Raw Input
+// worker's (steady_clock too) by ScrollDeduplicator.
+static int64_t steadyNowUs()
+{
+    using namespace std::chrono;
+    return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
 
-// Phase 5B: Settings observer callback — runs on main thread (same as hooks).
-static void onSettingsChanged(const SettingsSnapshot& s, void* /*userData*/)
+// Physical key state for the router. GetAsyncKeyState is a fast user32 read —
+// hook-safe. Some touchpad drivers send scroll events without the matching
+// keyboard hook events for the modifier, hence the physical fallback. Keys are
+// matched against the router's own modifier tracking; this is read only to
+// confirm a binding that matched.
+static bool asyncKeyDown(int vk, void* /*ctx*/)
 {
-    s_modifierKeyVK = s.modifierKeyVK;
-    s_toggleKey1VK  = s.toggleKey1VK;
-    s_toggleKey2VK  = s.toggleKey2VK;
-    s_nonWinModifierHeld = false;  // Reset on config change to avoid stale state
-    s_winKeyMgr.reset();  // BF-2: Clear stale Win key state on modifier change
+    return (GetAsyncKeyState(vk) & 0x8000) != 0;
 }
+static const KeyStateView s_asyncKeys{asyncKeyDown, nullptr};
 
 // WM_OPEN_SETTINGS defined in common/AppMessages.h
 
-// Helper: check if the configured modifier key is currently held.
-// Mirrors the scroll-gesture modifier check (AC-2.1.19, AC-2.1.20).
-// Win modifier → WinKeyManager state machine; others → hook state OR GetAsyncKeyState.
-// GetAsyncKeyState fallback is needed because some touchpad drivers send scroll events
-// without corresponding keyboard hook events for modifier keys (e.g., Shift+touchpad
-// scroll may bypass the LL keyboard hook when certain apps are focused).
-static bool isConfiguredModifierHeld()
+// Carry out everything but the consume decision. R-05: stores, one queue push
+// per command, at most one PostMessage / SendInput.
+static void applyActions(const RouterActions& a)
 {
-    if (s_modifierKeyVK == VK_LWIN || s_modifierKeyVK == VK_RWIN)
+    for (uint8_t i = 0; i < a.commandCount; ++i)
+        s_state->commandQueue.push(a.commands[i]);
+
+    if (a.scroll)
+    {
+        // Stamped for the render thread's cross-source dedup (ScrollDeduplicator);
+        // a full queue drops the notch rather than block the hook.
+        ScrollEvent ev;
+        ev.timeUs = steadyNowUs();
+        ev.delta = a.scrollDelta;
+        ev.source = ScrollSource::LLHook;
+        s_state->hookScrollQueue.push(ev);
+    }
+
+    // Keyboard activity for caret priority (Phase 3). steadyNowMs, not
+    // info->time: the arbitration compares this against steady_clock timestamps.
+    if (a.keyboardActivity)
+        s_state->lastKeyboardInputTime.store(steadyNowMs(), std::memory_order_relaxed);
+
+    if (a.suppressStartMenu)
+        WinKeyManager::injectStartMenuSuppression();
+
+    if (a.openSettings)
     {
-        // Cross-check physical key state. The state machine alone sticks at
-        // Held* whenever the Win key-up is never delivered — deterministically
-        // on Win+L, where the key-up lands on the secure desktop and LL hooks
-        // receive nothing. Without this check, every plain mouse-wheel scroll
-        // after unlock is consumed and zooms the screen until Win is re-tapped.
-        // GetAsyncKeyState is a fast user32 read — hook-safe.
-        bool physicallyHeld =
-            ((GetAsyncKeyState(VK_LWIN) | GetAsyncKeyState(VK_RWIN)) & 0x8000) != 0;
-        return physicallyHeld && s_winKeyMgr.state() != WinKeyManager::State::Idle;
+        HWND wnd = s_msgWindow.load(std::memory_order_acquire);
+        if (wnd)
+            PostMessageW(wnd, WM_OPEN_SETTINGS, 0, 0);
     }
-    return s_nonWinModifierHeld
-        || (GetAsyncKeyState(toGenericVK(s_modifierKeyVK)) & 0x8000) != 0;
 }
 
-// Helper: check if the configured modifier is the Win key.
-static bool isWinModifier()
+// Pick up configured keys (AC-2.1.19, AC-2.1.20), the message window and
+// reset requests from the main thread. Same pattern as RenderLoop step 0: a
+// few atomic loads per event, the shared_ptr load only on change. configure()
+// also clears stale modifier / Win key state (BF-2).
+static void syncFromSharedState()
 {
-    return s_modifierKeyVK == VK_LWIN || s_modifierKeyVK == VK_RWIN;
+    const uint64_t ver = s_state->settingsVersion.load(std::memory_order_acquire);
+    if (ver != s_cachedSettingsVersion)
+    {
+        s_cachedSettingsVersion = ver;
+        auto snap = std::atomic_load(&s_state->settingsSnapshot);
+        if (snap)
+        {
+            s_router.configure(snap->modifierKeyVK, snap->toggleKey1VK, snap->toggleKey2VK,
+                               snap->keyBindings.data(), snap->keyBindingCount);
+            uint32_t thresholdsUs[kMaxHookSlowThresholds];
+            for (int i = 0; i < snap->hookSlowThresholdCount; ++i)
+                thresholdsUs[i] = static_cast<uint32_t>(snap->hookSlowThresholdsMs[i]) * 1000u;
+            // No-op unless the thresholds changed: slow counts survive
+            // unrelated settings changes.
+            s_state->hookService.configure(thresholdsUs, snap->hookSlowThresholdCount, s_hookTimeoutUs);
+            s_pointerSampleStream = snap->pointerSampleStream;
+        }
+    }
+    s_router.setSettingsShortcutEnabled(s_msgWindow.load(std::memory_order_relaxed) != nullptr);
+    const uint32_t resets = s_state->inputResetRequests.load(std::memory_order_acquire);
+    if (resets != s_cachedResetRequests)
+    {
+        s_cachedResetRequests = resets;
+        applyActions(s_router.resetTransient());
+    }
 }
 
-// ─── Mouse Hook Callback ────────────────────────────────────────────────────
-// Minimal: read event, check modifier via WinKeyManager, update atomics, return.
-static LRESULT CALLBACK mouseHookProc(int nCode, WPARAM wParam, LPARAM lParam)
+// Records one callback into SharedState on scope exit: service time (QPC, µs,
+// per event type) and delivery delay (event timestamp → entry, ms). QPC reads
+// the invariant TSC on current hardware (~20 ns). When the profiler raises its
+// early warning, one PostMessage tells the main thread.
+struct HookTimer
 {
-    s_lastHookCallbackTick = static_cast<int64_t>(GetTickCount64()); // R-05 liveness
-
-    if (nCode < 0 || s_state == nullptr)
-        return CallNextHookEx(s_mouseHook, nCode, wParam, lParam);
-
-    auto* info = reinterpret_cast<MSLLHOOKSTRUCT*>(lParam);
-
-    switch (wParam)
+    LARGE_INTEGER start;
+    HookEventKind kind;
+    HookTimer(DWORD eventTime, HookEventKind k) : kind(k)
     {
-    case WM_MOUSEWHEEL:
+        QueryPerformanceCounter(&start);
+        // DWORD subtraction handles the tick wrap; an event stamped after our
+        // tick read (negative delay) counts as 0.
+        const DWORD delay = GetTickCount() - eventTime;
+        s_state->hookDeliveryMs.record(delay < 0x80000000u ? delay : 0u);
+    }
+    ~HookTimer()
     {
-#ifdef SMOOTHZOOM_INPUT_DIAG  // opt-in per-event hook tracing — deliberately NOT enabled by Debug/SMOOTHZOOM_LOGGING (R-05: hook callbacks must do no I/O)
+        LARGE_INTEGER end;
+        QueryPerformanceCounter(&end);
+        const uint32_t us = static_cast<uint32_t>(
+            (end.QuadPart - start.QuadPart) * 1000000 / s_qpcFrequency);
+        if (s_state->hookService.record(kind, us))
         {
-            wchar_t dbg[256];
-            swprintf_s(dbg, L"[SZ-DIAG] WM_MOUSEWHEEL: nonWinMod=%d, modVK=0x%X, asyncMod=%d, fg=0x%p\n",
-                s_nonWinModifierHeld ? 1 : 0,
-                s_modifierKeyVK,
-                (GetAsyncKeyState(toGenericVK(s_modifierKeyVK)) & 0x8000) ? 1 : 0,
-                GetForegroundWindow());
-            OutputDebugStringW(dbg);
+            HWND wnd = s_msgWindow.load(std::memory_order_acquire);
+            if (wnd)
+                PostMessageW(wnd, WM_HOOK_SERVICE_ALARM, static_cast<WPARAM>(kind), static_cast<LPARAM>(us));
         }
-#endif
-        // Phase 5B: Configurable modifier key (AC-2.1.19, AC-2.1.20)
-        bool modifierHeld = isConfiguredModifierHeld();
-
-        if (modifierHeld)
-        {
-            // Extract scroll delta from high word of mouseData
-            int16_t delta = static_cast<int16_t>(HIWORD(info->mouseData));
+    }
+};
 
-            // Record LL hook scroll timestamp for Raw Input dedup
-            s_state->lastLLHookScrollTime.store(
-                static_cast<int64_t>(GetTickCount64()), std::memory_order_relaxed);
+static HookEventKind mouseEventKind(WPARAM msg)
+{
+    if (msg == WM_MOUSEMOVE)
+        return HookEventKind::MouseMove;
+    if (msg == WM_MOUSEWHEEL || msg == WM_MOUSEHWHEEL)
+        return HookEventKind::MouseWheel;
+    return HookEventKind::MouseButton;
+}
 
-            // Atomically accumulate delta (render thread will exchange-with-0)
-            s_state->scrollAccumulator.fetch_add(delta, std::memory_order_release);
+// ─── Mouse Hook Callback ────────────────────────────────────────────────────
+// Minimal: read event, route, update atomics, return.
+static LRESULT CALLBACK mouseHookProc(int nCode, WPARAM wParam, LPARAM lParam)
+{
+    s_lastHookCallbackTick.store(static_cast<int64_t>(GetTickCount64()),
+                                 std::memory_order_relaxed); // R-05 liveness
 
-            // Suppress Start Menu only when Win is the modifier (AC-2.1.16, AC-2.1.20)
-            if (s_modifierKeyVK == VK_LWIN || s_modifierKeyVK == VK_RWIN)
-                s_winKeyMgr.markUsedForZoom();
+    if (nCode < 0 || s_state == nullptr)
+        return CallNextHookEx(nullptr, nCode, wParam, lParam);
 
-            // Consume the event — do not pass to next hook or applications (AC-2.1.02)
-            return 1;
-        }
-        break;
+    auto* info = reinterpret_cast<MSLLHOOKSTRUCT*>(lParam);
+    const HookTimer timer(info->time, mouseEventKind(wParam)); // every event, moves included
+    syncFromSharedState();
+    if (wParam == WM_MOUSEMOVE && s_pointerSampleStream)
+    {
+        // Sub-frame pointer stream: one wait-free ring push per move.
+        PointerSample sample;
+        sample.timeUs = steadyNowUs();
+        sample.x = info->pt.x;
+        sample.y = info->pt.y;
+        s_state->hookPointerSamples.push(sample);
     }
+    if (wParam != WM_MOUSEWHEEL && wParam != WM_MOUSEHWHEEL)
+        return CallNextHookEx(nullptr, nCode, wParam, lParam);
 
-    case WM_MOUSEHWHEEL:
-    {
-        // Windows (and some mouse drivers) convert Shift+Scroll into horizontal
-        // scroll (WM_MOUSEHWHEEL) before it reaches low-level hooks. Only
-        // intercept when Shift IS the configured modifier — otherwise let
-        // horizontal scroll pass through to applications normally (AC-2.1.02).
-        // R-07: Shift+Scroll conflict mitigation.
-        bool isShiftMod = (s_modifierKeyVK == VK_LSHIFT || s_modifierKeyVK == VK_RSHIFT
-                           || s_modifierKeyVK == VK_SHIFT);
-
-        if (isShiftMod)
-        {
 #ifdef SMOOTHZOOM_INPUT_DIAG  // opt-in per-event hook tracing — deliberately NOT enabled by Debug/SMOOTHZOOM_LOGGING (R-05: hook callbacks must do no I/O)
-            {
-                wchar_t dbg[256];
-                swprintf_s(dbg, L"[SZ-DIAG] WM_MOUSEHWHEEL (Shift mod): nonWinMod=%d, modVK=0x%X, asyncMod=%d, fg=0x%p\n",
-                    s_nonWinModifierHeld ? 1 : 0,
-                    s_modifierKeyVK,
-                    (GetAsyncKeyState(toGenericVK(s_modifierKeyVK)) & 0x8000) ? 1 : 0,
-                    GetForegroundWindow());
-                OutputDebugStringW(dbg);
-            }
+    {
+        wchar_t dbg[256];
+        swprintf_s(dbg, L"[SZ-DIAG] %s: modHeld=%d, modVK=0x%X, asyncMod=%d, fg=0x%p\n",
+            wParam == WM_MOUSEWHEEL ? L"WM_MOUSEWHEEL" : L"WM_MOUSEHWHEEL",
+            s_router.modifierHeld(s_asyncKeys) ? 1 : 0,
+            s_router.modifierVK(),
+            (GetAsyncKeyState(toGenericVK(s_router.modifierVK())) & 0x8000) ? 1 : 0,
+            GetForegroundWindow());
+        OutputDebugStringW(dbg);
+    }
 #endif
-            bool modifierHeld = isConfiguredModifierHeld();
-
-            if (modifierHeld)
-            {
-                int16_t delta = static_cast<int16_t>(HIWORD(info->mouseData));
-
-                // Negate: WM_MOUSEHWHEEL uses opposite sign convention from
-                // WM_MOUSEWHEEL (positive = right, not up). Restores vertical
-                // scroll semantics so scroll-up = zoom-in (AC-2.1.01).
-                delta = -delta;
-
-                // Record LL hook scroll timestamp for Raw Input dedup
-                s_state->lastLLHookScrollTime.store(
-                    static_cast<int64_t>(GetTickCount64()), std::memory_order_relaxed);
 
-                s_state->scrollAccumulator.fetch_add(delta, std::memory_order_release);
+    InputEvent ev;
+    ev.type = wParam == WM_MOUSEWHEEL ? InputEventType::Wheel : InputEventType::HWheel;
+    ev.wheelDelta = static_cast<int16_t>(HIWORD(info->mouseData));
 
-                // Consume — prevent horizontal scroll reaching applications
-                return 1;
-            }
-        }
-        break;
-    }
-
-    default:
-        break;
-    }
+    const RouterActions a = s_router.route(ev, s_asyncKeys);
+    applyActions(a);
 
-    // Pass through to next hook
-    return CallNextHookEx(s_mouseHook, nCode, wParam, lParam);
+    // Consume the event — do not pass to next hook or applications (AC-2.1.02)
+    if (a.consume)
+        return 1;
+    return CallNextHookEx(nullptr, nCode, wParam, lParam);
 }
 
 // ─── Keyboard Hook Callback ─────────────────────────────────────────────────
-// Tracks Win key via WinKeyManager. Consumes zoom-in/out keys only when the
-// configured modifier is held (prevents character leak with Shift modifier);
-// all other keyboard events pass through. (AC-2.1.18)
-// Phase 4: Tracks Ctrl+Alt for temporary toggle (AC-2.7.01–AC-2.7.10).
-
-// Phase 4/5B: Toggle key state — configurable keys (3 bools + 1 queue push), R-05 safe.
-static bool s_toggleKey1Held = false;
-static bool s_toggleKey2Held = false;
-static bool s_toggleEngaged = false;
-
-// Ctrl+Alt+I edge filter: LL hooks receive typematic auto-repeats and
-// KBDLLHOOKSTRUCT carries no repeat flag. Without edge-triggering, holding the
-// chord strobes full-screen inversion at the keyboard repeat rate — a
-// photosensitivity hazard. Set on the first qualifying 'I' down, cleared on 'I' up.
-static bool s_invertChordDown = false;
-
+// Tracks Win key, modifier and toggle keys (AC-2.7.01–AC-2.7.10) through the
+// router. Consumes zoom-in/out and numpad shortcut keys only while the
+// configured modifier is held (prevents character leak with a Shift modifier,
+// and with peripheral macros that SendInput them); all other keyboard events
+// pass through (AC-2.1.18).
+//
+// No keyboard exit shortcut. A bare global Ctrl+Q hijacked a near-universal
+// application shortcut (Quit) and silently terminated SmoothZoom from any
+// focused app. The tray-menu "Exit" item is the sole exit mechanism (AC-2.9.16).
 static LRESULT CALLBACK keyboardHookProc(int nCode, WPARAM wParam, LPARAM lParam)
 {
-    s_lastHookCallbackTick = static_cast<int64_t>(GetTickCount64()); // R-05 liveness
+    s_lastHookCallbackTick.store(static_cast<int64_t>(GetTickCount64()),
+                                 std::memory_order_relaxed); // R-05 liveness
 
     if (nCode < 0 || s_state == nullptr)
-        return CallNextHookEx(s_keyboardHook, nCode, wParam, lParam);
-
-    auto* info = reinterpret_cast<KBDLLHOOKSTRUCT*>(lParam);
+        return CallNextHookEx(nullptr, nCode, wParam, lParam);
 
-    bool isDown = (wParam == WM_KEYDOWN || wParam == WM_SYSKEYDOWN);
-    bool isUp = (wParam == WM_KEYUP || wParam == WM_SYSKEYUP);
+    const bool isDown = (wParam == WM_KEYDOWN || wParam == WM_SYSKEYDOWN);
+    const bool isUp = (wParam == WM_KEYUP || wParam == WM_SYSKEYUP);
+    if (!isDown && !isUp)
+        return CallNextHookEx(nullptr, nCode, wParam, lParam);
 
-    // Track Win key state via WinKeyManager (AC-2.1.04: both LWin and RWin)
-    if (info->vkCode == VK_LWIN || info->vkCode == VK_RWIN)
-    {
-        if (isDown)
-        {
-            s_winKeyMgr.onWinKeyDown();
-        }
-        else if (isUp)
-        {
-            s_winKeyMgr.onWinKeyUp();
-        }
-    }
+    auto* info = reinterpret_cast<KBDLLHOOKSTRUCT*>(lParam);
+    const HookTimer timer(info->time, HookEventKind::Keyboard);
+    syncFromSharedState();
 
-    // Track non-Win modifier state for scroll gesture detection (Issue 1 fix)
-    if (!isWinModifier() && isModifierMatch(static_cast<int>(info->vkCode), s_modifierKeyVK))
-    {
 #ifdef SMOOTHZOOM_INPUT_DIAG  // opt-in per-event hook tracing — deliberately NOT enabled by Debug/SMOOTHZOOM_LOGGING (R-05: hook callbacks must do no I/O)
-        {
-            wchar_t dbg[128];
-            swprintf_s(dbg, L"[SZ-DIAG] ModifierKey vk=0x%X isDown=%d\n",
-                info->vkCode, isDown ? 1 : 0);
-            OutputDebugStringW(dbg);
-        }
-#endif
-        s_nonWinModifierHeld = isDown;
-    }
-
-    // Phase 4/5B: Configurable toggle key tracking (AC-2.7.01–AC-2.7.10)
-    bool isToggle1 = isModifierMatch(info->vkCode, s_toggleKey1VK);
-    bool isToggle2 = isModifierMatch(info->vkCode, s_toggleKey2VK);
-
-    if (isToggle1) s_toggleKey1Held = isDown;
-    if (isToggle2) s_toggleKey2Held = isDown;
-
-    bool bothHeld = s_toggleKey1Held && s_toggleKey2Held;
-    if (bothHeld && !s_toggleEngaged)
+    if (isModifierMatch(static_cast<int>(info->vkCode), s_router.modifierVK()))
     {
-        s_toggleEngaged = true;
-        s_state->commandQueue.push(ZoomCommand::ToggleEngage);
-    }
-    if (!bothHeld && s_toggleEngaged)
-    {
-        s_toggleEngaged = false;
-        s_state->commandQueue.push(ZoomCommand::ToggleRelease);
+        wchar_t dbg[128];
+        swprintf_s(dbg, L"[SZ-DIAG] ModifierKey vk=0x%X isDown=%d\n",
+            info->vkCode, isDown ? 1 : 0);
+        OutputDebugStringW(dbg);
     }
+#endif
 
-    // Clear the inversion-chord edge filter on 'I' release (see s_invertChordDown)
-    if (info->vkCode == 'I' && isUp)
-        s_invertChordDown = false;
+    InputEvent ev;
+    ev.type = isDown ? InputEventType::KeyDown : InputEventType::KeyUp;
+    ev.vk = info->vkCode;
 
-    if (isDown)
-    {
-        // Record keyboard activity timestamp (for caret tracking priority — Phase 3)
-        // Filter out modifier keys — holding Ctrl/Alt/Shift/Win alone should not
-        // activate caret tracking (WS2C fix).
-        if (!isModifierVK(static_cast<int>(info->vkCode)))
-        {
-            // steadyNowMs, not info->time: the arbitration compares this against
-            // steady_clock timestamps (see steadyNowMs comment above).
-            s_state->lastKeyboardInputTime.store(
-                steadyNowMs(), std::memory_order_relaxed);
-        }
+    const RouterActions a = s_router.route(ev, s_asyncKeys);
+    applyActions(a);
 
-        // AC-2.1.18: a non-SmoothZoom key pressed while Win is held (e.g. Win+E/D/L/R,
-        // a Windows shell shortcut) must NOT trigger Start-Menu suppression on Win
-        // release — the injected Ctrl would leak into the launched app and the shell
-        // shortcut should run normally. SmoothZoom's own Win-chord keys (zoom +/-,
-        // Esc reset, Ctrl+M settings) still suppress, so they are excluded here.
-        if (s_winKeyMgr.state() != WinKeyManager::State::Idle
-            && info->vkCode != VK_LWIN && info->vkCode != VK_RWIN
-            && !isModifierVK(static_cast<int>(info->vkCode))
-            && info->vkCode != VK_OEM_PLUS && info->vkCode != VK_ADD
-            && info->vkCode != VK_OEM_MINUS && info->vkCode != VK_SUBTRACT
-            && info->vkCode != VK_ESCAPE && info->vkCode != 'M')
-        {
-            s_winKeyMgr.markUsedWithOtherKey();
-        }
+    // No LLKHF_INJECTED guard: WinKeyManager only injects VK_CONTROL, never a
+    // consumable key, so consuming injected variants is safe.
+    if (a.consume)
+        return 1;       // Consume — prevent character insertion
 
-        // Modifier+key shortcuts (Phase 2: AC-2.8.01–AC-2.8.10, Phase 5B: AC-2.1.19)
-        // Uses configurable modifier — not hardcoded to Win key.
-        bool modHeld = isConfiguredModifierHeld();
-        if (modHeld)
-        {
-            switch (info->vkCode)
-            {
-            case VK_OEM_PLUS:   // '=' / '+' on main keyboard
-            case VK_ADD:        // '+' on numpad
-                s_state->commandQueue.push(ZoomCommand::ZoomIn);
-                if (isWinModifier()) s_winKeyMgr.markUsedForZoom();
-                break;
-
-            case VK_OEM_MINUS:  // '-' on main keyboard
-            case VK_SUBTRACT:   // '-' on numpad
-                s_state->commandQueue.push(ZoomCommand::ZoomOut);
-                if (isWinModifier()) s_winKeyMgr.markUsedForZoom();
-                break;
-
-            case VK_ESCAPE:
-                s_state->commandQueue.push(ZoomCommand::ResetZoom);
-                if (isWinModifier()) s_winKeyMgr.markUsedForZoom();
-                break;
-            }
-        }
-
-        // Win+Ctrl+M → open settings (AC-2.8.11)
-        // Always Win-based regardless of configured modifier.
-        // Physical Win check guards against a stale state machine (missed
-        // key-up across the secure desktop) turning plain Ctrl+M into this.
-        if (info->vkCode == 'M'
-            && s_winKeyMgr.state() != WinKeyManager::State::Idle
-            && ((GetAsyncKeyState(VK_LWIN) | GetAsyncKeyState(VK_RWIN)) & 0x8000)
-            && (GetAsyncKeyState(VK_CONTROL) & 0x8000)
-            && s_msgWindow)
-        {
-            PostMessageW(s_msgWindow, WM_OPEN_SETTINGS, 0, 0);
-            s_winKeyMgr.markUsedForZoom();
-        }
-
-        // Ctrl+Alt+I → toggle color inversion (Phase 6: AC-2.10.01)
-        // Edge-triggered via s_invertChordDown — see declaration comment.
-        if (info->vkCode == 'I')
-        {
-            bool ctrlHeld = (GetAsyncKeyState(VK_CONTROL) & 0x8000) != 0;
-            bool altHeld  = (GetAsyncKeyState(VK_MENU)    & 0x8000) != 0;
-            if (ctrlHeld && altHeld && !s_invertChordDown)
-            {
-                s_invertChordDown = true;
-                s_state->commandQueue.push(ZoomCommand::ToggleInvert);
-            }
-        }
+    // Never consume non-zoom keyboard events (Doc 3 §3.1, AC-2.1.18)
+    return CallNextHookEx(nullptr, nCode, wParam, lParam);
+}
 
-        // No keyboard exit shortcut. A bare global Ctrl+Q hijacked a near-
-        // universal application shortcut (Quit) and silently terminated
-        // SmoothZoom from any focused app. The tray-menu "Exit" item is the sole
-        // exit mechanism (AC-2.9.16); no AC mandates a keyboard exit.
-    }
+// ─── Input Thread ───────────────────────────────────────────────────────────
+// Installs both hooks, reports the result through s_inputThreadReady, then
+// pumps until WM_QUIT. LL hooks need nothing else from the pump: their
+// callbacks are dispatched from inside GetMessage. Thread messages (posted by
+// resetTransientKeyState) only wake it to apply reset requests promptly.
+static void inputThreadMain()
+{
+    // Force the message queue into existence before anyone can post to it.
+    MSG msg;
+    PeekMessageW(&msg, nullptr, WM_USER, WM_USER, PM_NOREMOVE);
+
+    // Service time is bounded by our tiny callbacks; TIME_CRITICAL keeps
+    // dispatch from queueing behind normal-priority work on a loaded system.
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL);
+
+    s_cachedSettingsVersion = ~0ull; // force configure from the current snapshot
+    s_cachedResetRequests = s_state->inputResetRequests.load(std::memory_order_acquire);
+    syncFromSharedState();
+    applyActions(s_router.resetTransient()); // fresh Win/toggle state per install
+
+    s_mouseHook.store(SetWindowsHookExW(WH_MOUSE_LL, mouseHookProc, nullptr, 0));
+    s_keyboardHook.store(SetWindowsHookExW(WH_KEYBOARD_LL, keyboardHookProc, nullptr, 0));
+    s_inputThreadId.store(GetCurrentThreadId(), std::memory_order_release);
+    s_inputThreadReady.store(true, std::memory_order_release);
+
+    while (GetMessageW(&msg, nullptr, 0, 0) > 0)
+        syncFromSharedState();
+
+    if (HHOOK h = s_mouseHook.exchange(nullptr))
+        UnhookWindowsHookEx(h);
+    if (HHOOK h = s_keyboardHook.exchange(nullptr))
+        UnhookWindowsHookEx(h);
+}
 
-    // Consume zoom-in/zoom-out action keys when the configured modifier is held.
-    // Required for non-Win modifiers (e.g., Shift) where Shift+= produces '+' and
-    // Shift+- produces '_', leaking into focused text fields. Also required for
-    // peripheral macros (Logitech Options+, AHK, etc.) that send Shift+=/Shift+-
-    // via SendInput — those events have LLKHF_INJECTED set but must still be
-    // consumed, otherwise the character leaks into the focused app. The zoom
-    // command was already posted above (lines 278-299) on key-down; this gate
-    // blocks the keystroke from reaching applications on BOTH key-down and key-up.
-    //
-    // Why only zoom-in/out (not Esc/settings/toggle/inversion):
-    //   - VK_ESCAPE produces no character — safe to pass through (apps may need it).
-    //   - Win+Ctrl+M, Ctrl+Alt+I, Ctrl+Alt toggle — all use Ctrl/Alt/Win
-    //     which never produce printable characters. Consuming them could break
-    //     standard app behavior (e.g., Esc closing dialogs).
-    //
-    // No LLKHF_INJECTED guard: WinKeyManager only injects VK_CONTROL, never any
-    // of the four zoom keys below, so consuming injected variants is safe and
-    // required for peripheral-macro use cases.
-    if ((isDown || isUp) && isConfiguredModifierHeld())
-    {
-        switch (info->vkCode)
-        {
-        case VK_OEM_PLUS:   // '=' / '+' on main keyboard
-        case VK_ADD:        // '+' on numpad
-        case VK_OEM_MINUS:  // '-' on main keyboard
-        case VK_SUBTRACT:   // '-' on numpad
-            return 1;       // Consume — prevent character insertion
-        }
-    }
+static bool startInputThread()
+{
+    s_inputThreadReady.store(false, std::memory_order_relaxed);
+    s_inputThread = std::thread(inputThreadMain);
+
+    // Wait for the hooks to be installed (or fail) so callers can report it,
+    // as RenderLoop::start() waits for MagBridge init.
+    while (!s_inputThreadReady.load(std::memory_order_acquire))
+        Sleep(1);
+    return s_mouseHook.load() != nullptr && s_keyboardHook.load() != nullptr;
+}
 
-    // Never consume non-zoom keyboard events (Doc 3 §3.1, AC-2.1.18)
-    return CallNextHookEx(s_keyboardHook, nCode, wParam, lParam);
+static void stopInputThread()
+{
+    if (!s_inputThread.joinable())
+        return;
+    PostThreadMessageW(s_inputThreadId.load(std::memory_order_acquire), WM_QUIT, 0, 0);
+    s_inputThread.join();
+    s_inputThreadId.store(0, std::memory_order_release);
 }
 
 // ─── Public Interface ───────────────────────────────────────────────────────
@@ -420,46 +379,40 @@ static LRESULT CALLBACK keyboardHookProc(int nCode, WPARAM wParam, LPARAM lParam
 bool InputInterceptor::install(SharedState& state)
 {
     s_state = &state;
-    s_winKeyMgr = WinKeyManager{}; // Reset state machine
-
-    // Install low-level mouse hook (requires message pump on this thread)
-    s_mouseHook = SetWindowsHookExW(WH_MOUSE_LL, mouseHookProc, nullptr, 0);
-    if (!s_mouseHook)
-        return false;
-
-    // Install low-level keyboard hook
-    s_keyboardHook = SetWindowsHookExW(WH_KEYBOARD_LL, keyboardHookProc, nullptr, 0);
-    if (!s_keyboardHook)
+    LARGE_INTEGER freq;
+    QueryPerformanceFrequency(&freq);
+    s_qpcFrequency = freq.QuadPart;
+
+    // The OS hook timeout (ms, REG_DWORD). Windows 7+ caps it at
+    // 1000 ms and uses the default when the value is absent.
+    s_hookTimeoutUs = HookServiceProfiler::kDefaultTimeoutUs;
+    DWORD timeoutMs = 0;
+    DWORD size = sizeof(timeoutMs);
+    if (RegGetValueW(HKEY_CURRENT_USER, L"Control Panel\\Desktop", L"LowLevelHooksTimeout",
+                     RRF_RT_REG_DWORD, nullptr, &timeoutMs, &size) == ERROR_SUCCESS
+        && timeoutMs > 0)
+        s_hookTimeoutUs = (timeoutMs < 1000 ? timeoutMs : 1000) * 1000u;
+
+    if (!startInputThread())
     {
-        UnhookWindowsHookEx(s_mouseHook);
-        s_mouseHook = nullptr;
+        uninstall();
         return false;
     }
 
     // Seed liveness so the watchdog has a grace period before any input arrives
-    s_lastHookCallbackTick = static_cast<int64_t>(GetTickCount64());
-
+    s_lastHookCallbackTick.store(static_cast<int64_t>(GetTickCount64()));
     return true;
 }
 
 void InputInterceptor::uninstall()
 {
-    if (s_mouseHook)
-    {
-        UnhookWindowsHookEx(s_mouseHook);
-        s_mouseHook = nullptr;
-    }
-    if (s_keyboardHook)
-    {
-        UnhookWindowsHookEx(s_keyboardHook);
-        s_keyboardHook = nullptr;
-    }
+    stopInputThread();
     s_state = nullptr;
 }
 
 bool InputInterceptor::isHealthy() const
 {
-    return s_mouseHook != nullptr && s_keyboardHook != nullptr;
+    return s_mouseHook.load() != nullptr && s_keyboardHook.load() != nullptr;
 }
 
 bool InputInterceptor::reinstall()
@@ -467,17 +420,11 @@ bool InputInterceptor::reinstall()
     if (s_state == nullptr)
         return false;
 
-    // Reinstall unhealthy hooks (R-05, AC-ERR.03)
-    if (!s_mouseHook)
-    {
-        s_mouseHook = SetWindowsHookExW(WH_MOUSE_LL, mouseHookProc, nullptr, 0);
-    }
-    if (!s_keyboardHook)
-    {
-        s_keyboardHook = SetWindowsHookExW(WH_KEYBOARD_LL, keyboardHookProc, nullptr, 0);
-    }
-
-    return isHealthy();
+    // Reinstall unhealthy hooks (R-05, AC-ERR.03). Hooks belong to the thread
+    // that installed them, so this restarts the input thread.
+    if (isHealthy())
+        return true;
+    return forceReinstall();
 }
 
 bool InputInterceptor::forceReinstall()
@@ -486,33 +433,22 @@ bool InputInterceptor::forceReinstall()
         return false;
 
     // Silent OS deregistration (R-05) leaves the HHOOK non-null but dead, so
-    // unconditionally unhook and rehook. UnhookWindowsHookEx on an
-    // already-deregistered handle fails harmlessly.
-    if (s_mouseHook)
-    {
-        UnhookWindowsHookEx(s_mouseHook);
-        s_mouseHook = nullptr;
-    }
-    if (s_keyboardHook)
-    {
-        UnhookWindowsHookEx(s_keyboardHook);
-        s_keyboardHook = nullptr;
-    }
-    s_mouseHook = SetWindowsHookExW(WH_MOUSE_LL, mouseHookProc, nullptr, 0);
-    s_keyboardHook = SetWindowsHookExW(WH_KEYBOARD_LL, keyboardHookProc, nullptr, 0);
-
-    // Key-up events were likely missed during the outage — clear held-key state.
-    resetTransientKeyState();
+    // unconditionally unhook and rehook on a fresh input thread.
+    // UnhookWindowsHookEx on an already-deregistered handle fails harmlessly.
+    // The new thread starts with cleared held-key state (key-ups were likely
+    // missed during the outage).
+    stopInputThread();
+    const bool restored = startInputThread();
 
     // Restart the liveness grace period
-    s_lastHookCallbackTick = static_cast<int64_t>(GetTickCount64());
+    s_lastHookCallbackTick.store(static_cast<int64_t>(GetTickCount64()));
 
-    return isHealthy();
+    return restored;
 }
 
 int64_t InputInterceptor::lastCallbackTick()
 {
-    return s_lastHookCallbackTick;
+    return s_lastHookCallbackTick.load(std::memory_order_relaxed);
 }
 
 void InputInterceptor::resetTransientKeyState()
@@ -520,30 +456,20 @@ void InputInterceptor::resetTransientKeyState()
     // Clears every held/engaged flag derived from hook-delivered key events.
     // Called when key-ups may have been missed: secure-desktop transitions
     // (Win+L strands WinKeyManager in Held*, hijacking plain scrolling into
-    // zoom after unlock) and hook reinstalls after an outage.
-    s_winKeyMgr.reset();
-    s_nonWinModifierHeld = false;
-    s_toggleKey1Held = false;
-    s_toggleKey2Held = false;
-    s_invertChordDown = false;
-    if (s_toggleEngaged)
-    {
-        s_toggleEngaged = false;
-        if (s_state)
-            s_state->commandQueue.push(ZoomCommand::ToggleRelease);
-    }
-}
-
-// Phase 5B: Register for settings change notifications (AC-2.9.04)
-void InputInterceptor::registerSettingsObserver(SettingsManager& mgr)
-{
-    mgr.addObserver(onSettingsChanged, nullptr);
+    // zoom after unlock). Applied on the input thread; the thread message only
+    // wakes it so an engaged toggle is released without waiting for input.
+    if (s_state == nullptr)
+        return;
+    s_state->inputResetRequests.fetch_add(1, std::memory_order_release);
+    if (DWORD tid = s_inputThreadId.load(std::memory_order_acquire))
+        PostThreadMessageW(tid, WM_NULL, 0, 0);
 }
 
-// Phase 5B: Store message window handle for Win+Ctrl+M posting (AC-2.8.11)
+// Phase 5B: Store message window handle for Win+Ctrl+M posting (AC-2.8.11).
+// The input thread picks it up on its next callback.
 void InputInterceptor::setMessageWindow(void* hWnd)
 {
-    s_msgWindow = static_cast<HWND>(hWnd);
+    s_msgWindow.store(static_cast<HWND>(hWnd), std::memory_order_release);
 }
 
 } // namespace SmoothZoom
@@ -0,0 +1,263 @@
+// =============================================================================
+// SmoothZoom — InputRouter
+// Platform-free decision logic of the low-level hooks. Doc 3 §3.1, §3.2
+//
+// Behavior is that of the former inline hook procedures; InputInterceptor
+// now only translates events in and actions out (see InputRouter.h).
+// =============================================================================
+
+#include "smoothzoom/input/InputRouter.h"
+
+namespace SmoothZoom
+{
+
+namespace
+{
+
+// Held modifier keys, one bit per side; the hook sees L/R VKs, so one side's
+// release must not drop a family the other side still holds.
+constexpr uint8_t kSideCtrl = 0x03, kSideAlt = 0x0C, kSideShift = 0x30, kSideWin = 0xC0;
+
+uint8_t sideBitOf(uint32_t vk)
+{
+    switch (vk)
+    {
+    case VK_LCONTROL: case VK_CONTROL: return 0x01;
+    case VK_RCONTROL: return 0x02;
+    case VK_LMENU: case VK_MENU: return 0x04;
+    case VK_RMENU: return 0x08;
+    case VK_LSHIFT: case VK_SHIFT: return 0x10;
+    case VK_RSHIFT: return 0x20;
+    case VK_LWIN: return 0x40;
+    case VK_RWIN: return 0x80;
+    default: return 0;
+    }
+}
+
+uint8_t modsOf(uint8_t sides)
+{
+    return static_cast<uint8_t>(((sides & kSideCtrl) ? kKeyModCtrl : 0)
+                                | ((sides & kSideAlt) ? kKeyModAlt : 0)
+                                | ((sides & kSideShift) ? kKeyModShift : 0)
+                                | ((sides & kSideWin) ? kKeyModWin : 0));
+}
+
+} // namespace
+
+void InputRouter::configure(int modifierVK, int toggleKey1VK, int toggleKey2VK,
+                            const KeyBinding* bindings, int bindingCount)
+{
+    modifierVK_ = modifierVK;
+    shiftModifier_ = (modifierVK == VK_LSHIFT || modifierVK == VK_RSHIFT
+                      || modifierVK == VK_SHIFT);
+
+    for (int vk = 0; vk < 256; ++vk)
+    {
+        uint8_t r = 0;
+        if (vk == VK_LWIN || vk == VK_RWIN)
+            r |= kRoleWin;
+        if (isModifierVK(vk))
+            r |= kRoleModifierKey;
+        if (!winModifier() && isModifierMatch(vk, modifierVK))
+            r |= kRoleConfigMod;
+        if (isModifierMatch(vk, toggleKey1VK))
+            r |= kRoleToggle1;
+        if (isModifierMatch(vk, toggleKey2VK))
+            r |= kRoleToggle2;
+        role_[static_cast<size_t>(vk)] = r;
+    }
+
+    // Keyboard shortcuts (Phase 2: AC-2.8.01–AC-2.8.11, Phase 5B: AC-2.1.19,
+    // AC-2.10.01), "Modifier" resolved to the configured modifier.
+    if (bindings == nullptr)
+    {
+        bindings = kDefaultKeyBindings;
+        bindingCount = kDefaultKeyBindingCount;
+    }
+    bindings_.compile(bindings, bindingCount, modifierVK);
+
+    // A settings change invalidates the tracked modifier state (BF-2).
+    nonWinModifierHeld_ = false;
+    modSides_ = 0;
+    edgeKeyDownVK_ = 0;
+    winKeys_.reset();
+}
+
+const KeyBindingTable::Entry* InputRouter::matchBinding(uint32_t vk, const KeyStateView& keys)
+{
+    // Common case: no binding for this key under the held modifiers — one
+    // table read, no physical key queries.
+    const KeyBindingTable::Entry* e = bindings_.match(vk, modsOf(modSides_));
+    while (e != nullptr)
+    {
+        // Confirm the binding's modifiers physically. A tracked modifier can be
+        // stale: on Win+L the key-up lands on the secure desktop and LL hooks
+        // receive nothing, so the next plain '+' must not zoom. Drop what is
+        // not down and look again (each pass drops at least one family).
+        uint8_t stale = 0;
+        if ((e->mods & kKeyModCtrl) && !keys.down(VK_CONTROL))
+            stale |= kSideCtrl;
+        if ((e->mods & kKeyModAlt) && !keys.down(VK_MENU))
+            stale |= kSideAlt;
+        if ((e->mods & kKeyModShift) && !keys.down(VK_SHIFT))
+            stale |= kSideShift;
+        if ((e->mods & kKeyModWin) && !keys.down(VK_LWIN) && !keys.down(VK_RWIN))
+            stale |= kSideWin;
+        if (stale == 0)
+            return e;
+        modSides_ = static_cast<uint8_t>(modSides_ & ~stale);
+        e = bindings_.match(vk, modsOf(modSides_));
+    }
+    return nullptr;
+}
+
+bool InputRouter::modifierHeld(const KeyStateView& keys) const
+{
+    if (winModifier())
+    {
+        // Cross-check physical key state. The state machine alone sticks at
+        // Held* whenever the Win key-up is never delivered — deterministically
+        // on Win+L, where the key-up lands on the secure desktop and LL hooks
+        // receive nothing. Without this check, every plain mouse-wheel scroll
+        // after unlock is consumed and zooms the screen until Win is re-tapped.
+        return winKeys_.state() != WinKeyManager::State::Idle
+            && (keys.down(VK_LWIN) || keys.down(VK_RWIN));
+    }
+    // Physical-state fallback: some touchpad drivers send scroll events without
+    // the matching keyboard hook events for the modifier.
+    return nonWinModifierHeld_ || keys.down(toGenericVK(modifierVK_));
+}
+
+RouterActions InputRouter::route(const InputEvent& ev, const KeyStateView& keys)
+{
+    if (ev.type == InputEventType::Wheel || ev.type == InputEventType::HWheel)
+        return routeWheel(ev, keys);
+    return routeKey(ev, keys);
+}
+
+RouterActions InputRouter::routeWheel(const InputEvent& ev, const KeyStateView& keys)
+{
+    RouterActions a;
+    if (ev.type == InputEventType::HWheel)
+    {
+        // Windows (and some mouse drivers) convert Shift+Scroll into horizontal
+        // scroll before it reaches low-level hooks. Only intercept when Shift IS
+        // the configured modifier — otherwise horizontal scroll passes through
+        // (AC-2.1.02, R-07). WM_MOUSEHWHEEL's sign is opposite (+ = right), so
+        // negate to keep scroll-up = zoom-in (AC-2.1.01).
+        if (shiftModifier_ && modifierHeld(keys))
+        {
+            a.scroll = true;
+            a.scrollDelta = -static_cast<int32_t>(ev.wheelDelta);
+            a.consume = true;
+        }
+        return a;
+    }
+
+    if (modifierHeld(keys))
+    {
+        a.scroll = true;
+        a.scrollDelta = ev.wheelDelta;
+        // Suppress Start Menu only when Win is the modifier (AC-2.1.16, AC-2.1.20)
+        if (winModifier())
+            winKeys_.markUsedForZoom();
+        a.consume = true; // AC-2.1.02
+    }
+    return a;
+}
+
+RouterActions InputRouter::routeKey(const InputEvent& ev, const KeyStateView& keys)
+{
+    RouterActions a;
+    const bool isDown = ev.type == InputEventType::KeyDown;
+    const uint16_t r = ev.vk < 256 ? role_[ev.vk] : 0;
+
+    // Win key state machine (AC-2.1.04: both LWin and RWin)
+    if (r & kRoleWin)
+    {
+        if (isDown)
+            winKeys_.onWinKeyDown();
+        else
+            a.suppressStartMenu = winKeys_.release();
+    }
+
+    // Modifier state for scroll gesture detection and binding matching
+    if (r & kRoleConfigMod)
+        nonWinModifierHeld_ = isDown;
+    if (r & kRoleModifierKey)
+    {
+        const uint8_t side = sideBitOf(ev.vk);
+        modSides_ = static_cast<uint8_t>(isDown ? (modSides_ | side) : (modSides_ & ~side));
+    }
+
+    // Temporary toggle chord (AC-2.7.01–AC-2.7.10)
+    if (r & kRoleToggle1)
+        toggle1Held_ = isDown;
+    if (r & kRoleToggle2)
+        toggle2Held_ = isDown;
+    const bool bothHeld = toggle1Held_ && toggle2Held_;
+    if (bothHeld != toggleEngaged_)
+    {
+        toggleEngaged_ = bothHeld;
+        a.push(bothHeld ? ZoomCommand::ToggleEngage : ZoomCommand::ToggleRelease);
+    }
+
+    const KeyBindingTable::Entry* b = (r & kRoleModifierKey) ? nullptr : matchBinding(ev.vk, keys);
+    if (!isDown)
+    {
+        if (ev.vk == edgeKeyDownVK_)
+            edgeKeyDownVK_ = 0;
+    }
+    else
+    {
+        // Keyboard activity for caret priority — modifiers alone don't count (WS2C).
+        if (!(r & kRoleModifierKey))
+            a.keyboardActivity = true;
+
+        // AC-2.1.18: a non-SmoothZoom key pressed while Win is held (Win+E/D/L/R,
+        // a shell shortcut) must NOT trigger Start-Menu suppression on Win release.
+        if (winKeys_.state() != WinKeyManager::State::Idle && b == nullptr
+            && !(r & (kRoleWin | kRoleModifierKey)))
+            winKeys_.markUsedWithOtherKey();
+
+        // Edge-triggered bindings fire once per press; a different key re-arms.
+        if (b != nullptr && (!b->edge || edgeKeyDownVK_ != ev.vk))
+        {
+            if (b->edge)
+                edgeKeyDownVK_ = ev.vk;
+            // Win+Ctrl+M → open settings (AC-2.8.11), once a window can take it.
+            if (b->command == ZoomCommand::OpenSettings)
+                a.openSettings = settingsShortcut_;
+            else
+                a.push(b->command);
+        }
+        if (b != nullptr && (b->mods & kKeyModWin))
+            winKeys_.markUsedForZoom();
+    }
+
+    // Swallow zoom / preset keys on both down and up while their chord is held,
+    // including injected ones (peripheral macros): with a Shift modifier,
+    // Shift+= types '+'. Never other keys (AC-2.1.18).
+    if (b != nullptr && b->consume)
+        a.consume = true;
+    return a;
+}
+
+RouterActions InputRouter::resetTransient()
+{
+    RouterActions a;
+    winKeys_.reset();
+    nonWinModifierHeld_ = false;
+    toggle1Held_ = false;
+    toggle2Held_ = false;
+    modSides_ = 0;
+    edgeKeyDownVK_ = 0;
+    if (toggleEngaged_)
+    {
+        toggleEngaged_ = false;
+        a.push(ZoomCommand::ToggleRelease);
+    }
+    return a;
+}
+
+} // namespace SmoothZoom
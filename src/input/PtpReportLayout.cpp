@@ -0,0 +1,261 @@
+// =============================================================================
+// SmoothZoom — PtpReportLayout (Win32 loader)
+// Builds a PtpReportLayout from a Raw Input HID device. Doc 3 §3.1, R-08
+//
+// HIDP_VALUE_CAPS / HIDP_BUTTON_CAPS give usage, link collection, report ID and
+// bit size but not the bit position. Each field's position is found once by
+// writing it into a scratch report with the public HidP_Set* APIs and diffing:
+// a value field set to 0 vs. all-ones differs in exactly its own bits; a tip
+// switch or confidence bit set vs. not set differs in exactly one bit. Fields
+// that do not probe cleanly (usage arrays, ranges, multi-count values) are left
+// absent and decode as 0. The preparsed data is freed before returning — the
+// per-report path never touches it.
+// =============================================================================
+
+#include "smoothzoom/input/PtpReportLayout.h"
+
+#ifndef SMOOTHZOOM_TESTING
+#include <windows.h>
+extern "C" {
+#include <hidusage.h>
+#include <hidpi.h>
+}
+#include "smoothzoom/support/Logger.h"
+
+#include <algorithm>
+#include <vector>
+#endif
+
+namespace SmoothZoom
+{
+
+#ifndef SMOOTHZOOM_TESTING
+
+namespace
+{
+
+// First differing bit between two equal-length reports and the count of
+// differing bits.
+struct BitDiff
+{
+    int first = -1;
+    int count = 0;
+};
+
+BitDiff diffBits(const std::vector<char>& a, const std::vector<char>& b)
+{
+    BitDiff d;
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        const unsigned x = static_cast<unsigned char>(a[i] ^ b[i]);
+        for (int bit = 0; bit < 8; ++bit)
+        {
+            if (x & (1u << bit))
+            {
+                if (d.first < 0)
+                    d.first = static_cast<int>(i * 8) + bit;
+                ++d.count;
+            }
+        }
+    }
+    return d;
+}
+
+bool initReport(std::vector<char>& buf, UCHAR reportId, PHIDP_PREPARSED_DATA ppd)
+{
+    std::fill(buf.begin(), buf.end(), 0);
+    return HidP_InitializeReportForID(HidP_Input, reportId, ppd, buf.data(),
+                                      static_cast<ULONG>(buf.size())) == HIDP_STATUS_SUCCESS;
+}
+
+PtpField probeValue(const HIDP_VALUE_CAPS& vc, PHIDP_PREPARSED_DATA ppd,
+                    std::vector<char>& lo, std::vector<char>& hi)
+{
+    if (vc.IsRange || vc.ReportCount != 1 || vc.BitSize == 0 || vc.BitSize > 32)
+        return {};
+    const ULONG ones = vc.BitSize == 32 ? 0xFFFFFFFFul : ((1ul << vc.BitSize) - 1);
+    const ULONG len = static_cast<ULONG>(lo.size());
+    if (!initReport(lo, vc.ReportID, ppd) || !initReport(hi, vc.ReportID, ppd))
+        return {};
+    if (HidP_SetUsageValue(HidP_Input, vc.UsagePage, vc.LinkCollection, vc.NotRange.Usage,
+                           0, ppd, lo.data(), len) != HIDP_STATUS_SUCCESS
+        || HidP_SetUsageValue(HidP_Input, vc.UsagePage, vc.LinkCollection, vc.NotRange.Usage,
+                              ones, ppd, hi.data(), len) != HIDP_STATUS_SUCCESS)
+        return {};
+    const BitDiff d = diffBits(lo, hi);
+    if (d.count != vc.BitSize)
+        return {};
+    return {static_cast<uint16_t>(d.first), static_cast<uint8_t>(vc.BitSize)};
+}
+
+PtpField probeButton(USAGE page, USHORT linkCollection, USAGE usage, UCHAR reportId,
+                     PHIDP_PREPARSED_DATA ppd, std::vector<char>& base, std::vector<char>& set)
+{
+    if (!initReport(base, reportId, ppd) || !initReport(set, reportId, ppd))
+        return {};
+    ULONG n = 1;
+    if (HidP_SetUsages(HidP_Input, page, linkCollection, &usage, &n, ppd, set.data(),
+                       static_cast<ULONG>(set.size())) != HIDP_STATUS_SUCCESS)
+        return {};
+    const BitDiff d = diffBits(base, set);
+    if (d.count != 1) // usage array (index byte), not a bit field
+        return {};
+    return {static_cast<uint16_t>(d.first), 1};
+}
+
+} // namespace
+
+bool loadPtpReportLayout(void* hDevice, PtpReportLayout& out)
+{
+    // One-shot guard: log detailed diagnostics only on first failure per device
+    static bool s_diagLogged = false;
+    out = PtpReportLayout{};
+
+    UINT ppSize = 0;
+    if (GetRawInputDeviceInfoW(hDevice, RIDI_PREPARSEDDATA, nullptr, &ppSize) != 0)
+    {
+        if (!s_diagLogged)
+            SZ_LOG_WARN("PTP", L"loadPtpReportLayout: GetRawInputDeviceInfoW size query failed (GetLastError=%lu)", GetLastError());
+        s_diagLogged = true;
+        return false;
+    }
+    if (ppSize == 0 || ppSize > 65536)
+    {
+        if (!s_diagLogged)
+            SZ_LOG_WARN("PTP", L"loadPtpReportLayout: preparsed data size out of range (ppSize=%u)", ppSize);
+        s_diagLogged = true;
+        return false;
+    }
+
+    std::vector<unsigned char> ppBuf(ppSize);
+    if (GetRawInputDeviceInfoW(hDevice, RIDI_PREPARSEDDATA, ppBuf.data(), &ppSize) == UINT(-1))
+    {
+        if (!s_diagLogged)
+            SZ_LOG_WARN("PTP", L"loadPtpReportLayout: GetRawInputDeviceInfoW data retrieval failed (GetLastError=%lu)", GetLastError());
+        s_diagLogged = true;
+        return false;
+    }
+    auto ppd = reinterpret_cast<PHIDP_PREPARSED_DATA>(ppBuf.data());
+
+    HIDP_CAPS caps = {};
+    NTSTATUS capsStatus = HidP_GetCaps(ppd, &caps);
+    if (capsStatus != HIDP_STATUS_SUCCESS)
+    {
+        if (!s_diagLogged)
+            SZ_LOG_WARN("PTP", L"loadPtpReportLayout: HidP_GetCaps failed (NTSTATUS=0x%08lX)", static_cast<unsigned long>(capsStatus));
+        s_diagLogged = true;
+        return false;
+    }
+
+    USHORT numValCaps = caps.NumberInputValueCaps;
+    if (numValCaps == 0 || numValCaps > 256 || caps.InputReportByteLength == 0
+        || caps.InputReportByteLength > PtpReportLayout::kMaxReportBytes)
+    {
+        if (!s_diagLogged)
+            SZ_LOG_WARN("PTP", L"loadPtpReportLayout: caps out of range (numValCaps=%u, InputReportByteLength=%u, UsagePage=0x%04X, Usage=0x%04X)",
+                        numValCaps, caps.InputReportByteLength, caps.UsagePage, caps.Usage);
+        s_diagLogged = true;
+        return false;
+    }
+
+    std::vector<HIDP_VALUE_CAPS> valCaps(numValCaps);
+    NTSTATUS valStatus = HidP_GetValueCaps(HidP_Input, valCaps.data(), &numValCaps, ppd);
+    if (valStatus != HIDP_STATUS_SUCCESS)
+    {
+        if (!s_diagLogged)
+            SZ_LOG_WARN("PTP", L"loadPtpReportLayout: HidP_GetValueCaps failed (NTSTATUS=0x%08lX)", static_cast<unsigned long>(valStatus));
+        s_diagLogged = true;
+        return false;
+    }
+    valCaps.resize(numValCaps);
+
+    USHORT numBtnCaps = caps.NumberInputButtonCaps;
+    std::vector<HIDP_BUTTON_CAPS> btnCaps(numBtnCaps);
+    if (numBtnCaps != 0
+        && HidP_GetButtonCaps(HidP_Input, btnCaps.data(), &numBtnCaps, ppd) != HIDP_STATUS_SUCCESS)
+        numBtnCaps = 0; // no tip switches → contacts never go active; compile still logs
+    btnCaps.resize(numBtnCaps);
+
+    if (!s_diagLogged)
+    {
+        SZ_LOG_INFO("PTP", L"loadPtpReportLayout: HID caps — UsagePage=0x%04X, Usage=0x%04X, InputValueCaps=%u, InputButtonCaps=%u, InputReportByteLength=%u",
+                    caps.UsagePage, caps.Usage, caps.NumberInputValueCaps, caps.NumberInputButtonCaps,
+                    caps.InputReportByteLength);
+    }
+
+    std::vector<char> a(caps.InputReportByteLength), b(caps.InputReportByteLength);
+    std::vector<PtpFieldDesc> fields;
+    fields.reserve(valCaps.size() + btnCaps.size());
+    bool usesReportIds = false;
+
+    for (size_t i = 0; i < valCaps.size(); ++i)
+    {
+        const HIDP_VALUE_CAPS& vc = valCaps[i];
+        USAGE usage = vc.IsRange ? vc.Range.UsageMin : vc.NotRange.Usage;
+        usesReportIds |= vc.ReportID != 0;
+
+        PtpFieldDesc f;
+        f.usagePage = vc.UsagePage;
+        f.usage = usage;
+        f.linkCollection = vc.LinkCollection;
+        f.reportId = vc.ReportID;
+        f.field = probeValue(vc, ppd, a, b);
+        f.logicalMin = vc.LogicalMin;
+        f.logicalMax = vc.LogicalMax;
+        fields.push_back(f);
+
+        // Log each value cap on first attempt for diagnostics
+        if (!s_diagLogged)
+        {
+            SZ_LOG_INFO("PTP", L"  ValCap[%zu]: UsagePage=0x%04X, Usage=0x%04X, LinkCollection=%u, ReportID=%u, IsRange=%d, BitSize=%u, BitOffset=%d",
+                        i, vc.UsagePage, usage, vc.LinkCollection, vc.ReportID, vc.IsRange, vc.BitSize,
+                        f.field.present() ? static_cast<int>(f.field.bitOffset) : -1);
+        }
+    }
+
+    for (const HIDP_BUTTON_CAPS& bc : btnCaps)
+    {
+        if (bc.UsagePage != kHidPageDigitizer)
+            continue;
+        const USAGE lo = bc.IsRange ? bc.Range.UsageMin : bc.NotRange.Usage;
+        const USAGE hi = bc.IsRange ? bc.Range.UsageMax : bc.NotRange.Usage;
+        for (const USAGE usage : {kHidUsageTipSwitch, kHidUsageConfidence})
+        {
+            if (usage < lo || usage > hi)
+                continue;
+
+            PtpFieldDesc f;
+            f.usagePage = kHidPageDigitizer;
+            f.usage = usage;
+            f.linkCollection = bc.LinkCollection;
+            f.reportId = bc.ReportID;
+            f.field = probeButton(kHidPageDigitizer, bc.LinkCollection, usage, bc.ReportID,
+                                  ppd, a, b);
+            fields.push_back(f);
+        }
+    }
+
+    if (!out.compile(fields.data(), fields.size(), usesReportIds))
+    {
+        if (!s_diagLogged)
+            SZ_LOG_WARN("PTP", L"loadPtpReportLayout: No Contact Count or Contact ID found in %u value caps — device is not a PTP or uses unexpected descriptor",
+                        numValCaps);
+        s_diagLogged = true;
+        return false;
+    }
+
+    for (int s = 0; s < out.numSlots; ++s)
+    {
+        const PtpSlotLayout& l = out.slots[s];
+        SZ_LOG_INFO("PTP", L"  slot=%d lc=%u bits: id=%u/%u tip=%u/%u conf=%u/%u x=%u/%u y=%u/%u",
+                    s, l.linkCollection, l.contactId.bitOffset, l.contactId.bitSize,
+                    l.tipSwitch.bitOffset, l.tipSwitch.bitSize, l.confidence.bitOffset,
+                    l.confidence.bitSize, l.x.bitOffset, l.x.bitSize, l.y.bitOffset, l.y.bitSize);
+    }
+    s_diagLogged = false; // allow logging for future device changes
+    return true;
+}
+
+#endif // SMOOTHZOOM_TESTING
+
+} // namespace SmoothZoom
@@ -0,0 +1,246 @@
+// =============================================================================
+// SmoothZoom — RawInputProcessor
+// Platform-free bulk processing of Raw Input batches. Doc 3 §3.1, R-08
+//
+// Behavior per packet is that of the former main-thread WM_INPUT handler
+// (mouse wheel fallback + handlePtpHidReport) plus PTP pinch-to-zoom; see
+// RawInputProcessor.h and PtpGestureRecognizer.h.
+// =============================================================================
+
+#include "smoothzoom/input/RawInputProcessor.h"
+#include "smoothzoom/input/ScrollNormalizer.h"
+
+#include <cstring>
+
+namespace SmoothZoom
+{
+
+void RawInputBatchStats::emit(ScrollSource source, uint64_t device, int64_t timeUs,
+                              int32_t delta, float logZoom)
+{
+    scrollDelta += delta;
+    pinchLogZoom += logZoom;
+    // PTP: one event per device run — consecutive reports extend it.
+    if (source == ScrollSource::PtpHid && eventCount > 0)
+    {
+        ScrollEvent& last = events[eventCount - 1];
+        if (last.source == source && last.device == device)
+        {
+            last.delta += delta;
+            last.logZoom += logZoom;
+            return;
+        }
+    }
+    if (eventCount < kMaxEvents)
+    {
+        events[eventCount++] = ScrollEvent{timeUs, device, delta, source, logZoom};
+        return;
+    }
+    for (int i = eventCount - 1; i >= 0; --i)
+    {
+        if (events[i].source == source && events[i].device == device)
+        {
+            events[i].delta += delta;
+            events[i].logZoom += logZoom;
+            return;
+        }
+    }
+    scrollDelta -= delta; // no event to carry it
+    pinchLogZoom -= logZoom;
+    ++ignored;
+}
+
+void RawInputProcessor::setDeviceLoader(DeviceLoader loader, void* ctx)
+{
+    loader_ = loader;
+    loaderCtx_ = ctx;
+    reset();
+}
+
+void RawInputProcessor::reset()
+{
+    devices_.clear();
+}
+
+PtpDevice* RawInputProcessor::load(uint64_t device)
+{
+    // The only place a layout is built — HID parsing and its allocations stay
+    // out of the per-report path.
+    PtpDeviceInfo info;
+    const bool ok = loader_ != nullptr && loader_(loaderCtx_, device, info) && info.layout.valid;
+    return devices_.insert(device, ok ? &info : nullptr);
+}
+
+const PtpDevice* RawInputProcessor::deviceArrived(uint64_t device)
+{
+    const PtpDevice* d = devices_.find(device);
+    if (d != nullptr && d->usable)
+        return d; // its first packet beat the notification
+    return load(device);
+}
+
+void RawInputProcessor::deviceRemoved(uint64_t device)
+{
+    devices_.remove(device);
+}
+
+void RawInputProcessor::setDeviceProfiles(const PtpDeviceProfile* profiles, int count)
+{
+    devices_.setProfiles(profiles, count);
+}
+
+void RawInputProcessor::process(const uint8_t* batch, size_t bytes, uint32_t count,
+                                const RawInputGate& gate, RawInputBatchStats& stats)
+{
+    const bool gated = !gate.modifierHeld;
+
+    size_t offset = 0;
+    for (uint32_t i = 0; i < count && offset + sizeof(RawPacketHeader) <= bytes; ++i)
+    {
+        RawPacketHeader h;
+        std::memcpy(&h, batch + offset, sizeof(h));
+        if (h.size < sizeof(RawPacketHeader) || h.size > bytes - offset)
+        {
+            ++stats.ignored; // malformed — the rest of the batch is unreachable
+            break;
+        }
+        ++stats.packets;
+        const uint8_t* packet = batch + offset;
+
+        if (h.type == kRawTypeMouse && h.size >= kRawMouseOffset + sizeof(RawMousePacket))
+        {
+            RawMousePacket m;
+            std::memcpy(&m, packet + kRawMouseOffset, sizeof(m));
+            const int16_t delta = (m.buttonFlags & (kRawMouseWheel | kRawMouseHWheel))
+                ? static_cast<int16_t>(m.buttonData) : int16_t{0};
+            if (gate.pointerMotion && (m.flags & kRawMouseMoveAbsolute) == 0
+                && (m.lastX != 0 || m.lastY != 0))
+            {
+                ++stats.motionPackets;
+                stats.motionX += m.lastX;
+                stats.motionY += m.lastY;
+            }
+            if (delta != 0)
+            {
+                ++stats.wheelPackets;
+                if (!gated)
+                    stats.emit(ScrollSource::RawMouse, h.device, gate.timeUs,
+                               mouseWheelToWheelEquiv(delta));
+            }
+        }
+        else if (h.type == kRawTypeHid)
+        {
+            processHid(h, packet, h.size, gate, stats);
+        }
+        else
+        {
+            ++stats.ignored;
+        }
+        offset = nextRawPacket(offset, h.size);
+    }
+}
+
+void RawInputProcessor::processHid(const RawPacketHeader& h, const uint8_t* packet, size_t size,
+                                   const RawInputGate& gate, RawInputBatchStats& stats)
+{
+    PtpDevice* d = devices_.find(h.device);
+    if (d == nullptr)
+    {
+        d = load(h.device);
+        if (d != nullptr && stats.loadedCount++ < RawInputBatchStats::kMaxLoaded)
+            stats.loaded[stats.loadedCount - 1] = h.device;
+    }
+    if (d == nullptr || !d->usable)
+    {
+        ++stats.ignored;
+        return;
+    }
+
+    if (size < kRawHidDataOffset)
+    {
+        ++stats.ignored;
+        return;
+    }
+    RawHidPacket hid;
+    std::memcpy(&hid, packet + sizeof(RawPacketHeader), sizeof(hid));
+    const size_t available = size - kRawHidDataOffset;
+    if (hid.sizeHid == 0 || static_cast<uint64_t>(hid.sizeHid) * hid.count > available)
+    {
+        ++stats.ignored;
+        return;
+    }
+
+    const uint8_t* data = packet + kRawHidDataOffset;
+    for (uint32_t r = 0; r < hid.count; ++r)
+        processPtpReport(*d, data + static_cast<size_t>(r) * hid.sizeHid, hid.sizeHid, gate, stats);
+}
+
+void RawInputProcessor::processPtpReport(PtpDevice& d, const uint8_t* report, size_t size,
+                                         const RawInputGate& gate, RawInputBatchStats& stats)
+{
+    PtpContactFrame frame;
+    if (!d.layout.decode(report, size, frame))
+    {
+        ++stats.ignored;
+        return;
+    }
+    ++stats.hidReports;
+
+    const PtpGestureFrame g = d.gestures.update(frame);
+    if (g.fingers < 2)
+        return;
+
+    // Characterization samples precede the modifier gate so they fire on
+    // real two-finger motion regardless of modifier state (R-08, AC-2.1.05).
+    if (g.avgDeltaY != 0 && d.charSamples < kCharSamplesPerDevice
+        && stats.charSampleCount < RawInputBatchStats::kMaxCharSamples)
+    {
+        PtpCharSample& s = stats.charSamples[stats.charSampleCount++];
+        s.device = d.handle;
+        s.index = ++d.charSamples;
+        s.contacts = frame.contactCount;
+        s.fingers = g.fingers;
+        s.avgDeltaY = g.avgDeltaY;
+        s.wheelEquiv = ptpDeltaToWheelEquiv(static_cast<float>(g.avgDeltaY), d.yScale);
+    }
+
+    if (!gate.modifierHeld)
+        return;
+
+    if (g.gesture == PtpGesture::Pinch && g.logZoomDelta != 0.0f)
+    {
+        // Spread = zoom in regardless of scroll direction, by exactly the
+        // distance ratio: carried as log-zoom, outside the per-device scroll
+        // sensitivity and the wheel-unit remainder. The zoom centers on the
+        // pointer like every other input: an indirect pad has no screen
+        // position under the fingers (g.anchorX/Y are pad fractions).
+        ++stats.pinchReports;
+        stats.emit(ScrollSource::PtpHid, d.handle, gate.timeUs, 0, g.logZoomDelta);
+        return;
+    }
+
+    float wheelEquiv = 0.0f;
+    if (g.gesture == PtpGesture::Scroll && g.scrollDeltaY != 0)
+    {
+        // PTP Y increases downward; WHEEL_DELTA positive = scroll up. Negate for
+        // the traditional direction. With natural scrolling ON, Windows pre-flips
+        // the LL hook's WM_MOUSEWHEEL but not raw HID — leave the sign to match it
+        // (unless the device's profile says its driver flips raw HID as well).
+        const bool natural = gate.naturalScrolling != d.invertNaturalScroll;
+        const int32_t adjustedDeltaY = natural ? g.scrollDeltaY : -g.scrollDeltaY;
+
+        // A1: normalize by the device's logical Y range so a given fraction-of-pad
+        // swipe produces the same zoom on any touchpad.
+        wheelEquiv = ptpDeltaToWheelEquiv(static_cast<float>(adjustedDeltaY), d.yScale);
+    }
+    if (wheelEquiv == 0.0f)
+        return;
+
+    d.remainder += wheelEquiv * d.sensitivity;
+    const auto whole = static_cast<int32_t>(d.remainder); // truncate toward zero
+    d.remainder -= static_cast<float>(whole);
+    if (whole != 0)
+        stats.emit(ScrollSource::PtpHid, d.handle, gate.timeUs, whole);
+}
+
+} // namespace SmoothZoom
@@ -0,0 +1,412 @@
+// =============================================================================
+// SmoothZoom — RawInputWorker
+// Raw Input on a dedicated worker thread, drained with GetRawInputBuffer.
+// Doc 3 §3.1, R-08
+//
+// Previously every WM_INPUT went to the main thread's message window and made
+// two GetRawInputData calls for a single packet — one message per touchpad HID
+// report, 125–250/s during a gesture, queued behind tray and settings work.
+// The worker wakes on queued input, pulls everything pending in one
+// GetRawInputBuffer call per arena-full, and processes the batch in bulk
+// (RawInputProcessor). A WM_INPUT that is dispatched before the drain sees it
+// (a race with the wait) is handled the same way as a one-packet batch.
+//
+// Touchpads are registered with RIDEV_DEVNOTIFY: WM_INPUT_DEVICE_CHANGE
+// (sent for pads already attached at registration, too) loads a device's
+// layout and VID:PID into the processor's registry, and removal drops it, so
+// hot-plugging or switching pads never re-parses HID data on the input path.
+// =============================================================================
+
+#include "smoothzoom/input/RawInputWorker.h"
+#include "smoothzoom/input/RawInputProcessor.h"
+#include "smoothzoom/input/ModifierUtils.h"
+#include "smoothzoom/common/SharedState.h"
+#include "smoothzoom/support/Logger.h"
+
+#ifndef SMOOTHZOOM_TESTING
+
+#ifndef UNICODE
+#define UNICODE
+#endif
+#ifndef _UNICODE
+#define _UNICODE
+#endif
+
+#include <windows.h>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <thread>
+
+namespace SmoothZoom
+{
+
+// The processor walks batches in the x64 wire layout it mirrors.
+static_assert(sizeof(RawPacketHeader) == sizeof(RAWINPUTHEADER), "RAWINPUTHEADER layout");
+static_assert(offsetof(RAWINPUTHEADER, hDevice) == offsetof(RawPacketHeader, device), "hDevice offset");
+static_assert(offsetof(RAWINPUT, data) == kRawMouseOffset, "RAWINPUT data offset");
+static_assert(sizeof(RAWMOUSE) == sizeof(RawMousePacket), "RAWMOUSE layout");
+static_assert(offsetof(RAWMOUSE, usButtonFlags) == offsetof(RawMousePacket, buttonFlags), "usButtonFlags offset");
+static_assert(offsetof(RAWMOUSE, usButtonData) == offsetof(RawMousePacket, buttonData), "usButtonData offset");
+static_assert(offsetof(RAWINPUT, data.hid.bRawData) == kRawHidDataOffset, "RAWHID data offset");
+static_assert(RIM_TYPEMOUSE == kRawTypeMouse && RIM_TYPEHID == kRawTypeHid, "RIM_TYPE values");
+static_assert(RI_MOUSE_WHEEL == kRawMouseWheel && RI_MOUSE_HWHEEL == kRawMouseHWheel, "RI_MOUSE flags");
+static_assert(MOUSE_MOVE_ABSOLUTE == kRawMouseMoveAbsolute, "MOUSE_MOVE flags");
+static_assert(offsetof(RAWMOUSE, lLastX) == offsetof(RawMousePacket, lastX), "lLastX offset");
+
+// Batch arena. One GetRawInputBuffer call returns as many whole packets as fit;
+// a PTP packet is well under 1 KB, so 64 KB holds hundreds.
+static constexpr size_t kArenaBytes = 64 * 1024;
+
+static const wchar_t kWindowClass[] = L"SmoothZoomRawInputWindow";
+
+// ─── RawInputWorker::Impl ────────────────────────────────────────────────
+
+struct RawInputWorker::Impl
+{
+    SharedState* state = nullptr;
+    std::thread thread;
+    std::atomic<DWORD> threadId{0};
+    std::atomic<bool> ready{false};
+    std::atomic<bool> windowCreated{false};
+    std::atomic<bool> naturalScrolling{false};
+    HWND hwnd = nullptr;
+
+    // Worker-thread only.
+    RawInputProcessor processor;
+    std::unique_ptr<uint64_t[]> arena; // uint64_t: RAWINPUT needs pointer alignment
+    std::shared_ptr<const SettingsSnapshot> profileSnap; // snapshot the device profiles came from
+
+    uint8_t* arenaBytes() { return reinterpret_cast<uint8_t*>(arena.get()); }
+
+    static bool loadDevice(void*, uint64_t device, PtpDeviceInfo& out)
+    {
+        const HANDLE h = reinterpret_cast<HANDLE>(static_cast<uintptr_t>(device));
+        RID_DEVICE_INFO info = {};
+        info.cbSize = sizeof(info);
+        UINT cb = sizeof(info);
+        if (GetRawInputDeviceInfoW(h, RIDI_DEVICEINFO, &info, &cb) == UINT(-1)
+            || info.dwType != RIM_TYPEHID)
+            return false;
+        out.vendorId = static_cast<uint16_t>(info.hid.dwVendorId);
+        out.productId = static_cast<uint16_t>(info.hid.dwProductId);
+        return loadPtpReportLayout(h, out.layout);
+    }
+
+    void logDevice(const PtpDevice& d, const wchar_t* how) const
+    {
+        const PtpReportLayout& l = d.layout;
+        SZ_LOG_INFO("RawInput", L"PTP device %s: handle=0x%llX VID:PID=%04X:%04X, %d contact slot(s), "
+                                L"reportId=%u, contactCountLC=%u, logicalRangeY=%d, profile=%d (devices=%d)",
+                    how, static_cast<unsigned long long>(d.handle), d.vendorId, d.productId,
+                    l.numSlots, l.reportId, l.contactCountLC, l.logicalRangeY, d.hasProfile ? 1 : 0,
+                    processor.ptpDevices().size());
+    }
+
+    // WM_INPUT_DEVICE_CHANGE — the only place devices are loaded (besides a
+    // first packet that beats its notification).
+    void deviceChanged(WPARAM change, HANDLE h)
+    {
+        const auto device = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(h));
+        if (change == GIDC_REMOVAL)
+        {
+            processor.deviceRemoved(device);
+            SZ_LOG_INFO("RawInput", L"PTP device removed: handle=0x%llX",
+                        static_cast<unsigned long long>(device));
+            return;
+        }
+        const PtpDevice* d = processor.deviceArrived(device);
+        if (d == nullptr)
+            SZ_LOG_WARN("RawInput", L"PTP device registry full (%d) — handle=0x%llX ignored",
+                        PtpDeviceRegistry::kMaxDevices, static_cast<unsigned long long>(device));
+        else if (d->usable)
+            logDevice(*d, L"arrived");
+    }
+
+    // Gates are sampled once per batch — one GetAsyncKeyState, one clock read.
+    // The event stamp shares steady_clock with the LL hook's (InputInterceptor).
+    // A new settings snapshot also re-applies the per-device profiles.
+    RawInputGate sampleGate()
+    {
+        RawInputGate gate;
+        auto snap = std::atomic_load(&state->settingsSnapshot);
+        if (snap && snap != profileSnap)
+        {
+            processor.setDeviceProfiles(snap->ptpDeviceProfiles.data(), snap->ptpDeviceProfileCount);
+            profileSnap = snap;
+        }
+        const int genericVK = toGenericVK(snap ? snap->modifierKeyVK : VK_LWIN);
+        gate.modifierHeld = (GetAsyncKeyState(genericVK) & 0x8000) != 0;
+        gate.naturalScrolling = naturalScrolling.load(std::memory_order_relaxed);
+        gate.pointerMotion = snap && snap->pointerSampleStream;
+        gate.timeUs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        return gate;
+    }
+
+    void finishBatch(const RawInputBatchStats& stats, const RawInputGate& gate)
+    {
+        for (int i = 0; i < stats.loadedCount && i < RawInputBatchStats::kMaxLoaded; ++i)
+        {
+            const PtpDevice* d = processor.ptpDevices().find(stats.loaded[i]);
+            if (d != nullptr && d->usable)
+                logDevice(*d, L"initialized from input");
+        }
+
+        // One-shot device characterization (INFO): the first few two-finger
+        // samples per device, so a new touchpad's feel can be fingerprinted
+        // from the shipped log. Bounded per device (R-05, R-08, AC-2.1.05).
+        for (int i = 0; i < stats.charSampleCount; ++i)
+        {
+            const PtpCharSample& s = stats.charSamples[i];
+            const PtpDevice* d = processor.ptpDevices().find(s.device);
+            const PtpAxisScale scale = d ? d->yScale : PtpAxisScale{};
+            SZ_LOG_INFO("PTP-Char",
+                L"sample %d/%d: contacts=%u fingers=%d avgDeltaY=%d logicalRangeY=%d "
+                L"unitsPerNotch=%.1f wheelEquiv=%.2f naturalScroll=%d",
+                s.index, RawInputProcessor::kCharSamplesPerDevice, s.contacts, s.fingers,
+                s.avgDeltaY, scale.logicalRange, ptpUnitsPerNotch(scale), s.wheelEquiv,
+                naturalScrolling.load(std::memory_order_relaxed) ? 1 : 0);
+        }
+
+        if (stats.scrollDelta != 0)
+        {
+            // Debug, not Info: fires per qualifying batch and the logger
+            // flushes synchronously per line (R-05).
+            SZ_LOG_DEBUG("RawInput", L"batch: packets=%u wheel=%u hid=%u pinch=%u ignored=%u events=%d delta=%d",
+                         stats.packets, stats.wheelPackets, stats.hidReports, stats.pinchReports,
+                         stats.ignored, stats.eventCount, stats.scrollDelta);
+        }
+        // The render thread deduplicates against the LL hook's copies.
+        for (int i = 0; i < stats.eventCount; ++i)
+            state->rawScrollQueue.push(stats.events[i]);
+
+        // Pointer sample stream: the batch's relative motion as one sample,
+        // stamped like its scroll events. The render thread converts counts
+        // to px itself (PointerMotionEstimator).
+        if (stats.motionPackets != 0)
+        {
+            PointerSample sample;
+            sample.timeUs = gate.timeUs;
+            sample.x = stats.motionX;
+            sample.y = stats.motionY;
+            state->rawPointerSamples.push(sample);
+        }
+    }
+
+    // Pull everything queued, one arena-full per call.
+    void drain()
+    {
+        RawInputBatchStats stats;
+        const RawInputGate gate = sampleGate();
+        for (;;)
+        {
+            UINT cb = static_cast<UINT>(kArenaBytes);
+            const UINT n = GetRawInputBuffer(reinterpret_cast<PRAWINPUT>(arena.get()), &cb,
+                                             sizeof(RAWINPUTHEADER));
+            if (n == 0 || n == UINT(-1))
+                break; // empty, or a packet larger than the arena — left to WM_INPUT
+            processor.process(arenaBytes(), kArenaBytes, n, gate, stats);
+        }
+        finishBatch(stats, gate);
+    }
+
+    // WM_INPUT dispatched before drain() picked its packet up.
+    void handleSingle(HRAWINPUT hRaw)
+    {
+        UINT cb = static_cast<UINT>(kArenaBytes);
+        if (GetRawInputData(hRaw, RID_INPUT, arena.get(), &cb, sizeof(RAWINPUTHEADER)) == UINT(-1))
+            return;
+        RawInputBatchStats stats;
+        const RawInputGate gate = sampleGate();
+        processor.process(arenaBytes(), cb, 1, gate, stats);
+        finishBatch(stats, gate);
+    }
+
+    static LRESULT CALLBACK wndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam)
+    {
+        if (msg == WM_INPUT)
+        {
+            if (auto* self = reinterpret_cast<Impl*>(GetWindowLongPtrW(hWnd, GWLP_USERDATA)))
+                self->handleSingle(reinterpret_cast<HRAWINPUT>(lParam));
+        }
+        else if (msg == WM_INPUT_DEVICE_CHANGE)
+        {
+            if (auto* self = reinterpret_cast<Impl*>(GetWindowLongPtrW(hWnd, GWLP_USERDATA)))
+                self->deviceChanged(wParam, reinterpret_cast<HANDLE>(lParam));
+            return 0;
+        }
+        // DefWindowProc must see WM_INPUT too (RIM_INPUT cleanup).
+        return DefWindowProcW(hWnd, msg, wParam, lParam);
+    }
+
+    void registerDevices()
+    {
+        RAWINPUTDEVICE rids[2] = {};
+        // 1. Generic mouse — catches external mouse wheel events
+        rids[0].usUsagePage = 0x01;  // HID_USAGE_PAGE_GENERIC
+        rids[0].usUsage     = 0x02;  // HID_USAGE_GENERIC_MOUSE
+        rids[0].dwFlags     = RIDEV_INPUTSINK;
+        rids[0].hwndTarget  = hwnd;
+        // 2. Precision Touchpad — HID digitizer page, with arrival/removal
+        //    notifications for the device registry
+        rids[1].usUsagePage = 0x0D;  // HID_USAGE_PAGE_DIGITIZER
+        rids[1].usUsage     = 0x05;  // HID_USAGE_GENERIC_TOUCHPAD
+        rids[1].dwFlags     = RIDEV_INPUTSINK | RIDEV_DEVNOTIFY;
+        rids[1].hwndTarget  = hwnd;
+        if (!RegisterRawInputDevices(rids, 2, sizeof(RAWINPUTDEVICE)))
+        {
+            // Touchpad registration may fail if no PTP device — try mouse only
+            SZ_LOG_WARN("RawInput", L"RegisterRawInputDevices (mouse+touchpad) failed, trying mouse only");
+            if (!RegisterRawInputDevices(rids, 1, sizeof(RAWINPUTDEVICE)))
+                SZ_LOG_WARN("RawInput", L"RegisterRawInputDevices (mouse only) also failed");
+            else
+                SZ_LOG_INFO("RawInput", L"RegisterRawInputDevices (mouse only) succeeded");
+        }
+        else
+            SZ_LOG_INFO("RawInput", L"RegisterRawInputDevices (mouse+touchpad) succeeded");
+    }
+
+    static void unregisterDevices()
+    {
+        RAWINPUTDEVICE rids[2] = {};
+        rids[0].usUsagePage = 0x01;
+        rids[0].usUsage     = 0x02;
+        rids[0].dwFlags     = RIDEV_REMOVE;
+        rids[1].usUsagePage = 0x0D;
+        rids[1].usUsage     = 0x05;
+        rids[1].dwFlags     = RIDEV_REMOVE;
+        RegisterRawInputDevices(rids, 2, sizeof(RAWINPUTDEVICE));
+    }
+
+    void threadMain()
+    {
+        // Force the message queue into existence before anyone can post to it.
+        MSG msg;
+        PeekMessageW(&msg, nullptr, WM_USER, WM_USER, PM_NOREMOVE);
+        // Above the main thread, below the TIME_CRITICAL hook thread.
+        SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_ABOVE_NORMAL);
+
+        arena.reset(new uint64_t[kArenaBytes / sizeof(uint64_t)]);
+        processor.setDeviceLoader(&Impl::loadDevice, nullptr);
+
+        WNDCLASSEXW wc = {};
+        wc.cbSize = sizeof(WNDCLASSEXW);
+        wc.lpfnWndProc = &Impl::wndProc;
+        wc.hInstance = GetModuleHandleW(nullptr);
+        wc.lpszClassName = kWindowClass;
+        RegisterClassExW(&wc); // ERROR_CLASS_ALREADY_EXISTS on restart is fine
+
+        hwnd = CreateWindowExW(0, kWindowClass, nullptr, 0, 0, 0, 0, 0,
+                               HWND_MESSAGE, nullptr, wc.hInstance, nullptr);
+        if (hwnd)
+        {
+            SetWindowLongPtrW(hwnd, GWLP_USERDATA, reinterpret_cast<LONG_PTR>(this));
+            registerDevices();
+        }
+        else
+        {
+            SZ_LOG_ERROR("RawInput", L"CreateWindowExW(HWND_MESSAGE) failed (GetLastError=%lu) — "
+                                     L"Raw Input scroll fallback disabled", GetLastError());
+        }
+        windowCreated.store(hwnd != nullptr, std::memory_order_release);
+        threadId.store(GetCurrentThreadId(), std::memory_order_release);
+        ready.store(true, std::memory_order_release);
+
+        bool quit = (hwnd == nullptr);
+        while (!quit)
+        {
+            MsgWaitForMultipleObjectsEx(0, nullptr, INFINITE, QS_ALLINPUT, MWMO_INPUTAVAILABLE);
+            drain();
+            while (PeekMessageW(&msg, nullptr, 0, 0, PM_REMOVE))
+            {
+                if (msg.message == WM_QUIT)
+                {
+                    quit = true;
+                    break;
+                }
+                DispatchMessageW(&msg);
+            }
+        }
+
+        if (hwnd)
+        {
+            unregisterDevices();
+            DestroyWindow(hwnd);
+            hwnd = nullptr;
+        }
+    }
+};
+
+// ─── RawInputWorker public interface ─────────────────────────────────────
+
+RawInputWorker::~RawInputWorker()
+{
+    stop();
+}
+
+bool RawInputWorker::start(SharedState& state)
+{
+    if (running_.load(std::memory_order_relaxed))
+        return true;
+
+    impl_ = new Impl();
+    impl_->state = &state;
+    impl_->thread = std::thread([this]() { impl_->threadMain(); });
+
+    // Wait for the window and registration, as InputInterceptor::install waits
+    // for its hooks.
+    while (!impl_->ready.load(std::memory_order_acquire))
+        Sleep(1);
+
+    running_.store(true, std::memory_order_release);
+    return impl_->windowCreated.load(std::memory_order_acquire);
+}
+
+void RawInputWorker::stop()
+{
+    if (!running_.load(std::memory_order_acquire))
+        return;
+
+    if (impl_)
+    {
+        PostThreadMessageW(impl_->threadId.load(std::memory_order_acquire), WM_QUIT, 0, 0);
+        if (impl_->thread.joinable())
+            impl_->thread.join();
+        delete impl_;
+        impl_ = nullptr;
+    }
+
+    running_.store(false, std::memory_order_release);
+}
+
+void RawInputWorker::setNaturalScrolling(bool natural)
+{
+    if (impl_)
+        impl_->naturalScrolling.store(natural, std::memory_order_relaxed);
+}
+
+} // namespace SmoothZoom
+
+#else // SMOOTHZOOM_TESTING — stub for non-Win32 test builds
+
+namespace SmoothZoom
+{
+
+RawInputWorker::~RawInputWorker() { stop(); }
+
+bool RawInputWorker::start(SharedState& /*state*/)
+{
+    return true; // No-op in test builds
+}
+
+void RawInputWorker::stop()
+{
+    // No-op in test builds
+}
+
+void RawInputWorker::setNaturalScrolling(bool /*natural*/) {}
+
+} // namespace SmoothZoom
+
+#endif // SMOOTHZOOM_TESTING
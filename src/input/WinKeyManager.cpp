@@ -27,29 +27,37 @@ void WinKeyManager::onWinKeyDown()
 
 void WinKeyManager::onWinKeyUp()
 {
-    if (shouldSuppressStartMenu())
-    {
-        // Suppress Start Menu by injecting Ctrl press+release (AC-2.1.16).
-        // Windows tracks whether Win was used in a chord; a Ctrl keystroke
-        // makes it look like Win+Ctrl was pressed, preventing the Start Menu.
+    if (release())
+        injectStartMenuSuppression();
+}
+
+void WinKeyManager::injectStartMenuSuppression()
+{
+    // Suppress Start Menu by injecting Ctrl press+release (AC-2.1.16).
+    // Windows tracks whether Win was used in a chord; a Ctrl keystroke
+    // makes it look like Win+Ctrl was pressed, preventing the Start Menu.
 #ifndef SMOOTHZOOM_TESTING
-        INPUT inputs[2] = {};
+    INPUT inputs[2] = {};
 
-        // Ctrl down
-        inputs[0].type = INPUT_KEYBOARD;
-        inputs[0].ki.wVk = VK_CONTROL;
+    // Ctrl down
+    inputs[0].type = INPUT_KEYBOARD;
+    inputs[0].ki.wVk = VK_CONTROL;
 
-        // Ctrl up
-        inputs[1].type = INPUT_KEYBOARD;
-        inputs[1].ki.wVk = VK_CONTROL;
-        inputs[1].ki.dwFlags = KEYEVENTF_KEYUP;
+    // Ctrl up
+    inputs[1].type = INPUT_KEYBOARD;
+    inputs[1].ki.wVk = VK_CONTROL;
+    inputs[1].ki.dwFlags = KEYEVENTF_KEYUP;
 
-        SendInput(2, inputs, sizeof(INPUT));
+    SendInput(2, inputs, sizeof(INPUT));
 #endif
-    }
+}
 
+bool WinKeyManager::release()
+{
+    const bool suppress = shouldSuppressStartMenu();
     state_ = State::Idle;
     usedWithOtherKey_ = false;
+    return suppress;
 }
 
 void WinKeyManager::markUsedForZoom()
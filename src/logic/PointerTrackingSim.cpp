@@ -0,0 +1,268 @@
+// =============================================================================
+// SmoothZoom — PointerTrackingSim
+// Offline replay of pointer traces through the viewport tracking policies.
+// Doc 3 §3.6
+//
+// The per-frame sequence must stay in step with the pointer path of
+// RenderLoop::frameTick (pointer filter, damper, trackPointerOffset, changed-gate).
+// =============================================================================
+
+#include "smoothzoom/logic/PointerTrackingSim.h"
+#include <algorithm>
+#include <cmath>
+
+namespace SmoothZoom
+{
+
+namespace
+{
+
+struct Lcg
+{
+    uint32_t s;
+    float next() // [0, 1)
+    {
+        s = s * 1664525u + 1013904223u;
+        return static_cast<float>(s >> 8) / 16777216.0f;
+    }
+    float range(float lo, float hi) { return lo + (hi - lo) * next(); }
+};
+
+// Emits frames while the pointer moves at constant speed between waypoints.
+struct TraceWriter
+{
+    std::vector<PointerSample>& out;
+    float dt;
+    float endSec;
+    float t = 0.0f;
+    float x;
+    float y;
+
+    bool done() const { return t >= endSec; }
+
+    void emit()
+    {
+        t += dt;
+        out.push_back({t, static_cast<int32_t>(std::lround(x)), static_cast<int32_t>(std::lround(y))});
+    }
+
+    void moveTo(float tx, float ty, float speedPxPerSec)
+    {
+        float dist = std::hypot(tx - x, ty - y);
+        int frames = std::max(1, static_cast<int>(dist / (speedPxPerSec * dt)));
+        float sx = (tx - x) / frames, sy = (ty - y) / frames;
+        for (int i = 0; i < frames && !done(); ++i)
+        {
+            x += sx;
+            y += sy;
+            emit();
+        }
+    }
+
+    void hold(float seconds, Lcg* tremor = nullptr)
+    {
+        const float cx = x, cy = y;
+        for (int i = 0; i < static_cast<int>(seconds / dt) && !done(); ++i)
+        {
+            if (tremor)
+            {
+                x = cx + tremor->range(-1.5f, 1.5f);
+                y = cy + tremor->range(-1.5f, 1.5f);
+            }
+            emit();
+        }
+        x = cx;
+        y = cy;
+    }
+};
+
+} // namespace
+
+std::vector<PointerSample> synthesizePointerTrace(PointerTraceKind kind, float hz,
+                                                  float seconds, int32_t screenW,
+                                                  int32_t screenH, uint32_t seed)
+{
+    std::vector<PointerSample> out;
+    if (hz <= 0.0f || seconds <= 0.0f || screenW <= 0 || screenH <= 0)
+        return out;
+    out.reserve(static_cast<size_t>(hz * seconds) + 1);
+
+    Lcg rng{seed};
+    const float w = static_cast<float>(screenW);
+    const float h = static_cast<float>(screenH);
+    TraceWriter tw{out, 1.0f / hz, seconds, 0.0f, w * 0.5f, h * 0.5f};
+
+    switch (kind)
+    {
+    case PointerTraceKind::Precision:
+        // Editing inside a ~300×200 px area: short strokes, dwell with tremor.
+        while (!tw.done())
+        {
+            float tx = std::clamp(tw.x + rng.range(-40.0f, 40.0f), w * 0.5f - 150.0f, w * 0.5f + 150.0f);
+            float ty = std::clamp(tw.y + rng.range(-25.0f, 25.0f), h * 0.5f - 100.0f, h * 0.5f + 100.0f);
+            tw.moveTo(tx, ty, rng.range(40.0f, 200.0f));
+            tw.hold(rng.range(0.2f, 0.8f), &rng);
+        }
+        break;
+    case PointerTraceKind::Reading:
+        // 600 px lines at reading pace, 24 px line pitch.
+        while (!tw.done())
+        {
+            float x0 = w * 0.5f - 300.0f;
+            float y = h * 0.3f;
+            tw.x = x0;
+            tw.y = y;
+            for (int line = 0; line < 15 && !tw.done(); ++line)
+            {
+                tw.moveTo(x0 + 600.0f, y, 250.0f);
+                y += 24.0f;
+                tw.moveTo(x0, y, 2000.0f);
+                tw.hold(0.15f);
+            }
+        }
+        break;
+    case PointerTraceKind::Sweep:
+        // Flicks between random points anywhere on screen.
+        while (!tw.done())
+        {
+            tw.moveTo(rng.range(0.0f, w - 1.0f), rng.range(0.0f, h - 1.0f), rng.range(1500.0f, 5000.0f));
+            tw.hold(rng.range(0.1f, 0.5f));
+        }
+        break;
+    }
+    return out;
+}
+
+std::vector<PointerSample> synthesizeMouseTrace(int32_t dpi, float hz, float seconds,
+                                                int32_t screenW, int32_t screenH,
+                                                uint32_t seed)
+{
+    std::vector<PointerSample> out;
+    if (dpi <= 0 || hz <= 0.0f || seconds <= 0.0f || screenW <= 0 || screenH <= 0)
+        return out;
+    out.reserve(static_cast<size_t>(hz * seconds) + 1);
+
+    Lcg rng{seed};
+    const float w = static_cast<float>(screenW);
+    const float h = static_cast<float>(screenH);
+    const float frameDt = 1.0f / hz;
+    constexpr float kReportDt = 0.001f; // 1 kHz USB polling
+
+    // Pointer position (px) and the sub-count remainder the sensor carries.
+    float x = w * 0.5f, y = h * 0.5f;
+    float t = 0.0f, nextFrame = frameDt;
+    auto advance = [&](float until, float vx, float vy, float t0, float dur) {
+        // vx, vy: reach vector in inches; minimum-jerk position profile.
+        auto s = [&](float tt) {
+            if (dur <= 0.0f)
+                return 1.0f;
+            float u = std::clamp((tt - t0) / dur, 0.0f, 1.0f);
+            return u * u * u * (10.0f - 15.0f * u + 6.0f * u * u);
+        };
+        float countX = 0.0f, countY = 0.0f; // counts reported so far this reach
+        while (t < until && t < seconds)
+        {
+            t += kReportDt;
+            float wantX = vx * dpi * s(t), wantY = vy * dpi * s(t);
+            float cx = std::trunc(wantX - countX), cy = std::trunc(wantY - countY);
+            countX += cx;
+            countY += cy;
+            x = std::clamp(x + cx, 0.0f, w - 1.0f);
+            y = std::clamp(y + cy, 0.0f, h - 1.0f);
+            while (nextFrame <= t)
+            {
+                out.push_back({nextFrame, static_cast<int32_t>(x), static_cast<int32_t>(y)});
+                nextFrame += frameDt;
+            }
+        }
+    };
+
+    while (t < seconds)
+    {
+        // One in three reaches is a flick: long and fast.
+        const bool flick = rng.next() < 0.33f;
+        float inches = flick ? rng.range(1.5f, 3.0f) : rng.range(0.3f, 1.2f);
+        float dur = flick ? rng.range(0.12f, 0.2f) : rng.range(0.3f, 0.6f);
+        float angle = rng.range(0.0f, 6.2831853f);
+        // Head back toward the middle when near an edge so reaches aren't
+        // swallowed by the screen clamp.
+        float dirX = std::cos(angle), dirY = std::sin(angle);
+        if ((x < w * 0.25f && dirX < 0.0f) || (x > w * 0.75f && dirX > 0.0f)) dirX = -dirX;
+        if ((y < h * 0.25f && dirY < 0.0f) || (y > h * 0.75f && dirY > 0.0f)) dirY = -dirY;
+        advance(t + dur, dirX * inches, dirY * inches, t, dur);
+        advance(t + rng.range(0.2f, 0.8f), 0.0f, 0.0f, t, 0.0f);
+    }
+    return out;
+}
+
+PointerTrackingStats simulatePointerTracking(const PointerSample* samples, size_t count,
+                                             const PointerTrackingSimParams& params)
+{
+    PointerTrackingStats stats;
+    if (count == 0)
+        return stats;
+
+    ViewportTracker tracker;
+    tracker.setPointerTracking(params.mode, params.edgePush);
+    tracker.setCenteredFollow(params.centered);
+    const bool raw = params.mode != PointerTrackingMode::Continuous;
+    PointerDamper damper;
+    damper.setEnabled(params.damping);
+    const float zoom = params.zoom;
+
+    // RenderLoop state: applied transform (starts at 1.0×, offset 0) and the
+    // filtered pointer (AC-2.4.09, per-monitor scaled).
+    ViewportTracker::Offset applied;
+    float appliedZoom = 1.0f;
+    PointerFilter filter;
+    filter.reset(samples[0].x, samples[0].y);
+    const float pointerScale = static_cast<float>(params.screenH) / 1080.0f;
+
+    float prevTime = 0.0f;
+    double centerError = 0.0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const PointerSample& s = samples[i];
+        float dt = std::clamp(s.timeSec - prevTime, 0.0f, 0.1f);
+        prevTime = s.timeSec;
+
+        ScreenPoint committed = filter.update(s.x, s.y, dt, pointerScale);
+        ScreenPoint damped = damper.update(committed.x, committed.y, zoom, dt);
+
+        ViewportTracker::Offset off = tracker.trackPointer(
+            raw ? s.x : damped.x, raw ? s.y : damped.y, zoom,
+            applied, appliedZoom, dt, params.screenW, params.screenH);
+
+        if (zoom != appliedZoom || off.x != applied.x || off.y != applied.y)
+        {
+            float pan = std::hypot(off.x - applied.x, off.y - applied.y) * zoom;
+            if (zoom == appliedZoom)
+            {
+                stats.viewportTravelPx += pan;
+                stats.maxFramePanPx = std::max(stats.maxFramePanPx, pan);
+            }
+            ++stats.transformCalls;
+            applied = off;
+            appliedZoom = zoom;
+        }
+
+        float physX = (static_cast<float>(s.x) - applied.x) * zoom;
+        float physY = (static_cast<float>(s.y) - applied.y) * zoom;
+        if (physX < -0.5f || physY < -0.5f
+            || physX > static_cast<float>(params.screenW) + 0.5f
+            || physY > static_cast<float>(params.screenH) + 0.5f)
+        {
+            ++stats.pointerOffscreenFrames;
+        }
+        centerError += std::hypot(physX - 0.5f * static_cast<float>(params.screenW),
+                                  physY - 0.5f * static_cast<float>(params.screenH));
+    }
+
+    stats.frames = static_cast<int>(count);
+    stats.meanCenterErrorPx = static_cast<float>(centerError / static_cast<double>(count));
+    float duration = samples[count - 1].timeSec;
+    stats.transformsPerSec = duration > 0.0f ? stats.transformCalls / duration : 0.0f;
+    return stats;
+}
+
+} // namespace SmoothZoom
@@ -13,6 +13,13 @@
 #include "smoothzoom/common/SharedState.h"
 #include "smoothzoom/common/RectValidation.h"
 #include "smoothzoom/logic/ZoomController.h"
+#include "smoothzoom/logic/CaretMotionModel.h"
+#include "smoothzoom/logic/PointerDamper.h"
+#include "smoothzoom/logic/PointerFilter.h"
+#include "smoothzoom/logic/PointerMotionEstimator.h"
+#include "smoothzoom/logic/ScrollDeduplicator.h"
+#include "smoothzoom/logic/ZoomQuantizer.h"
+#include "smoothzoom/logic/ViewportDetach.h"
 #include "smoothzoom/logic/ViewportTracker.h"
 #include "smoothzoom/output/MagBridge.h"
 #include "smoothzoom/support/Logger.h"
@@ -59,20 +66,45 @@ static int s_screenH = 0;
 static int s_screenOriginX = 0;
 static int s_screenOriginY = 0;
 
-// Deadzone filter for pointer micro-jitter suppression (AC-2.4.09–AC-2.4.11).
-// Tracks last "committed" pointer position. Viewport only updates when pointer
-// moves beyond the deadzone threshold, preventing visible jitter from
-// sub-pixel pointer noise while remaining imperceptible during intentional movement.
+// Monitor rectangles, copied from SharedState only when the main thread
+// republishes them (WM_DISPLAYCHANGE) — replaces per-frame MonitorFromPoint /
+// GetMonitorInfo calls. s_zoomScope picks the pointer tracking region.
+static MonitorTable s_monitors;
+static uint64_t s_monitorTableVersion = 0;
+static ZoomScope s_zoomScope = ZoomScope::Unified;
+
+// Adaptive pointer filter for micro-jitter suppression (AC-2.4.09–AC-2.4.11).
+// One-Euro low-pass: strong on hand tremor at rest, transparent during fast
+// intentional movement, no deadzone stair-steps. The "committed" position is
+// its whole-pixel output and is what continuous tracking maps to an offset.
+static PointerFilter s_pointerFilter;
 static int32_t s_committedPtrX = 0;
 static int32_t s_committedPtrY = 0;
-static bool s_deadzoneInitialized = false;
+static bool s_pointerInitialized = false;
+
+// Pointer sample stream (pointerSampleStream, opt-in): sub-frame samples from
+// the LL hook and Raw Input, drained on each tracking frame, give the filter
+// its speed. A drain more than kPointerDrainGapUs after the last one follows
+// skipped frames (idle at 1.0×, frozen detach): the backlog is discarded
+// rather than counted as ring overflow.
+static PointerMotionEstimator s_pointerMotion;
+static PointerSample s_pointerSampleBuf[PointerSampleRing<>::kCapacity];
+static bool s_pointerSampleStream = false;
+static int64_t s_lastPointerDrainUs = 0;
+static constexpr int64_t kPointerDrainGapUs = 100000;
+
+// R-19 speed-dependent damping of the committed pointer at high zoom (opt-in).
+// The damped position is what continuous tracking maps to an offset.
+static PointerDamper s_pointerDamper;
+static int32_t s_dampedPtrX = 0;
+static int32_t s_dampedPtrY = 0;
 
 // Phase 3: Source tracking state — all pre-allocated, no heap on hot path.
 static int64_t s_lastPointerMoveTimeMs = 0;  // Updated on ANY pointer movement (WS2A fix)
 static TrackingSource s_activeSource = TrackingSource::Pointer;
 
 // Raw pointer position — tracks any movement for timestamp updates (WS2A).
-// Separate from committed position (deadzone-filtered) used for viewport offset.
+// Separate from committed position (filtered) used for viewport offset.
 static int32_t s_lastRawPtrX = 0;
 static int32_t s_lastRawPtrY = 0;
 
@@ -95,6 +127,42 @@ static bool s_firstTick = true;
 // MagBridge error tracking — log on state transitions only (not every frame)
 static bool s_magBridgeLastOk = true;
 
+// One scroll source per gesture across the LL hook and Raw Input queues.
+static ScrollDeduplicator s_scrollDedup;
+
+// Step 1 of frameTick: merge both scroll queues in time order through the
+// deduplicator and return the delta to apply; accepted pinch log-zoom is
+// added to `pinchLogZoom`. Each queue is in its producer's time order, so a
+// two-way merge of the heads suffices. Stats are published for the main
+// thread's periodic log only when events were seen.
+static int32_t drainScrollEvents(float& pinchLogZoom)
+{
+    int32_t delta = 0;
+    std::optional<ScrollEvent> hook = s_state->hookScrollQueue.pop();
+    std::optional<ScrollEvent> raw = s_state->rawScrollQueue.pop();
+    if (!hook && !raw)
+        return 0;
+    while (hook || raw)
+    {
+        if (hook && (!raw || hook->timeUs <= raw->timeUs))
+        {
+            delta += s_scrollDedup.submit(*hook, &pinchLogZoom);
+            hook = s_state->hookScrollQueue.pop();
+        }
+        else
+        {
+            delta += s_scrollDedup.submit(*raw, &pinchLogZoom);
+            raw = s_state->rawScrollQueue.pop();
+        }
+    }
+    const ScrollDedupStats& st = s_scrollDedup.stats();
+    s_state->scrollEventsAccepted.store(st.accepted, std::memory_order_relaxed);
+    s_state->scrollEventsDuplicate.store(st.duplicates, std::memory_order_relaxed);
+    s_state->scrollEventsSuppressed.store(st.suppressed, std::memory_order_relaxed);
+    s_state->scrollSourceHandovers.store(st.handovers, std::memory_order_relaxed);
+    return delta;
+}
+
 #ifdef SMOOTHZOOM_PERF_AUDIT
 // Performance instrumentation (E6.12): QPC timing around frameTick().
 // Logs min/max/avg frame cost every ~600 frames (~10s at 60Hz).
@@ -106,12 +174,38 @@ static int64_t s_perfMaxTicks = 0;
 static constexpr int64_t kPerfReportInterval = 600;
 #endif
 
-// Source transition smoothing (200ms ease-out between sources)
-static constexpr float kSourceTransitionDurationMs = 200.0f;
-static float s_transitionOffX = 0.0f;   // Starting offset when transition began
-static float s_transitionOffY = 0.0f;
-static float s_transitionElapsedMs = 0.0f;
-static bool s_sourceTransitionActive = false;
+// Source transition pan (distance-adaptive duration, velocity carry-over)
+static ViewportTracker::PanAnimator s_sourceTransition;
+
+// Detached (frozen) viewport — ToggleDetach command (research Priority 7).
+static ViewportDetach s_detach;
+
+// Caret following (AC-2.6.06): motion model for direction/speed-aware lookahead,
+// and the resting caret viewport it pans from (only changes on an edge trigger).
+static CaretMotionModel s_caretMotion;
+static ViewportTracker::Offset s_caretAnchor;
+
+// Pointer-source offset under the configured tracking mode. Continuous tracks the
+// filtered (and optionally damped) position (AC-2.4.09); edge push holds the viewport still
+// inside its margin band and centered mode smooths with its own follow filter,
+// so both use the raw pointer and continue from the transform last applied.
+// `monitor` is the pointer's monitor (centered mode centers on it); the
+// tracking region is the virtual desktop or, in active-monitor scope, that monitor.
+static ViewportTracker::Offset trackPointerOffset(int32_t rawPtrX, int32_t rawPtrY,
+                                                  float zoom, float dtSeconds,
+                                                  const ScreenRect& monitor)
+{
+    const bool raw =
+        s_viewportTracker.pointerTrackingMode() != PointerTrackingMode::Continuous;
+    const ScreenRect region = ViewportTracker::scopeRegion(
+        s_zoomScope, s_monitors,
+        {s_screenOriginX, s_screenOriginY, s_screenOriginX + s_screenW, s_screenOriginY + s_screenH},
+        rawPtrX, rawPtrY);
+    return s_viewportTracker.trackPointer(
+        raw ? rawPtrX : s_dampedPtrX, raw ? rawPtrY : s_dampedPtrY,
+        zoom, {s_lastOffX, s_lastOffY}, s_lastZoom, dtSeconds,
+        region.width(), region.height(), region.left, region.top, &monitor);
+}
 
 // Get monotonic time in milliseconds (for source priority timestamps)
 static int64_t currentTimeMs()
@@ -120,6 +214,35 @@ static int64_t currentTimeMs()
     return duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
 }
 
+// Step 5a helper: drain both pointer sample rings into the estimator and
+// return the sub-frame velocity in screen px/s (false: none fresh, the filter
+// differences frames itself). (frameDx, frameDy) is this frame's GetCursorPos
+// displacement, which calibrates Raw Input counts to px.
+static bool drainPointerSamples(int32_t frameDx, int32_t frameDy, float& vx, float& vy)
+{
+    using namespace std::chrono;
+    const int64_t nowUs = duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+    const bool resumed = nowUs - s_lastPointerDrainUs > kPointerDrainGapUs;
+    s_lastPointerDrainUs = nowUs;
+    if (resumed)
+    {
+        s_state->hookPointerSamples.discard();
+        s_state->rawPointerSamples.discard();
+        s_pointerMotion.reset();
+        return false;
+    }
+
+    constexpr int kMax = static_cast<int>(PointerSampleRing<>::kCapacity);
+    int n = s_state->hookPointerSamples.drain(s_pointerSampleBuf, kMax);
+    for (int i = 0; i < n; ++i)
+        s_pointerMotion.addAbsolute(s_pointerSampleBuf[i]);
+    n = s_state->rawPointerSamples.drain(s_pointerSampleBuf, kMax);
+    for (int i = 0; i < n; ++i)
+        s_pointerMotion.addRelative(s_pointerSampleBuf[i]);
+    s_pointerMotion.calibrate(frameDx, frameDy);
+    return s_pointerMotion.velocity(nowUs, vx, vy);
+}
+
 // Forward declare the thread trampoline
 static void renderThreadMain(RenderLoop* self);
 
@@ -267,6 +390,24 @@ void RenderLoop::frameTick()
                 snap->minZoom, snap->maxZoom,
                 snap->keyboardZoomStep, snap->defaultZoomLevel,
                 snap->animationSpeed, snap->scrollSensitivity);
+            s_zoomController.setQuantization(snap->zoomQuantization,
+                                             snap->quantizeIntegerTolerance);
+            s_zoomController.setZoomPresets(snap->zoomPresets.data(), snap->zoomPresetCount);
+            s_zoomController.setWheelSmoothing(snap->smoothWheelZoom,
+                                               snap->wheelSmoothingLatencyMs / 1000.0f);
+            {
+                ViewportTracker::EdgePushParams edge;
+                edge.marginFraction = snap->edgePushMarginPct / 100.0f;
+                edge.pushSpeedPx = static_cast<float>(snap->edgePushSpeedPx);
+                s_viewportTracker.setPointerTracking(
+                    static_cast<PointerTrackingMode>(snap->pointerTrackingMode), edge);
+                ViewportTracker::CenteredParams centered;
+                centered.followSec = snap->centeredFollowMs / 1000.0f;
+                s_viewportTracker.setCenteredFollow(centered);
+            }
+            s_pointerDamper.setEnabled(snap->pointerDamping);
+            s_pointerSampleStream = snap->pointerSampleStream;
+            s_zoomScope = static_cast<ZoomScope>(snap->zoomScope);
             s_followKeyboardFocus = snap->followKeyboardFocus;
             s_followTextCursor = snap->followTextCursor;
             s_reverseScrollDirection = snap->reverseScrollDirection;
@@ -293,44 +434,81 @@ void RenderLoop::frameTick()
     s_screenH = s_state->screenHeight.load(std::memory_order_relaxed);
     s_screenOriginX = s_state->screenOriginX.load(std::memory_order_relaxed);
     s_screenOriginY = s_state->screenOriginY.load(std::memory_order_relaxed);
+    const ScreenRect virtualDesktop{s_screenOriginX, s_screenOriginY,
+                                    s_screenOriginX + s_screenW, s_screenOriginY + s_screenH};
+    {
+        const uint64_t monVer = s_state->monitorTableVersion.load(std::memory_order_acquire);
+        if (monVer != s_monitorTableVersion)
+        {
+            s_monitors = s_state->monitorTable.read();
+            s_monitorTableVersion = monVer;
+        }
+    }
 
-    // 1. Consume scroll delta (atomic exchange with 0)
-    int32_t scrollDelta = s_state->scrollAccumulator.exchange(0, std::memory_order_acquire);
+    // 1. Consume scroll events (LL hook + Raw Input, deduplicated)
+    float pinchLogZoom = 0.0f;
+    int32_t scrollDelta = drainScrollEvents(pinchLogZoom);
 
-    // 2. Drain keyboard commands (lock-free queue)
-    while (auto cmd = s_state->commandQueue.pop())
+    // 2. Drain commands: hook shortcuts, then tray / settings (one SPSC queue
+    //    per producer thread)
+    for (LockFreeQueue<ZoomCommand>* queue : {&s_state->commandQueue, &s_state->uiCommandQueue})
     {
-        switch (*cmd)
+        while (auto cmd = queue->pop())
         {
-        case ZoomCommand::ZoomIn:
-            s_zoomController.applyKeyboardStep(+1);
-            break;
-        case ZoomCommand::ZoomOut:
-            s_zoomController.applyKeyboardStep(-1);
-            break;
-        case ZoomCommand::ResetZoom:
-            s_zoomController.animateToZoom(1.0f);
-            break;
-        case ZoomCommand::ToggleEngage:
-            s_zoomController.engageToggle();
-            break;
-        case ZoomCommand::ToggleRelease:
-            s_zoomController.releaseToggle();
-            break;
-        case ZoomCommand::TrayToggle:
-            s_zoomController.trayToggle();
-            break;
-        case ZoomCommand::ToggleInvert:
-            // AC-2.10.01: instantaneous toggle, no animation
-            s_colorInversionActive = !s_colorInversionActive;
-            s_magBridge.setColorInversion(s_colorInversionActive);
-            // Publish for the main thread to persist (AC-2.10.04 / E6.2) off the
-            // render hot path — invariants forbid I/O here. PostMessage/save is
-            // done by the tray-timer poller in main.cpp.
-            s_state->colorInversionActive.store(s_colorInversionActive, std::memory_order_relaxed);
-            break;
-        default:
-            break;
+            switch (*cmd)
+            {
+            case ZoomCommand::ZoomIn:
+                s_zoomController.applyKeyboardStep(+1);
+                break;
+            case ZoomCommand::ZoomOut:
+                s_zoomController.applyKeyboardStep(-1);
+                break;
+            case ZoomCommand::ResetZoom:
+                s_zoomController.animateToZoom(1.0f);
+                break;
+            case ZoomCommand::ToggleEngage:
+                s_zoomController.engageToggle();
+                break;
+            case ZoomCommand::ToggleRelease:
+                s_zoomController.releaseToggle();
+                break;
+            case ZoomCommand::TrayToggle:
+                s_zoomController.trayToggle();
+                break;
+            case ZoomCommand::JumpToPreset1:
+            case ZoomCommand::JumpToPreset2:
+            case ZoomCommand::JumpToPreset3:
+            case ZoomCommand::JumpToPreset4:
+            case ZoomCommand::JumpToPreset5:
+            case ZoomCommand::JumpToPreset6:
+                s_zoomController.jumpToPreset(
+                    static_cast<int>(*cmd) - static_cast<int>(ZoomCommand::JumpToPreset1));
+                break;
+            case ZoomCommand::CyclePreset:
+                s_zoomController.cyclePreset();
+                break;
+            case ZoomCommand::ToggleDetach:
+            {
+                // Deferred while the zoom is still moving (ViewportDetach.h).
+                const bool wasDetached = s_detach.detached();
+                const bool settled = s_zoomController.mode() == ZoomController::Mode::Idle;
+                if (s_detach.toggle(s_zoomController.currentZoom(), settled) && !wasDetached)
+                    SZ_LOG_INFO("RenderLoop", settled ? L"Viewport detached"
+                                                      : L"Viewport detach deferred until the zoom settles");
+                break;
+            }
+            case ZoomCommand::ToggleInvert:
+                // AC-2.10.01: instantaneous toggle, no animation
+                s_colorInversionActive = !s_colorInversionActive;
+                s_magBridge.setColorInversion(s_colorInversionActive);
+                // Publish for the main thread to persist (AC-2.10.04 / E6.2) off the
+                // render hot path — invariants forbid I/O here. PostMessage/save is
+                // done by the tray-timer poller in main.cpp.
+                s_state->colorInversionActive.store(s_colorInversionActive, std::memory_order_relaxed);
+                break;
+            default:
+                break;
+            }
         }
     }
 
@@ -341,6 +519,9 @@ void RenderLoop::frameTick()
             scrollDelta = -scrollDelta;
         s_zoomController.applyScrollDelta(scrollDelta);
     }
+    // Pinch: spread = in whatever the scroll direction setting (RawInputProcessor).
+    if (pinchLogZoom != 0.0f)
+        s_zoomController.applyPinchLogZoom(pinchLogZoom);
 
     // 4. Compute dt and advance animation (Phase 2: ease-out interpolation)
     LARGE_INTEGER now;
@@ -362,20 +543,35 @@ void RenderLoop::frameTick()
     // controller settles from Scrolling to Idle. This arms the 1.0× idle
     // short-circuit below; a later scroll re-enters Scrolling via
     // applyScrollDelta(). (AC-2.3.13, R-18)
-    if (scrollDelta == 0)
+    if (scrollDelta == 0 && pinchLogZoom == 0.0f)
         s_zoomController.endScroll();
 
     // Get current zoom level
     float zoom = s_zoomController.currentZoom();
 
+    // Detached viewport (ViewportDetach.h): the applied transform stays on
+    // screen and all tracking work below is skipped until re-attach (second
+    // ToggleDetach or any zoom change).
+    const ViewportDetach::Frame detachFrame =
+        s_detach.frame(zoom, s_zoomController.mode() == ZoomController::Mode::Idle);
+    if (detachFrame == ViewportDetach::Frame::Frozen)
+    {
+        // Freeze where the view is; drop any in-flight source pan so
+        // re-attach starts from rest.
+        s_sourceTransition.cancel();
+        return;
+    }
+    if (detachFrame == ViewportDetach::Frame::Reattach)
+        SZ_LOG_INFO("RenderLoop", L"Viewport re-attached");
+
     // R-18 / AC-2.3.13 idle short-circuit: once settled at rest at 1.0×, skip all
-    // per-frame tracking work (GetCursorPos, MonitorFromPoint/GetMonitorInfo,
+    // per-frame tracking work (GetCursorPos, monitor lookup,
     // source arbitration, offset math, setTransform). Settings (step 0), commands
     // (step 2), scroll (step 3) and animation (step 4) all ran above, so color
     // inversion, keyboard shortcuts and re-zoom still work — any of them breaks
     // out of Idle next frame. The s_lastZoom/offset guard ensures the final
     // reset-to-1.0× frame (which still needs one setTransform(1,0,0)) is not
-    // skipped. !s_sourceTransitionActive lets an in-flight 200ms source blend
+    // skipped. !s_sourceTransition.active() lets an in-flight source pan
     // finish first. Float == is exact here: ZoomController snaps to exactly 1.0f
     // and s_lastZoom is assigned from zoom (same compare as the changed-check).
     // NOTE: idle frames return before the SMOOTHZOOM_PERF_AUDIT block — the
@@ -384,7 +580,7 @@ void RenderLoop::frameTick()
     if (s_zoomController.mode() == ZoomController::Mode::Idle
         && zoom == 1.0f
         && s_lastZoom == 1.0f && s_lastOffX == 0.0f && s_lastOffY == 0.0f
-        && !s_sourceTransitionActive)
+        && !s_sourceTransition.active())
     {
         return;
     }
@@ -392,7 +588,7 @@ void RenderLoop::frameTick()
     // 5. Compute viewport offset with multi-source tracking (Phase 3)
     //    Reads are all lock-free (atomics + SeqLock) — no hot path violations.
 
-    // 5a. Pointer position with deadzone filtering (AC-2.4.09–AC-2.4.11)
+    // 5a. Pointer position with adaptive filtering (AC-2.4.09–AC-2.4.11)
     // Use GetCursorPos() directly instead of SharedState atomics. The low-level
     // mouse hook's WM_MOUSEMOVE events are not reliably delivered when the
     // fullscreen magnifier is active (DWM handles cursor rendering at a level
@@ -403,42 +599,56 @@ void RenderLoop::frameTick()
     int32_t rawPtrX = cursorPos.x;
     int32_t rawPtrY = cursorPos.y;
 
-    // Per-frame active monitor detection (AC-MM.04, E6.4–E6.7)
-    // MonitorFromPoint and GetMonitorInfo are lightweight shared-memory reads (~1µs),
-    // no heap allocation, no mutex — safe for the hot path.
-    static HMONITOR s_activeMonitor = nullptr;
-    POINT cursorPt = {rawPtrX, rawPtrY};
-    HMONITOR hMon = MonitorFromPoint(cursorPt, MONITOR_DEFAULTTONEAREST);
-    MONITORINFO monInfo = {};
-    monInfo.cbSize = sizeof(monInfo);
-    GetMonitorInfo(hMon, &monInfo);
-
-    int32_t monHeight = monInfo.rcMonitor.bottom - monInfo.rcMonitor.top;
+    // Per-frame active monitor detection (AC-MM.04, E6.4–E6.7) against the
+    // cached monitor table: a linear scan of ≤16 rects, no user32 calls.
+    static int s_activeMonitor = -2;
+    const int monIndex = s_monitors.indexAt(rawPtrX, rawPtrY);
+    const ScreenRect pointerMonitor = s_monitors.monitorAt(rawPtrX, rawPtrY, virtualDesktop);
+    int32_t monHeight = pointerMonitor.height();
 
     // Log on monitor transition (state transition only, not per-frame)
-    if (hMon != s_activeMonitor) {
-        s_activeMonitor = hMon;
-        SZ_LOG_INFO("RenderLoop", L"Monitor transition: rect=(%d,%d %dx%d)",
-                    monInfo.rcMonitor.left, monInfo.rcMonitor.top,
-                    monInfo.rcMonitor.right - monInfo.rcMonitor.left, monHeight);
+    if (monIndex != s_activeMonitor) {
+        s_activeMonitor = monIndex;
+        SZ_LOG_INFO("RenderLoop", L"Monitor transition: #%d rect=(%d,%d %dx%d)",
+                    monIndex, pointerMonitor.left, pointerMonitor.top,
+                    pointerMonitor.width(), monHeight);
     }
 
-    // Per-monitor deadzone scaling (AC-MM.04)
-    int32_t deadzoneThreshold = monHeight > 0 ? (3 * monHeight / 1080) : 3;
-    if (deadzoneThreshold < 1) deadzoneThreshold = 1;
+    // Resting-zoom quantization (optional): glide onto the active monitor's
+    // output-pixel grid once settled. Sub-pixel steps only; no-op at 1.0×.
+    if (s_zoomController.tickQuantize(dtSeconds, pointerMonitor.width()))
+        zoom = s_zoomController.currentZoom();
 
-    if (!s_deadzoneInitialized)
+    // Per-monitor filter scaling (AC-MM.04): speeds in 1080p-equivalent px.
+    const float pointerScale = monHeight > 0 ? static_cast<float>(monHeight) / 1080.0f : 1.0f;
+
+    if (!s_pointerInitialized)
     {
+        s_pointerFilter.reset(rawPtrX, rawPtrY);
         s_committedPtrX = rawPtrX;
         s_committedPtrY = rawPtrY;
         s_lastRawPtrX = rawPtrX;
         s_lastRawPtrY = rawPtrY;
-        s_deadzoneInitialized = true;
+        s_pointerInitialized = true;
     }
 
-    // WS2A: Update timestamp on ANY raw pointer movement (even sub-deadzone).
+    // Re-attach: restart the filter and damper on the pointer (no catch-up lag
+    // from where it was at detach) and count it as pointer intent.
+    if (detachFrame == ViewportDetach::Frame::Reattach)
+    {
+        s_pointerFilter.reset(rawPtrX, rawPtrY);
+        s_committedPtrX = rawPtrX;
+        s_committedPtrY = rawPtrY;
+        s_pointerDamper.reset(rawPtrX, rawPtrY);
+        s_lastPointerMoveTimeMs = currentTimeMs();
+    }
+
+    const int32_t frameDx = rawPtrX - s_lastRawPtrX;
+    const int32_t frameDy = rawPtrY - s_lastRawPtrY;
+
+    // WS2A: Update timestamp on ANY raw pointer movement (even filtered out).
     // This ensures determineActiveSource() correctly favors Pointer when the
-    // user is moving the mouse, even if the movement is within the deadzone.
+    // user is moving the mouse, even if the filter absorbs the movement.
     bool rawMoved = (rawPtrX != s_lastRawPtrX || rawPtrY != s_lastRawPtrY);
     if (rawMoved)
     {
@@ -447,14 +657,22 @@ void RenderLoop::frameTick()
         s_lastRawPtrY = rawPtrY;
     }
 
-    // Deadzone gates the committed position used for viewport offset calculation.
-    int32_t dx = rawPtrX - s_committedPtrX;
-    int32_t dy = rawPtrY - s_committedPtrY;
-    bool pointerMoved = (dx * dx + dy * dy > deadzoneThreshold * deadzoneThreshold);
-    if (pointerMoved)
+    // The filtered position is the committed position used for viewport offset
+    // calculation; it "moved" when the filter output reaches another pixel.
+    // With the sample stream on, its speed term uses the sub-frame velocity.
+    float streamVx = 0.0f, streamVy = 0.0f;
+    ScreenPoint filtered =
+        (s_pointerSampleStream && drainPointerSamples(frameDx, frameDy, streamVx, streamVy))
+            ? s_pointerFilter.update(rawPtrX, rawPtrY, dtSeconds, pointerScale, streamVx, streamVy)
+            : s_pointerFilter.update(rawPtrX, rawPtrY, dtSeconds, pointerScale);
+    bool pointerMoved = (filtered.x != s_committedPtrX || filtered.y != s_committedPtrY);
+    s_committedPtrX = filtered.x;
+    s_committedPtrY = filtered.y;
     {
-        s_committedPtrX = rawPtrX;
-        s_committedPtrY = rawPtrY;
+        ScreenPoint damped = s_pointerDamper.update(s_committedPtrX, s_committedPtrY,
+                                                    zoom, dtSeconds);
+        s_dampedPtrX = damped.x;
+        s_dampedPtrY = damped.y;
     }
 
     // 5b. Read timestamps and rects for source priority arbitration
@@ -493,10 +711,28 @@ void RenderLoop::frameTick()
     focusValid = focusValid && s_followKeyboardFocus;
     caretValid = caretValid && s_followTextCursor;
 
-    // 5c. Determine active tracking source
-    TrackingSource newSource = s_viewportTracker.determineActiveSource(
-        nowMs, s_lastPointerMoveTimeMs, lastFocusChange, lastKeyboardInput,
-        focusValid, caretValid);
+    // Caret motion model sees every valid caret frame (unchanged rects decay
+    // its velocity); a gap while invalid reads as stale and resets the motion.
+    if (caretValid)
+        s_caretMotion.update(caretRect, nowMs);
+
+    // 5c. Determine active tracking source: each source publishes its candidate
+    // (caret's timestamp is the last keystroke — typing is the intent) and the
+    // arbiter scores them with hysteresis (Doc 3 §3.4).
+    SourceArbiter& arbiter = s_viewportTracker.arbiter();
+    arbiter.publish(TrackingSource::Pointer,
+                    {{s_committedPtrX, s_committedPtrY, s_committedPtrX + 1, s_committedPtrY + 1},
+                     s_lastPointerMoveTimeMs, 1.0f});
+    arbiter.publish(TrackingSource::Focus,
+                    {focusRect, lastFocusChange, focusValid ? 1.0f : 0.0f});
+    arbiter.publish(TrackingSource::Caret,
+                    {caretRect, lastKeyboardInput, caretValid ? 1.0f : 0.0f});
+    TrackingSource newSource = arbiter.arbitrate(nowMs);
+    if (detachFrame == ViewportDetach::Frame::Reattach)
+    {
+        arbiter.setActive(TrackingSource::Pointer, nowMs);
+        newSource = TrackingSource::Pointer;
+    }
 
     // 5d. Compute target offset based on active source
     ViewportTracker::Offset targetOffset;
@@ -506,28 +742,33 @@ void RenderLoop::frameTick()
         // Use caret's monitor for centering (AC-MM.04)
         {
             ScreenPoint caretCenter = caretRect.center();
-            POINT cp = {caretCenter.x, caretCenter.y};
-            HMONITOR hElemMon = MonitorFromPoint(cp, MONITOR_DEFAULTTONEAREST);
-            MONITORINFO emi = {}; emi.cbSize = sizeof(emi);
-            GetMonitorInfo(hElemMon, &emi);
-            int32_t eMonL = emi.rcMonitor.left, eMonT = emi.rcMonitor.top;
-            int32_t eMonW = emi.rcMonitor.right - eMonL;
-            int32_t eMonH = emi.rcMonitor.bottom - eMonT;
-            targetOffset = ViewportTracker::computeCaretOffset(
-                caretRect, zoom, eMonW, eMonH, eMonL, eMonT);
+            const ScreenRect em = s_monitors.monitorAt(caretCenter.x, caretCenter.y, virtualDesktop);
+            int32_t eMonL = em.left, eMonT = em.top;
+            int32_t eMonW = em.width();
+            int32_t eMonH = em.height();
+            // Edge-triggered follow: no pan while the caret has room ahead of
+            // it; when it nears the edge it is moving toward, pan (animated)
+            // so the lookahead in its typing direction is revealed.
+            if (s_activeSource != TrackingSource::Caret)
+                s_caretAnchor = {s_lastOffX, s_lastOffY};
+            ViewportTracker::Offset next = ViewportTracker::computeCaretFollowOffset(
+                s_caretAnchor.x, s_caretAnchor.y, caretRect, s_caretMotion.lookahead(),
+                zoom, eMonW, eMonH, eMonL, eMonT);
+            if (s_activeSource == TrackingSource::Caret
+                && (next.x != s_caretAnchor.x || next.y != s_caretAnchor.y))
+                s_sourceTransition.begin({s_lastOffX, s_lastOffY}, next, zoom);
+            s_caretAnchor = next;
+            targetOffset = next;
         }
         break;
     case TrackingSource::Focus:
         // Use focus element's monitor for centering (AC-MM.04)
         {
             ScreenPoint focusCenter = focusRect.center();
-            POINT fp = {focusCenter.x, focusCenter.y};
-            HMONITOR hElemMon = MonitorFromPoint(fp, MONITOR_DEFAULTTONEAREST);
-            MONITORINFO emi = {}; emi.cbSize = sizeof(emi);
-            GetMonitorInfo(hElemMon, &emi);
-            int32_t eMonL = emi.rcMonitor.left, eMonT = emi.rcMonitor.top;
-            int32_t eMonW = emi.rcMonitor.right - eMonL;
-            int32_t eMonH = emi.rcMonitor.bottom - eMonT;
+            const ScreenRect em = s_monitors.monitorAt(focusCenter.x, focusCenter.y, virtualDesktop);
+            int32_t eMonL = em.left, eMonT = em.top;
+            int32_t eMonW = em.width();
+            int32_t eMonH = em.height();
             // AC-2.5.05/06: pan only if the focused element isn't already fully
             // visible, and then only just enough — pass the current applied offset
             // so an already-visible element produces zero viewport motion.
@@ -537,54 +778,40 @@ void RenderLoop::frameTick()
         break;
     case TrackingSource::Pointer:
     default:
-        targetOffset = ViewportTracker::computePointerOffset(
-            s_committedPtrX, s_committedPtrY, zoom, s_screenW, s_screenH,
-            s_screenOriginX, s_screenOriginY);
+        targetOffset = trackPointerOffset(rawPtrX, rawPtrY, zoom, dtSeconds, pointerMonitor);
         break;
     }
 
-    // 5e. Source transition smoothing (200ms ease-out between sources)
-    // When the active source changes, don't snap — interpolate from current to new.
-    if (newSource != s_activeSource)
+    // 5e. Source transition: pan from the current offset to the new source's
+    // target instead of snapping; duration scales with the on-screen distance
+    // and an interrupted pan's velocity carries over. Re-attaching after a
+    // detach pans the same way, from the frozen view (at rest) to the pointer.
+    if (newSource != s_activeSource || detachFrame == ViewportDetach::Frame::Reattach)
     {
-        // Begin transition: save current offset as starting point
-        s_transitionOffX = s_lastOffX;
-        s_transitionOffY = s_lastOffY;
-        s_transitionElapsedMs = 0.0f;
-        s_sourceTransitionActive = true;
+        s_sourceTransition.begin({s_lastOffX, s_lastOffY}, targetOffset, zoom);
         s_activeSource = newSource;
         SZ_LOG_DEBUG("RenderLoop", L"Source transition: -> %d", static_cast<int>(newSource));
     }
 
-    // WS2B: Cancel active transition if pointer moves beyond deadzone.
+    // WS2B: Cancel active transition if the filtered pointer moves.
     // Prevents viewport drifting toward stale focus/caret target when user moves mouse.
-    if (s_sourceTransitionActive && s_activeSource != TrackingSource::Pointer && pointerMoved)
+    if (s_sourceTransition.active() && s_activeSource != TrackingSource::Pointer && pointerMoved)
     {
-        s_sourceTransitionActive = false;
+        s_sourceTransition.cancel();
         s_activeSource = TrackingSource::Pointer;
-        targetOffset = ViewportTracker::computePointerOffset(
-            s_committedPtrX, s_committedPtrY, zoom, s_screenW, s_screenH,
-            s_screenOriginX, s_screenOriginY);
+        arbiter.setActive(TrackingSource::Pointer, nowMs);
+        targetOffset = trackPointerOffset(rawPtrX, rawPtrY, zoom, dtSeconds, pointerMonitor);
         SZ_LOG_DEBUG("RenderLoop", L"Source transition cancelled by pointer movement");
     }
 
-    ViewportTracker::Offset offset = targetOffset;
-    if (s_sourceTransitionActive)
+    ViewportTracker::Offset offset = s_sourceTransition.advance(targetOffset, dtSeconds);
+
+    // Quantized rest: pin offsets to the integer source-pixel grid MagBridge
+    // applies anyway, so sub-pixel drift doesn't re-issue an identical transform.
+    if (s_zoomController.isQuantized() && !s_sourceTransition.active())
     {
-        s_transitionElapsedMs += dtSeconds * 1000.0f;
-        float t = s_transitionElapsedMs / kSourceTransitionDurationMs;
-        if (t >= 1.0f)
-        {
-            // Transition complete
-            s_sourceTransitionActive = false;
-        }
-        else
-        {
-            // Ease-out: 1 - (1-t)^2
-            float eased = 1.0f - (1.0f - t) * (1.0f - t);
-            offset.x = s_transitionOffX + (targetOffset.x - s_transitionOffX) * eased;
-            offset.y = s_transitionOffY + (targetOffset.y - s_transitionOffY) * eased;
-        }
+        offset.x = quantizeOffset(offset.x);
+        offset.y = quantizeOffset(offset.y);
     }
 
     // 6. Apply to MagBridge — only if values changed since last frame.
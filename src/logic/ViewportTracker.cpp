@@ -3,16 +3,48 @@
 // Offset computation, proportional pointer mapping. Doc 3 §3.6
 //
 // Phase 1: Full proportional mapping (AC-2.4.01), edge clamping.
-//          Deadzone filtering lives in RenderLoop (AC-2.4.09–AC-2.4.11).
-// Phase 3: Multi-source priority arbitration (focus, caret, pointer).
+//          Pointer jitter filtering lives in RenderLoop (AC-2.4.09–AC-2.4.11).
+// Phase 3: Multi-source priority arbitration (focus, caret, pointer) —
+//          scored by SourceArbiter's policy table.
 // =============================================================================
 
 #include "smoothzoom/logic/ViewportTracker.h"
 #include <algorithm>
+#include <cmath>
 
 namespace SmoothZoom
 {
 
+// Valid offset range for a screen region: its physical area must show only its
+// own virtual area. See computePointerOffset for the derivation.
+ViewportTracker::OffsetBounds ViewportTracker::offsetBounds(
+    float zoom, int32_t screenW, int32_t screenH, int32_t originX, int32_t originY)
+{
+    const float k = 1.0f - 1.0f / zoom;
+    OffsetBounds b;
+    b.minX = static_cast<float>(originX) * k;
+    b.minY = static_cast<float>(originY) * k;
+    b.maxX = static_cast<float>(originX + screenW) * k;
+    b.maxY = static_cast<float>(originY + screenH) * k;
+    return b;
+}
+
+ViewportTracker::Offset ViewportTracker::clampOffset(const Offset& offset,
+                                                     const OffsetBounds& bounds)
+{
+    return {std::clamp(offset.x, bounds.minX, bounds.maxX),
+            std::clamp(offset.y, bounds.minY, bounds.maxY)};
+}
+
+ScreenRect ViewportTracker::scopeRegion(ZoomScope scope, const MonitorTable& monitors,
+                                        const ScreenRect& virtualDesktop,
+                                        int32_t x, int32_t y)
+{
+    if (scope == ZoomScope::ActiveMonitor)
+        return monitors.monitorAt(x, y, virtualDesktop);
+    return virtualDesktop;
+}
+
 // Core proportional mapping formula from Doc 3 §3.4:
 //   xOffset = pointerX * (1.0 - 1.0 / zoom)
 //   yOffset = pointerY * (1.0 - 1.0 / zoom)
@@ -43,15 +75,245 @@ ViewportTracker::Offset ViewportTracker::computePointerOffset(
     // to the classic [0, screenW*(1-1/Z)]; with a negative origin (monitor left
     // of primary) the previous [originX, originX+screenW*(1-1/Z)] range was too
     // small by |originX|/Z and pinned tracking across the primary monitor.
-    float minOffX = static_cast<float>(originX) * (1.0f - invZoom);
-    float minOffY = static_cast<float>(originY) * (1.0f - invZoom);
-    float maxOffX = static_cast<float>(originX + screenW) * (1.0f - invZoom);
-    float maxOffY = static_cast<float>(originY + screenH) * (1.0f - invZoom);
+    return clampOffset({xOff, yOff}, offsetBounds(zoom, screenW, screenH, originX, originY));
+}
 
-    xOff = std::clamp(xOff, minOffX, maxOffX);
-    yOff = std::clamp(yOff, minOffY, maxOffY);
+// ─── Edge-push tracking (research §3.5 "when pointer reaches edge") ──────────
+//
+// The pointer appears on screen at physX = (pointerX − offsetX) · zoom. While
+// physX lies inside [origin + m, origin + extent − m] (m = margin band) the
+// offset is left untouched — no pan, no setTransform. Past the band's inner
+// edge the pointer is `depth` screen px into the band; the viewport pans to
+// remove that depth at rate pushSpeed/m, i.e. depth(t) = depth₀·e^(−k·t), which
+// is exact for any dt (refresh-rate independent) and gives pushSpeed px/s with
+// the pointer at the outer edge. A pointer that jumps beyond the band (fast
+// flick) is first brought back to the outer edge so it never leaves the screen.
+
+namespace
+{
 
-    return {xOff, yOff};
+float edgePushAxis(float offset, float pointer, float zoom, float origin, float extent,
+                   float marginPx, float decay)
+{
+    const float phys = (pointer - offset) * zoom;
+    const float lo = origin + marginPx;
+    const float hi = origin + extent - marginPx;
+
+    float depth = 0.0f;
+    if (phys < lo)
+        depth = phys - lo;
+    else if (phys > hi)
+        depth = phys - hi;
+    if (depth == 0.0f)
+        return offset;
+
+    // Hard constraint: the pointer stays on screen.
+    if (depth > marginPx)
+    {
+        offset += (depth - marginPx) / zoom;
+        depth = marginPx;
+    }
+    else if (depth < -marginPx)
+    {
+        offset += (depth + marginPx) / zoom;
+        depth = -marginPx;
+    }
+
+    float remaining = depth * decay;
+    if (std::abs(remaining) < ViewportTracker::kEdgePushSettlePx)
+        remaining = 0.0f;
+    return offset + (depth - remaining) / zoom;
+}
+
+} // namespace
+
+ViewportTracker::Offset ViewportTracker::computeEdgePushOffset(
+    const Offset& current,
+    int32_t pointerX, int32_t pointerY,
+    float zoom, const EdgePushParams& params,
+    float dtSeconds, int32_t screenW, int32_t screenH,
+    int32_t originX, int32_t originY)
+{
+    if (zoom <= 1.0f)
+        return {0.0f, 0.0f};
+
+    const float dt = (dtSeconds > 0.0f) ? dtSeconds : 0.0f;
+    const float margin = std::clamp(params.marginFraction, 0.0f, 0.45f);
+    const float marginX = margin * static_cast<float>(screenW);
+    const float marginY = margin * static_cast<float>(screenH);
+
+    // e^(−k·dt) with k = pushSpeed / margin (per axis). Zero margin → the
+    // pointer simply drags the viewport at the screen edge.
+    auto decayFor = [&](float marginPx) {
+        if (marginPx <= 0.0f || params.pushSpeedPx <= 0.0f)
+            return 0.0f;
+        return std::exp(-params.pushSpeedPx / marginPx * dt);
+    };
+
+    Offset out;
+    out.x = edgePushAxis(current.x, static_cast<float>(pointerX), zoom,
+                         static_cast<float>(originX), static_cast<float>(screenW),
+                         marginX, decayFor(marginX));
+    out.y = edgePushAxis(current.y, static_cast<float>(pointerY), zoom,
+                         static_cast<float>(originY), static_cast<float>(screenH),
+                         marginY, decayFor(marginY));
+
+    return clampOffset(out, offsetBounds(zoom, screenW, screenH, originX, originY));
+}
+
+// Keep physX = (pointerX − offset)·zoom fixed across the zoom change:
+//   offset' = pointerX − (pointerX − offset)·fromZoom / toZoom
+ViewportTracker::Offset ViewportTracker::reanchorOffset(
+    const Offset& current, int32_t pointerX, int32_t pointerY,
+    float fromZoom, float toZoom)
+{
+    if (toZoom <= 1.0f)
+        return {0.0f, 0.0f};
+    if (fromZoom <= 0.0f)
+        fromZoom = 1.0f;
+
+    const float ratio = fromZoom / toZoom;
+    const float px = static_cast<float>(pointerX);
+    const float py = static_cast<float>(pointerY);
+    return {px - (px - current.x) * ratio, py - (py - current.y) * ratio};
+}
+
+// ─── Keep-pointer-centered tracking (research §3.5 "keep pointer centered") ───
+//
+// The pointer sits at the monitor center c when offset = pointerX − c/zoom.
+// The view follows that goal g with a critically damped spring
+//   x″ = −2ω·x′ − ω²·(x − g)
+// whose exact solution over a frame (g held constant) is, with e = x − g,
+//   x(dt) = g + (e + (v + ω·e)·dt)·e^(−ω·dt)
+//   v(dt) = (v − ω·(v + ω·e)·dt)·e^(−ω·dt)
+// so the path is the same at any refresh rate and never overshoots a step.
+
+namespace
+{
+
+void followAxis(float& x, float& v, float goal, float omega, float dt, float zoom,
+                float lo, float hi)
+{
+    const float e = x - goal;
+    const float decay = std::exp(-omega * dt);
+    const float c = (v + omega * e) * dt;
+    x = goal + (e + c) * decay;
+    v = (v - omega * c) * decay;
+
+    // Come to rest once the remaining error — and what the velocity would add
+    // over one time constant — is below the settle threshold on screen.
+    const float settle = ViewportTracker::kCenteredSettlePx / zoom;
+    if (std::abs(x - goal) < settle && std::abs(v) < settle * omega)
+    {
+        x = goal;
+        v = 0.0f;
+    }
+    else if (x < lo || x > hi)
+    {
+        x = std::clamp(x, lo, hi);
+        v = 0.0f;
+    }
+}
+
+} // namespace
+
+ViewportTracker::FollowState ViewportTracker::computeCenteredOffset(
+    const FollowState& current,
+    int32_t pointerX, int32_t pointerY,
+    float zoom, const CenteredParams& params,
+    float dtSeconds, int32_t screenW, int32_t screenH,
+    int32_t originX, int32_t originY, const ScreenRect* monitor)
+{
+    if (zoom <= 1.0f)
+        return {};
+
+    // Region bounds keep the view on the virtual desktop; monitor bounds keep
+    // the pointer's monitor showing only its own content (AC-MM.04).
+    OffsetBounds b = offsetBounds(zoom, screenW, screenH, originX, originY);
+    ScreenRect area{originX, originY, originX + screenW, originY + screenH};
+    if (monitor && monitor->width() > 0 && monitor->height() > 0)
+    {
+        const OffsetBounds m = offsetBounds(zoom, monitor->width(), monitor->height(),
+                                            monitor->left, monitor->top);
+        b.minX = std::max(b.minX, m.minX);
+        b.minY = std::max(b.minY, m.minY);
+        b.maxX = std::max(b.minX, std::min(b.maxX, m.maxX));
+        b.maxY = std::max(b.minY, std::min(b.maxY, m.maxY));
+        area = *monitor;
+    }
+
+    // Hard constraint, as for edge push: however far the follow lags a fast
+    // flick, the pointer stays on screen — physX ∈ [left, right] gives
+    // offset ∈ [pointerX − right/Z, pointerX − left/Z]. Always intersects the
+    // bounds above for a pointer inside `area`.
+    const float px = static_cast<float>(pointerX);
+    const float py = static_cast<float>(pointerY);
+    b.minX = std::max(b.minX, px - static_cast<float>(area.right) / zoom);
+    b.minY = std::max(b.minY, py - static_cast<float>(area.bottom) / zoom);
+    b.maxX = std::max(b.minX, std::min(b.maxX, px - static_cast<float>(area.left) / zoom));
+    b.maxY = std::max(b.minY, std::min(b.maxY, py - static_cast<float>(area.top) / zoom));
+
+    const float centerX = 0.5f * static_cast<float>(area.left + area.right);
+    const float centerY = 0.5f * static_cast<float>(area.top + area.bottom);
+    const Offset goal = clampOffset({px - centerX / zoom, py - centerY / zoom}, b);
+    if (params.followSec <= 0.0f)
+        return {goal, {0.0f, 0.0f}};
+
+    const float omega = kCenteredFollowOmegaT / params.followSec;
+    const float dt = (dtSeconds > 0.0f) ? dtSeconds : 0.0f;
+    FollowState out = current;
+    followAxis(out.offset.x, out.velocity.x, goal.x, omega, dt, zoom, b.minX, b.maxX);
+    followAxis(out.offset.y, out.velocity.y, goal.y, omega, dt, zoom, b.minY, b.maxY);
+    return out;
+}
+
+ViewportTracker::Offset ViewportTracker::trackPointer(
+    int32_t pointerX, int32_t pointerY, float zoom,
+    const Offset& applied, float appliedZoom, float dtSeconds,
+    int32_t screenW, int32_t screenH, int32_t originX, int32_t originY,
+    const ScreenRect* monitor)
+{
+    if (pointerMode_ == PointerTrackingMode::Continuous)
+    {
+        followStateValid_ = false;
+        return computePointerOffset(pointerX, pointerY, zoom, screenW, screenH,
+                                    originX, originY);
+    }
+
+    // Continue the exact (float) state from last frame while the applied
+    // transform is still the one this produced; otherwise (another source or
+    // mode moved the view) start at rest from what is on screen. A zoom change
+    // pivots about the pointer (zoom-center stability, as the proportional
+    // mapping gives for free).
+    FollowState from{applied, {0.0f, 0.0f}};
+    if (followStateValid_ && std::round(followState_.offset.x) == applied.x
+        && std::round(followState_.offset.y) == applied.y)
+        from = followState_;
+    if (zoom != appliedZoom)
+    {
+        const float ratio = (appliedZoom > 0.0f && zoom > 0.0f) ? appliedZoom / zoom : 1.0f;
+        from.offset = reanchorOffset(from.offset, pointerX, pointerY, appliedZoom, zoom);
+        from.velocity = {from.velocity.x * ratio, from.velocity.y * ratio};
+    }
+
+    if (pointerMode_ == PointerTrackingMode::Centered)
+    {
+        followState_ = computeCenteredOffset(from, pointerX, pointerY, zoom, centered_,
+                                             dtSeconds, screenW, screenH, originX, originY,
+                                             monitor);
+    }
+    else
+    {
+        followState_.offset = computeEdgePushOffset(from.offset, pointerX, pointerY, zoom,
+                                                    edgePush_, dtSeconds, screenW, screenH,
+                                                    originX, originY);
+        followState_.velocity = {0.0f, 0.0f};
+    }
+    followStateValid_ = true;
+
+    // MagBridge applies whole source pixels, so sub-pixel pans are invisible
+    // and would only re-issue setTransform: emit the rounded offset.
+    return {std::round(followState_.offset.x), std::round(followState_.offset.y)};
 }
 
 ViewportTracker::Offset ViewportTracker::computeElementOffset(
@@ -62,8 +324,6 @@ ViewportTracker::Offset ViewportTracker::computeElementOffset(
     if (zoom <= 1.0f)
         return {0.0f, 0.0f};
 
-    float invZoom = 1.0f / zoom;
-
     // Center the element on its physical monitor (AC-MM.04).
     // Derivation: we want the element at the physical center of the monitor.
     // Physical center of monitor = originX + screenW/2.
@@ -83,15 +343,7 @@ ViewportTracker::Offset ViewportTracker::computeElementOffset(
     // These must stay within [originX, originX+screenW]:
     //   offX >= originX * (1 - 1/Z)  and  offX <= (originX+screenW) * (1 - 1/Z)
     // When originX=0: min=0, max=screenW*(1-1/Z) — same as before.
-    float minOffX = static_cast<float>(originX) * (1.0f - invZoom);
-    float minOffY = static_cast<float>(originY) * (1.0f - invZoom);
-    float maxOffX = static_cast<float>(originX + screenW) * (1.0f - invZoom);
-    float maxOffY = static_cast<float>(originY + screenH) * (1.0f - invZoom);
-
-    xOff = std::clamp(xOff, minOffX, maxOffX);
-    yOff = std::clamp(yOff, minOffY, maxOffY);
-
-    return {xOff, yOff};
+    return clampOffset({xOff, yOff}, offsetBounds(zoom, screenW, screenH, originX, originY));
 }
 
 // Visibility-aware focus offset (AC-2.5.05 / AC-2.5.06):
@@ -112,10 +364,7 @@ ViewportTracker::Offset ViewportTracker::computeFocusOffset(
 
     // Valid global-offset range that keeps this monitor's physical area within its
     // virtual region (identical derivation to computeElementOffset's clamp).
-    const float minOffX = static_cast<float>(originX) * (1.0f - invZoom);
-    const float minOffY = static_cast<float>(originY) * (1.0f - invZoom);
-    const float maxOffX = static_cast<float>(originX + screenW) * (1.0f - invZoom);
-    const float maxOffY = static_cast<float>(originY + screenH) * (1.0f - invZoom);
+    const OffsetBounds bounds = offsetBounds(zoom, screenW, screenH, originX, originY);
 
     // Minimal 1-D pan. The visible virtual span on this monitor is
     // [curOff + origin/zoom, curOff + (origin+extent)/zoom). If [lo,hi] is already
@@ -158,19 +407,20 @@ ViewportTracker::Offset ViewportTracker::computeFocusOffset(
                              static_cast<float>(elementRect.left),
                              static_cast<float>(elementRect.right),
                              static_cast<float>(originX),
-                             static_cast<float>(screenW), minOffX, maxOffX);
+                             static_cast<float>(screenW), bounds.minX, bounds.maxX);
     const float yOff = solve(currentOffsetY,
                              static_cast<float>(elementRect.top),
                              static_cast<float>(elementRect.bottom),
                              static_cast<float>(originY),
-                             static_cast<float>(screenH), minOffY, maxOffY);
+                             static_cast<float>(screenH), bounds.minY, bounds.maxY);
 
     return {xOff, yOff};
 }
 
 // Caret offset with lookahead margin (AC-2.6.06):
 // Shifts the target ~15% of viewport width ahead of the caret so the user
-// can see upcoming text. Assumes LTR typing direction (positive X shift).
+// can see upcoming text. Assumes LTR typing direction (positive X shift);
+// RenderLoop follows the caret with computeCaretFollowOffset instead.
 ViewportTracker::Offset ViewportTracker::computeCaretOffset(
     const ScreenRect& caretRect,
     float zoom, int32_t screenW, int32_t screenH,
@@ -179,7 +429,6 @@ ViewportTracker::Offset ViewportTracker::computeCaretOffset(
     if (zoom <= 1.0f)
         return {0.0f, 0.0f};
 
-    float invZoom = 1.0f / zoom;
     float viewportW = static_cast<float>(screenW) / zoom;
 
     ScreenPoint center = caretRect.center();
@@ -192,21 +441,135 @@ ViewportTracker::Offset ViewportTracker::computeCaretOffset(
     float yOff = static_cast<float>(center.y) - monCenterY / zoom;
 
     // Clamp: keep active monitor's physical display within its virtual area
-    float minOffX = static_cast<float>(originX) * (1.0f - invZoom);
-    float minOffY = static_cast<float>(originY) * (1.0f - invZoom);
-    float maxOffX = static_cast<float>(originX + screenW) * (1.0f - invZoom);
-    float maxOffY = static_cast<float>(originY + screenH) * (1.0f - invZoom);
+    return clampOffset({xOff, yOff}, offsetBounds(zoom, screenW, screenH, originX, originY));
+}
 
-    xOff = std::clamp(xOff, minOffX, maxOffX);
-    yOff = std::clamp(yOff, minOffY, maxOffY);
+// Edge-triggered caret follow: 1-D per axis, in fractions of the visible span.
+// Moving toward +: pan once the caret's leading edge passes 1 − lookahead;
+// toward −: once it passes |lookahead|; any direction: once it leaves the view.
+// The pan puts the caret center at 0.5 − lookahead, so a full half-viewport
+// or more of typing fits before the next pan instead of one pan per character.
+ViewportTracker::Offset ViewportTracker::computeCaretFollowOffset(
+    float currentOffsetX, float currentOffsetY,
+    const ScreenRect& caretRect, const CaretLookahead& lookahead,
+    float zoom, int32_t screenW, int32_t screenH,
+    int32_t originX, int32_t originY)
+{
+    if (zoom <= 1.0f)
+        return {0.0f, 0.0f};
 
-    return {xOff, yOff};
+    const float invZoom = 1.0f / zoom;
+    const OffsetBounds bounds = offsetBounds(zoom, screenW, screenH, originX, originY);
+
+    auto solve = [invZoom](float curOff, float lo, float hi, float la,
+                           float origin, float extent,
+                           float minOff, float maxOff) -> float
+    {
+        const float span = extent * invZoom;
+        const float visibleLo = curOff + origin * invZoom;
+        const float fLo = (lo - visibleLo) / span;
+        const float fHi = (hi - visibleLo) / span;
+
+        const bool offscreen = fLo < 0.0f || fHi > 1.0f;
+        const bool nearLeadingEdge = (la > 0.0f && fHi > 1.0f - la)
+                                  || (la < 0.0f && fLo < -la);
+        if (!offscreen && !nearLeadingEdge)
+            return std::clamp(curOff, minOff, maxOff);
+
+        const float center = 0.5f * (lo + hi);
+        return std::clamp(center - (0.5f - la) * span - origin * invZoom, minOff, maxOff);
+    };
+
+    return {solve(currentOffsetX, static_cast<float>(caretRect.left),
+                  static_cast<float>(caretRect.right), lookahead.x,
+                  static_cast<float>(originX), static_cast<float>(screenW),
+                  bounds.minX, bounds.maxX),
+            solve(currentOffsetY, static_cast<float>(caretRect.top),
+                  static_cast<float>(caretRect.bottom), lookahead.y,
+                  static_cast<float>(originY), static_cast<float>(screenH),
+                  bounds.minY, bounds.maxY)};
+}
+
+float ViewportTracker::PanAnimator::durationForDistance(float screenDistancePx)
+{
+    const float d = std::max(0.0f, screenDistancePx);
+    const float ms = kMinDurationMs + kMsPerDoubling * std::log2(1.0f + d / kDistanceRefPx);
+    return std::clamp(ms, kMinDurationMs, kMaxDurationMs);
+}
+
+namespace
+{
+
+// Carried-velocity term (velocity × duration) for one axis, limited to the
+// monotone range of a cubic Hermite with zero end slope: [0, 3·Δ] along Δ
+// (Fritsch–Carlson). Velocity away from the target is dropped.
+float monotoneCarry(float carry, float delta)
+{
+    if (delta == 0.0f || carry * delta <= 0.0f)
+        return 0.0f;
+    const float limit = 3.0f * std::abs(delta);
+    return std::copysign(std::min(std::abs(carry), limit), delta);
+}
+
+} // namespace
+
+void ViewportTracker::PanAnimator::begin(const Offset& from, const Offset& target, float zoom)
+{
+    const Offset v = velocity(); // of the pan being interrupted, zero if idle
+    const float dx = target.x - from.x;
+    const float dy = target.y - from.y;
+    durationMs_ = durationForDistance(std::sqrt(dx * dx + dy * dy) * std::max(zoom, 1.0f));
+
+    const float T = durationMs_ / 1000.0f;
+    from_ = from;
+    carry_ = {monotoneCarry(v.x * T, dx), monotoneCarry(v.y * T, dy)};
+    lastTarget_ = target;
+    elapsedMs_ = 0.0f;
+    active_ = true;
+}
+
+// p(u) = from + Δ·(3u² − 2u³) + carry·(u − 2u² + u³),  u = elapsed / duration.
+// Position and slope match the start (from, carried velocity) and the end
+// (target, rest); with no carry it is a smoothstep.
+ViewportTracker::Offset ViewportTracker::PanAnimator::advance(const Offset& target,
+                                                              float dtSeconds)
+{
+    if (!active_)
+        return target;
+
+    elapsedMs_ += dtSeconds * 1000.0f;
+    lastTarget_ = target;
+    const float u = elapsedMs_ / durationMs_;
+    if (u >= 1.0f)
+    {
+        active_ = false;
+        return target;
+    }
+
+    const float hTarget = u * u * (3.0f - 2.0f * u);
+    const float hCarry = u * (1.0f - u) * (1.0f - u);
+    Offset out;
+    out.x = from_.x + (target.x - from_.x) * hTarget + carry_.x * hCarry;
+    out.y = from_.y + (target.y - from_.y) * hTarget + carry_.y * hCarry;
+    return out;
 }
 
-// Priority arbitration for viewport tracking source (Doc 3 §3.4):
-//   1. Caret — user is actively typing (keyboard input within 500ms) and caret available
-//   2. Focus — a focus change occurred more recently than mouse movement, debounced 100ms
-//   3. Pointer — default fallback
+ViewportTracker::Offset ViewportTracker::PanAnimator::velocity() const
+{
+    if (!active_)
+        return {};
+    const float u = std::clamp(elapsedMs_ / durationMs_, 0.0f, 1.0f);
+    const float T = durationMs_ / 1000.0f;
+    const float dTarget = 6.0f * u * (1.0f - u);
+    const float dCarry = (1.0f - u) * (1.0f - 3.0f * u);
+    return {((lastTarget_.x - from_.x) * dTarget + carry_.x * dCarry) / T,
+            ((lastTarget_.y - from_.y) * dTarget + carry_.y * dCarry) / T};
+}
+
+// Legacy entry point: scores the three built-in sources with this tracker's
+// policy table but without hysteresis, so the answer depends only on the inputs.
+// Caret's timestamp is the last keystroke (typing is the intent), focus yields
+// to a later pointer move, pointer is the fallback (AC-2.5.10).
 TrackingSource ViewportTracker::determineActiveSource(
     int64_t now,
     int64_t lastPointerMoveTime,
@@ -215,25 +578,13 @@ TrackingSource ViewportTracker::determineActiveSource(
     bool focusRectValid,
     bool caretRectValid) const
 {
-    // Caret takes priority while user is actively typing (AC-2.6.07)
-    if (caretRectValid && lastKeyboardInputTime > 0 &&
-        (now - lastKeyboardInputTime) < kCaretIdleTimeoutMs)
-    {
-        return TrackingSource::Caret;
-    }
-
-    // Focus takes priority if a focus change occurred after the last pointer move,
-    // the focus rect is valid, and the debounce window has elapsed (AC-2.5.07, AC-2.5.08).
-    // The debounce prevents chasing intermediate elements during rapid Tab cycling.
-    if (focusRectValid && lastFocusChangeTime > 0 &&
-        lastFocusChangeTime > lastPointerMoveTime &&
-        (now - lastFocusChangeTime) >= kFocusDebounceMs)
-    {
-        return TrackingSource::Focus;
-    }
-
-    // Default: pointer tracking (AC-2.5.10)
-    return TrackingSource::Pointer;
+    SourceArbiter scratch = arbiter_;
+    scratch.publish(TrackingSource::Pointer, {{}, lastPointerMoveTime, 1.0f});
+    scratch.publish(TrackingSource::Focus,
+                    {{}, lastFocusChangeTime, focusRectValid ? 1.0f : 0.0f});
+    scratch.publish(TrackingSource::Caret,
+                    {{}, lastKeyboardInputTime, caretRectValid ? 1.0f : 0.0f});
+    return scratch.evaluate(now);
 }
 
 } // namespace SmoothZoom
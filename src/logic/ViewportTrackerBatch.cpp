@@ -0,0 +1,313 @@
+// =============================================================================
+// SmoothZoom — ViewportTracker batch kernels
+// Structure-of-arrays offset kernels for many points / rects at once. Doc 3 §3.6
+//
+// Each kernel hoists the per-call constants (1/zoom, the four clamp bounds,
+// the scaled monitor center) and evaluates the per-element math with the same
+// float operations, in the same order, as the scalar function it mirrors, so
+// the results are bit-identical:
+//   • int → float conversion rounds to nearest in both paths;
+//   • std::clamp(v, lo, hi) is min(hi, max(lo, v)) with the bound as the
+//     FIRST operand — MAXPS/MINPS return the second operand on ties, which
+//     keeps v (and the sign of a zero) exactly as std::clamp does;
+//   • ScreenRect::center()'s truncating (l + r) / 2 is (s + (s >>> 31)) >> 1;
+//   • branches (computeFocusOffset) become masks: every path is computed and
+//     the scalar function's choice selected per lane.
+// Identity assumes no floating-point contraction into FMA (MSVC /fp:precise
+// default; GCC/Clang only contract when FMA is enabled, which we never do).
+//
+// The instruction set is chosen at compile time: AVX2 (8 lanes) when built
+// with SMOOTHZOOM_AVX2 (/arch:AVX2), else SSE2 (4 lanes, baseline on x64),
+// else the scalar functions. The remainder after the last full vector always
+// goes through the scalar functions.
+// =============================================================================
+
+#include "smoothzoom/logic/ViewportTracker.h"
+
+#if defined(__AVX2__)
+#define SMOOTHZOOM_BATCH_AVX2 1
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#define SMOOTHZOOM_BATCH_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace SmoothZoom
+{
+
+namespace
+{
+
+#if defined(SMOOTHZOOM_BATCH_AVX2)
+
+struct Lanes
+{
+    static constexpr size_t kWidth = 8;
+    using F = __m256;
+    using I = __m256i;
+
+    static I loadI(const int32_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    static F toF(I v) { return _mm256_cvtepi32_ps(v); }
+    static F set(float v) { return _mm256_set1_ps(v); }
+    static void store(float* p, F v) { _mm256_storeu_ps(p, v); }
+    static F add(F a, F b) { return _mm256_add_ps(a, b); }
+    static F sub(F a, F b) { return _mm256_sub_ps(a, b); }
+    static F mul(F a, F b) { return _mm256_mul_ps(a, b); }
+    static F min(F a, F b) { return _mm256_min_ps(a, b); }
+    static F max(F a, F b) { return _mm256_max_ps(a, b); }
+    static F lt(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static F ge(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+    static F le(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+    static F andMask(F a, F b) { return _mm256_and_ps(a, b); }
+    static F select(F mask, F a, F b) { return _mm256_blendv_ps(b, a, mask); } // mask ? a : b
+    static I center(I lo, I hi)
+    {
+        const I s = _mm256_add_epi32(lo, hi);
+        return _mm256_srai_epi32(_mm256_add_epi32(s, _mm256_srli_epi32(s, 31)), 1);
+    }
+};
+
+#elif defined(SMOOTHZOOM_BATCH_SSE2)
+
+struct Lanes
+{
+    static constexpr size_t kWidth = 4;
+    using F = __m128;
+    using I = __m128i;
+
+    static I loadI(const int32_t* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    static F toF(I v) { return _mm_cvtepi32_ps(v); }
+    static F set(float v) { return _mm_set1_ps(v); }
+    static void store(float* p, F v) { _mm_storeu_ps(p, v); }
+    static F add(F a, F b) { return _mm_add_ps(a, b); }
+    static F sub(F a, F b) { return _mm_sub_ps(a, b); }
+    static F mul(F a, F b) { return _mm_mul_ps(a, b); }
+    static F min(F a, F b) { return _mm_min_ps(a, b); }
+    static F max(F a, F b) { return _mm_max_ps(a, b); }
+    static F lt(F a, F b) { return _mm_cmplt_ps(a, b); }
+    static F ge(F a, F b) { return _mm_cmpge_ps(a, b); }
+    static F le(F a, F b) { return _mm_cmple_ps(a, b); }
+    static F andMask(F a, F b) { return _mm_and_ps(a, b); }
+    static F select(F mask, F a, F b) // mask ? a : b
+    {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+    static I center(I lo, I hi)
+    {
+        const I s = _mm_add_epi32(lo, hi);
+        return _mm_srai_epi32(_mm_add_epi32(s, _mm_srli_epi32(s, 31)), 1);
+    }
+};
+
+#endif
+
+#if defined(SMOOTHZOOM_BATCH_AVX2) || defined(SMOOTHZOOM_BATCH_SSE2)
+#define SMOOTHZOOM_BATCH_SIMD 1
+
+using L = Lanes;
+
+// std::clamp(v, lo, hi), tie-exact (see header comment).
+inline L::F clampLanes(L::F v, L::F lo, L::F hi)
+{
+    return L::min(hi, L::max(lo, v));
+}
+
+// One axis of computeFocusOffset's `solve`, all three branches per lane.
+struct FocusAxis
+{
+    L::F curOff, viewportSpan, monCenterScaled, visibleLo, visibleHi;
+    L::F originScaled, farScaled, margin, minOff, maxOff;
+
+    FocusAxis(float cur, float origin, float extent, float invZoom, float minO, float maxO)
+    {
+        curOff = L::set(cur);
+        viewportSpan = L::set(extent * invZoom);
+        monCenterScaled = L::set((origin + extent * 0.5f) * invZoom);
+        visibleLo = L::set(cur + origin * invZoom);
+        visibleHi = L::set(cur + (origin + extent) * invZoom);
+        originScaled = L::set(origin * invZoom);
+        farScaled = L::set((origin + extent) * invZoom);
+        margin = L::set(ViewportTracker::kFocusRevealMarginPx);
+        minOff = L::set(minO);
+        maxOff = L::set(maxO);
+    }
+
+    L::F solve(L::F lo, L::F hi) const
+    {
+        const L::F elementSpan = L::sub(hi, lo);
+        const L::F center = L::mul(L::add(lo, hi), L::set(0.5f));
+        const L::F centered = L::sub(center, monCenterScaled);
+
+        const L::F visible = L::andMask(L::ge(lo, visibleLo), L::le(hi, visibleHi));
+        // std::min(kMargin, s) == MINPS(s, kMargin)
+        const L::F m = L::min(L::mul(L::sub(viewportSpan, elementSpan), L::set(0.5f)), margin);
+        const L::F revealLo = L::sub(L::sub(lo, m), originScaled);
+        const L::F revealHi = L::sub(L::add(hi, m), farScaled);
+        L::F r = L::select(L::lt(lo, visibleLo), revealLo, revealHi);
+        r = L::select(visible, curOff, r);
+        r = L::select(L::ge(elementSpan, viewportSpan), centered, r);
+        return clampLanes(r, minOff, maxOff);
+    }
+};
+
+#endif
+
+void zeroFill(size_t count, const ViewportTracker::OffsetBatch& out)
+{
+    for (size_t i = 0; i < count; ++i)
+        out.x[i] = out.y[i] = 0.0f;
+}
+
+ScreenRect rectAt(const ViewportTracker::RectBatch& r, size_t i)
+{
+    return {r.left[i], r.top[i], r.right[i], r.bottom[i]};
+}
+
+} // namespace
+
+const char* ViewportTracker::batchKernelIsa()
+{
+#if defined(SMOOTHZOOM_BATCH_AVX2)
+    return "avx2";
+#elif defined(SMOOTHZOOM_BATCH_SSE2)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
+
+void ViewportTracker::computePointerOffsets(const PointBatch& points, float zoom,
+                                            int32_t screenW, int32_t screenH,
+                                            int32_t originX, int32_t originY,
+                                            const OffsetBatch& out)
+{
+    if (zoom <= 1.0f)
+        return zeroFill(points.count, out);
+
+    size_t i = 0;
+#if defined(SMOOTHZOOM_BATCH_SIMD)
+    const float invZoom = 1.0f / zoom;
+    const OffsetBounds b = offsetBounds(zoom, screenW, screenH, originX, originY);
+    const L::F k = L::set(1.0f - invZoom);
+    const L::F minX = L::set(b.minX), maxX = L::set(b.maxX);
+    const L::F minY = L::set(b.minY), maxY = L::set(b.maxY);
+    for (; i + L::kWidth <= points.count; i += L::kWidth)
+    {
+        const L::F x = L::mul(L::toF(L::loadI(points.x + i)), k);
+        const L::F y = L::mul(L::toF(L::loadI(points.y + i)), k);
+        L::store(out.x + i, clampLanes(x, minX, maxX));
+        L::store(out.y + i, clampLanes(y, minY, maxY));
+    }
+#endif
+    for (; i < points.count; ++i)
+    {
+        const Offset o = computePointerOffset(points.x[i], points.y[i], zoom,
+                                              screenW, screenH, originX, originY);
+        out.x[i] = o.x;
+        out.y[i] = o.y;
+    }
+}
+
+void ViewportTracker::computeElementOffsets(const RectBatch& rects, float zoom,
+                                            int32_t screenW, int32_t screenH,
+                                            int32_t originX, int32_t originY,
+                                            const OffsetBatch& out)
+{
+    if (zoom <= 1.0f)
+        return zeroFill(rects.count, out);
+
+    size_t i = 0;
+#if defined(SMOOTHZOOM_BATCH_SIMD)
+    const float monCenterX = static_cast<float>(originX) + static_cast<float>(screenW) / 2.0f;
+    const float monCenterY = static_cast<float>(originY) + static_cast<float>(screenH) / 2.0f;
+    const L::F shiftX = L::set(monCenterX / zoom), shiftY = L::set(monCenterY / zoom);
+    const OffsetBounds b = offsetBounds(zoom, screenW, screenH, originX, originY);
+    const L::F minX = L::set(b.minX), maxX = L::set(b.maxX);
+    const L::F minY = L::set(b.minY), maxY = L::set(b.maxY);
+    for (; i + L::kWidth <= rects.count; i += L::kWidth)
+    {
+        const L::F cx = L::toF(L::center(L::loadI(rects.left + i), L::loadI(rects.right + i)));
+        const L::F cy = L::toF(L::center(L::loadI(rects.top + i), L::loadI(rects.bottom + i)));
+        L::store(out.x + i, clampLanes(L::sub(cx, shiftX), minX, maxX));
+        L::store(out.y + i, clampLanes(L::sub(cy, shiftY), minY, maxY));
+    }
+#endif
+    for (; i < rects.count; ++i)
+    {
+        const Offset o = computeElementOffset(rectAt(rects, i), zoom,
+                                              screenW, screenH, originX, originY);
+        out.x[i] = o.x;
+        out.y[i] = o.y;
+    }
+}
+
+void ViewportTracker::computeFocusOffsets(float currentOffsetX, float currentOffsetY,
+                                          const RectBatch& rects, float zoom,
+                                          int32_t screenW, int32_t screenH,
+                                          int32_t originX, int32_t originY,
+                                          const OffsetBatch& out)
+{
+    if (zoom <= 1.0f)
+        return zeroFill(rects.count, out);
+
+    size_t i = 0;
+#if defined(SMOOTHZOOM_BATCH_SIMD)
+    const float invZoom = 1.0f / zoom;
+    const OffsetBounds b = offsetBounds(zoom, screenW, screenH, originX, originY);
+    const FocusAxis ax(currentOffsetX, static_cast<float>(originX), static_cast<float>(screenW),
+                       invZoom, b.minX, b.maxX);
+    const FocusAxis ay(currentOffsetY, static_cast<float>(originY), static_cast<float>(screenH),
+                       invZoom, b.minY, b.maxY);
+    for (; i + L::kWidth <= rects.count; i += L::kWidth)
+    {
+        L::store(out.x + i, ax.solve(L::toF(L::loadI(rects.left + i)),
+                                     L::toF(L::loadI(rects.right + i))));
+        L::store(out.y + i, ay.solve(L::toF(L::loadI(rects.top + i)),
+                                     L::toF(L::loadI(rects.bottom + i))));
+    }
+#endif
+    for (; i < rects.count; ++i)
+    {
+        const Offset o = computeFocusOffset(currentOffsetX, currentOffsetY, rectAt(rects, i),
+                                            zoom, screenW, screenH, originX, originY);
+        out.x[i] = o.x;
+        out.y[i] = o.y;
+    }
+}
+
+void ViewportTracker::computeCaretOffsets(const RectBatch& rects, float zoom,
+                                          int32_t screenW, int32_t screenH,
+                                          int32_t originX, int32_t originY,
+                                          const OffsetBatch& out)
+{
+    if (zoom <= 1.0f)
+        return zeroFill(rects.count, out);
+
+    size_t i = 0;
+#if defined(SMOOTHZOOM_BATCH_SIMD)
+    const float viewportW = static_cast<float>(screenW) / zoom;
+    const float monCenterX = static_cast<float>(originX) + static_cast<float>(screenW) / 2.0f;
+    const float monCenterY = static_cast<float>(originY) + static_cast<float>(screenH) / 2.0f;
+    const L::F lookahead = L::set(viewportW * kCaretLookaheadFraction);
+    const L::F shiftX = L::set(monCenterX / zoom), shiftY = L::set(monCenterY / zoom);
+    const OffsetBounds b = offsetBounds(zoom, screenW, screenH, originX, originY);
+    const L::F minX = L::set(b.minX), maxX = L::set(b.maxX);
+    const L::F minY = L::set(b.minY), maxY = L::set(b.maxY);
+    for (; i + L::kWidth <= rects.count; i += L::kWidth)
+    {
+        const L::F cx = L::toF(L::center(L::loadI(rects.left + i), L::loadI(rects.right + i)));
+        const L::F cy = L::toF(L::center(L::loadI(rects.top + i), L::loadI(rects.bottom + i)));
+        L::store(out.x + i, clampLanes(L::sub(L::add(cx, lookahead), shiftX), minX, maxX));
+        L::store(out.y + i, clampLanes(L::sub(cy, shiftY), minY, maxY));
+    }
+#endif
+    for (; i < rects.count; ++i)
+    {
+        const Offset o = computeCaretOffset(rectAt(rects, i), zoom,
+                                            screenW, screenH, originX, originY);
+        out.x[i] = o.x;
+        out.y[i] = o.y;
+    }
+}
+
+} // namespace SmoothZoom
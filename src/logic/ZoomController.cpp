@@ -5,112 +5,88 @@
 // Phase 1: Logarithmic scroll model (AC-2.1.06), soft bounds (AC-2.1.15).
 // Phase 2: ANIMATING mode with ease-out (AC-2.2.04–AC-2.2.07).
 // Phase 4: Temporary toggle via engageToggle/releaseToggle (AC-2.7.01–AC-2.7.10).
+// Optional resting-zoom quantization onto the output-pixel grid (ZoomQuantizer.h).
+// Preset jumps: one planned log-space segment per jump (beginAnimation).
 // =============================================================================
 
 #include "smoothzoom/logic/ZoomController.h"
+#include "smoothzoom/logic/ZoomCurve.h"
+#include "smoothzoom/logic/ZoomQuantizer.h"
 #include <algorithm>
 #include <cmath>
 
 namespace SmoothZoom
 {
 
-static constexpr float kWheelDelta = 120.0f;
-
-// Logarithmic zoom factor per notch (AC-2.1.06): newZoom = currentZoom * pow(kScrollZoomBase, normalizedDelta)
-// 1.1 = 10% per notch at any zoom level. 1×→2× requires same scroll effort as 5×→10×.
-static constexpr float kScrollZoomBase = 1.1f;
-
-// Epsilon for snapping to 1.0× and maxZoom (R-17)
-static constexpr float kSnapEpsilon = 0.005f;
-
-// Exponential ease-out reference rate (render-loop.md, AC-2.2.05)
-// Used as: alpha = 1.0 - pow(1.0 - easeOutRate_, dt * kReferenceHz)
-// Speed variants: slow=0.08, normal=0.15, fast=0.25
-static constexpr double kEaseOutRateSlow   = 0.08;
-static constexpr double kEaseOutRateNormal = 0.15;
-static constexpr double kEaseOutRateFast   = 0.25;
-static constexpr double kReferenceHz = 60.0;
-
-// Soft-approach margin as fraction of log-range near bounds (AC-2.1.15)
-static constexpr float kSoftMarginFraction = 0.15f;
+// Curve constants (kScrollZoomBase, kSoftMarginFraction, kSnapEpsilon, ease-out
+// rates) and the per-step math live in ZoomCurve.h, shared with ZoomSimulation.
 
 void ZoomController::applyScrollDelta(int32_t accumulatedDelta)
 {
     if (accumulatedDelta == 0)
         return;
 
+    // Notched wheel with smoothing: step the accumulating target (continuing
+    // from an in-flight glide) and let tick() glide currentZoom toward it.
+    bool glide = wheelSmoothingSec_ > 0.0f && isNotchedDelta(accumulatedDelta);
+    if (glide && mode_ != Mode::Scrolling)
+        targetZoom_ = currentZoom_; // new gesture starts from what's on screen
+
     mode_ = Mode::Scrolling;
+    planDuration_ = 0.0f; // scroll takes over from any planned segment
 
-    // Logarithmic zoom model (AC-2.1.06):
-    // Each 120-unit notch multiplies zoom by kScrollZoomBase.
-    // Sub-notch deltas (Precision Touchpad) scale proportionally.
-    // scrollSensitivity_ scales the effective input so users can tune zoom rate
-    // across devices (A3); 1.0 = default, leaving prior behaviour unchanged.
-    float normalizedDelta =
-        static_cast<float>(accumulatedDelta) / kWheelDelta * scrollSensitivity_;
-
-    // Soft-approach bounds attenuation (AC-2.1.15):
-    // As zoom nears min or max, attenuate the delta to decelerate smoothly.
-    float logMin = std::log(minZoom_);
-    float logMax = std::log(maxZoom_);
-    float logRange = logMax - logMin;
-    float margin = logRange * kSoftMarginFraction;
-    float logCurrent = std::log(currentZoom_);
-
-    if (normalizedDelta > 0.0f && logCurrent > logMax - margin)
-    {
-        // Approaching upper bound — attenuate
-        float t = (logCurrent - (logMax - margin)) / margin;
-        t = std::clamp(t, 0.0f, 1.0f);
-        float attenuation = 1.0f - t * t; // quadratic ease to zero
-        normalizedDelta *= attenuation;
-    }
-    else if (normalizedDelta < 0.0f && logCurrent < logMin + margin)
-    {
-        // Approaching lower bound — attenuate
-        float t = ((logMin + margin) - logCurrent) / margin;
-        t = std::clamp(t, 0.0f, 1.0f);
-        float attenuation = 1.0f - t * t;
-        normalizedDelta *= attenuation;
-    }
+    // Logarithmic model + soft-approach bounds + snap (AC-2.1.06, AC-2.1.15, R-17)
+    float base = glide ? targetZoom_ : currentZoom_;
+    float newZoom = scrollZoomStep(base, accumulatedDelta, minZoom_, maxZoom_,
+                                   scrollSensitivity_, kScrollZoomBase,
+                                   kSoftMarginFraction, kSnapEpsilon);
 
-    float newZoom = currentZoom_ * std::pow(kScrollZoomBase, normalizedDelta);
+    if (!glide)
+        currentZoom_ = newZoom;
+    targetZoom_ = newZoom;
 
-    // Hard clamp to bounds (safety net after soft approach)
-    newZoom = std::clamp(newZoom, minZoom_, maxZoom_);
+    // Phase 4: Update toggle restore target if scrolling during toggle (AC-2.7.09 / E4.5)
+    if (isToggled_)
+        savedZoomForToggle_ = targetZoom_;
 
-    // Snap to 1.0× within epsilon (R-17)
-    if (std::abs(newZoom - 1.0f) < kSnapEpsilon)
-        newZoom = 1.0f;
+    // Track last-used zoom for "toggle from 1.0×" (AC-2.7.04)
+    if (targetZoom_ > 1.0f + kSnapEpsilon)
+        lastUsedZoom_ = targetZoom_;
+}
+
+void ZoomController::applyPinchLogZoom(float logZoomDelta)
+{
+    if (logZoomDelta == 0.0f)
+        return;
 
-    // Snap to max within epsilon
-    if (std::abs(newZoom - maxZoom_) < kSnapEpsilon)
-        newZoom = maxZoom_;
+    mode_ = Mode::Scrolling;
+    planDuration_ = 0.0f;
 
-    currentZoom_ = newZoom;
-    targetZoom_ = newZoom;
+    // Direct: the pinch already is a zoom ratio. Takes over from any glide.
+    currentZoom_ = clampSnapZoom(currentZoom_ * std::exp(logZoomDelta),
+                                 minZoom_, maxZoom_, kSnapEpsilon);
+    targetZoom_ = currentZoom_;
 
-    // Phase 4: Update toggle restore target if scrolling during toggle (AC-2.7.09 / E4.5)
     if (isToggled_)
-        savedZoomForToggle_ = currentZoom_;
+        savedZoomForToggle_ = targetZoom_;
+    if (targetZoom_ > 1.0f + kSnapEpsilon)
+        lastUsedZoom_ = targetZoom_;
+}
 
-    // Track last-used zoom for "toggle from 1.0×" (AC-2.7.04)
-    if (currentZoom_ > 1.0f + kSnapEpsilon)
-        lastUsedZoom_ = currentZoom_;
+void ZoomController::setWheelSmoothing(bool enabled, float latencySec)
+{
+    wheelSmoothingSec_ = enabled
+        ? std::clamp(latencySec, kWheelSmoothingMinSec, kWheelSmoothingMaxSec)
+        : 0.0f;
 }
 
 void ZoomController::applyKeyboardStep(int direction)
 {
     // Phase 2: Multiplicative step for logarithmic consistency (AC-2.1.06, AC-2.2.06, AC-2.8.07)
     // direction=+1 → target *= (1 + step), direction=-1 → target /= (1 + step)
-    float newTarget = targetZoom_ * std::pow(1.0f + keyboardStep_, static_cast<float>(direction));
-    newTarget = std::clamp(newTarget, minZoom_, maxZoom_);
-
-    // Snap within epsilon of 1.0 and max (R-17)
-    if (std::abs(newTarget - 1.0f) < kSnapEpsilon)
-        newTarget = 1.0f;
-    if (std::abs(newTarget - maxZoom_) < kSnapEpsilon)
-        newTarget = maxZoom_;
+    // Clamped and snapped within epsilon of 1.0 and max (R-17).
+    float newTarget = keyboardStepTarget(targetZoom_, direction, keyboardStep_,
+                                         minZoom_, maxZoom_, kSnapEpsilon);
 
     // No-effect check at bounds (AC-2.8.05): if step produces no change, don't animate
     if (std::abs(newTarget - targetZoom_) < kSnapEpsilon)
@@ -118,6 +94,7 @@ void ZoomController::applyKeyboardStep(int direction)
 
     targetZoom_ = newTarget;
     mode_ = Mode::Animating;
+    planDuration_ = 0.0f; // re-targeting continues as exponential ease from here
 
     // Phase 4: Update toggle restore target if keyboard step during toggle (AC-2.7.09)
     if (isToggled_)
@@ -130,23 +107,82 @@ void ZoomController::applyKeyboardStep(int direction)
 
 void ZoomController::animateToZoom(float target)
 {
-    target = std::clamp(target, minZoom_, maxZoom_);
+    beginAnimation(target, 0.0f);
+}
 
-    // Snap within epsilon (R-17)
-    if (std::abs(target - 1.0f) < kSnapEpsilon)
-        target = 1.0f;
-    if (std::abs(target - maxZoom_) < kSnapEpsilon)
-        target = maxZoom_;
+void ZoomController::beginAnimation(float target, float durationSec)
+{
+    // Clamp + snap within epsilon (R-17)
+    target = clampSnapZoom(target, minZoom_, maxZoom_, kSnapEpsilon);
 
-    // No-effect: already at target (AC-2.8.09)
+    // No-effect: already at target (AC-2.8.09). Also makes a repeated preset
+    // command (key auto-repeat) a no-op instead of restarting the plan.
     if (std::abs(currentZoom_ - target) < kSnapEpsilon &&
         std::abs(targetZoom_ - target) < kSnapEpsilon)
     {
         return;
     }
+    if (durationSec > 0.0f && mode_ == Mode::Animating && planDuration_ > 0.0f &&
+        std::abs(targetZoom_ - target) < kSnapEpsilon)
+    {
+        return;
+    }
 
     targetZoom_ = target;
     mode_ = Mode::Animating;
+    planFromZoom_ = currentZoom_;
+    planElapsed_ = 0.0f;
+    planDuration_ = (durationSec > 0.0f) ? durationSec : 0.0f;
+}
+
+void ZoomController::setZoomPresets(const float* presets, int count)
+{
+    if (!presets || count <= 0)
+        return;
+    presetCount_ = std::min(count, kMaxPresets);
+    for (int i = 0; i < presetCount_; ++i)
+        presets_[i] = presets[i];
+}
+
+void ZoomController::jumpToPreset(int index)
+{
+    if (index < 0 || index >= presetCount_)
+        return;
+
+    float target = clampSnapZoom(presets_[index], minZoom_, maxZoom_, kSnapEpsilon);
+    beginAnimation(target, planDurationSec(currentZoom_, target, animationSpeed_));
+
+    // A preset is an explicit level choice — same bookkeeping as a keyboard step.
+    if (isToggled_)
+        savedZoomForToggle_ = targetZoom_;
+    if (targetZoom_ > 1.0f + kSnapEpsilon)
+        lastUsedZoom_ = targetZoom_;
+}
+
+void ZoomController::cyclePreset()
+{
+    if (presetCount_ <= 0)
+        return;
+
+    // On a preset (within snap epsilon of the target) → next entry in table order.
+    for (int i = 0; i < presetCount_; ++i)
+    {
+        if (std::abs(clampSnapZoom(presets_[i], minZoom_, maxZoom_, kSnapEpsilon) - targetZoom_)
+            < kSnapEpsilon)
+        {
+            jumpToPreset((i + 1) % presetCount_);
+            return;
+        }
+    }
+
+    // Between presets → smallest preset above the current target, else the first.
+    int best = -1;
+    for (int i = 0; i < presetCount_; ++i)
+    {
+        if (presets_[i] > targetZoom_ && (best < 0 || presets_[i] < presets_[best]))
+            best = i;
+    }
+    jumpToPreset(best >= 0 ? best : 0);
 }
 
 void ZoomController::trayToggle()
@@ -200,6 +236,17 @@ bool ZoomController::tick(float dtSeconds)
     if (mode_ == Mode::Idle)
         return false;
 
+    if (mode_ == Mode::Scrolling && currentZoom_ != targetZoom_)
+    {
+        // Notched-wheel glide toward the accumulated scroll target (log space,
+        // frame-rate independent: alpha = 1 − exp(−dt/τ)).
+        double alpha = wheelGlideAlpha(wheelSmoothingSec_ > 0.0f ? wheelSmoothingSec_
+                                                                  : kWheelSmoothingDefaultSec,
+                                       static_cast<double>(dtSeconds));
+        currentZoom_ = wheelGlideStep(currentZoom_, targetZoom_, alpha, kSnapEpsilon);
+        return true;
+    }
+
     if (mode_ == Mode::Scrolling)
     {
         // Scroll-direct: no interpolation needed. The value was set directly in
@@ -211,17 +258,29 @@ bool ZoomController::tick(float dtSeconds)
         return true;
     }
 
+    if (mode_ == Mode::Animating && planDuration_ > 0.0f)
+    {
+        // Planned segment (preset jump): log-space cubic ease-out over a fixed
+        // duration — time-based, so frame-rate independent by construction.
+        planElapsed_ += (dtSeconds > 0.0f) ? dtSeconds : 0.0f;
+        float t = planElapsed_ / planDuration_;
+        if (t >= 1.0f)
+        {
+            currentZoom_ = targetZoom_;
+            planDuration_ = 0.0f;
+            mode_ = Mode::Idle;
+            return true;
+        }
+        currentZoom_ = planZoomAt(planFromZoom_, targetZoom_, t);
+        return true;
+    }
+
     if (mode_ == Mode::Animating)
     {
         // Exponential ease-out (render-loop.md, AC-2.2.05):
         // Frame-rate-independent: at 60fps alpha≈0.15, at 144fps alpha≈0.065.
-        double dt = static_cast<double>(dtSeconds);
-        if (dt <= 0.0)
-            dt = 1.0 / kReferenceHz; // Fallback if dt is zero or negative
-        if (dt > 0.1)
-            dt = 0.1; // Clamp to avoid huge jumps (debugger break, system sleep)
-
-        double alpha = 1.0 - std::pow(1.0 - easeOutRate_, dt * kReferenceHz);
+        // dt fallback/clamp (zero dt, debugger break, system sleep) lives in easeOutAlpha.
+        double alpha = easeOutAlpha(easeOutRate_, static_cast<double>(dtSeconds));
 
         double current = static_cast<double>(currentZoom_);
         double target = static_cast<double>(targetZoom_);
@@ -256,12 +315,8 @@ void ZoomController::applySettings(float minZoom, float maxZoom,
     scrollSensitivity_ = (scrollSensitivity > 0.0f) ? scrollSensitivity : 1.0f;
 
     // Wire animation speed: 0=slow, 1=normal, 2=fast
-    switch (animationSpeed)
-    {
-    case 0:  easeOutRate_ = kEaseOutRateSlow;   break;
-    case 2:  easeOutRate_ = kEaseOutRateFast;   break;
-    default: easeOutRate_ = kEaseOutRateNormal; break;
-    }
+    easeOutRate_ = easeOutRateForSpeed(animationSpeed);
+    animationSpeed_ = animationSpeed;
 
     // AC-2.9.05: zoomed above new max → animate down
     if (currentZoom_ > maxZoom_)
@@ -273,13 +328,69 @@ void ZoomController::applySettings(float minZoom, float maxZoom,
 
     // Clamp pending target to new bounds
     targetZoom_ = std::clamp(targetZoom_, minZoom_, maxZoom_);
+
+    // New bounds may move the quantization grid target
+    quantizeTarget_ = 0.0f;
+    quantized_ = false;
+}
+
+void ZoomController::setQuantization(bool enabled, float integerTolerance)
+{
+    quantizeEnabled_ = enabled;
+    quantizeIntegerTolerance_ = (integerTolerance >= 0.0f) ? integerTolerance : 0.0f;
+    quantizeTarget_ = 0.0f; // re-evaluate against the new tolerance
+    quantized_ = false;
+}
+
+bool ZoomController::tickQuantize(float dtSeconds, int32_t extentPx)
+{
+    // Only a settled controller is quantized — never fight a scroll gesture or
+    // an ease-out in progress. Any input restarts the settle delay.
+    if (!quantizeEnabled_ || mode_ != Mode::Idle || extentPx <= 0)
+    {
+        quantizeIdleSec_ = 0.0f;
+        quantizeTarget_ = 0.0f;
+        quantized_ = false;
+        return false;
+    }
+
+    if (quantizeTarget_ == 0.0f || extentPx != quantizeExtentPx_)
+    {
+        // A monitor change re-targets immediately; otherwise wait out the delay.
+        if (quantizeTarget_ == 0.0f)
+        {
+            quantizeIdleSec_ += (dtSeconds > 0.0f) ? dtSeconds : 0.0f;
+            if (quantizeIdleSec_ < kQuantizeSettleDelaySec)
+                return false;
+            // Glide only for the part of this frame past the delay, so the
+            // glide starts at the same wall time whatever the frame rate.
+            dtSeconds = quantizeIdleSec_ - kQuantizeSettleDelaySec;
+        }
+        quantizeTarget_ = quantizeZoom(currentZoom_, extentPx, quantizeIntegerTolerance_,
+                                       minZoom_, maxZoom_);
+        quantizeExtentPx_ = extentPx;
+        quantized_ = false;
+    }
+
+    if (currentZoom_ == quantizeTarget_)
+    {
+        quantized_ = true;
+        return false;
+    }
+
+    // Sub-pixel glide onto the grid (kQuantizeMaxStepPx per 60 Hz frame).
+    currentZoom_ = quantizeStepToward(currentZoom_, quantizeTarget_, extentPx,
+                                      quantizeStepBudgetPx(dtSeconds));
+    targetZoom_ = currentZoom_;
+    quantized_ = (currentZoom_ == quantizeTarget_);
+    return true;
 }
 
 void ZoomController::endScroll()
 {
     // Only ends a scroll gesture. Never interrupts an in-progress animation
     // (Animating) or disturbs an already-Idle controller.
-    if (mode_ == Mode::Scrolling)
+    if (mode_ == Mode::Scrolling && currentZoom_ == targetZoom_)
         mode_ = Mode::Idle;
 }
 
@@ -288,6 +399,10 @@ void ZoomController::reset()
     currentZoom_ = 1.0f;
     targetZoom_ = 1.0f;
     mode_ = Mode::Idle;
+    planDuration_ = 0.0f;
+    quantizeIdleSec_ = 0.0f;
+    quantizeTarget_ = 0.0f;
+    quantized_ = false;
 }
 
 } // namespace SmoothZoom
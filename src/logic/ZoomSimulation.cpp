@@ -0,0 +1,275 @@
+// =============================================================================
+// SmoothZoom — ZoomSimulation
+// Offline batch simulation of the zoom curve for tuning. Doc 3 §3.5
+//
+// Each lane is one ZoomController-equivalent state machine. Rare events
+// (keyboard steps, toggles) are applied per lane with ordinary branches; the
+// per-frame work every lane does (scroll step, ease-out tick, endScroll) is
+// written as select-style loops over contiguous arrays so the compiler can
+// vectorize them. Semantics must stay in lock-step with ZoomController.cpp —
+// test_ZoomSimulation.cpp checks a lane against a live controller.
+// =============================================================================
+
+#include "smoothzoom/logic/ZoomSimulation.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace SmoothZoom
+{
+
+namespace
+{
+
+// Mirrors ZoomController::Mode (stored as bytes for dense lane arrays).
+enum : uint8_t
+{
+    kLaneIdle      = 0,
+    kLaneScrolling = 1,
+    kLaneAnimating = 2,
+};
+
+// Structure-of-arrays lane state. Field meanings match ZoomController members.
+struct Lanes
+{
+    std::vector<float>   current;
+    std::vector<float>   target;
+    std::vector<uint8_t> mode;
+    std::vector<uint8_t> toggled;
+    std::vector<float>   savedForToggle;
+    std::vector<float>   lastUsed;
+
+    // Per-lane constants, copied out of ZoomSimParams for contiguous access.
+    std::vector<float>   minZoom;
+    std::vector<float>   maxZoom;
+    std::vector<float>   snapEps;
+    std::vector<double>  easeRate;
+    std::vector<float>   glideSec;   // ZoomController::wheelSmoothingSec_
+
+    explicit Lanes(size_t n)
+        : current(n, 1.0f), target(n, 1.0f), mode(n, kLaneIdle), toggled(n, 0),
+          savedForToggle(n, 1.0f), lastUsed(n, 2.0f),
+          minZoom(n), maxZoom(n), snapEps(n), easeRate(n), glideSec(n)
+    {
+    }
+
+    // ZoomController::animateToZoom
+    void animateTo(size_t i, float t)
+    {
+        t = clampSnapZoom(t, minZoom[i], maxZoom[i], snapEps[i]);
+        if (std::abs(current[i] - t) < snapEps[i] && std::abs(target[i] - t) < snapEps[i])
+            return;
+        target[i] = t;
+        mode[i] = kLaneAnimating;
+    }
+
+    // ZoomController::applyKeyboardStep
+    void keyboardStep(size_t i, int direction, const ZoomCurveParams& p)
+    {
+        float newTarget = keyboardStepTarget(target[i], direction, p.keyboardStep,
+                                             minZoom[i], maxZoom[i], snapEps[i]);
+        if (std::abs(newTarget - target[i]) < snapEps[i])
+            return;
+        target[i] = newTarget;
+        mode[i] = kLaneAnimating;
+        if (toggled[i])
+            savedForToggle[i] = target[i];
+        if (target[i] > 1.0f + snapEps[i])
+            lastUsed[i] = target[i];
+    }
+
+    // ZoomController::trayToggle / engageToggle share the "at 1.0× ?" switch.
+    void toggleSwitch(size_t i)
+    {
+        if (std::abs(current[i] - 1.0f) < snapEps[i])
+        {
+            animateTo(i, lastUsed[i]);
+        }
+        else
+        {
+            lastUsed[i] = current[i];
+            animateTo(i, 1.0f);
+        }
+    }
+
+    void engageToggle(size_t i)
+    {
+        if (toggled[i])
+            return;
+        savedForToggle[i] = current[i];
+        toggled[i] = 1;
+        toggleSwitch(i);
+    }
+
+    void releaseToggle(size_t i)
+    {
+        if (!toggled[i])
+            return;
+        toggled[i] = 0;
+        animateTo(i, savedForToggle[i]);
+    }
+};
+
+} // namespace
+
+void simulateZoomBatch(const ZoomSimEvent* events, size_t eventCount,
+                       const ZoomSimParams* params, size_t paramCount,
+                       float* trajectory)
+{
+    if (paramCount == 0 || eventCount == 0)
+        return;
+
+    Lanes lanes(paramCount);
+
+    // Initial applySettings() on a fresh controller at 1.0×.
+    for (size_t i = 0; i < paramCount; ++i)
+    {
+        const ZoomCurveParams& p = params[i].curve;
+        lanes.minZoom[i] = p.minZoom;
+        lanes.maxZoom[i] = p.maxZoom;
+        lanes.snapEps[i] = p.snapEpsilon;
+        lanes.easeRate[i] = p.easeOutRate;
+        lanes.glideSec[i] = (p.wheelSmoothingSec > 0.0f)
+            ? std::clamp(p.wheelSmoothingSec, kWheelSmoothingMinSec, kWheelSmoothingMaxSec)
+            : 0.0f;
+        lanes.lastUsed[i] = params[i].defaultZoomLevel;
+        if (lanes.current[i] > p.maxZoom)
+            lanes.animateTo(i, p.maxZoom);
+        if (lanes.current[i] < p.minZoom)
+            lanes.animateTo(i, p.minZoom);
+        lanes.target[i] = std::clamp(lanes.target[i], p.minZoom, p.maxZoom);
+    }
+
+    float* cur = lanes.current.data();
+    float* tgt = lanes.target.data();
+    uint8_t* mode = lanes.mode.data();
+    const float* eps = lanes.snapEps.data();
+    const double* rate = lanes.easeRate.data();
+    const float* glideSec = lanes.glideSec.data();
+
+    float prevTime = 0.0f;
+    for (size_t f = 0; f < eventCount; ++f)
+    {
+        const ZoomSimEvent& ev = events[f];
+
+        // Frame dt exactly as RenderLoop computes it: clamped to [0, 100 ms].
+        float dt = ev.timeSec - prevTime;
+        prevTime = ev.timeSec;
+        dt = std::clamp(dt, 0.0f, 0.1f);
+
+        // Commands (RenderLoop step 2) — rare, scalar per lane.
+        if (ev.keyStep != 0 || ev.commands != kZoomSimNone)
+        {
+            for (size_t i = 0; i < paramCount; ++i)
+            {
+                if (ev.keyStep != 0)
+                    lanes.keyboardStep(i, ev.keyStep > 0 ? +1 : -1, params[i].curve);
+                if (ev.commands & kZoomSimReset)
+                    lanes.animateTo(i, 1.0f);
+                if (ev.commands & kZoomSimToggleEngage)
+                    lanes.engageToggle(i);
+                if (ev.commands & kZoomSimToggleRelease)
+                    lanes.releaseToggle(i);
+                if (ev.commands & kZoomSimTrayToggle)
+                    lanes.toggleSwitch(i);
+            }
+        }
+
+        // Scroll (step 3): direct, or a notch glide target when the lane
+        // smooths notched wheels (ZoomController::applyScrollDelta).
+        if (ev.scrollDelta != 0)
+        {
+            const bool notched = isNotchedDelta(ev.scrollDelta);
+            for (size_t i = 0; i < paramCount; ++i)
+            {
+                const ZoomCurveParams& p = params[i].curve;
+                bool glide = notched && glideSec[i] > 0.0f;
+                if (glide && mode[i] != kLaneScrolling)
+                    tgt[i] = cur[i];
+                float z = scrollZoomStep(glide ? tgt[i] : cur[i], ev.scrollDelta,
+                                         p.minZoom, p.maxZoom,
+                                         p.scrollSensitivity, p.scrollZoomBase,
+                                         p.softMarginFraction, p.snapEpsilon);
+                cur[i] = glide ? cur[i] : z;
+                tgt[i] = z;
+                mode[i] = kLaneScrolling;
+                if (lanes.toggled[i])
+                    lanes.savedForToggle[i] = z;
+                if (z > 1.0f + eps[i])
+                    lanes.lastUsed[i] = z;
+            }
+        }
+
+        // Ease-out tick (step 4) — the per-frame hot loop, select form.
+        for (size_t i = 0; i < paramCount; ++i)
+        {
+            double alpha = easeOutAlpha(rate[i], static_cast<double>(dt));
+            double c = static_cast<double>(cur[i]);
+            double t = static_cast<double>(tgt[i]);
+            double next = c + (t - c) * alpha;
+            bool animating = mode[i] == kLaneAnimating;
+            bool snap = std::abs(next - t) < static_cast<double>(eps[i]);
+            float stepped = snap ? tgt[i] : static_cast<float>(next);
+            cur[i] = animating ? stepped : cur[i];
+            mode[i] = (animating && snap) ? static_cast<uint8_t>(kLaneIdle) : mode[i];
+        }
+
+        // Notch glide (Scrolling lanes behind their target) — rare, scalar.
+        for (size_t i = 0; i < paramCount; ++i)
+        {
+            if (mode[i] == kLaneScrolling && cur[i] != tgt[i])
+            {
+                double budget = glideSec[i] > 0.0f ? glideSec[i] : kWheelSmoothingDefaultSec;
+                cur[i] = wheelGlideStep(cur[i], tgt[i],
+                                        wheelGlideAlpha(budget, static_cast<double>(dt)), eps[i]);
+            }
+        }
+
+        // endScroll() on a frame with no scroll input (waits for a glide).
+        if (ev.scrollDelta == 0)
+        {
+            for (size_t i = 0; i < paramCount; ++i)
+                mode[i] = (mode[i] == kLaneScrolling && cur[i] == tgt[i])
+                    ? static_cast<uint8_t>(kLaneIdle) : mode[i];
+        }
+
+        std::copy(cur, cur + paramCount, trajectory + f * paramCount);
+    }
+}
+
+ZoomSimMetrics summarizeZoomTrajectory(const ZoomSimEvent* events, size_t eventCount,
+                                       const float* trajectory, size_t paramCount,
+                                       size_t lane)
+{
+    ZoomSimMetrics m;
+    if (eventCount == 0 || lane >= paramCount)
+        return m;
+
+    // Last frame that carried any input.
+    size_t lastInput = 0;
+    for (size_t f = 0; f < eventCount; ++f)
+    {
+        const ZoomSimEvent& ev = events[f];
+        if (ev.scrollDelta != 0 || ev.keyStep != 0 || ev.commands != kZoomSimNone)
+            lastInput = f;
+    }
+
+    float prev = 1.0f;
+    size_t lastMove = lastInput;
+    for (size_t f = 0; f < eventCount; ++f)
+    {
+        float z = trajectory[f * paramCount + lane];
+        m.peakZoom = std::max(m.peakZoom, z);
+        float logStep = std::abs(std::log(z) - std::log(prev));
+        m.maxFrameLogStep = std::max(m.maxFrameLogStep, logStep);
+        if (f > lastInput && z != prev)
+            lastMove = f;
+        prev = z;
+    }
+
+    m.finalZoom = prev;
+    m.settleTimeSec = events[lastMove].timeSec - events[lastInput].timeSec;
+    return m;
+}
+
+} // namespace SmoothZoom
@@ -13,6 +13,7 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstdio>
 #include <cstdlib>
 #include <filesystem>
 #include <fstream>
@@ -46,6 +47,46 @@ std::string SettingsManager::getDefaultConfigPath()
 #endif
 }
 
+// ─── Device IDs ──────────────────────────────────────────────────────────────
+
+// USB/Bluetooth vendor or product ID: an integer 0–0xFFFF or a hex string
+// ("0x06CB" or "06CB", case-insensitive). Anything else is rejected.
+static bool readDeviceId(const json& v, uint16_t& out)
+{
+    if (v.is_number_integer())
+    {
+        const auto n = v.get<long long>();
+        if (n < 0 || n > 0xFFFF)
+            return false;
+        out = static_cast<uint16_t>(n);
+        return true;
+    }
+    if (!v.is_string())
+        return false;
+    std::string s = v.get<std::string>();
+    if (s.size() > 2 && s[0] == '0' && (s[1] == 'x' || s[1] == 'X'))
+        s.erase(0, 2);
+    if (s.empty() || s.size() > 4)
+        return false;
+    unsigned n = 0;
+    for (char c : s)
+    {
+        if (!std::isxdigit(static_cast<unsigned char>(c)))
+            return false;
+        const int lc = std::tolower(static_cast<unsigned char>(c));
+        n = n * 16 + static_cast<unsigned>(lc <= '9' ? lc - '0' : lc - 'a' + 10);
+    }
+    out = static_cast<uint16_t>(n);
+    return true;
+}
+
+static std::string formatDeviceId(uint16_t id)
+{
+    char buf[8];
+    std::snprintf(buf, sizeof(buf), "0x%04X", static_cast<unsigned>(id));
+    return buf;
+}
+
 // ─── Load ────────────────────────────────────────────────────────────────────
 
 bool SettingsManager::loadFromFile(const char* path)
@@ -98,6 +139,10 @@ bool SettingsManager::loadFromFile(const char* path)
     readInt("animationSpeed", settings.animationSpeed, 0, 2);
     readInt("toggleKey1VK", settings.toggleKey1VK, 0, 0xFF);
     readInt("toggleKey2VK", settings.toggleKey2VK, 0, 0xFF);
+    readInt("wheelSmoothingLatencyMs", settings.wheelSmoothingLatencyMs, 8, 50);
+    readInt("edgePushMarginPct", settings.edgePushMarginPct, 0, 40);
+    readInt("edgePushSpeedPx", settings.edgePushSpeedPx, 200, 20000);
+    readInt("centeredFollowMs", settings.centeredFollowMs, 0, 500);
 
     // ── Float fields ──
     auto readFloat = [&](const char* key, float& target, float lo, float hi) {
@@ -113,6 +158,7 @@ bool SettingsManager::loadFromFile(const char* path)
     readFloat("maxZoom", settings.maxZoom, 1.0f, 10.0f);
     readFloat("keyboardZoomStep", settings.keyboardZoomStep, 0.05f, 1.0f); // AC-2.9.12: 5%–100%
     readFloat("scrollSensitivity", settings.scrollSensitivity, 0.1f, 5.0f); // A3: scroll-gesture rate
+    readFloat("quantizeIntegerTolerance", settings.quantizeIntegerTolerance, 0.0f, 0.5f);
 
     // ── Cross-validation: min must be <= max (AC-2.9.10) ──
     if (settings.minZoom > settings.maxZoom)
@@ -124,6 +170,124 @@ bool SettingsManager::loadFromFile(const char* path)
     // defaultZoomLevel must be within [minZoom, maxZoom]
     readFloat("defaultZoomLevel", settings.defaultZoomLevel, settings.minZoom, settings.maxZoom);
 
+    // ── Zoom presets: array of 1–kMaxZoomPresets levels in [1.0, 10.0] ──
+    // Invalid entries are skipped; an array with no valid entry keeps defaults.
+    if (j.contains("zoomPresets") && j["zoomPresets"].is_array())
+    {
+        std::array<float, kMaxZoomPresets> presets{};
+        int count = 0;
+        for (const auto& v : j["zoomPresets"])
+        {
+            if (count >= kMaxZoomPresets)
+                break;
+            if (!v.is_number())
+                continue;
+            float z = v.get<float>();
+            if (z >= 1.0f && z <= 10.0f)
+                presets[count++] = z;
+        }
+        if (count > 0)
+        {
+            settings.zoomPresets = presets;
+            settings.zoomPresetCount = count;
+        }
+    }
+
+    // ── Hook slow-callback thresholds: array of 1–4 ms values in [1, 1000] ──
+    // Invalid and repeated entries are skipped; none valid keeps defaults.
+    if (j.contains("hookSlowThresholdsMs") && j["hookSlowThresholdsMs"].is_array())
+    {
+        std::array<int, kMaxHookSlowThresholds> thresholds{};
+        int count = 0;
+        for (const auto& v : j["hookSlowThresholdsMs"])
+        {
+            if (count >= kMaxHookSlowThresholds)
+                break;
+            if (!v.is_number_integer())
+                continue;
+            const int ms = v.get<int>();
+            if (ms >= 1 && ms <= 1000
+                && std::find(thresholds.begin(), thresholds.begin() + count, ms) == thresholds.begin() + count)
+                thresholds[count++] = ms;
+        }
+        if (count > 0)
+        {
+            std::sort(thresholds.begin(), thresholds.begin() + count);
+            settings.hookSlowThresholdsMs = thresholds;
+            settings.hookSlowThresholdCount = count;
+        }
+    }
+
+    // ── Keyboard shortcuts: command name → array of chord strings ──
+    // Unknown commands and unparseable chords are skipped; a listed command's
+    // chords replace its defaults. Past kMaxKeyBindings, later chords drop.
+    if (j.contains("keyBindings") && j["keyBindings"].is_object())
+    {
+        const json& kb = j["keyBindings"];
+        std::array<KeyBinding, kMaxKeyBindings> bindings{};
+        int count = 0;
+        for (int i = 0; i < kDefaultKeyBindingCount; ++i)
+        {
+            const KeyCommandInfo* info = keyCommandInfo(kDefaultKeyBindings[i].command);
+            if (!kb.contains(info->name) || !kb[info->name].is_array())
+                bindings[count++] = kDefaultKeyBindings[i];
+        }
+        for (const KeyCommandInfo& info : kKeyCommands)
+        {
+            if (!kb.contains(info.name) || !kb[info.name].is_array())
+                continue;
+            for (const auto& chord : kb[info.name])
+            {
+                KeyBinding b;
+                b.command = info.command;
+                if (count < kMaxKeyBindings && chord.is_string()
+                    && parseKeyChord(chord.get<std::string>(), b))
+                    bindings[count++] = b;
+            }
+        }
+        settings.keyBindings = bindings;
+        settings.keyBindingCount = count;
+    }
+
+    // ── Per-device touchpad profiles ──
+    // Entries need a vendorId and productId (not both 0); out-of-range tuning
+    // values keep their defaults, and a repeated VID:PID is skipped.
+    if (j.contains("ptpDeviceProfiles") && j["ptpDeviceProfiles"].is_array())
+    {
+        for (const auto& e : j["ptpDeviceProfiles"])
+        {
+            if (settings.ptpDeviceProfileCount >= kMaxPtpDeviceProfiles)
+                break;
+            PtpDeviceProfile prof;
+            if (!e.is_object() || !e.contains("vendorId") || !e.contains("productId")
+                || !readDeviceId(e["vendorId"], prof.vendorId)
+                || !readDeviceId(e["productId"], prof.productId)
+                || (prof.vendorId == 0 && prof.productId == 0))
+                continue;
+            const auto begin = settings.ptpDeviceProfiles.begin();
+            const auto end = begin + settings.ptpDeviceProfileCount;
+            if (std::any_of(begin, end, [&](const PtpDeviceProfile& p) {
+                    return p.vendorId == prof.vendorId && p.productId == prof.productId;
+                }))
+                continue;
+            if (e.contains("axisScale") && e["axisScale"].is_number())
+            {
+                const float v = e["axisScale"].get<float>();
+                if (v >= 0.25f && v <= 4.0f)
+                    prof.axisScale = v;
+            }
+            if (e.contains("sensitivity") && e["sensitivity"].is_number())
+            {
+                const float v = e["sensitivity"].get<float>();
+                if (v >= 0.1f && v <= 5.0f)
+                    prof.sensitivity = v;
+            }
+            if (e.contains("invertNaturalScroll") && e["invertNaturalScroll"].is_boolean())
+                prof.invertNaturalScroll = e["invertNaturalScroll"].get<bool>();
+            settings.ptpDeviceProfiles[settings.ptpDeviceProfileCount++] = prof;
+        }
+    }
+
     // ── Boolean fields ──
     auto readBool = [&](const char* key, bool& target) {
         if (j.contains(key) && j[key].is_boolean())
@@ -138,6 +302,55 @@ bool SettingsManager::loadFromFile(const char* path)
     readBool("colorInversionEnabled", settings.colorInversionEnabled);
     readBool("reverseScrollDirection", settings.reverseScrollDirection);
     readBool("momentumZoom", settings.momentumZoom);
+    readBool("zoomQuantization", settings.zoomQuantization);
+    readBool("smoothWheelZoom", settings.smoothWheelZoom);
+    readBool("pointerDamping", settings.pointerDamping);
+    readBool("pointerSampleStream", settings.pointerSampleStream);
+
+    // ── Pointer tracking mode ──
+    // "continuous" / "edge" / "centered" (case-insensitive) or the PointerTrackingMode
+    // integer. Absent or invalid keeps Continuous.
+    if (j.contains("pointerTracking"))
+    {
+        const auto& pt = j["pointerTracking"];
+        if (pt.is_string())
+        {
+            std::string s = pt.get<std::string>();
+            for (auto& c : s)
+                c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+            if      (s == "continuous") settings.pointerTrackingMode = 0;
+            else if (s == "edge")       settings.pointerTrackingMode = 1;
+            else if (s == "centered")   settings.pointerTrackingMode = 2;
+        }
+        else if (pt.is_number_integer())
+        {
+            int v = pt.get<int>();
+            if (v >= 0 && v <= 2)
+                settings.pointerTrackingMode = v;
+        }
+    }
+
+    // ── Zoom scope ──
+    // "unified" / "active" (case-insensitive) or the ZoomScope integer. Absent
+    // or invalid keeps Unified.
+    if (j.contains("zoomScope"))
+    {
+        const auto& zs = j["zoomScope"];
+        if (zs.is_string())
+        {
+            std::string s = zs.get<std::string>();
+            for (auto& c : s)
+                c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+            if      (s == "unified") settings.zoomScope = 0;
+            else if (s == "active")  settings.zoomScope = 1;
+        }
+        else if (zs.is_number_integer())
+        {
+            int v = zs.get<int>();
+            if (v >= 0 && v <= 1)
+                settings.zoomScope = v;
+        }
+    }
 
     // ── Log level (diagnostics) ──
     // Stored as a human-friendly string ("debug"/"info"/"warn"/"error",
@@ -202,6 +415,45 @@ bool SettingsManager::saveToFile(const char* path) const
     j["reverseScrollDirection"] = snap->reverseScrollDirection;
     j["scrollSensitivity"]     = snap->scrollSensitivity;
     j["momentumZoom"]          = snap->momentumZoom;
+    j["smoothWheelZoom"]       = snap->smoothWheelZoom;
+    j["wheelSmoothingLatencyMs"] = snap->wheelSmoothingLatencyMs;
+    j["zoomPresets"] = json::array();
+    for (int i = 0; i < snap->zoomPresetCount && i < kMaxZoomPresets; ++i)
+        j["zoomPresets"].push_back(snap->zoomPresets[i]);
+    j["hookSlowThresholdsMs"] = json::array();
+    for (int i = 0; i < snap->hookSlowThresholdCount && i < kMaxHookSlowThresholds; ++i)
+        j["hookSlowThresholdsMs"].push_back(snap->hookSlowThresholdsMs[i]);
+    j["keyBindings"] = json::object();
+    for (const KeyCommandInfo& info : kKeyCommands)
+    {
+        json chords = json::array();
+        for (int i = 0; i < snap->keyBindingCount && i < kMaxKeyBindings; ++i)
+            if (snap->keyBindings[i].command == info.command)
+                chords.push_back(formatKeyChord(snap->keyBindings[i]));
+        j["keyBindings"][info.name] = chords;
+    }
+    j["ptpDeviceProfiles"] = json::array();
+    for (int i = 0; i < snap->ptpDeviceProfileCount && i < kMaxPtpDeviceProfiles; ++i)
+    {
+        const PtpDeviceProfile& prof = snap->ptpDeviceProfiles[i];
+        j["ptpDeviceProfiles"].push_back({
+            {"vendorId", formatDeviceId(prof.vendorId)},
+            {"productId", formatDeviceId(prof.productId)},
+            {"axisScale", prof.axisScale},
+            {"sensitivity", prof.sensitivity},
+            {"invertNaturalScroll", prof.invertNaturalScroll},
+        });
+    }
+    j["zoomQuantization"]      = snap->zoomQuantization;
+    j["quantizeIntegerTolerance"] = snap->quantizeIntegerTolerance;
+    j["pointerTracking"]       = (snap->pointerTrackingMode == 1) ? "edge" :
+                                 (snap->pointerTrackingMode == 2) ? "centered" : "continuous";
+    j["edgePushMarginPct"]     = snap->edgePushMarginPct;
+    j["edgePushSpeedPx"]       = snap->edgePushSpeedPx;
+    j["centeredFollowMs"]      = snap->centeredFollowMs;
+    j["pointerDamping"]        = snap->pointerDamping;
+    j["pointerSampleStream"]   = snap->pointerSampleStream;
+    j["zoomScope"]             = (snap->zoomScope == 1) ? "active" : "unified";
     // logLevel written as a human-readable string (mirrors the load mapping).
     j["logLevel"]              = (snap->logLevel == 0) ? "debug" :
                                  (snap->logLevel == 2) ? "warn"  :
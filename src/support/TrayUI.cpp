@@ -820,7 +820,7 @@ void TrayUI::requestGracefulExit()
     }
 
     // Animate to 1.0× then exit
-    state_->commandQueue.push(ZoomCommand::ResetZoom);
+    state_->uiCommandQueue.push(ZoomCommand::ResetZoom);
     exitPending_ = true;
     exitStartTick_ = GetTickCount();
 
@@ -0,0 +1,182 @@
+// =============================================================================
+// SmoothZoom — Pointer Tracking Sim (offline developer tool)
+// Replays synthetic pointer traces through each tracking mode and prints one
+// CSV row per (trace, zoom, mode, parameters): setTransform calls per second,
+// on-screen viewport travel, the largest single-frame pan and how far the
+// pointer sits from the screen center on average. Doc 3 §3.6
+//
+// Usage:
+//   PointerTrackingSim [--trace precision|reading|sweep|mouse800|mouse1600|mouse3200|all]
+//                      [--hz 144]
+//                      [--seconds 30] [--margin lo:hi:n] [--speed lo:hi:n]
+//                      [--follow lo:hi:n]
+//
+// --margin is the edge-push band as a fraction of the screen (0–0.45);
+// --speed the push speed in screen px/s; --follow the centered-mode follow
+// time in seconds (0 = locked). Each range is lo:hi:n or one value.
+// Continuous rows ignore all three and are printed once per trace and zoom,
+// with and without R-19 pointer damping. mouseN traces replay the same hand
+// motion as an N-DPI mouse reports it.
+// =============================================================================
+
+#include "smoothzoom/logic/PointerTrackingSim.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace SmoothZoom;
+
+namespace
+{
+
+struct Range
+{
+    double lo = 0.0;
+    double hi = 0.0;
+    int n = 1;
+
+    double at(int i) const
+    {
+        return (n <= 1) ? lo : lo + (hi - lo) * static_cast<double>(i) / (n - 1);
+    }
+};
+
+bool parseRange(const char* s, Range& out)
+{
+    char* end = nullptr;
+    out.lo = std::strtod(s, &end);
+    if (end == s)
+        return false;
+    out.hi = out.lo;
+    out.n = 1;
+    if (*end != ':')
+        return *end == '\0';
+    const char* p = end + 1;
+    out.hi = std::strtod(p, &end);
+    if (end == p || *end != ':')
+        return false;
+    p = end + 1;
+    out.n = static_cast<int>(std::strtol(p, &end, 10));
+    return end != p && *end == '\0' && out.n >= 1 && out.n <= 1000;
+}
+
+void usage()
+{
+    std::fprintf(stderr,
+        "usage: PointerTrackingSim [--trace precision|reading|sweep|mouse800|mouse1600|\n"
+        "                                   mouse3200|all] [--hz N]\n"
+        "                          [--seconds N] [--margin lo:hi:n] [--speed lo:hi:n]\n"
+        "                          [--follow lo:hi:n]\n");
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const char* trace = "all";
+    float hz = 144.0f;
+    float seconds = 30.0f;
+    const ViewportTracker::EdgePushParams defaults;
+    Range margin{defaults.marginFraction, defaults.marginFraction, 1};
+    Range speed{defaults.pushSpeedPx, defaults.pushSpeedPx, 1};
+    const ViewportTracker::CenteredParams centeredDefaults;
+    Range follow{centeredDefaults.followSec, centeredDefaults.followSec, 1};
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* a = argv[i];
+        const char* v = (i + 1 < argc) ? argv[i + 1] : nullptr;
+        bool ok = true;
+        if (!v)                                    ok = false;
+        else if (std::strcmp(a, "--trace") == 0)   trace = v;
+        else if (std::strcmp(a, "--hz") == 0)      { hz = static_cast<float>(std::atof(v)); ok = hz >= 10.0f && hz <= 1000.0f; }
+        else if (std::strcmp(a, "--seconds") == 0) { seconds = static_cast<float>(std::atof(v)); ok = seconds > 0.0f && seconds <= 3600.0f; }
+        else if (std::strcmp(a, "--margin") == 0)  ok = parseRange(v, margin);
+        else if (std::strcmp(a, "--speed") == 0)   ok = parseRange(v, speed);
+        else if (std::strcmp(a, "--follow") == 0)  ok = parseRange(v, follow) && follow.lo >= 0.0 && follow.hi >= 0.0;
+        else                                       ok = false;
+        if (!ok)
+        {
+            usage();
+            return 2;
+        }
+        ++i;
+    }
+
+    // Traces: the synthetic kinds, then mouse traces (by DPI).
+    struct Trace
+    {
+        const char* name;
+        PointerTraceKind kind;
+        int32_t dpi; // > 0: mouse trace
+    };
+    static const Trace kTraces[] = {
+        {"precision", PointerTraceKind::Precision, 0},
+        {"reading",   PointerTraceKind::Reading,   0},
+        {"sweep",     PointerTraceKind::Sweep,     0},
+        {"mouse800",  PointerTraceKind::Sweep,     800},
+        {"mouse1600", PointerTraceKind::Sweep,     1600},
+        {"mouse3200", PointerTraceKind::Sweep,     3200},
+    };
+    std::vector<Trace> traces;
+    const bool all = std::strcmp(trace, "all") == 0;
+    for (const Trace& t : kTraces)
+    {
+        if (all || std::strcmp(trace, t.name) == 0)
+            traces.push_back(t);
+    }
+    if (traces.empty())
+    {
+        std::fprintf(stderr, "unknown trace '%s'\n", trace);
+        usage();
+        return 2;
+    }
+
+    const int32_t screenW = 1920, screenH = 1080;
+    std::printf("trace,zoom,mode,margin,speed_px_s,follow_s,transforms_per_s,travel_px,max_frame_pan_px,offscreen_frames,center_err_px\n");
+    for (const Trace& t : traces)
+    {
+        auto samples = t.dpi > 0
+            ? synthesizeMouseTrace(t.dpi, hz, seconds, screenW, screenH)
+            : synthesizePointerTrace(t.kind, hz, seconds, screenW, screenH);
+        for (float zoom : {2.0f, 4.0f, 8.0f, 10.0f})
+        {
+            PointerTrackingSimParams p;
+            p.zoom = zoom;
+            p.screenW = screenW;
+            p.screenH = screenH;
+
+            auto row = [&](const char* mode) {
+                PointerTrackingStats s = simulatePointerTracking(samples.data(), samples.size(), p);
+                std::printf("%s,%.1f,%s,%.3f,%.0f,%.3f,%.2f,%.0f,%.1f,%d,%.0f\n", t.name,
+                            zoom, mode, p.edgePush.marginFraction, p.edgePush.pushSpeedPx,
+                            p.centered.followSec, s.transformsPerSec, s.viewportTravelPx,
+                            s.maxFramePanPx, s.pointerOffscreenFrames, s.meanCenterErrorPx);
+            };
+
+            p.mode = PointerTrackingMode::Continuous;
+            row("continuous");
+            p.damping = true;
+            row("damped");
+            p.damping = false;
+
+            p.mode = PointerTrackingMode::EdgePush;
+            for (int m = 0; m < margin.n; ++m)
+                for (int s = 0; s < speed.n; ++s)
+                {
+                    p.edgePush.marginFraction = static_cast<float>(margin.at(m));
+                    p.edgePush.pushSpeedPx = static_cast<float>(speed.at(s));
+                    row("edge");
+                }
+
+            p.mode = PointerTrackingMode::Centered;
+            for (int f = 0; f < follow.n; ++f)
+            {
+                p.centered.followSec = static_cast<float>(follow.at(f));
+                row("centered");
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,206 @@
+// =============================================================================
+// SmoothZoom — Zoom Curve Sweep (offline developer tool)
+// Sweeps a grid of zoom-curve parameters over a scripted input scenario with
+// the batch simulator and prints one CSV row of metrics per parameter set.
+// Doc 3 §3.5
+//
+// Usage:
+//   ZoomCurveSweep [--scenario notches|keyboard|toggle|mixed] [--hz 144]
+//                  [--base lo:hi:n] [--margin lo:hi:n] [--rate lo:hi:n]
+//                  [--sensitivity lo:hi:n] [--smoothing lo:hi:n] [--trajectory]
+//
+// Each range is lo:hi:n (n evenly spaced values, inclusive); a single value is
+// also accepted. --smoothing is the notched-wheel glide budget in seconds
+// (0 = direct). Unswept parameters keep their shipped defaults. --trajectory
+// prints the per-frame zoom of every set (long format) instead of metrics.
+// =============================================================================
+
+#include "smoothzoom/logic/ZoomSimulation.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace SmoothZoom;
+
+namespace
+{
+
+struct Range
+{
+    double lo = 0.0;
+    double hi = 0.0;
+    int n = 1;
+
+    double at(int i) const
+    {
+        return (n <= 1) ? lo : lo + (hi - lo) * static_cast<double>(i) / (n - 1);
+    }
+};
+
+bool parseRange(const char* s, Range& out)
+{
+    char* end = nullptr;
+    out.lo = std::strtod(s, &end);
+    if (end == s)
+        return false;
+    out.hi = out.lo;
+    out.n = 1;
+    if (*end != ':')
+        return *end == '\0';
+    const char* p = end + 1;
+    out.hi = std::strtod(p, &end);
+    if (end == p || *end != ':')
+        return false;
+    p = end + 1;
+    out.n = static_cast<int>(std::strtol(p, &end, 10));
+    return end != p && *end == '\0' && out.n >= 1 && out.n <= 1000;
+}
+
+// Scripted input scenarios, one event per render frame at `hz`.
+std::vector<ZoomSimEvent> buildScenario(const char* name, float hz)
+{
+    std::vector<ZoomSimEvent> ev;
+    const float dt = 1.0f / hz;
+    float t = 0.0f;
+    auto frame = [&](int32_t scroll, int8_t key, uint8_t cmd) {
+        t += dt;
+        ZoomSimEvent e;
+        e.timeSec = t;
+        e.scrollDelta = scroll;
+        e.keyStep = key;
+        e.commands = cmd;
+        ev.push_back(e);
+    };
+    auto idleFor = [&](float seconds) {
+        int frames = static_cast<int>(seconds * hz + 0.5f);
+        for (int i = 0; i < frames; ++i)
+            frame(0, 0, kZoomSimNone);
+    };
+    const bool all = std::strcmp(name, "mixed") == 0;
+
+    if (all || std::strcmp(name, "notches") == 0)
+    {
+        // Notched wheel: 20 notches at ~20 notches/s, then 20 back out.
+        for (int i = 0; i < 20; ++i) { frame(120, 0, kZoomSimNone); idleFor(0.05f); }
+        idleFor(0.5f);
+        for (int i = 0; i < 20; ++i) { frame(-120, 0, kZoomSimNone); idleFor(0.05f); }
+        idleFor(1.0f);
+    }
+    if (all || std::strcmp(name, "keyboard") == 0)
+    {
+        // Win+Plus ×4 at key-repeat pace, settle, Win+Minus ×4.
+        for (int i = 0; i < 4; ++i) { frame(0, +1, kZoomSimNone); idleFor(0.1f); }
+        idleFor(1.0f);
+        for (int i = 0; i < 4; ++i) { frame(0, -1, kZoomSimNone); idleFor(0.1f); }
+        idleFor(1.0f);
+    }
+    if (all || std::strcmp(name, "toggle") == 0)
+    {
+        // Scroll to a working level, then hold-to-peek and release.
+        for (int i = 0; i < 15; ++i) frame(120, 0, kZoomSimNone);
+        idleFor(0.5f);
+        frame(0, 0, kZoomSimToggleEngage);
+        idleFor(1.0f);
+        frame(0, 0, kZoomSimToggleRelease);
+        idleFor(1.0f);
+    }
+    return ev;
+}
+
+void usage()
+{
+    std::fprintf(stderr,
+        "usage: ZoomCurveSweep [--scenario notches|keyboard|toggle|mixed] [--hz N]\n"
+        "                      [--base lo:hi:n] [--margin lo:hi:n] [--rate lo:hi:n]\n"
+        "                      [--sensitivity lo:hi:n] [--smoothing lo:hi:n] [--trajectory]\n");
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const char* scenario = "mixed";
+    float hz = 144.0f;
+    bool trajectoryOut = false;
+
+    const ZoomCurveParams defaults;
+    Range base{defaults.scrollZoomBase, defaults.scrollZoomBase, 1};
+    Range margin{defaults.softMarginFraction, defaults.softMarginFraction, 1};
+    Range rate{defaults.easeOutRate, defaults.easeOutRate, 1};
+    Range sens{defaults.scrollSensitivity, defaults.scrollSensitivity, 1};
+    Range glide{defaults.wheelSmoothingSec, defaults.wheelSmoothingSec, 1};
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* a = argv[i];
+        const char* v = (i + 1 < argc) ? argv[i + 1] : nullptr;
+        bool ok = true;
+        if (std::strcmp(a, "--trajectory") == 0)      { trajectoryOut = true; continue; }
+        else if (!v)                                  ok = false;
+        else if (std::strcmp(a, "--scenario") == 0)   scenario = v;
+        else if (std::strcmp(a, "--hz") == 0)         { hz = static_cast<float>(std::atof(v)); ok = hz >= 10.0f && hz <= 1000.0f; }
+        else if (std::strcmp(a, "--base") == 0)       ok = parseRange(v, base);
+        else if (std::strcmp(a, "--margin") == 0)     ok = parseRange(v, margin);
+        else if (std::strcmp(a, "--rate") == 0)       ok = parseRange(v, rate);
+        else if (std::strcmp(a, "--sensitivity") == 0) ok = parseRange(v, sens);
+        else if (std::strcmp(a, "--smoothing") == 0)  ok = parseRange(v, glide);
+        else                                          ok = false;
+        if (!ok)
+        {
+            usage();
+            return 2;
+        }
+        ++i;
+    }
+
+    std::vector<ZoomSimEvent> events = buildScenario(scenario, hz);
+    if (events.empty())
+    {
+        std::fprintf(stderr, "unknown scenario '%s'\n", scenario);
+        usage();
+        return 2;
+    }
+
+    std::vector<ZoomSimParams> params;
+    for (int b = 0; b < base.n; ++b)
+        for (int m = 0; m < margin.n; ++m)
+            for (int r = 0; r < rate.n; ++r)
+                for (int s = 0; s < sens.n; ++s)
+                    for (int g = 0; g < glide.n; ++g)
+                    {
+                        ZoomSimParams p;
+                        p.curve.scrollZoomBase = static_cast<float>(base.at(b));
+                        p.curve.softMarginFraction = static_cast<float>(margin.at(m));
+                        p.curve.easeOutRate = rate.at(r);
+                        p.curve.scrollSensitivity = static_cast<float>(sens.at(s));
+                        p.curve.wheelSmoothingSec = static_cast<float>(glide.at(g));
+                        params.push_back(p);
+                    }
+
+    std::vector<float> traj(events.size() * params.size());
+    simulateZoomBatch(events.data(), events.size(), params.data(), params.size(), traj.data());
+
+    if (trajectoryOut)
+    {
+        std::printf("set,time_ms,zoom\n");
+        for (size_t l = 0; l < params.size(); ++l)
+            for (size_t f = 0; f < events.size(); ++f)
+                std::printf("%zu,%.3f,%.6f\n", l, events[f].timeSec * 1000.0f,
+                            traj[f * params.size() + l]);
+        return 0;
+    }
+
+    std::printf("set,base,margin,rate,sensitivity,smoothing,final_zoom,peak_zoom,settle_ms,max_frame_log_step\n");
+    for (size_t l = 0; l < params.size(); ++l)
+    {
+        const ZoomCurveParams& c = params[l].curve;
+        ZoomSimMetrics m = summarizeZoomTrajectory(events.data(), events.size(),
+                                                   traj.data(), params.size(), l);
+        std::printf("%zu,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.1f,%.5f\n",
+                    l, c.scrollZoomBase, c.softMarginFraction, c.easeOutRate,
+                    c.scrollSensitivity, c.wheelSmoothingSec, m.finalZoom, m.peakZoom,
+                    m.settleTimeSec * 1000.0f, m.maxFrameLogStep);
+    }
+    return 0;
+}
@@ -0,0 +1,303 @@
+// =============================================================================
+// Unit tests for CaretMotionModel and caret follow — AC-2.6.06, Doc 3 §3.6
+// Caret traces (LTR and RTL typing, arrowing backwards, Enter/wrap, moving
+// down lines, clicks) are replayed frame by frame: the lookahead must point
+// the way the caret is going, grow with speed, and the viewport must pan only
+// when the caret nears the edge it is heading for.
+// Pure logic — no Win32 API dependencies.
+// =============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_message.hpp>
+#include "smoothzoom/logic/CaretMotionModel.h"
+#include "smoothzoom/logic/ViewportTracker.h"
+#include <cmath>
+#include <vector>
+
+using namespace SmoothZoom;
+using Catch::Approx;
+
+namespace
+{
+
+constexpr int32_t kLineH = 20;
+constexpr int32_t kCharW = 10;
+
+struct CaretFrame
+{
+    int64_t t;
+    ScreenRect rect;
+};
+
+ScreenRect caretAt(int32_t x, int32_t y)
+{
+    return {x, y, x + 2, y + kLineH};
+}
+
+// Caret advancing `dirX` chars (and `dirY` lines) per keystroke at `cps`
+// keystrokes/s, sampled at `hz` for `seconds`, starting at (x, y) and time t0.
+// `wrapAt` > 0 wraps to the next line after that many characters (LTR only).
+std::vector<CaretFrame> typingTrace(int32_t x, int32_t y, int dirX, int dirY, float cps,
+                                    float hz, float seconds, int64_t t0 = 1000,
+                                    int wrapAt = 0)
+{
+    std::vector<CaretFrame> out;
+    const int frames = static_cast<int>(hz * seconds);
+    int typed = 0;
+    for (int i = 0; i < frames; ++i)
+    {
+        const float t = static_cast<float>(i) / hz;
+        const int keys = static_cast<int>(t * cps);
+        while (typed < keys)
+        {
+            ++typed;
+            if (wrapAt > 0 && typed % wrapAt == 0)
+            {
+                x -= (wrapAt - 1) * kCharW;
+                y += kLineH;
+                continue;
+            }
+            x += dirX * kCharW;
+            y += dirY * kLineH;
+        }
+        out.push_back({t0 + static_cast<int64_t>(std::lround(t * 1000.0f)), caretAt(x, y)});
+    }
+    return out;
+}
+
+void feed(CaretMotionModel& m, const std::vector<CaretFrame>& trace)
+{
+    for (const CaretFrame& f : trace)
+        m.update(f.rect, f.t);
+}
+
+// Caret idle at its last position for `seconds` after `trace`.
+std::vector<CaretFrame> idleAfter(const std::vector<CaretFrame>& trace, float seconds,
+                                  float hz = 60.0f)
+{
+    std::vector<CaretFrame> out;
+    const CaretFrame last = trace.back();
+    for (int i = 1; i <= static_cast<int>(seconds * hz); ++i)
+        out.push_back({last.t + static_cast<int64_t>(i * 1000.0f / hz), last.rect});
+    return out;
+}
+
+} // namespace
+
+TEST_CASE("LTR typing: lookahead to the right, growing with speed", "[CaretMotionModel]")
+{
+    CaretMotionModel slow, fast;
+    feed(slow, typingTrace(200, 500, +1, 0, 3.0f, 60.0f, 2.0f));
+    feed(fast, typingTrace(200, 500, +1, 0, 12.0f, 60.0f, 2.0f));
+
+    REQUIRE(slow.horizontalDirection() == 1);
+    REQUIRE_FALSE(slow.rightToLeft());
+    // Between keystrokes the estimate ripples around the mean speed; the
+    // ripple is smaller the faster the typing.
+    const float slowMean = 3.0f * kCharW / kLineH, fastMean = 12.0f * kCharW / kLineH;
+    REQUIRE(slow.velocityX() > 0.5f * slowMean);
+    REQUIRE(slow.velocityX() < 1.5f * slowMean);
+    REQUIRE(fast.velocityX() == Approx(fastMean).epsilon(0.25));
+
+    const auto a = slow.lookahead(), b = fast.lookahead();
+    REQUIRE(a.x > 0.0f);
+    REQUIRE(b.x > a.x);
+    REQUIRE(b.x <= slow.params().maxLookahead);
+    REQUIRE(a.y == 0.0f);
+}
+
+TEST_CASE("RTL typing: lookahead to the left, kept once the caret pauses",
+          "[CaretMotionModel]")
+{
+    CaretMotionModel m;
+    auto trace = typingTrace(1500, 500, -1, 0, 6.0f, 60.0f, 3.0f);
+    feed(m, trace);
+    REQUIRE(m.horizontalDirection() == -1);
+    REQUIRE(m.rightToLeft());
+    REQUIRE(m.lookahead().x < 0.0f);
+
+    feed(m, idleAfter(trace, 2.0f));
+    REQUIRE(std::abs(m.velocityX()) < m.params().moveThreshold);
+    REQUIRE(m.lookahead().x == Approx(-m.params().minLookahead).margin(0.005));
+}
+
+TEST_CASE("Arrowing backwards in LTR text flips lookahead, then it returns",
+          "[CaretMotionModel]")
+{
+    CaretMotionModel m;
+    auto typed = typingTrace(200, 500, +1, 0, 6.0f, 60.0f, 4.0f);
+    feed(m, typed);
+    const CaretFrame end = typed.back();
+
+    auto back = typingTrace(end.rect.left, 500, -1, 0, 15.0f, 60.0f, 0.6f, end.t + 16);
+    feed(m, back);
+    REQUIRE(m.horizontalDirection() == -1);
+    REQUIRE(m.lookahead().x < 0.0f);
+    REQUIRE_FALSE(m.rightToLeft()); // a brief reversal doesn't change the script
+
+    feed(m, idleAfter(back, 2.0f));
+    REQUIRE(m.lookahead().x > 0.0f);
+}
+
+TEST_CASE("Line wraps and Enter don't read as leftward typing", "[CaretMotionModel]")
+{
+    CaretMotionModel m;
+    auto trace = typingTrace(200, 300, +1, 0, 8.0f, 60.0f, 6.0f, 1000, 12);
+    feed(m, trace);
+    REQUIRE(m.horizontalDirection() == 1);
+    REQUIRE_FALSE(m.rightToLeft());
+    REQUIRE(m.velocityX() > 0.0f);
+}
+
+TEST_CASE("Moving down through lines adds vertical lookahead", "[CaretMotionModel]")
+{
+    CaretMotionModel m;
+    feed(m, typingTrace(400, 100, 0, +1, 8.0f, 60.0f, 1.0f));
+    REQUIRE(m.verticalDirection() == 1);
+    REQUIRE(m.lookahead().y > 0.0f);
+    REQUIRE(m.lookahead().y <= m.params().maxVerticalLookahead);
+
+    CaretMotionModel up;
+    feed(up, typingTrace(400, 800, 0, -1, 8.0f, 60.0f, 1.0f));
+    REQUIRE(up.lookahead().y < 0.0f);
+}
+
+TEST_CASE("A click elsewhere is a jump, not motion", "[CaretMotionModel]")
+{
+    CaretMotionModel m;
+    auto trace = typingTrace(200, 500, +1, 0, 8.0f, 60.0f, 2.0f);
+    feed(m, trace);
+    REQUIRE(m.velocityX() > 1.0f);
+
+    m.update(caretAt(1600, 100), trace.back().t + 16);
+    REQUIRE(m.velocityX() == 0.0f);
+    REQUIRE(m.velocityY() == 0.0f);
+    REQUIRE(m.horizontalDirection() == 1); // still LTR text
+}
+
+TEST_CASE("Estimates don't depend on the sampling rate", "[CaretMotionModel]")
+{
+    // Compared at the same instant; keystrokes are only seen on frames, so a
+    // 30 Hz caret sees each one up to 33 ms late.
+    auto run = [](float hz) {
+        CaretMotionModel m;
+        auto trace = typingTrace(200, 500, +1, 0, 7.0f, hz, 2.0f);
+        feed(m, trace);
+        m.update(trace.back().rect, 3000);
+        return m;
+    };
+    const CaretMotionModel ref = run(1000.0f);
+    for (float hz : {30.0f, 60.0f, 144.0f, 240.0f})
+    {
+        const CaretMotionModel m = run(hz);
+        INFO("hz " << hz << ": " << m.velocityX() << " vs " << ref.velocityX());
+        REQUIRE(m.velocityX() == Approx(ref.velocityX()).epsilon(0.15));
+        REQUIRE(m.lookahead().x == Approx(ref.lookahead().x).epsilon(0.1));
+    }
+}
+
+// ─── Edge-triggered follow ──────────────────────────────────────────────────
+
+namespace
+{
+
+struct FollowStats
+{
+    int pans = 0;
+    int caretTargetChanges = 0; // legacy per-character re-centering
+    bool alwaysVisible = true;
+};
+
+FollowStats followTrace(const std::vector<CaretFrame>& trace, float zoom)
+{
+    CaretMotionModel m;
+    FollowStats st;
+    ViewportTracker::Offset off = ViewportTracker::computeCaretOffset(
+        trace.front().rect, zoom, 1920, 1080);
+    ViewportTracker::Offset legacyPrev = off;
+    for (const CaretFrame& f : trace)
+    {
+        m.update(f.rect, f.t);
+        auto next = ViewportTracker::computeCaretFollowOffset(
+            off.x, off.y, f.rect, m.lookahead(), zoom, 1920, 1080);
+        st.pans += (next.x != off.x || next.y != off.y);
+        off = next;
+
+        auto legacy = ViewportTracker::computeCaretOffset(f.rect, zoom, 1920, 1080);
+        st.caretTargetChanges += (legacy.x != legacyPrev.x || legacy.y != legacyPrev.y);
+        legacyPrev = legacy;
+
+        const float span = 1920.0f / zoom, spanY = 1080.0f / zoom;
+        if (f.rect.left < off.x || f.rect.right > off.x + span
+            || f.rect.top < off.y || f.rect.bottom > off.y + spanY)
+            st.alwaysVisible = false;
+    }
+    return st;
+}
+
+} // namespace
+
+TEST_CASE("Caret follow pans at the edge, not on every character",
+          "[CaretMotionModel][ViewportTracker]")
+{
+    // 4× zoom: a 480 px wide viewport; 8 chars/s across 1200 px of text.
+    auto trace = typingTrace(300, 500, +1, 0, 8.0f, 60.0f, 15.0f);
+    auto st = followTrace(trace, 4.0f);
+    INFO("pans " << st.pans << ", legacy re-centers " << st.caretTargetChanges);
+    REQUIRE(st.alwaysVisible);
+    REQUIRE(st.pans >= 2);
+    REQUIRE(st.pans * 10 < st.caretTargetChanges);
+}
+
+TEST_CASE("Caret follow: RTL typing pans left with lookahead on the left",
+          "[CaretMotionModel][ViewportTracker]")
+{
+    auto trace = typingTrace(1600, 500, -1, 0, 8.0f, 60.0f, 15.0f);
+    auto st = followTrace(trace, 4.0f);
+    REQUIRE(st.alwaysVisible);
+    REQUIRE(st.pans >= 2);
+
+    // Near the left edge of the view while typing leftward → pan, leaving the
+    // caret right of center so the text ahead (left) is revealed.
+    CaretMotionModel m;
+    feed(m, typingTrace(1000, 500, -1, 0, 8.0f, 60.0f, 1.0f));
+    const ScreenRect caret = caretAt(620, 500);
+    auto off = ViewportTracker::computeCaretFollowOffset(600.0f, 400.0f, caret, m.lookahead(),
+                                                         4.0f, 1920, 1080);
+    REQUIRE(off.x < 600.0f);
+    const float f = (621.0f - off.x) / 480.0f; // caret center, fraction of the view
+    REQUIRE(f == Approx(0.5f - m.lookahead().x).margin(0.01));
+    REQUIRE(f > 0.5f);
+}
+
+TEST_CASE("Caret follow: still caret inside the view never pans",
+          "[CaretMotionModel][ViewportTracker]")
+{
+    const ScreenRect caret = caretAt(800, 500);
+    for (float lx : {-0.3f, 0.0f, 0.15f, 0.3f})
+    {
+        auto off = ViewportTracker::computeCaretFollowOffset(
+            600.0f, 400.0f, caret, {lx, 0.0f}, 4.0f, 1920, 1080);
+        REQUIRE(off.x == 600.0f);
+        REQUIRE(off.y == 400.0f);
+    }
+}
+
+TEST_CASE("Caret follow: moving down lines pans vertically near the bottom",
+          "[CaretMotionModel][ViewportTracker]")
+{
+    auto trace = typingTrace(700, 100, 0, +1, 6.0f, 60.0f, 6.0f);
+    auto st = followTrace(trace, 4.0f);
+    REQUIRE(st.alwaysVisible);
+    REQUIRE(st.pans >= 2);
+    REQUIRE(st.pans < 20);
+}
+
+TEST_CASE("Caret follow at 1.0x returns (0,0)", "[ViewportTracker]")
+{
+    auto off = ViewportTracker::computeCaretFollowOffset(0.0f, 0.0f, caretAt(500, 300),
+                                                         {0.2f, 0.0f}, 1.0f, 1920, 1080);
+    REQUIRE(off.x == 0.0f);
+    REQUIRE(off.y == 0.0f);
+}
@@ -0,0 +1,448 @@
+// =============================================================================
+// Refresh-rate independence suite — Doc 3 §3.4, §3.5
+// Every time-driven animation (zoom curves, source transitions, edge-push
+// pans) is replayed at 30–240 Hz with uniform, jittered
+// and dropped-frame dt sequences and compared against a 1 kHz reference run of
+// the same path. A path fails when its trajectory diverges from the reference
+// (max error as a fraction of the whole move) or settles at a different wall
+// time than one frame of slack allows. Registered as its own ctest entry.
+// Pure logic — no Win32 API dependencies.
+// =============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include "smoothzoom/logic/ZoomController.h"
+#include "smoothzoom/logic/ZoomQuantizer.h"
+#include "smoothzoom/logic/ViewportTracker.h"
+#include "smoothzoom/logic/PointerDamper.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+using namespace SmoothZoom;
+
+namespace
+{
+
+constexpr float kRates[] = {30.0f, 60.0f, 75.0f, 120.0f, 144.0f, 165.0f, 240.0f};
+constexpr float kReferenceRate = 1000.0f;
+constexpr float kRunSec = 1.5f;
+
+// Largest dt RenderLoop ever passes on (it clamps to 100 ms).
+constexpr float kMaxFrameDt = 0.1f;
+
+enum class Cadence
+{
+    Uniform,   // vsync-locked
+    Jitter,    // ±15% per-frame timing noise (compositor / timer slop)
+    Dropped,   // jitter plus a frame delivered 2–3 periods late every ~11 frames
+};
+
+const char* cadenceName(Cadence c)
+{
+    switch (c)
+    {
+    case Cadence::Uniform: return "uniform";
+    case Cadence::Jitter:  return "jitter";
+    default:               return "dropped";
+    }
+}
+
+// Deterministic LCG so every run sees the same "noise".
+struct Lcg
+{
+    uint32_t s;
+    float next() // [0, 1)
+    {
+        s = s * 1664525u + 1013904223u;
+        return static_cast<float>(s >> 8) / 16777216.0f;
+    }
+};
+
+std::vector<float> frameDts(float hz, Cadence cadence, uint32_t seed = 12345u)
+{
+    std::vector<float> dts;
+    Lcg rng{seed};
+    const float period = 1.0f / hz;
+    float total = 0.0f;
+    int frame = 0;
+    while (total < kRunSec)
+    {
+        float dt = period;
+        if (cadence != Cadence::Uniform)
+            dt *= 1.0f + 0.3f * (rng.next() - 0.5f);
+        if (cadence == Cadence::Dropped && ++frame % 11 == 0)
+            dt = std::min(dt * (rng.next() < 0.5f ? 2.0f : 3.0f), kMaxFrameDt);
+        dts.push_back(dt);
+        total += dt;
+    }
+    return dts;
+}
+
+struct Sample
+{
+    double t;
+    double v;
+};
+
+// An animation path: fresh state, one trigger at t = 0, then one value per
+// frame after advancing by that frame's dt. Values are in the path's natural
+// linear unit (log zoom for zoom curves, px for offsets).
+using PathFn = std::vector<Sample> (*)(const std::vector<float>& dts);
+
+template <typename Step>
+std::vector<Sample> record(const std::vector<float>& dts, double v0, Step step)
+{
+    std::vector<Sample> out;
+    out.reserve(dts.size() + 1);
+    out.push_back({0.0, v0});
+    double t = 0.0;
+    for (float dt : dts)
+    {
+        t += dt;
+        out.push_back({t, step(dt)});
+    }
+    return out;
+}
+
+void settleScrolledTo(ZoomController& zc, int notches)
+{
+    zc.applyScrollDelta(120 * notches);
+    zc.tick(0.0f);
+    zc.endScroll();
+}
+
+std::vector<Sample> keyboardEase(const std::vector<float>& dts)
+{
+    ZoomController zc;
+    for (int i = 0; i < 4; ++i)
+        zc.applyKeyboardStep(+1);
+    return record(dts, 0.0, [&](float dt) {
+        zc.tick(dt);
+        return std::log(static_cast<double>(zc.currentZoom()));
+    });
+}
+
+std::vector<Sample> keyboardEaseFast(const std::vector<float>& dts)
+{
+    ZoomController zc;
+    zc.applySettings(1.0f, 10.0f, 0.25f, 2.0f, 2, 1.0f);
+    for (int i = 0; i < 4; ++i)
+        zc.applyKeyboardStep(+1);
+    return record(dts, 0.0, [&](float dt) {
+        zc.tick(dt);
+        return std::log(static_cast<double>(zc.currentZoom()));
+    });
+}
+
+std::vector<Sample> toggleOutEase(const std::vector<float>& dts)
+{
+    ZoomController zc;
+    settleScrolledTo(zc, 15);
+    double v0 = std::log(static_cast<double>(zc.currentZoom()));
+    zc.engageToggle(); // zoomed in → animates out to 1.0×
+    return record(dts, v0, [&](float dt) {
+        zc.tick(dt);
+        return std::log(static_cast<double>(zc.currentZoom()));
+    });
+}
+
+std::vector<Sample> presetPlanned(const std::vector<float>& dts)
+{
+    ZoomController zc;
+    zc.jumpToPreset(2); // 1.0× → 6.0×, planned log-space segment
+    return record(dts, 0.0, [&](float dt) {
+        zc.tick(dt);
+        return std::log(static_cast<double>(zc.currentZoom()));
+    });
+}
+
+std::vector<Sample> wheelGlide(const std::vector<float>& dts)
+{
+    ZoomController zc;
+    zc.setWheelSmoothing(true, kWheelSmoothingDefaultSec);
+    for (int i = 0; i < 5; ++i)
+        zc.applyScrollDelta(120);
+    return record(dts, 0.0, [&](float dt) {
+        zc.tick(dt);
+        zc.endScroll();
+        return std::log(static_cast<double>(zc.currentZoom()));
+    });
+}
+
+std::vector<Sample> quantizeGlide(const std::vector<float>& dts)
+{
+    ZoomController zc;
+    zc.setQuantization(true, 0.0f);
+    settleScrolledTo(zc, 13); // ≈3.45×, off-grid on a 1920 px monitor
+    double v0 = std::log(static_cast<double>(zc.currentZoom()));
+    return record(dts, v0, [&](float dt) {
+        zc.tickQuantize(dt, 1920);
+        return std::log(static_cast<double>(zc.currentZoom()));
+    });
+}
+
+std::vector<Sample> sourceTransition(const std::vector<float>& dts)
+{
+    ViewportTracker::PanAnimator pan;
+    const ViewportTracker::Offset target{1000.0f, 0.0f};
+    pan.begin({0.0f, 0.0f}, target, 2.0f);
+    return record(dts, 0.0, [&](float dt) {
+        return static_cast<double>(pan.advance(target, dt).x);
+    });
+}
+
+std::vector<Sample> interruptedPan(const std::vector<float>& dts)
+{
+    // A second source change exactly 100 ms into a pan retargets it, carrying
+    // the velocity at that moment. The frame spanning 100 ms is split there so
+    // only the animator, not event sampling, is compared across rates.
+    ViewportTracker::PanAnimator pan;
+    ViewportTracker::Offset target{1000.0f, 0.0f};
+    pan.begin({0.0f, 0.0f}, target, 2.0f);
+    float t = 0.0f;
+    bool retargeted = false;
+    return record(dts, 0.0, [&](float dt) {
+        if (!retargeted && t + dt >= 0.1f)
+        {
+            const float before = 0.1f - t;
+            ViewportTracker::Offset p = pan.advance(target, before);
+            target = {2500.0f, 0.0f};
+            pan.begin(p, target, 2.0f);
+            retargeted = true;
+            t += dt;
+            return static_cast<double>(pan.advance(target, dt - before).x);
+        }
+        t += dt;
+        return static_cast<double>(pan.advance(target, dt).x);
+    });
+}
+
+std::vector<Sample> edgePush(const std::vector<float>& dts)
+{
+    // Pointer parked deep in a wide right-hand band at 1.5×: the viewport
+    // pans until the pointer sits on the band's inner edge.
+    ViewportTracker::EdgePushParams params;
+    params.marginFraction = 0.3f;
+    params.pushSpeedPx = 2000.0f;
+    ViewportTracker::Offset off{300.0f, 180.0f};
+    return record(dts, off.x, [&](float dt) {
+        off = ViewportTracker::computeEdgePushOffset(off, 1550, 540, 1.5f, params, dt, 1920, 1080);
+        return static_cast<double>(off.x);
+    });
+}
+
+std::vector<Sample> centeredFollow(const std::vector<float>& dts)
+{
+    // Pointer jumps 300 px right of a centered view at 3×: the damped follow
+    // brings it back to the screen center.
+    ViewportTracker::CenteredParams params;
+    ViewportTracker::FollowState st;
+    st.offset = {660.0f - 960.0f / 3.0f, 540.0f - 540.0f / 3.0f};
+    return record(dts, st.offset.x, [&](float dt) {
+        st = ViewportTracker::computeCenteredOffset(st, 960, 540, 3.0f, params, dt, 1920, 1080);
+        return static_cast<double>(st.offset.x);
+    });
+}
+
+std::vector<Sample> pointerDampingGlide(const std::vector<float>& dts)
+{
+    // R-19 damper at 8×: the pointer jumps 1200 px and the damped pointer
+    // glides after it.
+    PointerDamper damper;
+    damper.setEnabled(true);
+    damper.reset(0, 0);
+    return record(dts, 0.0, [&](float dt) {
+        return static_cast<double>(damper.update(1200, 0, 8.0f, dt).x);
+    });
+}
+
+struct Path
+{
+    const char* name;
+    PathFn run;
+    // Longest frame for which the path promises rate independence. The
+    // quantization glide is pixel-bounded per frame (kQuantizeMaxStepPx), so
+    // frames slower than 60 Hz deliberately glide slower.
+    float maxIndependentDt;
+};
+
+const Path kPaths[] = {
+    {"ease-out (keyboard, normal)", keyboardEase,     kMaxFrameDt},
+    {"ease-out (keyboard, fast)",   keyboardEaseFast, kMaxFrameDt},
+    {"ease-out (toggle to 1.0x)",   toggleOutEase,    kMaxFrameDt},
+    {"planned preset jump",         presetPlanned,    kMaxFrameDt},
+    {"notched-wheel glide",         wheelGlide,       kMaxFrameDt},
+    {"quantization glide",          quantizeGlide,    1.0f / static_cast<float>(kReferenceHz)},
+    {"source transition",           sourceTransition, kMaxFrameDt},
+    {"interrupted pan",             interruptedPan,   kMaxFrameDt},
+    {"edge-push pan",               edgePush,         kMaxFrameDt},
+    {"centered follow",             centeredFollow,   kMaxFrameDt},
+    {"pointer damping glide",       pointerDampingGlide, kMaxFrameDt},
+};
+
+// Reference value at time t (linear interpolation of the 1 kHz run).
+double referenceAt(const std::vector<Sample>& ref, double t)
+{
+    auto it = std::lower_bound(ref.begin(), ref.end(), t,
+                               [](const Sample& s, double x) { return s.t < x; });
+    if (it == ref.begin())
+        return it->v;
+    if (it == ref.end())
+        return ref.back().v;
+    const Sample& b = *it;
+    const Sample& a = *(it - 1);
+    double u = (t - a.t) / (b.t - a.t);
+    return a.v + (b.v - a.v) * u;
+}
+
+// Wall time of the last frame whose value changed.
+double settleTime(const std::vector<Sample>& s)
+{
+    for (size_t i = s.size() - 1; i > 0; --i)
+        if (s[i].v != s[i - 1].v)
+            return s[i].t;
+    return 0.0;
+}
+
+struct Comparison
+{
+    double divergence = 0.0;  // max |v − ref| / |total move|
+    double settleSec = 0.0;
+    double refSettleSec = 0.0;
+    double maxDt = 0.0;
+    double finalError = 0.0;  // |final − ref final| / |total move|
+};
+
+Comparison compare(const std::vector<Sample>& run, const std::vector<Sample>& ref)
+{
+    Comparison c;
+    const double move = std::abs(ref.back().v - ref.front().v);
+    for (size_t i = 1; i < run.size(); ++i)
+    {
+        c.maxDt = std::max(c.maxDt, run[i].t - run[i - 1].t);
+        double err = std::abs(run[i].v - referenceAt(ref, run[i].t)) / move;
+        c.divergence = std::max(c.divergence, err);
+    }
+    c.settleSec = settleTime(run);
+    c.refSettleSec = settleTime(ref);
+    c.finalError = std::abs(run.back().v - ref.back().v) / move;
+    return c;
+}
+
+// Thresholds. Divergence: 2% of the move — ease-outs snap onto the target
+// within kSnapEpsilon, so a coarse frame can land up to one snap early.
+// Settle: within one (longest) frame of the reference, plus 2 ms for the
+// reference's own 1 ms quantization.
+constexpr double kMaxDivergence = 0.02;
+constexpr double kSettleSlackSec = 0.002;
+
+} // namespace
+
+TEST_CASE("Reference runs of every path settle inside the run window", "[FrameRate]")
+{
+    auto refDts = frameDts(kReferenceRate, Cadence::Uniform);
+    for (const Path& p : kPaths)
+    {
+        auto ref = p.run(refDts);
+        INFO(p.name);
+        REQUIRE(std::abs(ref.back().v - ref.front().v) > 0.0);
+        REQUIRE(settleTime(ref) > 0.0);
+        REQUIRE(settleTime(ref) < kRunSec - 0.25);
+    }
+}
+
+TEST_CASE("Animations match the reference curve at every refresh rate", "[FrameRate]")
+{
+    auto refDts = frameDts(kReferenceRate, Cadence::Uniform);
+    for (const Path& p : kPaths)
+    {
+        auto ref = p.run(refDts);
+        for (float hz : kRates)
+        {
+            for (Cadence cad : {Cadence::Uniform, Cadence::Jitter, Cadence::Dropped})
+            {
+                auto dts = frameDts(hz, cad);
+                Comparison c = compare(p.run(dts), ref);
+                INFO(p.name << " @" << hz << " Hz " << cadenceName(cad)
+                     << ": divergence " << c.divergence * 100.0 << "%, settle "
+                     << c.settleSec * 1000.0 << " ms vs " << c.refSettleSec * 1000.0 << " ms");
+
+                // Every path converges to the same resting value.
+                REQUIRE(c.finalError < 1e-3);
+
+                if (c.maxDt <= p.maxIndependentDt)
+                {
+                    REQUIRE(c.divergence <= kMaxDivergence);
+                    REQUIRE(std::abs(c.settleSec - c.refSettleSec) <= c.maxDt + kSettleSlackSec);
+                }
+                else
+                {
+                    // Outside its rate-independent range a path may only be
+                    // slower (bounded per frame), never faster.
+                    REQUIRE(c.settleSec >= c.refSettleSec - c.maxDt - kSettleSlackSec);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Jitter seed does not change the settled trajectory", "[FrameRate]")
+{
+    // Same rate, different noise: both runs stay on the reference curve, so
+    // they stay within twice the threshold of each other.
+    auto refDts = frameDts(kReferenceRate, Cadence::Uniform);
+    for (const Path& p : kPaths)
+    {
+        auto ref = p.run(refDts);
+        for (uint32_t seed : {1u, 77u, 9001u})
+        {
+            Comparison c = compare(p.run(frameDts(144.0f, Cadence::Jitter, seed)), ref);
+            INFO(p.name << " seed " << seed << ": divergence " << c.divergence * 100.0 << "%");
+            REQUIRE(c.divergence <= kMaxDivergence);
+        }
+    }
+}
+
+TEST_CASE("Quantization glide never exceeds its per-frame pixel bound at any rate",
+          "[FrameRate][ZoomQuantizer]")
+{
+    for (float hz : kRates)
+    {
+        for (Cadence cad : {Cadence::Uniform, Cadence::Jitter, Cadence::Dropped})
+        {
+            auto dts = frameDts(hz, cad);
+            auto run = quantizeGlide(dts);
+            for (size_t i = 1; i < run.size(); ++i)
+            {
+                float from = static_cast<float>(std::exp(run[i - 1].v));
+                float to = static_cast<float>(std::exp(run[i].v));
+                INFO("@" << hz << " Hz " << cadenceName(cad) << " frame " << i);
+                REQUIRE(quantizeDisplacementPx(from, to, 1920) <= kQuantizeMaxStepPx * 1.01f);
+            }
+        }
+    }
+}
+
+// Human-readable table of divergence and settle time per path / rate /
+// cadence. Hidden; run with: smoothzoom_tests "[.frame-rate-report]"
+TEST_CASE("Refresh-rate divergence report", "[.frame-rate-report]")
+{
+    auto refDts = frameDts(kReferenceRate, Cadence::Uniform);
+    std::printf("%-28s %6s %-8s %10s %10s %10s\n",
+                "path", "hz", "cadence", "diverge%", "settle_ms", "ref_ms");
+    for (const Path& p : kPaths)
+    {
+        auto ref = p.run(refDts);
+        for (float hz : kRates)
+            for (Cadence cad : {Cadence::Uniform, Cadence::Jitter, Cadence::Dropped})
+            {
+                Comparison c = compare(p.run(frameDts(hz, cad)), ref);
+                std::printf("%-28s %6.0f %-8s %10.3f %10.1f %10.1f\n", p.name, hz,
+                            cadenceName(cad), c.divergence * 100.0,
+                            c.settleSec * 1000.0, c.refSettleSec * 1000.0);
+            }
+    }
+    SUCCEED();
+}
@@ -0,0 +1,206 @@
+// =============================================================================
+// Unit tests for HookServiceProfiler — Doc 3 §2.5, §3.1 (R-05)
+// Per-event-type histograms, slow-callback counts and their configuration,
+// the early warning (spike, trend, re-arm), interval deltas across a
+// reconfiguration (skipped when nothing changed, never torn under a
+// concurrent snapshot), and a benchmark of record() at hook rates.
+// Pure logic — no Win32 API dependencies.
+// =============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "smoothzoom/common/HookServiceProfiler.h"
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+using namespace SmoothZoom;
+
+TEST_CASE("Service times are kept per event type", "[HookServiceProfiler]")
+{
+    HookServiceProfiler p;
+    for (int i = 0; i < 100; ++i)
+        p.record(HookEventKind::MouseMove, 3);
+    p.record(HookEventKind::Keyboard, 700);
+    p.record(HookEventKind::MouseWheel, 40);
+
+    const auto s = p.snapshot();
+    REQUIRE(s.kind(HookEventKind::MouseMove).total() == 100);
+    REQUIRE(s.kind(HookEventKind::MouseMove).maxBound() == 4);
+    REQUIRE(s.kind(HookEventKind::Keyboard).maxBound() == 1024);
+    REQUIRE(s.kind(HookEventKind::MouseWheel).total() == 1);
+    REQUIRE(s.kind(HookEventKind::MouseButton).total() == 0);
+    REQUIRE(s.total().total() == 102);
+    REQUIRE(s.worstUs == 700);
+}
+
+TEST_CASE("Slow callbacks count against every threshold they reach", "[HookServiceProfiler]")
+{
+    HookServiceProfiler p; // 1, 10, 100 ms
+    const auto s0 = p.snapshot();
+    REQUIRE(s0.thresholdCount == 3);
+    REQUIRE(s0.thresholdsUs[0] == 1000);
+    REQUIRE(s0.thresholdsUs[2] == 100000);
+
+    p.record(HookEventKind::MouseMove, 999);
+    p.record(HookEventKind::MouseMove, 1000);
+    p.record(HookEventKind::Keyboard, 25000);
+    p.record(HookEventKind::Keyboard, 150000);
+    const auto s = p.snapshot();
+    REQUIRE(s.slow[0] == 3);
+    REQUIRE(s.slow[1] == 2);
+    REQUIRE(s.slow[2] == 1);
+    REQUIRE(s.slow[3] == 0);
+}
+
+TEST_CASE("Thresholds are deduplicated, sorted and capped", "[HookServiceProfiler]")
+{
+    HookServiceProfiler p;
+    p.record(HookEventKind::MouseMove, 5000);
+    const uint32_t t[] = {50000, 0, 2000, 50000, 500, 9000, 70000};
+    p.configure(t, 7, 0);
+
+    const auto s = p.snapshot();
+    REQUIRE(s.thresholdCount == 4);
+    REQUIRE(s.thresholdsUs[0] == 500);
+    REQUIRE(s.thresholdsUs[1] == 2000);
+    REQUIRE(s.thresholdsUs[2] == 9000);
+    REQUIRE(s.thresholdsUs[3] == 50000);
+    REQUIRE(s.slow[0] == 0); // restarted
+    REQUIRE(s.timeoutUs == HookServiceProfiler::kDefaultTimeoutUs);
+    REQUIRE(s.kind(HookEventKind::MouseMove).total() == 1); // histograms kept
+}
+
+TEST_CASE("A spike toward the timeout raises one warning until it clears", "[HookServiceProfiler]")
+{
+    HookServiceProfiler p;
+    const uint32_t t[] = {1000};
+    p.configure(t, 1, 300000);
+    for (int i = 0; i < 50; ++i)
+        REQUIRE_FALSE(p.record(HookEventKind::MouseMove, 20));
+
+    REQUIRE(p.record(HookEventKind::Keyboard, 120000)); // ≥ timeout / 3
+    REQUIRE_FALSE(p.record(HookEventKind::Keyboard, 120000));
+    REQUIRE(p.snapshot().alarms == 1);
+
+    // Re-armed once the trend decays below timeout / 64.
+    int n = 0;
+    while (p.snapshot().trendUs >= 300000 / 64)
+    {
+        REQUIRE_FALSE(p.record(HookEventKind::MouseMove, 20));
+        ++n;
+    }
+    REQUIRE(n > 16);
+    REQUIRE(p.record(HookEventKind::MouseMove, 100000));
+    REQUIRE(p.snapshot().alarms == 2);
+}
+
+TEST_CASE("A sustained trend raises the warning before any spike", "[HookServiceProfiler]")
+{
+    HookServiceProfiler p;
+    const uint32_t t[] = {10000};
+    p.configure(t, 1, 300000);
+    int calls = 0;
+    bool raised = false;
+    while (!raised && calls < 200)
+    {
+        raised = p.record(HookEventKind::MouseWheel, 40000); // well below 100 ms
+        ++calls;
+    }
+    REQUIRE(raised);
+    REQUIRE(calls > 1);
+    REQUIRE(p.snapshot().trendUs >= 300000 / 16);
+    REQUIRE(p.snapshot().slow[0] == static_cast<uint64_t>(calls));
+
+    // A shorter configured timeout lowers both levels.
+    HookServiceProfiler tight;
+    tight.configure(t, 1, 30000);
+    REQUIRE(tight.record(HookEventKind::Keyboard, 10000));
+}
+
+TEST_CASE("Interval snapshots subtract, restarting slow counts on reconfigure", "[HookServiceProfiler]")
+{
+    HookServiceProfiler p;
+    p.record(HookEventKind::MouseMove, 2000);
+    const auto a = p.snapshot();
+    p.record(HookEventKind::MouseMove, 2000);
+    p.record(HookEventKind::Keyboard, 20000);
+    const auto b = p.snapshot();
+
+    const auto d = b.since(a);
+    REQUIRE(d.total().total() == 2);
+    REQUIRE(d.slow[0] == 2);
+    REQUIRE(d.slow[1] == 1);
+    REQUIRE(d.alarms == 0);
+
+    const uint32_t t[] = {1000, 10000};
+    p.configure(t, 2, 0);
+    p.record(HookEventKind::MouseMove, 2000);
+    const auto c = p.snapshot();
+    REQUIRE(c.generation != b.generation);
+    const auto e = c.since(b);
+    REQUIRE(e.slow[0] == 1); // not 1 − 3
+    REQUIRE(e.total().total() == 1);
+}
+
+TEST_CASE("Reapplying the same configuration keeps the slow counts", "[HookServiceProfiler]")
+{
+    HookServiceProfiler p;
+    p.record(HookEventKind::Keyboard, 20000);
+    const auto a = p.snapshot();
+
+    // An unrelated settings change republishes the same thresholds.
+    const uint32_t same[] = {100000, 1000, 10000};
+    REQUIRE_FALSE(p.configure(same, 3, 0));
+    const auto b = p.snapshot();
+    REQUIRE(b.generation == a.generation);
+    REQUIRE(b.slow[1] == 1);
+
+    REQUIRE(p.configure(same, 3, 200000)); // the timeout did change
+    REQUIRE(p.snapshot().slow[1] == 0);
+}
+
+TEST_CASE("A snapshot never pairs a generation with another's counts", "[HookServiceProfiler]")
+{
+    // The writer alternates configurations, recording slow callbacks in
+    // between; the reader's interval deltas must never wrap.
+    HookServiceProfiler p;
+    std::atomic<bool> done{false};
+    std::thread writer([&] {
+        const uint32_t a[] = {1000};
+        const uint32_t b[] = {2000};
+        for (int i = 0; i < 20000; ++i)
+        {
+            p.configure((i & 1) ? a : b, 1, 0);
+            for (int k = 0; k < 8; ++k)
+                p.record(HookEventKind::MouseMove, 5000);
+        }
+        done.store(true, std::memory_order_release);
+    });
+
+    bool wrapped = false;
+    auto prev = p.snapshot();
+    while (!done.load(std::memory_order_acquire))
+    {
+        const auto cur = p.snapshot();
+        wrapped |= (cur.generation & 1u) != 0 || cur.since(prev).slow[0] > 8;
+        prev = cur;
+    }
+    writer.join();
+    REQUIRE_FALSE(wrapped);
+}
+
+TEST_CASE("HookServiceProfiler record cost", "[HookServiceProfiler][!benchmark]")
+{
+    HookServiceProfiler p;
+    uint32_t v = 1;
+    BENCHMARK("record x1000")
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            v = v * 1103515245u + 12345u;
+            p.record(static_cast<HookEventKind>(v >> 30), (v >> 16) & 0x3FF);
+        }
+        return p.snapshot().alarms;
+    };
+}
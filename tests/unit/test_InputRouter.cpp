@@ -0,0 +1,504 @@
+// =============================================================================
+// Unit tests for InputRouter — Doc 3 §3.1, §3.2
+// Scripted key / wheel sequences against a scripted physical key state: the
+// Win-chord Start-Menu suppression, the Shift-mode WM_MOUSEHWHEEL flip and
+// consume rule, the toggle chord, the auto-repeat edge filters and the
+// consume rules, configured key bindings and the physical-state check of a
+// matched chord. A benchmark and a hidden report measure routing throughput.
+// Pure logic — no Win32 API dependencies.
+// =============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "smoothzoom/input/InputRouter.h"
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#ifndef _WIN32
+// Keys the tests press (ModifierUtils.h has the modifiers)
+#ifndef VK_ESCAPE
+#define VK_ESCAPE     0x1B
+#define VK_NUMPAD0    0x60
+#define VK_NUMPAD1    0x61
+#define VK_NUMPAD6    0x66
+#define VK_ADD        0x6B
+#define VK_SUBTRACT   0x6D
+#define VK_DECIMAL    0x6E
+#define VK_OEM_PLUS   0xBB
+#define VK_OEM_MINUS  0xBD
+#endif
+#endif
+
+using namespace SmoothZoom;
+
+namespace
+{
+
+// Scripted physical key state plus a router fed from it. press()/release()
+// update the physical state (including the generic VK, as GetAsyncKeyState
+// reports) before routing, the order the OS delivers them in.
+struct Rig
+{
+    InputRouter router;
+    std::array<bool, 256> down{};
+
+    static bool isDown(int vk, void* ctx)
+    {
+        return static_cast<Rig*>(ctx)->down[static_cast<size_t>(vk & 0xFF)];
+    }
+    KeyStateView keys() { return {isDown, this}; }
+
+    void setPhysical(int vk, bool isDown)
+    {
+        down[static_cast<size_t>(vk)] = isDown;
+        const int generic = toGenericVK(vk);
+        if (generic != vk)
+            down[static_cast<size_t>(generic)] = isDown;
+    }
+    RouterActions press(int vk)
+    {
+        setPhysical(vk, true);
+        return router.route({InputEventType::KeyDown, static_cast<uint32_t>(vk), 0}, keys());
+    }
+    RouterActions release(int vk)
+    {
+        setPhysical(vk, false);
+        return router.route({InputEventType::KeyUp, static_cast<uint32_t>(vk), 0}, keys());
+    }
+    RouterActions wheel(int16_t delta)
+    {
+        return router.route({InputEventType::Wheel, 0, delta}, keys());
+    }
+    RouterActions hwheel(int16_t delta)
+    {
+        return router.route({InputEventType::HWheel, 0, delta}, keys());
+    }
+};
+
+bool onlyCommand(const RouterActions& a, ZoomCommand c)
+{
+    return a.commandCount == 1 && a.commands[0] == c;
+}
+
+} // namespace
+
+TEST_CASE("Plain wheel and keys pass through untouched", "[InputRouter]")
+{
+    Rig rig;
+    const auto w = rig.wheel(120);
+    REQUIRE_FALSE(w.consume);
+    REQUIRE_FALSE(w.scroll);
+
+    const auto k = rig.press(VK_OEM_PLUS);
+    REQUIRE_FALSE(k.consume);
+    REQUIRE(k.commandCount == 0);
+    REQUIRE(k.keyboardActivity);
+    REQUIRE_FALSE(rig.release(VK_OEM_PLUS).consume);
+}
+
+TEST_CASE("Win+scroll zooms and suppresses the Start Menu on release", "[InputRouter]")
+{
+    Rig rig;
+    const auto down = rig.press(VK_LWIN);
+    REQUIRE_FALSE(down.keyboardActivity); // modifiers alone are not typing
+    REQUIRE_FALSE(down.consume);          // Win itself always passes through
+
+    const auto w = rig.wheel(-240);
+    REQUIRE(w.consume);
+    REQUIRE(w.scroll);
+    REQUIRE(w.scrollDelta == -240);
+    REQUIRE(rig.router.winKeys().state() == WinKeyManager::State::HeldUsed);
+
+    const auto up = rig.release(VK_LWIN);
+    REQUIRE(up.suppressStartMenu);
+    REQUIRE_FALSE(up.consume);
+    REQUIRE(rig.router.winKeys().state() == WinKeyManager::State::Idle);
+
+    // Tap without zooming: the Start Menu opens normally.
+    rig.press(VK_RWIN);
+    REQUIRE_FALSE(rig.release(VK_RWIN).suppressStartMenu);
+}
+
+TEST_CASE("A shell shortcut during the Win chord cancels suppression", "[InputRouter]")
+{
+    Rig rig;
+    rig.press(VK_LWIN);
+    rig.wheel(120);
+    rig.press('E');   // Win+E opens Explorer
+    rig.release('E');
+    REQUIRE_FALSE(rig.release(VK_LWIN).suppressStartMenu);
+
+    // SmoothZoom's own chord keys keep it.
+    rig.press(VK_LWIN);
+    REQUIRE(onlyCommand(rig.press(VK_OEM_MINUS), ZoomCommand::ZoomOut));
+    rig.release(VK_OEM_MINUS);
+    REQUIRE(onlyCommand(rig.press(VK_ESCAPE), ZoomCommand::ResetZoom));
+    rig.release(VK_ESCAPE);
+    REQUIRE(rig.release(VK_LWIN).suppressStartMenu);
+}
+
+TEST_CASE("Stale Win state without the physical key does not hijack scrolling", "[InputRouter]")
+{
+    // Win+L: the key-up lands on the secure desktop and never reaches the hook.
+    Rig rig;
+    rig.press(VK_LWIN);
+    rig.setPhysical(VK_LWIN, false);
+    REQUIRE(rig.router.winKeys().state() != WinKeyManager::State::Idle);
+    REQUIRE_FALSE(rig.wheel(120).consume);
+    REQUIRE_FALSE(rig.press(VK_OEM_PLUS).consume);
+}
+
+TEST_CASE("Zoom keys are consumed on down and up while the modifier is held", "[InputRouter]")
+{
+    Rig rig;
+    rig.router.configure(VK_LSHIFT, VK_LCONTROL, VK_LMENU);
+    rig.press(VK_LSHIFT);
+
+    const auto plus = rig.press(VK_OEM_PLUS);
+    REQUIRE(onlyCommand(plus, ZoomCommand::ZoomIn));
+    REQUIRE(plus.consume);
+    REQUIRE(rig.release(VK_OEM_PLUS).consume);
+    REQUIRE(onlyCommand(rig.press(VK_ADD), ZoomCommand::ZoomIn));
+    REQUIRE(onlyCommand(rig.press(VK_SUBTRACT), ZoomCommand::ZoomOut));
+
+    // Esc fires but passes through; other keys are never consumed.
+    const auto esc = rig.press(VK_ESCAPE);
+    REQUIRE(onlyCommand(esc, ZoomCommand::ResetZoom));
+    REQUIRE_FALSE(esc.consume);
+    REQUIRE_FALSE(rig.press('A').consume);
+
+    rig.release(VK_LSHIFT);
+    REQUIRE_FALSE(rig.press(VK_OEM_MINUS).consume);
+}
+
+TEST_CASE("Horizontal wheel is flipped and consumed only in Shift mode", "[InputRouter]")
+{
+    Rig rig;
+    rig.router.configure(VK_LSHIFT, VK_LCONTROL, VK_LMENU);
+    REQUIRE_FALSE(rig.hwheel(120).consume); // Shift not held
+
+    rig.press(VK_LSHIFT);
+    const auto h = rig.hwheel(120);
+    REQUIRE(h.consume);
+    REQUIRE(h.scroll);
+    REQUIRE(h.scrollDelta == -120);
+    REQUIRE(rig.hwheel(-32768).scrollDelta == 32768); // no int16 overflow
+    REQUIRE(rig.wheel(120).scrollDelta == 120);
+
+    // Any other modifier: horizontal scroll belongs to the application.
+    Rig ctrl;
+    ctrl.router.configure(VK_LCONTROL, VK_LSHIFT, VK_LMENU);
+    ctrl.press(VK_LCONTROL);
+    const auto passed = ctrl.hwheel(120);
+    REQUIRE_FALSE(passed.consume);
+    REQUIRE_FALSE(passed.scroll);
+    REQUIRE(ctrl.wheel(120).consume);
+}
+
+TEST_CASE("Non-Win modifier falls back to the physical key state", "[InputRouter]")
+{
+    // Touchpad drivers that scroll without delivering the modifier to the hook.
+    Rig rig;
+    rig.router.configure(VK_LCONTROL, VK_LSHIFT, VK_LMENU);
+    rig.setPhysical(VK_RCONTROL, true);
+    REQUIRE(rig.wheel(120).consume);
+    rig.setPhysical(VK_RCONTROL, false);
+    REQUIRE_FALSE(rig.wheel(120).consume);
+}
+
+TEST_CASE("Toggle chord engages once and releases on either key", "[InputRouter]")
+{
+    Rig rig;
+    REQUIRE(rig.press(VK_LCONTROL).commandCount == 0);
+    REQUIRE(onlyCommand(rig.press(VK_LMENU), ZoomCommand::ToggleEngage));
+    REQUIRE(rig.press(VK_LMENU).commandCount == 0); // auto-repeat
+    REQUIRE(onlyCommand(rig.release(VK_LCONTROL), ZoomCommand::ToggleRelease));
+    REQUIRE(rig.release(VK_LMENU).commandCount == 0);
+}
+
+TEST_CASE("Invert chord is edge-triggered under auto-repeat", "[InputRouter]")
+{
+    Rig rig;
+    rig.press(VK_LCONTROL);
+    rig.press(VK_LMENU);
+    REQUIRE(onlyCommand(rig.press('I'), ZoomCommand::ToggleInvert));
+    for (int i = 0; i < 20; ++i)
+        REQUIRE(rig.press('I').commandCount == 0);
+    REQUIRE_FALSE(rig.release('I').consume);
+    REQUIRE(onlyCommand(rig.press('I'), ZoomCommand::ToggleInvert));
+
+    // Not without both Ctrl and Alt.
+    rig.release('I');
+    rig.release(VK_LMENU);
+    REQUIRE(rig.press('I').commandCount == 0);
+}
+
+TEST_CASE("Numpad shortcuts fire once per press", "[InputRouter]")
+{
+    Rig rig;
+    rig.press(VK_LWIN);
+    const auto cycle = rig.press(VK_NUMPAD0);
+    REQUIRE(onlyCommand(cycle, ZoomCommand::CyclePreset));
+    REQUIRE(cycle.consume);
+    const auto repeat = rig.press(VK_NUMPAD0);
+    REQUIRE(repeat.commandCount == 0);
+    REQUIRE(repeat.consume);
+
+    // A different numpad key fires immediately, and re-arms the first.
+    REQUIRE(onlyCommand(rig.press(VK_NUMPAD1 + 2), ZoomCommand::JumpToPreset3));
+    REQUIRE(onlyCommand(rig.press(VK_NUMPAD0), ZoomCommand::CyclePreset));
+    rig.release(VK_NUMPAD0);
+    REQUIRE(onlyCommand(rig.press(VK_NUMPAD6), ZoomCommand::JumpToPreset6));
+    REQUIRE(onlyCommand(rig.press(VK_DECIMAL), ZoomCommand::ToggleDetach));
+    REQUIRE(rig.press(VK_DECIMAL).commandCount == 0);
+
+    // Plus/minus are not edge-filtered: auto-repeat keeps stepping.
+    REQUIRE(onlyCommand(rig.press(VK_OEM_PLUS), ZoomCommand::ZoomIn));
+    REQUIRE(onlyCommand(rig.press(VK_OEM_PLUS), ZoomCommand::ZoomIn));
+    REQUIRE(rig.release(VK_LWIN).suppressStartMenu);
+}
+
+TEST_CASE("Win+Ctrl+M opens settings only with a message window", "[InputRouter]")
+{
+    Rig rig;
+    rig.press(VK_LWIN);
+    rig.press(VK_LCONTROL);
+    REQUIRE_FALSE(rig.press('M').openSettings);
+    rig.release('M');
+
+    rig.router.setSettingsShortcutEnabled(true);
+    const auto m = rig.press('M');
+    REQUIRE(m.openSettings);
+    REQUIRE_FALSE(m.consume);
+    rig.release('M');
+    rig.release(VK_LCONTROL);
+    REQUIRE(rig.release(VK_LWIN).suppressStartMenu);
+
+    // Plain Ctrl+M is the application's.
+    rig.press(VK_LCONTROL);
+    REQUIRE_FALSE(rig.press('M').openSettings);
+}
+
+TEST_CASE("Reconfiguring and resetting clear held state", "[InputRouter]")
+{
+    Rig rig;
+    rig.press(VK_LWIN);
+    rig.press(VK_LCONTROL);
+    rig.press(VK_LMENU);
+    REQUIRE(onlyCommand(rig.router.resetTransient(), ZoomCommand::ToggleRelease));
+    REQUIRE(rig.router.winKeys().state() == WinKeyManager::State::Idle);
+    REQUIRE(rig.router.resetTransient().commandCount == 0);
+
+    // Keys still physically down re-engage only on a fresh press.
+    REQUIRE(rig.press(VK_LCONTROL).commandCount == 0);
+    REQUIRE(onlyCommand(rig.press(VK_LMENU), ZoomCommand::ToggleEngage));
+
+    // Hook-tracked modifier state is dropped on a settings change.
+    Rig alt;
+    alt.router.configure(VK_LSHIFT, VK_LCONTROL, VK_LMENU);
+    alt.router.route({InputEventType::KeyDown, VK_LSHIFT, 0}, alt.keys()); // hook-only
+    REQUIRE(alt.wheel(120).consume);
+    alt.router.configure(VK_LSHIFT, VK_LCONTROL, VK_LMENU);
+    REQUIRE_FALSE(alt.wheel(120).consume);
+}
+
+TEST_CASE("Configured bindings replace the defaults", "[InputRouter]")
+{
+    constexpr int kF2 = 0x71;
+    const KeyBinding custom[] = {
+        {ZoomCommand::ZoomIn, 'Z', kKeyModZoom | kKeyModShift},
+        {ZoomCommand::JumpToPreset2, kF2, kKeyModCtrl | kKeyModAlt},
+    };
+    Rig rig;
+    rig.router.configure(VK_LWIN, VK_LCONTROL, VK_LMENU, custom, 2);
+
+    rig.press(VK_LWIN);
+    REQUIRE(rig.press(VK_OEM_PLUS).commandCount == 0); // default unbound
+    REQUIRE(rig.press('Z').commandCount == 0);         // Shift missing
+    rig.press(VK_RSHIFT);
+    const auto z = rig.press('Z');
+    REQUIRE(onlyCommand(z, ZoomCommand::ZoomIn));
+    REQUIRE(z.consume);
+    rig.release(VK_RSHIFT);
+    rig.release('Z');
+    // Win+'+' went to the shell (its own Magnifier), so Start is not suppressed.
+    REQUIRE_FALSE(rig.release(VK_LWIN).suppressStartMenu);
+    rig.press(VK_LWIN);
+    rig.press(VK_LSHIFT);
+    rig.press('Z');
+    REQUIRE(rig.release(VK_LWIN).suppressStartMenu);
+    rig.release(VK_LSHIFT);
+
+    // Edge-triggered by command, not by key.
+    rig.press(VK_RCONTROL);
+    rig.press(VK_RMENU);
+    REQUIRE(onlyCommand(rig.press(kF2), ZoomCommand::JumpToPreset2));
+    REQUIRE(rig.press(kF2).commandCount == 0);
+
+    // No bindings at all.
+    Rig none;
+    none.router.configure(VK_LWIN, VK_LCONTROL, VK_LMENU, custom, 0);
+    none.press(VK_LWIN);
+    REQUIRE_FALSE(none.press(VK_OEM_PLUS).consume);
+    REQUIRE(none.wheel(120).consume); // scroll zoom is not a binding
+}
+
+TEST_CASE("One side of a modifier pair keeps the chord held", "[InputRouter]")
+{
+    Rig rig;
+    rig.press(VK_LCONTROL);
+    rig.press(VK_RCONTROL);
+    rig.press(VK_LMENU);
+    rig.release(VK_LCONTROL);
+    rig.down[VK_CONTROL] = true; // GetAsyncKeyState(VK_CONTROL) reports either side
+    REQUIRE(onlyCommand(rig.press('I'), ZoomCommand::ToggleInvert));
+}
+
+TEST_CASE("Unbound keys never query the physical key state", "[InputRouter]")
+{
+    struct Counting
+    {
+        std::array<bool, 256> down{};
+        int queries = 0;
+        static bool isDown(int vk, void* ctx)
+        {
+            auto* c = static_cast<Counting*>(ctx);
+            ++c->queries;
+            return c->down[static_cast<size_t>(vk & 0xFF)];
+        }
+    } state;
+    const KeyStateView keys{Counting::isDown, &state};
+    InputRouter router;
+    auto key = [&](InputEventType t, int vk) {
+        return router.route({t, static_cast<uint32_t>(vk), 0}, keys);
+    };
+
+    state.down[VK_LWIN] = true;
+    key(InputEventType::KeyDown, VK_LWIN);
+    const int unbound[] = {'A', 'E', 0x20 /* space */, '1', VK_NUMPAD1 + 8};
+    for (int vk : unbound)
+    {
+        key(InputEventType::KeyDown, vk);
+        key(InputEventType::KeyUp, vk);
+    }
+    REQUIRE(state.queries == 0);
+
+    REQUIRE(onlyCommand(key(InputEventType::KeyDown, VK_OEM_PLUS), ZoomCommand::ZoomIn));
+    REQUIRE(state.queries > 0);
+
+    // A stale tracked modifier is dropped once the physical check fails.
+    state.down[VK_LWIN] = false;
+    REQUIRE(key(InputEventType::KeyDown, VK_OEM_MINUS).commandCount == 0);
+    state.queries = 0;
+    key(InputEventType::KeyDown, VK_OEM_MINUS);
+    REQUIRE(state.queries == 0);
+}
+
+namespace
+{
+
+// Synthetic hook traffic: mostly wheel ticks and ordinary typing, with
+// modifier chords, zoom keys and numpad presets mixed in.
+std::vector<InputEvent> syntheticEvents(size_t n)
+{
+    static constexpr uint32_t kKeys[] = {
+        'A', 'E', 'I', 'M', VK_OEM_PLUS, VK_OEM_MINUS, VK_ADD, VK_ESCAPE,
+        VK_NUMPAD0, VK_NUMPAD1 + 3, VK_DECIMAL, VK_LWIN, VK_LCONTROL, VK_LMENU, VK_LSHIFT};
+    constexpr size_t kKeyCount = sizeof(kKeys) / sizeof(kKeys[0]);
+    std::vector<InputEvent> events;
+    events.reserve(n);
+    uint64_t s = 12345;
+    for (size_t i = 0; i < n; ++i)
+    {
+        s = s * 6364136223846793005ULL + 1442695040888963407ULL;
+        const uint32_t r = static_cast<uint32_t>(s >> 33);
+        switch (r % 4)
+        {
+        case 0: events.push_back({InputEventType::Wheel, 0, static_cast<int16_t>((r & 8) ? 120 : -120)}); break;
+        case 1: events.push_back({InputEventType::HWheel, 0, 120}); break;
+        case 2: events.push_back({InputEventType::KeyDown, kKeys[(r >> 4) % kKeyCount], 0}); break;
+        default: events.push_back({InputEventType::KeyUp, kKeys[(r >> 4) % kKeyCount], 0}); break;
+        }
+    }
+    return events;
+}
+
+struct Sink
+{
+    int64_t scroll = 0;
+    uint64_t consumed = 0;
+    uint64_t commands = 0;
+    void add(const RouterActions& a)
+    {
+        scroll += a.scrollDelta;
+        consumed += a.consume ? 1u : 0u;
+        commands += a.commandCount;
+    }
+};
+
+bool scriptedDown(int vk, void* ctx)
+{
+    // Physical state that tracks the script loosely: Win and Shift "held".
+    (void)ctx;
+    return vk == VK_LWIN || vk == VK_SHIFT;
+}
+
+} // namespace
+
+TEST_CASE("InputRouter throughput", "[InputRouter][!benchmark]")
+{
+    const std::vector<InputEvent> events = syntheticEvents(4096);
+    const KeyStateView keys{scriptedDown, nullptr};
+    InputRouter winRouter;
+    InputRouter shiftRouter;
+    shiftRouter.configure(VK_LSHIFT, VK_LCONTROL, VK_LMENU);
+
+    BENCHMARK("route x4096 (Win modifier)")
+    {
+        Sink sink;
+        for (const InputEvent& ev : events)
+            sink.add(winRouter.route(ev, keys));
+        return sink.scroll + static_cast<int64_t>(sink.consumed + sink.commands);
+    };
+    BENCHMARK("route x4096 (Shift modifier)")
+    {
+        Sink sink;
+        for (const InputEvent& ev : events)
+            sink.add(shiftRouter.route(ev, keys));
+        return sink.scroll + static_cast<int64_t>(sink.consumed + sink.commands);
+    };
+}
+
+// Events per second over a few million synthetic events, per modifier mode.
+// Hidden; run with:
+//   smoothzoom_tests "[.input-router-report]"
+TEST_CASE("InputRouter throughput report", "[.input-router-report]")
+{
+    constexpr size_t kEvents = 1u << 16;
+    constexpr int kPasses = 64; // ~4.2M events per mode
+    const std::vector<InputEvent> events = syntheticEvents(kEvents);
+    const KeyStateView keys{scriptedDown, nullptr};
+
+    std::printf("%-10s %12s %12s %10s\n", "modifier", "events", "Mevents/s", "ns/event");
+    const int modifiers[] = {VK_LWIN, VK_LSHIFT, VK_LCONTROL};
+    const char* names[] = {"win", "shift", "ctrl"};
+    for (int m = 0; m < 3; ++m)
+    {
+        InputRouter router;
+        router.configure(modifiers[m], VK_LCONTROL, VK_LMENU);
+        Sink sink;
+        const auto t0 = std::chrono::steady_clock::now();
+        for (int p = 0; p < kPasses; ++p)
+            for (const InputEvent& ev : events)
+                sink.add(router.route(ev, keys));
+        const double s = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - t0).count();
+        const double total = static_cast<double>(kEvents) * kPasses;
+        std::printf("%-10s %12.0f %12.1f %10.2f   (consumed %llu)\n", names[m], total,
+                    total / s / 1e6, s / total * 1e9,
+                    static_cast<unsigned long long>(sink.consumed));
+    }
+}
@@ -0,0 +1,169 @@
+// =============================================================================
+// Unit tests for KeyBindings — Doc 3 §3.1, §3.9
+// Chord parsing and formatting (round trip over every key name), rejected
+// chords, command names, and the compiled table: superset matching, the more
+// specific chord winning, "Modifier" resolution and skipped bindings.
+// Pure logic — no Win32 API dependencies.
+// =============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include "smoothzoom/input/KeyBindings.h"
+#include <string>
+
+using namespace SmoothZoom;
+
+namespace
+{
+
+KeyBinding chord(const char* s, ZoomCommand c = ZoomCommand::ZoomIn)
+{
+    KeyBinding b;
+    b.command = c;
+    REQUIRE(parseKeyChord(s, b));
+    return b;
+}
+
+} // namespace
+
+TEST_CASE("Chords parse case-insensitively", "[KeyBindings]")
+{
+    const KeyBinding plus = chord("Modifier+Plus");
+    REQUIRE(plus.vk == 0xBB);
+    REQUIRE(plus.mods == kKeyModZoom);
+
+    const KeyBinding m = chord("win+CTRL+m");
+    REQUIRE(m.vk == 'M');
+    REQUIRE(m.mods == (kKeyModWin | kKeyModCtrl));
+
+    REQUIRE(chord("Control+Alt+Shift+F12").vk == 0x7B);
+    REQUIRE(chord("Alt+numpad7").vk == 0x67);
+    REQUIRE(chord("Ctrl+0x5D").vk == 0x5D);
+    REQUIRE(chord("Shift+9").vk == '9');
+}
+
+TEST_CASE("Malformed chords are rejected", "[KeyBindings]")
+{
+    const char* bad[] = {
+        "", "Plus", "Modifier+", "+Plus", "Modifier++Plus", "Hyper+A", "Ctrl+Alt",
+        "Ctrl+Shift+0x10", "Ctrl+F25", "Ctrl+F0", "Ctrl+0x", "Ctrl+0x100", "Ctrl+Numpad", "Ctrl+AB",
+    };
+    for (const char* s : bad)
+    {
+        KeyBinding b;
+        INFO(s);
+        REQUIRE_FALSE(parseKeyChord(s, b));
+    }
+}
+
+TEST_CASE("Formatted chords parse back to the same binding", "[KeyBindings]")
+{
+    for (int vk = 1; vk < 256; ++vk)
+    {
+        if (keyModOfVK(vk) != 0)
+            continue;
+        KeyBinding b;
+        b.vk = static_cast<uint8_t>(vk);
+        b.mods = static_cast<uint8_t>(kKeyModZoom | (vk % 16));
+        KeyBinding back;
+        const std::string s = formatKeyChord(b);
+        INFO(s);
+        REQUIRE(parseKeyChord(s, back));
+        REQUIRE(back.vk == b.vk);
+        REQUIRE(back.mods == b.mods);
+    }
+    REQUIRE(formatKeyChord(kDefaultKeyBindings[0]) == "Modifier+Plus");
+    REQUIRE(formatKeyChord({ZoomCommand::OpenSettings, 'M', kKeyModWin | kKeyModCtrl}) == "Win+Ctrl+M");
+}
+
+TEST_CASE("Command names map both ways", "[KeyBindings]")
+{
+    for (const KeyCommandInfo& k : kKeyCommands)
+        REQUIRE(parseKeyCommand(k.name) == k.command);
+    REQUIRE(parseKeyCommand("ZOOMIN") == ZoomCommand::ZoomIn);
+    REQUIRE(parseKeyCommand("toggleEngage") == ZoomCommand::None);
+    REQUIRE(keyCommandInfo(ZoomCommand::TrayToggle) == nullptr);
+    for (int i = 0; i < kDefaultKeyBindingCount; ++i)
+        REQUIRE(keyCommandInfo(kDefaultKeyBindings[i].command) != nullptr);
+}
+
+TEST_CASE("A chord matches under any superset of its modifiers", "[KeyBindings]")
+{
+    KeyBindingTable t; // defaults, Win modifier
+    REQUIRE(t.size() == kDefaultKeyBindingCount);
+    REQUIRE(t.match(0xBB, 0) == nullptr);
+    REQUIRE(t.match(0xBB, kKeyModCtrl) == nullptr);
+    for (uint8_t m = 0; m < kKeyModMasks; ++m)
+    {
+        const auto* e = t.match(0xBB, m);
+        REQUIRE((e != nullptr) == ((m & kKeyModWin) != 0));
+        if (e != nullptr)
+        {
+            REQUIRE(e->command == ZoomCommand::ZoomIn);
+            REQUIRE(e->mods == kKeyModWin);
+            REQUIRE(e->consume);
+            REQUIRE_FALSE(e->edge);
+        }
+    }
+    REQUIRE(t.match('I', kKeyModCtrl) == nullptr);
+    REQUIRE(t.match('I', kKeyModCtrl | kKeyModAlt)->command == ZoomCommand::ToggleInvert);
+    REQUIRE(t.match('I', kKeyModCtrl | kKeyModAlt)->edge);
+    REQUIRE(t.bound('I'));
+    REQUIRE_FALSE(t.bound('E'));
+    REQUIRE(t.match(0x1B, kKeyModWin)->consume == false);
+    REQUIRE(t.match(0x1FF, kKeyModWin) == nullptr);
+}
+
+TEST_CASE("The chord requiring more modifiers wins", "[KeyBindings]")
+{
+    const KeyBinding list[] = {
+        chord("Ctrl+Alt+Shift+Z", ZoomCommand::ResetZoom),
+        chord("Ctrl+Z", ZoomCommand::ZoomIn),
+        chord("Ctrl+Alt+Z", ZoomCommand::ZoomOut),
+        chord("Alt+Shift+Z", ZoomCommand::ToggleDetach), // ties with Ctrl+Alt+Z: first wins
+    };
+    KeyBindingTable t;
+    t.compile(list, 4, VK_LWIN);
+    REQUIRE(t.match('Z', kKeyModCtrl)->command == ZoomCommand::ZoomIn);
+    REQUIRE(t.match('Z', kKeyModCtrl | kKeyModWin)->command == ZoomCommand::ZoomIn);
+    REQUIRE(t.match('Z', kKeyModCtrl | kKeyModAlt)->command == ZoomCommand::ZoomOut);
+    REQUIRE(t.match('Z', kKeyModAlt | kKeyModShift)->command == ZoomCommand::ToggleDetach);
+    REQUIRE(t.match('Z', kKeyModCtrl | kKeyModAlt | kKeyModShift)->command == ZoomCommand::ResetZoom);
+    REQUIRE(t.match('Z', kKeyModAlt) == nullptr);
+}
+
+TEST_CASE("Modifier resolves to the configured modifier's family", "[KeyBindings]")
+{
+    KeyBindingTable t;
+    t.compile(kDefaultKeyBindings, kDefaultKeyBindingCount, VK_RCONTROL);
+    REQUIRE(t.match(0xBB, kKeyModWin) == nullptr);
+    REQUIRE(t.match(0xBB, kKeyModCtrl)->mods == kKeyModCtrl);
+    REQUIRE(t.match('M', kKeyModWin | kKeyModCtrl)->command == ZoomCommand::OpenSettings);
+
+    t.compile(kDefaultKeyBindings, kDefaultKeyBindingCount, VK_SHIFT);
+    REQUIRE(t.match(0x60, kKeyModShift)->command == ZoomCommand::CyclePreset);
+
+    // Not a modifier: Win, as the router's default.
+    t.compile(kDefaultKeyBindings, kDefaultKeyBindingCount, 'A');
+    REQUIRE(t.match(0xBB, kKeyModWin) != nullptr);
+}
+
+TEST_CASE("Unusable bindings are skipped at compile time", "[KeyBindings]")
+{
+    const KeyBinding list[] = {
+        {ZoomCommand::ToggleEngage, 'A', kKeyModCtrl}, // not bindable
+        {ZoomCommand::ZoomIn, 'B', 0},                 // no modifier
+        {ZoomCommand::ZoomIn, VK_LSHIFT, kKeyModCtrl}, // modifier key
+        {ZoomCommand::ZoomIn, 0, kKeyModCtrl},
+        {ZoomCommand::ZoomOut, 'C', kKeyModCtrl},
+    };
+    KeyBindingTable t;
+    t.compile(list, 5, VK_LWIN);
+    REQUIRE(t.size() == 1);
+    REQUIRE_FALSE(t.bound('A'));
+    REQUIRE_FALSE(t.bound('B'));
+    REQUIRE(t.match('C', kKeyModCtrl)->command == ZoomCommand::ZoomOut);
+
+    t.compile(list, 0, VK_LWIN);
+    REQUIRE(t.size() == 0);
+    REQUIRE(t.match(0xBB, kKeyModWin) == nullptr);
+}
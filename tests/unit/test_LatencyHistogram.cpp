@@ -0,0 +1,97 @@
+// =============================================================================
+// Unit tests for LatencyHistogram — Doc 3 §3.1 (R-05)
+// Bucket boundaries, quantile / max bounds, interval deltas, and a concurrent
+// writer / reader (the input thread records while the main thread snapshots).
+// Pure logic — no Win32 API dependencies.
+// =============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include "smoothzoom/common/LatencyHistogram.h"
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+using namespace SmoothZoom;
+using H = LatencyHistogram;
+
+TEST_CASE("Values land in their log2 bucket", "[LatencyHistogram]")
+{
+    REQUIRE(H::bucketOf(0) == 0);
+    REQUIRE(H::bucketOf(1) == 1);
+    REQUIRE(H::bucketOf(2) == 2);
+    REQUIRE(H::bucketOf(3) == 2);
+    REQUIRE(H::bucketOf(4) == 3);
+    REQUIRE(H::bucketOf(1023) == 10);
+    REQUIRE(H::bucketOf(1024) == 11);
+    REQUIRE(H::bucketOf(UINT32_MAX) == H::kBuckets - 1);
+
+    // Every value is below its bucket's bound and at or above the previous one.
+    for (uint32_t v : {0u, 1u, 5u, 99u, 300u, 70000u, 1u << 21, (1u << 22) - 1})
+    {
+        const int b = H::bucketOf(v);
+        REQUIRE(v < H::upperBound(b));
+        if (b > 0)
+            REQUIRE(v >= H::upperBound(b - 1));
+    }
+    REQUIRE(H::upperBound(H::kBuckets - 1) == UINT32_MAX);
+}
+
+TEST_CASE("Quantile and max bounds", "[LatencyHistogram]")
+{
+    H h;
+    REQUIRE(h.snapshot().total() == 0);
+    REQUIRE(h.snapshot().quantileBound(0.99) == 0);
+    REQUIRE(h.snapshot().maxBound() == 0);
+
+    // 98 fast callbacks (3 µs), one slow (40 µs), one outlier (5 ms).
+    for (int i = 0; i < 98; ++i)
+        h.record(3);
+    h.record(40);
+    h.record(5000);
+
+    const auto c = h.snapshot();
+    REQUIRE(c.total() == 100);
+    REQUIRE(c.quantileBound(0.0) == 4);
+    REQUIRE(c.quantileBound(0.5) == 4);
+    REQUIRE(c.quantileBound(0.98) == 64);
+    REQUIRE(c.quantileBound(0.99) == 8192);
+    REQUIRE(c.quantileBound(1.0) == 8192);
+    REQUIRE(c.maxBound() == 8192);
+}
+
+TEST_CASE("Interval deltas between snapshots", "[LatencyHistogram]")
+{
+    H h;
+    for (int i = 0; i < 10; ++i)
+        h.record(1000);
+    const auto first = h.snapshot();
+    for (int i = 0; i < 5; ++i)
+        h.record(2);
+
+    const auto d = h.snapshot().since(first);
+    REQUIRE(d.total() == 5);
+    REQUIRE(d.maxBound() == 4); // the earlier 1000s are not in this interval
+}
+
+TEST_CASE("Snapshots taken during recording stay consistent", "[LatencyHistogram]")
+{
+    H h;
+    constexpr uint64_t kSamples = 200000;
+    std::atomic<bool> done{false};
+    std::thread writer([&] {
+        for (uint64_t i = 0; i < kSamples; ++i)
+            h.record(static_cast<uint32_t>(i % 5000));
+        done.store(true, std::memory_order_release);
+    });
+
+    uint64_t prevTotal = 0;
+    while (!done.load(std::memory_order_acquire))
+    {
+        const auto c = h.snapshot();
+        REQUIRE(c.total() >= prevTotal); // monotonic: counters only grow
+        REQUIRE(c.maxBound() <= 8192);
+        prevTotal = c.total();
+    }
+    writer.join();
+    REQUIRE(h.snapshot().total() == kSamples);
+}
@@ -0,0 +1,266 @@
+// =============================================================================
+// Unit tests for MonitorTable and per-monitor zoom scope — Doc 3 §3.6, AC-MM.04
+// Randomized multi-monitor layouts (mixed sizes, vertical offsets, negative
+// origins) check the cached lookup against a brute-force oracle, and that
+// active-monitor scope keeps every tracking mode's viewport on one monitor.
+// Pure logic — no Win32 API dependencies.
+// =============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_message.hpp>
+#include "smoothzoom/common/MonitorTable.h"
+#include "smoothzoom/logic/ViewportTracker.h"
+#include <algorithm>
+#include <cstdint>
+
+using namespace SmoothZoom;
+
+namespace
+{
+
+// Deterministic LCG so failures reproduce from the printed seed.
+struct Lcg
+{
+    uint64_t s;
+    uint32_t next()
+    {
+        s = s * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<uint32_t>(s >> 33);
+    }
+    int32_t range(int32_t lo, int32_t hi) // inclusive
+    {
+        return lo + static_cast<int32_t>(next() % static_cast<uint32_t>(hi - lo + 1));
+    }
+};
+
+// 1–6 monitors side by side, left to right from a negative origin, each
+// shifted vertically (so some sit above y = 0) — the shapes Windows produces
+// when a secondary display is arranged left of / above the primary.
+MonitorTable randomLayout(Lcg& rng)
+{
+    static constexpr int32_t kSizes[][2] = {
+        {1280, 1024}, {1920, 1080}, {2560, 1440}, {3840, 2160}, {1080, 1920}, {1366, 768}};
+    MonitorTable t;
+    const int n = rng.range(1, 6);
+    int32_t x = rng.range(-8000, 0);
+    for (int i = 0; i < n; ++i)
+    {
+        const auto& sz = kSizes[rng.range(0, 5)];
+        const int32_t y = rng.range(-2200, 1200);
+        t.add({x, y, x + sz[0], y + sz[1]});
+        x += sz[0] + (rng.range(0, 3) == 0 ? rng.range(1, 400) : 0); // occasional gap
+    }
+    return t;
+}
+
+int64_t distSq(const ScreenRect& r, int32_t x, int32_t y)
+{
+    const int64_t dx = x < r.left ? r.left - x : (x >= r.right ? x - (r.right - 1) : 0);
+    const int64_t dy = y < r.top ? r.top - y : (y >= r.bottom ? y - (r.bottom - 1) : 0);
+    return dx * dx + dy * dy;
+}
+
+bool offsetWithin(const ViewportTracker::Offset& off, const ScreenRect& m, float zoom)
+{
+    const auto b = ViewportTracker::offsetBounds(zoom, m.width(), m.height(), m.left, m.top);
+    constexpr float kTol = 0.5f; // whole-pixel rounding of EdgePush / Centered
+    return off.x >= b.minX - kTol && off.x <= b.maxX + kTol
+        && off.y >= b.minY - kTol && off.y <= b.maxY + kTol;
+}
+
+} // namespace
+
+TEST_CASE("MonitorTable: empty table and capacity", "[MonitorTable]")
+{
+    MonitorTable t;
+    const ScreenRect fallback{-10, -10, 10, 10};
+    REQUIRE(t.indexAt(0, 0) == -1);
+    REQUIRE(t.monitorAt(0, 0, fallback).left == -10);
+    REQUIRE(t.bounds().width() == 0);
+
+    REQUIRE_FALSE(t.add({0, 0, 0, 100})); // empty rects are ignored
+    for (size_t i = 0; i < MonitorTable::kMaxMonitors; ++i)
+        REQUIRE(t.add({int32_t(i) * 100, 0, int32_t(i) * 100 + 100, 100}));
+    REQUIRE_FALSE(t.add({5000, 0, 5100, 100}));
+    REQUIRE(t.count == MonitorTable::kMaxMonitors);
+}
+
+TEST_CASE("MonitorTable: lookup matches brute force on random layouts", "[MonitorTable]")
+{
+    for (uint64_t seed = 1; seed <= 200; ++seed)
+    {
+        Lcg rng{seed};
+        const MonitorTable t = randomLayout(rng);
+        const ScreenRect vd = t.bounds();
+        INFO("seed " << seed << " monitors " << t.count);
+
+        // Points on every monitor, including its corners, map to that monitor.
+        for (uint32_t i = 0; i < t.count; ++i)
+        {
+            const ScreenRect& m = t.rects[i];
+            REQUIRE(t.indexAt(m.left, m.top) == int(i));
+            REQUIRE(t.indexAt(m.right - 1, m.bottom - 1) == int(i));
+            for (int k = 0; k < 20; ++k)
+                REQUIRE(t.indexAt(rng.range(m.left, m.right - 1),
+                                  rng.range(m.top, m.bottom - 1)) == int(i));
+        }
+
+        // Anywhere on (or past) the virtual desktop: the nearest monitor.
+        for (int k = 0; k < 200; ++k)
+        {
+            const int32_t x = rng.range(vd.left - 500, vd.right + 500);
+            const int32_t y = rng.range(vd.top - 500, vd.bottom + 500);
+            const int idx = t.indexAt(x, y);
+            REQUIRE(idx >= 0);
+            for (uint32_t i = 0; i < t.count; ++i)
+                REQUIRE(distSq(t.rects[static_cast<size_t>(idx)], x, y) <= distSq(t.rects[i], x, y));
+        }
+
+        // Bounds are the union of all monitors.
+        for (uint32_t i = 0; i < t.count; ++i)
+        {
+            const ScreenRect& m = t.rects[i];
+            REQUIRE(vd.left <= m.left);
+            REQUIRE(vd.top <= m.top);
+            REQUIRE(vd.right >= m.right);
+            REQUIRE(vd.bottom >= m.bottom);
+        }
+        REQUIRE(vd.left == t.rects[0].left);
+    }
+}
+
+TEST_CASE("scopeRegion: unified keeps the virtual desktop, active picks the monitor",
+          "[MonitorTable][ZoomScope]")
+{
+    MonitorTable t;
+    t.add({-1920, -300, 0, 780});
+    t.add({0, 0, 2560, 1440});
+    const ScreenRect vd = t.bounds();
+
+    const ScreenRect u = ViewportTracker::scopeRegion(ZoomScope::Unified, t, vd, -100, 100);
+    REQUIRE(u.left == vd.left);
+    REQUIRE(u.right == vd.right);
+    REQUIRE(u.top == vd.top);
+    REQUIRE(u.bottom == vd.bottom);
+
+    const ScreenRect a = ViewportTracker::scopeRegion(ZoomScope::ActiveMonitor, t, vd, -100, 100);
+    REQUIRE(a.left == -1920);
+    REQUIRE(a.top == -300);
+    const ScreenRect b = ViewportTracker::scopeRegion(ZoomScope::ActiveMonitor, t, vd, 100, 1300);
+    REQUIRE(b.left == 0);
+    REQUIRE(b.bottom == 1440);
+
+    // Nothing cached yet (first frame before the main thread publishes).
+    const ScreenRect e = ViewportTracker::scopeRegion(ZoomScope::ActiveMonitor, MonitorTable{},
+                                                      vd, 100, 100);
+    REQUIRE(e.left == vd.left);
+    REQUIRE(e.right == vd.right);
+}
+
+TEST_CASE("Active-monitor scope keeps every tracking mode on the pointer's monitor",
+          "[MonitorTable][ZoomScope]")
+{
+    const PointerTrackingMode modes[] = {PointerTrackingMode::Continuous,
+                                         PointerTrackingMode::EdgePush,
+                                         PointerTrackingMode::Centered};
+    for (PointerTrackingMode mode : modes)
+        for (uint64_t seed = 1; seed <= 60; ++seed)
+        {
+            Lcg rng{seed * 977};
+            const MonitorTable t = randomLayout(rng);
+            const ScreenRect vd = t.bounds();
+            ViewportTracker vt;
+            vt.setPointerTracking(mode, {});
+            INFO("mode " << int(mode) << " seed " << seed);
+
+            // The pointer wanders and hops between monitors; each frame continues
+            // from the previous frame's offset, as RenderLoop does.
+            ViewportTracker::Offset applied{static_cast<float>(vd.left),
+                                            static_cast<float>(vd.top)};
+            float appliedZoom = 1.0f;
+            int32_t px = t.rects[0].left, py = t.rects[0].top;
+            for (int frame = 0; frame < 400; ++frame)
+            {
+                if (frame % 40 == 0)
+                {
+                    const ScreenRect& m = t.rects[rng.next() % t.count];
+                    px = rng.range(m.left, m.right - 1);
+                    py = rng.range(m.top, m.bottom - 1);
+                }
+                else
+                {
+                    px += rng.range(-30, 30);
+                    py += rng.range(-30, 30);
+                }
+                const ScreenRect mon = t.monitorAt(px, py, vd);
+                px = std::clamp(px, mon.left, mon.right - 1); // the cursor can't leave the desktop
+                py = std::clamp(py, mon.top, mon.bottom - 1);
+                const float zoom = 1.0f + static_cast<float>(rng.range(0, 900)) / 100.0f;
+
+                const ScreenRect region =
+                    ViewportTracker::scopeRegion(ZoomScope::ActiveMonitor, t, vd, px, py);
+                const auto off = vt.trackPointer(px, py, zoom, applied, appliedZoom, 1.0f / 60.0f,
+                                                 region.width(), region.height(),
+                                                 region.left, region.top, &mon);
+                INFO("frame " << frame << " ptr " << px << "," << py << " zoom " << zoom);
+                REQUIRE(offsetWithin(off, mon, zoom));
+                applied = off;
+                appliedZoom = zoom;
+            }
+        }
+}
+
+TEST_CASE("Unified scope reproduces the virtual-desktop mapping", "[MonitorTable][ZoomScope]")
+{
+    for (uint64_t seed = 1; seed <= 50; ++seed)
+    {
+        Lcg rng{seed * 31};
+        const MonitorTable t = randomLayout(rng);
+        const ScreenRect vd = t.bounds();
+        for (int k = 0; k < 50; ++k)
+        {
+            const int32_t px = rng.range(vd.left, vd.right - 1);
+            const int32_t py = rng.range(vd.top, vd.bottom - 1);
+            const float zoom = 1.0f + static_cast<float>(rng.range(0, 900)) / 100.0f;
+            const ScreenRect region =
+                ViewportTracker::scopeRegion(ZoomScope::Unified, t, vd, px, py);
+            const auto scoped = ViewportTracker::computePointerOffset(
+                px, py, zoom, region.width(), region.height(), region.left, region.top);
+            const auto legacy = ViewportTracker::computePointerOffset(
+                px, py, zoom, vd.width(), vd.height(), vd.left, vd.top);
+            REQUIRE(scoped.x == legacy.x);
+            REQUIRE(scoped.y == legacy.y);
+        }
+    }
+}
+
+TEST_CASE("Focus and caret offsets stay on the element's monitor", "[MonitorTable][ZoomScope]")
+{
+    for (uint64_t seed = 1; seed <= 100; ++seed)
+    {
+        Lcg rng{seed * 7919};
+        const MonitorTable t = randomLayout(rng);
+        const ScreenRect vd = t.bounds();
+        INFO("seed " << seed);
+        for (int k = 0; k < 30; ++k)
+        {
+            const ScreenRect& m = t.rects[rng.next() % t.count];
+            const int32_t ex = rng.range(m.left, m.right - 40);
+            const int32_t ey = rng.range(m.top, m.bottom - 20);
+            const ScreenRect elem{ex, ey, ex + rng.range(2, 400), ey + rng.range(12, 200)};
+            const float zoom = 1.0f + static_cast<float>(rng.range(0, 900)) / 100.0f;
+            const ScreenPoint c = elem.center();
+            const ScreenRect em = t.monitorAt(c.x, c.y, vd);
+            // Start from an offset on some other part of the desktop.
+            const float curX = static_cast<float>(rng.range(vd.left, vd.right));
+            const float curY = static_cast<float>(rng.range(vd.top, vd.bottom));
+
+            const auto focus = ViewportTracker::computeFocusOffset(
+                curX, curY, elem, zoom, em.width(), em.height(), em.left, em.top);
+            REQUIRE(offsetWithin(focus, em, zoom));
+            const auto caret = ViewportTracker::computeCaretFollowOffset(
+                curX, curY, elem, {0.15f, 0.0f}, zoom, em.width(), em.height(), em.left, em.top);
+            REQUIRE(offsetWithin(caret, em, zoom));
+        }
+    }
+}
@@ -0,0 +1,208 @@
+// =============================================================================
+// Unit tests for PointerDamper — Doc 5 R-19
+// Slow pointer motion must map linearly, fast motion must be spread over time
+// at high zoom, and the damped pointer must land exactly on the pointer once
+// it stops. Traces replay 800/1600/3200 DPI mouse reports.
+// Pure logic — no Win32 API dependencies.
+// =============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_message.hpp>
+#include "smoothzoom/logic/PointerDamper.h"
+#include "smoothzoom/logic/PointerTrackingSim.h"
+#include <cmath>
+
+using namespace SmoothZoom;
+using Catch::Approx;
+
+namespace
+{
+
+PointerDamper enabledDamper(int32_t x, int32_t y)
+{
+    PointerDamper d;
+    d.setEnabled(true);
+    d.reset(x, y);
+    return d;
+}
+
+} // namespace
+
+TEST_CASE("Damping table: off below 4x, knee falls and rate slows with zoom",
+          "[PointerDamper]")
+{
+    float knee = 0.0f, rate = 0.0f;
+    REQUIRE_FALSE(pointerDampingAt(1.0f, knee, rate));
+    REQUIRE_FALSE(pointerDampingAt(3.9f, knee, rate));
+
+    REQUIRE(pointerDampingAt(4.0f, knee, rate));
+    REQUIRE(knee == Approx(12000.0f / 3.0f));
+    REQUIRE(rate == Approx(40.0f));
+
+    REQUIRE(pointerDampingAt(7.0f, knee, rate)); // halfway between 6× and 8×
+    REQUIRE(knee == Approx(5000.0f / 6.0f));
+    REQUIRE(rate == Approx(18.0f));
+
+    float prevKnee = 1e9f, prevRate = 1e9f;
+    for (float z = 4.0f; z <= 20.0f; z += 0.5f)
+    {
+        REQUIRE(pointerDampingAt(z, knee, rate));
+        REQUIRE(knee < prevKnee);
+        REQUIRE(rate <= prevRate);
+        prevKnee = knee;
+        prevRate = rate;
+    }
+}
+
+TEST_CASE("Disabled or low-zoom damper is a pass-through", "[PointerDamper]")
+{
+    PointerDamper off;
+    REQUIRE_FALSE(off.enabled());
+    off.reset(100, 100);
+    auto p = off.update(1900, 1000, 10.0f, 1.0f / 60.0f);
+    REQUIRE(p.x == 1900);
+    REQUIRE(p.y == 1000);
+
+    PointerDamper low = enabledDamper(100, 100);
+    p = low.update(1900, 1000, 3.0f, 1.0f / 60.0f);
+    REQUIRE(p.x == 1900);
+    REQUIRE(p.y == 1000);
+}
+
+TEST_CASE("Slow movement below the knee maps linearly with no lag", "[PointerDamper]")
+{
+    for (float zoom : {4.0f, 8.0f, 10.0f})
+    {
+        float knee = 0.0f, rate = 0.0f;
+        REQUIRE(pointerDampingAt(zoom, knee, rate));
+        for (float hz : {60.0f, 144.0f, 240.0f})
+        {
+            INFO("zoom " << zoom << " hz " << hz);
+            PointerDamper d = enabledDamper(200, 500);
+            // 80% of the knee, so whole-pixel frame steps stay under it too.
+            float x = 200.0f;
+            for (int i = 0; i < static_cast<int>(hz); ++i)
+            {
+                x += 0.8f * knee / hz;
+                auto p = d.update(static_cast<int32_t>(x), 500, zoom, 1.0f / hz);
+                REQUIRE(p.x == static_cast<int32_t>(x));
+            }
+        }
+    }
+}
+
+TEST_CASE("A jump glides and lands exactly within the closed-form bound",
+          "[PointerDamper]")
+{
+    const float zoom = 10.0f;
+    float knee = 0.0f, rate = 0.0f;
+    REQUIRE(pointerDampingAt(zoom, knee, rate));
+    const float gap = 1500.0f;
+    const float bound = std::log(1.0f + rate * gap / knee) / rate;
+
+    PointerDamper d = enabledDamper(200, 500);
+    const float dt = 1.0f / 144.0f;
+    float t = 0.0f;
+    int32_t prev = 200;
+    ScreenPoint p{200, 500};
+    while (!d.settled(1700, 500) && t < 2.0f)
+    {
+        p = d.update(1700, 500, zoom, dt);
+        t += dt;
+        REQUIRE(p.x >= prev); // monotonic, no overshoot
+        REQUIRE(p.x <= 1700);
+        prev = p.x;
+    }
+    REQUIRE(p.x == 1700);
+    REQUIRE(p.y == 500);
+    REQUIRE(t <= bound + dt);
+    REQUIRE(t > 0.1f); // spread over well more than a frame
+}
+
+TEST_CASE("Glide takes the same wall time at any refresh rate", "[PointerDamper]")
+{
+    auto posAt = [](float hz, float seconds) {
+        PointerDamper d = enabledDamper(0, 0);
+        ScreenPoint p{0, 0};
+        for (int i = 0; i < static_cast<int>(seconds * hz + 0.5f); ++i)
+            p = d.update(1200, 0, 8.0f, 1.0f / hz);
+        return p.x;
+    };
+    const int32_t ref = posAt(960.0f, 0.1f);
+    REQUIRE(ref > 0);
+    REQUIRE(ref < 1200);
+    for (float hz : {30.0f, 60.0f, 120.0f, 240.0f}) // whole frames in 100 ms
+    {
+        INFO("hz=" << hz);
+        REQUIRE(std::abs(posAt(hz, 0.1f) - ref) <= 1);
+    }
+}
+
+TEST_CASE("Damping spreads fast pans at 8-10x on 800/1600/3200 DPI traces",
+          "[PointerDamper][PointerTrackingSim]")
+{
+    for (int32_t dpi : {800, 1600, 3200})
+    {
+        auto trace = synthesizeMouseTrace(dpi, 144.0f, 30.0f, 1920, 1080);
+        REQUIRE(trace.size() >= 4000);
+        for (float zoom : {8.0f, 10.0f})
+        {
+            PointerTrackingSimParams p;
+            p.zoom = zoom;
+            auto plain = simulatePointerTracking(trace.data(), trace.size(), p);
+            p.damping = true;
+            auto damped = simulatePointerTracking(trace.data(), trace.size(), p);
+            INFO("dpi " << dpi << " zoom " << zoom << ": max frame pan " << plain.maxFramePanPx
+                 << " -> " << damped.maxFramePanPx << " px");
+            REQUIRE(damped.maxFramePanPx * 2.0f < plain.maxFramePanPx);
+            // Same destinations: total travel is not inflated by the glide.
+            REQUIRE(damped.viewportTravelPx <= plain.viewportTravelPx * 1.01f);
+        }
+    }
+}
+
+TEST_CASE("Damping leaves 2x and slow reading traces untouched",
+          "[PointerDamper][PointerTrackingSim]")
+{
+    auto mouse = synthesizeMouseTrace(1600, 144.0f, 10.0f, 1920, 1080);
+    auto reading = synthesizePointerTrace(PointerTraceKind::Reading, 144.0f, 10.0f, 1920, 1080);
+    PointerTrackingSimParams p;
+    p.zoom = 2.0f;
+    auto plain = simulatePointerTracking(mouse.data(), mouse.size(), p);
+    p.damping = true;
+    auto damped = simulatePointerTracking(mouse.data(), mouse.size(), p);
+    REQUIRE(damped.transformCalls == plain.transformCalls);
+    REQUIRE(damped.viewportTravelPx == plain.viewportTravelPx);
+
+    p.zoom = 4.0f;
+    auto r = simulatePointerTracking(reading.data(), reading.size(), p);
+    p.damping = false;
+    auto rPlain = simulatePointerTracking(reading.data(), reading.size(), p);
+    REQUIRE(r.viewportTravelPx == rPlain.viewportTravelPx);
+    REQUIRE(r.pointerOffscreenFrames == 0);
+}
+
+TEST_CASE("Mouse traces scale hand motion by DPI", "[PointerTrackingSim]")
+{
+    auto a = synthesizeMouseTrace(800, 144.0f, 5.0f, 1920, 1080, 9);
+    auto b = synthesizeMouseTrace(800, 144.0f, 5.0f, 1920, 1080, 9);
+    REQUIRE(a.size() == b.size());
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        REQUIRE(a[i].x == b[i].x);
+        REQUIRE(a[i].y == b[i].y);
+        REQUIRE(a[i].x >= 0);
+        REQUIRE(a[i].x < 1920);
+    }
+
+    // First reach from the center, before any screen clamp: twice the DPI,
+    // twice the pointer travel.
+    auto lo = synthesizeMouseTrace(800, 1000.0f, 0.1f, 100000, 100000, 9);
+    auto hi = synthesizeMouseTrace(1600, 1000.0f, 0.1f, 100000, 100000, 9);
+    REQUIRE(lo.size() == hi.size());
+    const float dLo = std::hypot(lo.back().x - 50000.0f, lo.back().y - 50000.0f);
+    const float dHi = std::hypot(hi.back().x - 50000.0f, hi.back().y - 50000.0f);
+    REQUIRE(dLo > 10.0f);
+    REQUIRE(dHi == Approx(2.0f * dLo).margin(3.0f));
+}
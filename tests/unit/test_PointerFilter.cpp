@@ -0,0 +1,270 @@
+// =============================================================================
+// Unit tests for PointerFilter — AC-2.4.09–AC-2.4.11, Doc 3 §3.6
+// The One-Euro filter that replaced the fixed 3 px deadzone must suppress
+// tremor at rest better than the deadzone did, move smoothly (no stair-steps)
+// during slow motion, add only a few ms of latency during fast motion, and
+// land exactly on the pointer once it stops. Each metric is measured against
+// the legacy deadzone on the same synthetic noisy trace.
+// Pure logic — no Win32 API dependencies.
+// =============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_message.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "smoothzoom/logic/PointerFilter.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+using namespace SmoothZoom;
+using Catch::Approx;
+
+namespace
+{
+
+struct Lcg
+{
+    uint32_t s;
+    float next() // [0, 1)
+    {
+        s = s * 1664525u + 1013904223u;
+        return static_cast<float>(s >> 8) / 16777216.0f;
+    }
+    // Approximately unit-variance noise (sum of four uniforms).
+    float noise()
+    {
+        float a = next() + next() + next() + next();
+        return (a - 2.0f) * 1.732f;
+    }
+};
+
+// Pre-change pointer stage: commit the raw position once it is more than
+// 3·monHeight/1080 px from the last committed one.
+struct LegacyDeadzone
+{
+    int32_t x = 0, y = 0;
+    bool init = false;
+    ScreenPoint update(int32_t rx, int32_t ry, float /*dt*/, float scale)
+    {
+        const int32_t dz = std::max(1, static_cast<int32_t>(3.0f * scale));
+        if (!init)
+        {
+            x = rx;
+            y = ry;
+            init = true;
+        }
+        const int32_t dx = rx - x, dy = ry - y;
+        if (dx * dx + dy * dy > dz * dz)
+        {
+            x = rx;
+            y = ry;
+        }
+        return {x, y};
+    }
+};
+
+struct TraceStats
+{
+    float jitterPxPerSec = 0.0f; // output motion beyond the true motion
+    float maxStepPx = 0.0f;      // largest single-frame output step
+    float lagMs = 0.0f;          // mean lag behind the true position
+};
+
+// Hand moving right at `speed` (1080p px/s) with Gaussian-like sensor/tremor
+// noise of `noisePx` σ, on a monitor `scale`× 1080p, sampled at `hz` for 4 s.
+// The first second is a warm-up and isn't measured.
+template <typename Stage>
+TraceStats runTrace(Stage& stage, float speed, float noisePx, float hz, float scale = 1.0f)
+{
+    Lcg rng{7};
+    const float dt = 1.0f / hz;
+    float x = 500.0f * scale;
+    const float y = 500.0f * scale;
+    const int frames = static_cast<int>(hz * 4.0f);
+    const int warmup = static_cast<int>(hz);
+
+    TraceStats st;
+    double moved = 0.0, lag = 0.0;
+    ScreenPoint prev{};
+    for (int i = 0; i < frames; ++i)
+    {
+        x += speed * scale * dt;
+        const int32_t rx = static_cast<int32_t>(std::lround(x + noisePx * scale * rng.noise()));
+        const int32_t ry = static_cast<int32_t>(std::lround(y + noisePx * scale * rng.noise()));
+        const ScreenPoint out = stage.update(rx, ry, dt, scale);
+        if (i > warmup)
+        {
+            const float step = std::abs(static_cast<float>(out.x - prev.x))
+                             + std::abs(static_cast<float>(out.y - prev.y));
+            moved += step;
+            st.maxStepPx = std::max(st.maxStepPx, step);
+            lag += x - static_cast<float>(out.x);
+        }
+        prev = out;
+    }
+    const float seconds = static_cast<float>(frames - warmup - 1) / hz;
+    st.jitterPxPerSec = static_cast<float>(moved / seconds) - speed * scale;
+    if (speed > 0.0f)
+        st.lagMs = static_cast<float>(lag / (frames - warmup - 1)) / (speed * scale) * 1000.0f;
+    return st;
+}
+
+TraceStats runFilter(float speed, float noisePx, float hz, float scale = 1.0f)
+{
+    PointerFilter f;
+    return runTrace(f, speed, noisePx, hz, scale);
+}
+
+TraceStats runDeadzone(float speed, float noisePx, float hz, float scale = 1.0f)
+{
+    LegacyDeadzone d;
+    return runTrace(d, speed, noisePx, hz, scale);
+}
+
+} // namespace
+
+TEST_CASE("First sample passes through; a still pointer is reached exactly",
+          "[PointerFilter]")
+{
+    PointerFilter f;
+    auto p = f.update(800, 600, 1.0f / 144.0f);
+    REQUIRE(p.x == 800);
+    REQUIRE(p.y == 600);
+
+    // Jump and hold: converges onto the raw pointer with zero residual error.
+    for (int i = 0; i < 144 * 3; ++i)
+        p = f.update(840, 620, 1.0f / 144.0f);
+    REQUIRE(p.x == 840);
+    REQUIRE(p.y == 620);
+    REQUIRE(f.filteredX() == Approx(840.0f).margin(0.01));
+}
+
+TEST_CASE("Zero dt leaves the filter state unchanged", "[PointerFilter]")
+{
+    PointerFilter f;
+    f.reset(100, 100);
+    auto p = f.update(500, 500, 0.0f);
+    REQUIRE(p.x == 100);
+    REQUIRE(p.y == 100);
+}
+
+TEST_CASE("Cutoff rises with speed: smoothing strong at rest, weak when fast",
+          "[PointerFilter]")
+{
+    const float dt = 1.0f / 144.0f;
+    PointerFilter::Params p;
+    const float atRest = PointerFilter::alpha(p.minCutoffHz, dt);
+    const float fast = PointerFilter::alpha(p.minCutoffHz + p.beta * 3000.0f, dt);
+    REQUIRE(atRest < 0.05f);
+    REQUIRE(fast > 0.7f);
+    REQUIRE(PointerFilter::alpha(1.0f, 0.0f) == 0.0f);
+}
+
+TEST_CASE("Tremor at rest is suppressed far better than by the deadzone",
+          "[PointerFilter]")
+{
+    for (float scale : {1.0f, 2.0f})
+    {
+        auto euro = runFilter(0.0f, 1.0f, 144.0f, scale);
+        auto dz = runDeadzone(0.0f, 1.0f, 144.0f, scale);
+        INFO("scale " << scale << ": filter " << euro.jitterPxPerSec << " px/s, deadzone "
+             << dz.jitterPxPerSec << " px/s");
+        REQUIRE(euro.jitterPxPerSec * 3.0f < dz.jitterPxPerSec);
+        REQUIRE(euro.maxStepPx <= 2.0f);
+    }
+}
+
+TEST_CASE("Slow motion moves smoothly instead of in deadzone stair-steps",
+          "[PointerFilter]")
+{
+    for (float speed : {20.0f, 60.0f})
+    {
+        auto euro = runFilter(speed, 0.5f, 144.0f);
+        auto dz = runDeadzone(speed, 0.5f, 144.0f);
+        INFO("speed " << speed << ": filter step " << euro.maxStepPx << " px, deadzone "
+             << dz.maxStepPx << " px");
+        REQUIRE(euro.maxStepPx <= 2.0f);
+        REQUIRE(dz.maxStepPx >= 4.0f);
+        // Lag stays within two pixels of travel at these speeds.
+        REQUIRE(euro.lagMs * speed / 1000.0f < 2.0f);
+    }
+}
+
+TEST_CASE("Fast motion passes through with only a few ms of latency",
+          "[PointerFilter]")
+{
+    for (float hz : {60.0f, 144.0f, 240.0f})
+    {
+        for (float speed : {1500.0f, 3000.0f})
+        {
+            auto euro = runFilter(speed, 1.0f, hz);
+            INFO("hz " << hz << " speed " << speed << ": lag " << euro.lagMs << " ms");
+            REQUIRE(euro.lagMs < 5.0f);
+        }
+    }
+}
+
+TEST_CASE("Per-monitor scaling: same hand motion filters the same at 4K",
+          "[PointerFilter]")
+{
+    for (float speed : {0.0f, 60.0f, 1500.0f})
+    {
+        auto hd = runFilter(speed, 1.0f, 144.0f, 1.0f);
+        auto uhd = runFilter(speed, 1.0f, 144.0f, 2.0f);
+        INFO("speed " << speed << ": lag " << hd.lagMs << " vs " << uhd.lagMs << " ms");
+        REQUIRE(uhd.lagMs == Approx(hd.lagMs).margin(1.0f));
+    }
+}
+
+TEST_CASE("Smoothing is defined in wall time, not frames", "[PointerFilter]")
+{
+    // A sampled ramp inherently trails by about half a frame more at lower
+    // rates; beyond that the lag must match the 1 kHz reference.
+    const float ref = runFilter(300.0f, 0.0f, 1000.0f).lagMs;
+    for (float hz : {60.0f, 120.0f, 144.0f, 240.0f})
+    {
+        const float halfFrameMs = 500.0f / hz;
+        INFO("hz " << hz << ": " << runFilter(300.0f, 0.0f, hz).lagMs << " ms vs " << ref);
+        REQUIRE(std::abs(runFilter(300.0f, 0.0f, hz).lagMs - ref) <= halfFrameMs + 1.0f);
+    }
+}
+
+TEST_CASE("PointerFilter per-frame cost", "[PointerFilter][!benchmark]")
+{
+    BENCHMARK("One-Euro x1000")
+    {
+        PointerFilter f;
+        ScreenPoint p{};
+        for (int i = 0; i < 1000; ++i)
+            p = f.update(500 + i % 37, 400 + i % 23, 1.0f / 144.0f);
+        return p.x + p.y;
+    };
+    BENCHMARK("Legacy deadzone x1000")
+    {
+        LegacyDeadzone d;
+        ScreenPoint p{};
+        for (int i = 0; i < 1000; ++i)
+            p = d.update(500 + i % 37, 400 + i % 23, 1.0f / 144.0f, 1.0f);
+        return p.x + p.y;
+    };
+}
+
+// Human-readable latency/jitter table, filter vs deadzone:
+//   smoothzoom_tests "[.pointer-filter-report]"
+TEST_CASE("Pointer filter report", "[.pointer-filter-report]")
+{
+    std::printf("%-6s %-6s %-7s | %-28s | %-28s\n", "scale", "hz", "speed",
+                "one-euro jitter/step/lag", "deadzone jitter/step/lag");
+    for (float scale : {1.0f, 2.0f})
+        for (float hz : {60.0f, 144.0f})
+            for (float speed : {0.0f, 20.0f, 60.0f, 300.0f, 1500.0f, 3000.0f})
+            {
+                auto e = runFilter(speed, 1.0f, hz, scale);
+                auto d = runDeadzone(speed, 1.0f, hz, scale);
+                std::printf("%-6.0f %-6.0f %-7.0f | %7.1f px/s %4.0f px %5.1f ms | %7.1f px/s %4.0f px %5.1f ms\n",
+                            scale, hz, speed, e.jitterPxPerSec, e.maxStepPx, e.lagMs,
+                            d.jitterPxPerSec, d.maxStepPx, d.lagMs);
+            }
+    SUCCEED();
+}
@@ -0,0 +1,146 @@
+// =============================================================================
+// Unit tests for PointerMotionEstimator — Doc 3 §3.6, §3.7
+// Sub-frame velocity from absolute (LL hook) and relative (Raw Input) pointer
+// samples: the averaging window, staleness, counts-to-px calibration, source
+// preference, and the filter responding to a stop within the frame.
+// Pure logic — no Win32 API dependencies.
+// =============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "smoothzoom/logic/PointerMotionEstimator.h"
+#include "smoothzoom/logic/PointerFilter.h"
+#include <cstdint>
+
+using namespace SmoothZoom;
+using Catch::Approx;
+
+namespace
+{
+
+PointerSample at(int64_t timeUs, int32_t x, int32_t y)
+{
+    PointerSample s;
+    s.timeUs = timeUs;
+    s.x = x;
+    s.y = y;
+    return s;
+}
+
+} // namespace
+
+TEST_CASE("Absolute samples give the velocity over the window", "[PointerMotionEstimator]")
+{
+    PointerMotionEstimator e;
+    float vx = 0.0f, vy = 0.0f;
+    REQUIRE_FALSE(e.velocity(0, vx, vy));
+
+    // 1 kHz mouse moving 2 px/ms right, 1 px/ms up.
+    for (int i = 0; i <= 40; ++i)
+        e.addAbsolute(at(i * 1000, 2 * i, -i));
+    REQUIRE(e.velocity(41000, vx, vy));
+    REQUIRE(vx == Approx(2000.0f));
+    REQUIRE(vy == Approx(-1000.0f));
+
+    // A stop at the end of the window shows within it, not a frame later.
+    for (int i = 41; i <= 52; ++i)
+        e.addAbsolute(at(i * 1000, 80, -40));
+    REQUIRE(e.velocity(52000, vx, vy));
+    REQUIRE(vx == Approx(0.0f));
+}
+
+TEST_CASE("Stale or lone samples give no velocity", "[PointerMotionEstimator]")
+{
+    PointerMotionEstimator e;
+    float vx = 0.0f, vy = 0.0f;
+    e.addAbsolute(at(0, 0, 0));
+    REQUIRE_FALSE(e.velocity(1000, vx, vy)); // one sample
+
+    e.addAbsolute(at(1000, 5, 0));
+    REQUIRE(e.velocity(2000, vx, vy));
+    REQUIRE_FALSE(e.velocity(1000 + PointerMotionEstimator::kStaleUs + 1, vx, vy));
+
+    // A move after a long rest: the previous sample is too old to difference.
+    e.addAbsolute(at(500000, 10, 0));
+    REQUIRE_FALSE(e.velocity(500000, vx, vy));
+
+    e.reset();
+    REQUIRE_FALSE(e.velocity(500000, vx, vy));
+}
+
+TEST_CASE("Relative counts need a calibrated gain", "[PointerMotionEstimator]")
+{
+    PointerMotionEstimator e;
+    float vx = 0.0f, vy = 0.0f;
+    // Raw Input batches every 2 ms, 6 counts each on x.
+    int64_t t = 0;
+    for (int i = 0; i < 8; ++i)
+        e.addRelative(at(t += 2000, 6, 0));
+    REQUIRE_FALSE(e.velocity(t, vx, vy)); // counts, not px, until calibrated
+
+    // The frame's GetCursorPos moved 1.5 px per count.
+    e.calibrate(72, 0);
+    REQUIRE(e.gain() == Approx(1.5f));
+    REQUIRE(e.velocity(t, vx, vy));
+    REQUIRE(vx == Approx(6.0f * 1.5f / 0.002f)); // 4500 px/s
+    REQUIRE(vy == Approx(0.0f));
+}
+
+TEST_CASE("Calibration skips idle and pinned frames and smooths the gain", "[PointerMotionEstimator]")
+{
+    PointerMotionEstimator e;
+    e.addRelative(at(1000, 3, 0));
+    e.calibrate(6, 0); // below kMinCalibrationCounts
+    REQUIRE(e.gain() == 0.0f);
+
+    e.addRelative(at(2000, 20, 0));
+    e.calibrate(0, 0); // pinned at the screen edge
+    REQUIRE(e.gain() == 0.0f);
+
+    e.addRelative(at(3000, 10, 10));
+    e.calibrate(20, 20);
+    REQUIRE(e.gain() == Approx(2.0f));
+    e.addRelative(at(4000, 10, 10));
+    e.calibrate(60, 60);
+    REQUIRE(e.gain() == Approx(2.0f + 0.25f * (6.0f - 2.0f)));
+}
+
+TEST_CASE("Absolute samples win over relative ones while fresh", "[PointerMotionEstimator]")
+{
+    PointerMotionEstimator e;
+    for (int i = 0; i <= 20; ++i)
+        e.addRelative(at(i * 1000, 10, 0));
+    e.calibrate(10 * 21, 0); // gain 1
+    for (int i = 0; i <= 20; ++i)
+        e.addAbsolute(at(i * 1000, i, 0));
+
+    float vx = 0.0f, vy = 0.0f;
+    REQUIRE(e.velocity(20000, vx, vy));
+    REQUIRE(vx == Approx(1000.0f)); // the hook's 1 px/ms, not Raw Input's 10
+
+    // The hook goes quiet (fullscreen magnifier): Raw Input takes over.
+    for (int i = 21; i <= 60; ++i)
+        e.addRelative(at(i * 1000, 10, 0));
+    REQUIRE(e.velocity(60000, vx, vy));
+    REQUIRE(vx == Approx(10000.0f));
+}
+
+TEST_CASE("A measured velocity drives the filter's cutoff", "[PointerMotionEstimator][PointerFilter]")
+{
+    // Both filters see the pointer step 40 px in one frame. The per-frame
+    // difference reads that as fast motion; the stream knows the hand had
+    // already stopped, so the filter keeps smoothing.
+    PointerFilter differenced, measured;
+    differenced.reset(0, 0);
+    measured.reset(0, 0);
+    const float dt = 1.0f / 60.0f;
+    const ScreenPoint a = differenced.update(40, 0, dt);
+    const ScreenPoint b = measured.update(40, 0, dt, 1.0f, 0.0f, 0.0f);
+    REQUIRE(a.x > b.x);
+
+    // A measured fast move opens the cutoff like a large difference would.
+    PointerFilter fast;
+    fast.reset(0, 0);
+    const ScreenPoint c = fast.update(40, 0, dt, 1.0f, 20000.0f, 0.0f);
+    REQUIRE(c.x > a.x);
+}
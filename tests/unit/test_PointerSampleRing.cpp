@@ -0,0 +1,189 @@
+// =============================================================================
+// Unit tests for PointerSampleRing — Doc 3 §2.7, §3.7
+// FIFO order, overwrite-oldest overflow with lost-sample accounting, drain
+// limits, discard after skipped frames, a concurrent producer/consumer check
+// for torn or reordered samples, and the producer cost at 8 kHz polling.
+// Pure logic — no Win32 API dependencies.
+// =============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "smoothzoom/common/PointerSampleRing.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+
+using namespace SmoothZoom;
+
+namespace
+{
+
+PointerSample sampleAt(int n)
+{
+    PointerSample s;
+    s.timeUs = 1000 + n;
+    s.x = n;
+    s.y = -n;
+    return s;
+}
+
+} // namespace
+
+TEST_CASE("Samples drain oldest first, once", "[PointerSampleRing]")
+{
+    PointerSampleRing<8> ring;
+    PointerSample out[8];
+    REQUIRE(ring.drain(out, 8) == 0);
+
+    for (int i = 0; i < 5; ++i)
+        ring.push(sampleAt(i));
+    REQUIRE(ring.drain(out, 8) == 5);
+    for (int i = 0; i < 5; ++i)
+    {
+        REQUIRE(out[i].timeUs == 1000 + i);
+        REQUIRE(out[i].x == i);
+        REQUIRE(out[i].y == -i);
+    }
+    REQUIRE(ring.drain(out, 8) == 0);
+    REQUIRE(ring.pushed() == 5);
+    REQUIRE(ring.lost() == 0);
+}
+
+TEST_CASE("A full ring overwrites the oldest and counts it lost", "[PointerSampleRing]")
+{
+    PointerSampleRing<8> ring;
+    PointerSample out[8];
+    for (int i = 0; i < 20; ++i)
+        ring.push(sampleAt(i)); // never refused
+
+    REQUIRE(ring.drain(out, 8) == 8);
+    REQUIRE(out[0].x == 12); // newest eight kept
+    REQUIRE(out[7].x == 19);
+    REQUIRE(ring.lost() == 12);
+
+    // The ring keeps working past the wrap.
+    ring.push(sampleAt(20));
+    REQUIRE(ring.drain(out, 8) == 1);
+    REQUIRE(out[0].x == 20);
+    REQUIRE(ring.pushed() == 21);
+    REQUIRE(ring.lost() == 12);
+}
+
+TEST_CASE("A short drain keeps the newest samples", "[PointerSampleRing]")
+{
+    PointerSampleRing<8> ring;
+    PointerSample out[8];
+    for (int i = 0; i < 6; ++i)
+        ring.push(sampleAt(i));
+    REQUIRE(ring.drain(out, 2) == 2);
+    REQUIRE(out[0].x == 4);
+    REQUIRE(out[1].x == 5);
+    REQUIRE(ring.lost() == 4);
+}
+
+TEST_CASE("Discard skips the backlog without counting it lost", "[PointerSampleRing]")
+{
+    PointerSampleRing<8> ring;
+    PointerSample out[8];
+    for (int i = 0; i < 30; ++i)
+        ring.push(sampleAt(i));
+    ring.discard();
+    REQUIRE(ring.drain(out, 8) == 0);
+    REQUIRE(ring.lost() == 0);
+
+    ring.push(sampleAt(30));
+    REQUIRE(ring.drain(out, 8) == 1);
+    REQUIRE(out[0].x == 30);
+}
+
+TEST_CASE("A lapping producer never yields torn or reordered samples", "[PointerSampleRing]")
+{
+    // Small ring and a consumer that sleeps between drains, so the producer
+    // laps it constantly, mid-copy included.
+    constexpr int kSamples = 500000;
+    PointerSampleRing<16> ring;
+    std::atomic<bool> done{false};
+
+    std::thread producer([&] {
+        for (int n = 1; n <= kSamples; ++n)
+            ring.push(sampleAt(n));
+        done.store(true, std::memory_order_release);
+    });
+
+    uint64_t read = 0;
+    int last = 0;
+    bool torn = false, reordered = false;
+    PointerSample out[16];
+    for (bool finished = false; !finished;)
+    {
+        finished = done.load(std::memory_order_acquire); // one more drain after the producer ends
+        const int n = ring.drain(out, 16);
+        for (int i = 0; i < n; ++i)
+        {
+            torn |= out[i].y != -out[i].x || out[i].timeUs != 1000 + out[i].x;
+            reordered |= out[i].x <= last;
+            last = out[i].x;
+        }
+        read += static_cast<uint64_t>(n);
+        if (!finished)
+            std::this_thread::yield();
+    }
+    producer.join();
+
+    REQUIRE_FALSE(torn);
+    REQUIRE_FALSE(reordered);
+    REQUIRE(last == kSamples);
+    REQUIRE(ring.pushed() == static_cast<uint64_t>(kSamples));
+    REQUIRE(read + ring.lost() == ring.pushed());
+}
+
+TEST_CASE("PointerSampleRing producer cost", "[PointerSampleRing][!benchmark]")
+{
+    PointerSampleRing<> ring;
+    PointerSample out[PointerSampleRing<>::kCapacity];
+    int n = 0;
+    // One second of an 8 kHz mouse, drained at 60 Hz (~133 samples a frame).
+    BENCHMARK("push x8000 (1 s at 8 kHz)")
+    {
+        for (int i = 0; i < 8000; ++i)
+        {
+            ring.push(sampleAt(++n));
+            if (i % 133 == 132)
+                ring.drain(out, static_cast<int>(PointerSampleRing<>::kCapacity));
+        }
+        return ring.pushed();
+    };
+}
+
+// Producer cost per sample and as a share of one core at 8 kHz, with the
+// render thread draining concurrently. Hidden; run with:
+//   smoothzoom_tests "[.pointer-sample-report]"
+TEST_CASE("PointerSampleRing producer report", "[.pointer-sample-report]")
+{
+    constexpr int kSamples = 8000 * 256; // 256 s of 8 kHz polling
+    PointerSampleRing<> ring;
+    std::atomic<bool> done{false};
+    uint64_t drained = 0;
+    std::thread consumer([&] {
+        PointerSample out[PointerSampleRing<>::kCapacity];
+        while (!done.load(std::memory_order_acquire))
+        {
+            drained += static_cast<uint64_t>(ring.drain(out, static_cast<int>(PointerSampleRing<>::kCapacity)));
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    });
+
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int n = 0; n < kSamples; ++n)
+        ring.push(sampleAt(n));
+    const double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    done.store(true, std::memory_order_release);
+    consumer.join();
+
+    const double ns = sec / kSamples * 1e9;
+    std::printf("%12s %12s %14s %12s %12s\n", "samples", "ns/push", "core%@8kHz", "drained", "lost");
+    std::printf("%12d %12.1f %14.4f %12llu %12llu\n", kSamples, ns, ns * 8000.0 / 1e9 * 100.0,
+                static_cast<unsigned long long>(drained), static_cast<unsigned long long>(ring.lost()));
+}
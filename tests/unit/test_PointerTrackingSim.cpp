@@ -0,0 +1,117 @@
+// =============================================================================
+// Unit tests for PointerTrackingSim — Doc 3 §3.6
+// Edge-push tracking must cut pan motion and setTransform calls during
+// precision work without ever losing the pointer off screen; centered
+// tracking's follow filter must absorb hand tremor the same way.
+// Pure logic — no Win32 API dependencies.
+// =============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include "smoothzoom/logic/PointerTrackingSim.h"
+
+using namespace SmoothZoom;
+
+namespace
+{
+
+PointerTrackingStats run(const std::vector<PointerSample>& trace, PointerTrackingMode mode,
+                         float zoom)
+{
+    PointerTrackingSimParams p;
+    p.mode = mode;
+    p.zoom = zoom;
+    return simulatePointerTracking(trace.data(), trace.size(), p);
+}
+
+} // namespace
+
+TEST_CASE("Synthetic traces are deterministic and stay on screen", "[PointerTrackingSim]")
+{
+    for (auto kind : {PointerTraceKind::Precision, PointerTraceKind::Reading,
+                      PointerTraceKind::Sweep})
+    {
+        auto a = synthesizePointerTrace(kind, 144.0f, 5.0f, 1920, 1080, 7);
+        auto b = synthesizePointerTrace(kind, 144.0f, 5.0f, 1920, 1080, 7);
+        REQUIRE(a.size() == b.size());
+        REQUIRE(a.size() >= 700);
+        for (size_t i = 0; i < a.size(); ++i)
+        {
+            REQUIRE(a[i].x == b[i].x);
+            REQUIRE(a[i].y == b[i].y);
+            REQUIRE(a[i].x >= 0);
+            REQUIRE(a[i].x < 1920);
+            REQUIRE(a[i].y >= 0);
+            REQUIRE(a[i].y < 1080);
+        }
+    }
+}
+
+TEST_CASE("Edge push cuts transform calls and pan travel during precision work",
+          "[PointerTrackingSim][EdgePush]")
+{
+    auto trace = synthesizePointerTrace(PointerTraceKind::Precision, 144.0f, 30.0f, 1920, 1080);
+    for (float zoom : {2.0f, 4.0f, 8.0f, 10.0f})
+    {
+        auto cont = run(trace, PointerTrackingMode::Continuous, zoom);
+        auto edge = run(trace, PointerTrackingMode::EdgePush, zoom);
+        INFO("zoom=" << zoom << " continuous " << cont.transformsPerSec << "/s "
+             << cont.viewportTravelPx << " px, edge " << edge.transformsPerSec << "/s "
+             << edge.viewportTravelPx << " px");
+        REQUIRE(cont.transformsPerSec > 5.0f);
+        REQUIRE(edge.transformsPerSec * 2.0f < cont.transformsPerSec);
+        REQUIRE(edge.viewportTravelPx * 5.0f < cont.viewportTravelPx);
+    }
+
+    // Work area fits inside the band at moderate zoom: the view never moves
+    // after the initial zoom-in transform.
+    REQUIRE(run(trace, PointerTrackingMode::EdgePush, 4.0f).transformCalls == 1);
+}
+
+TEST_CASE("Edge push never loses the pointer off screen", "[PointerTrackingSim][EdgePush]")
+{
+    for (auto kind : {PointerTraceKind::Precision, PointerTraceKind::Reading,
+                      PointerTraceKind::Sweep})
+    {
+        auto trace = synthesizePointerTrace(kind, 144.0f, 20.0f, 1920, 1080, 3);
+        for (float zoom : {2.0f, 6.0f, 10.0f})
+        {
+            INFO("trace " << static_cast<int>(kind) << " zoom " << zoom);
+            REQUIRE(run(trace, PointerTrackingMode::EdgePush, zoom).pointerOffscreenFrames == 0);
+        }
+    }
+}
+
+TEST_CASE("Centered follow absorbs tremor and keeps the pointer near center",
+          "[PointerTrackingSim][Centered]")
+{
+    auto trace = synthesizePointerTrace(PointerTraceKind::Precision, 144.0f, 30.0f, 1920, 1080);
+    PointerTrackingSimParams p;
+    p.mode = PointerTrackingMode::Centered;
+    p.zoom = 4.0f;
+    p.centered.followSec = 0.0f;
+    auto locked = simulatePointerTracking(trace.data(), trace.size(), p);
+    p.centered.followSec = 0.12f;
+    auto smoothed = simulatePointerTracking(trace.data(), trace.size(), p);
+
+    INFO("locked " << locked.transformsPerSec << "/s, smoothed " << smoothed.transformsPerSec
+         << "/s, center error " << smoothed.meanCenterErrorPx << " px");
+    REQUIRE(locked.meanCenterErrorPx < 1.0f);
+    REQUIRE(smoothed.transformsPerSec * 2.0f < locked.transformsPerSec);
+    REQUIRE(smoothed.viewportTravelPx * 2.0f < locked.viewportTravelPx);
+    REQUIRE(smoothed.meanCenterErrorPx < 20.0f);
+}
+
+TEST_CASE("Centered tracking never loses the pointer off screen",
+          "[PointerTrackingSim][Centered]")
+{
+    for (auto kind : {PointerTraceKind::Precision, PointerTraceKind::Reading,
+                      PointerTraceKind::Sweep})
+    {
+        auto trace = synthesizePointerTrace(kind, 144.0f, 20.0f, 1920, 1080, 3);
+        for (float zoom : {2.0f, 6.0f, 10.0f})
+        {
+            INFO("trace " << static_cast<int>(kind) << " zoom " << zoom);
+            REQUIRE(run(trace, PointerTrackingMode::Centered, zoom).pointerOffscreenFrames == 0);
+        }
+    }
+}
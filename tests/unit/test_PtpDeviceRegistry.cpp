@@ -0,0 +1,182 @@
+// =============================================================================
+// Unit tests for PtpDeviceRegistry — Doc 3 §3.1, R-08
+// Handle-keyed lookup through insertion, replacement and backward-shift
+// removal (checked against a reference map under random hot-plug churn),
+// capacity and eviction of unusable entries, and VID:PID profile matching.
+// Pure logic — no Win32 API dependencies.
+// =============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "smoothzoom/input/PtpDeviceRegistry.h"
+#include <cstdint>
+#include <map>
+
+using namespace SmoothZoom;
+using Catch::Approx;
+
+namespace
+{
+
+PtpDeviceInfo touchpad(uint16_t vid, uint16_t pid, int32_t rangeY = 1000)
+{
+    PtpDeviceInfo info;
+    const PtpFieldDesc f[] = {
+        {kHidPageDigitizer, kHidUsageTipSwitch, 1, 1, {8, 1}, 0, 1},
+        {kHidPageDigitizer, kHidUsageContactId, 1, 1, {16, 8}, 0, 255},
+        {kHidPageGenericDesktop, kHidUsageY, 1, 1, {24, 16}, 0, rangeY},
+        {kHidPageGenericDesktop, kHidUsageX, 1, 1, {40, 16}, 0, 2000},
+        {kHidPageDigitizer, kHidUsageContactCount, 0, 1, {56, 8}, 0, 5},
+    };
+    info.layout.compile(f, sizeof(f) / sizeof(f[0]), true);
+    info.vendorId = vid;
+    info.productId = pid;
+    return info;
+}
+
+} // namespace
+
+TEST_CASE("Devices are found by handle until removed", "[PtpDeviceRegistry]")
+{
+    PtpDeviceRegistry r;
+    const PtpDeviceInfo pad = touchpad(0x06CB, 0xCE78);
+    REQUIRE(pad.layout.valid);
+
+    PtpDevice* a = r.insert(0x10001, &pad);
+    REQUIRE(a != nullptr);
+    REQUIRE(a->usable);
+    REQUIRE(a->vendorId == 0x06CB);
+    REQUIRE(a->yScale.logicalRange == 1000);
+    REQUIRE(r.insert(0x20001, nullptr) != nullptr);
+    REQUIRE(r.size() == 2);
+
+    REQUIRE(r.find(0x10001) == a);
+    REQUIRE_FALSE(r.find(0x20001)->usable);
+    REQUIRE(r.find(0x30001) == nullptr);
+
+    // Re-inserting replaces the entry's state in place.
+    a->remainder = 0.5f;
+    REQUIRE(r.insert(0x10001, &pad) == a);
+    REQUIRE(a->remainder == 0.0f);
+    REQUIRE(r.size() == 2);
+
+    REQUIRE(r.remove(0x10001));
+    REQUIRE_FALSE(r.remove(0x10001));
+    REQUIRE(r.find(0x10001) == nullptr);
+    REQUIRE(r.find(0x20001) != nullptr);
+    REQUIRE(r.size() == 1);
+
+    r.clear();
+    REQUIRE(r.size() == 0);
+    REQUIRE(r.find(0x20001) == nullptr);
+}
+
+TEST_CASE("Handle 0 is never registered", "[PtpDeviceRegistry]")
+{
+    PtpDeviceRegistry r;
+    const PtpDeviceInfo pad = touchpad(1, 2);
+    REQUIRE(r.insert(0, &pad) == nullptr);
+    REQUIRE(r.find(0) == nullptr);
+    REQUIRE(r.size() == 0);
+}
+
+TEST_CASE("A full registry evicts unusable entries, never pads", "[PtpDeviceRegistry]")
+{
+    PtpDeviceRegistry r;
+    const PtpDeviceInfo pad = touchpad(1, 2);
+    for (int i = 0; i < PtpDeviceRegistry::kMaxDevices - 1; ++i)
+        REQUIRE(r.insert(0x1000 + 0x10 * i, &pad) != nullptr);
+    REQUIRE(r.insert(0x9000, nullptr) != nullptr); // not a PTP
+    REQUIRE(r.size() == PtpDeviceRegistry::kMaxDevices);
+
+    PtpDevice* d = r.insert(0xA000, &pad);
+    REQUIRE(d != nullptr);
+    REQUIRE(r.find(0x9000) == nullptr);
+    REQUIRE(r.size() == PtpDeviceRegistry::kMaxDevices);
+
+    REQUIRE(r.insert(0xB000, &pad) == nullptr);
+    for (int i = 0; i < PtpDeviceRegistry::kMaxDevices - 1; ++i)
+        REQUIRE(r.find(0x1000 + 0x10 * i) != nullptr);
+    REQUIRE(r.find(0xA000) == d);
+}
+
+TEST_CASE("Lookups stay correct under random hot-plug churn", "[PtpDeviceRegistry]")
+{
+    // Handles drawn from a small pool so probe runs collide and wrap, with
+    // removals in arbitrary order exercising the backward shift.
+    PtpDeviceRegistry r;
+    const PtpDeviceInfo pad = touchpad(1, 2);
+    std::map<uint64_t, PtpDevice*> truth;
+    uint32_t seed = 777;
+    auto next = [&seed](uint32_t n) {
+        seed = seed * 1664525u + 1013904223u;
+        return (seed >> 8) % n;
+    };
+    for (int step = 0; step < 20000; ++step)
+    {
+        const uint64_t h = 0x100000 + 0x40 * static_cast<uint64_t>(next(24));
+        if (truth.count(h) != 0 && next(2) == 0)
+        {
+            REQUIRE(r.remove(h));
+            truth.erase(h);
+        }
+        else if (truth.count(h) == 0 && static_cast<int>(truth.size()) < PtpDeviceRegistry::kMaxDevices)
+        {
+            PtpDevice* d = r.insert(h, &pad);
+            REQUIRE(d != nullptr);
+            truth[h] = d;
+        }
+        REQUIRE(r.size() == static_cast<int>(truth.size()));
+        for (const auto& kv : truth)
+            REQUIRE(r.find(kv.first) == kv.second);
+        for (uint64_t k = 0; k < 24; ++k)
+        {
+            const uint64_t other = 0x100000 + 0x40 * k;
+            if (truth.count(other) == 0)
+                REQUIRE(r.find(other) == nullptr);
+        }
+    }
+}
+
+TEST_CASE("Profiles match by VID:PID and apply on insert or update", "[PtpDeviceRegistry]")
+{
+    PtpDeviceRegistry r;
+    const PtpDeviceInfo synaptics = touchpad(0x06CB, 0xCE78, 800);
+    const PtpDeviceInfo apple = touchpad(0x05AC, 0x0265, 1000);
+
+    PtpDeviceProfile profiles[2];
+    profiles[0].vendorId = 0x06CB;
+    profiles[0].productId = 0xCE78;
+    profiles[0].axisScale = 1.5f;
+    profiles[0].sensitivity = 0.8f;
+    profiles[1].vendorId = 0x06CB;
+    profiles[1].productId = 0x0001;
+    profiles[1].invertNaturalScroll = true;
+    r.setProfiles(profiles, 2);
+
+    PtpDevice* s = r.insert(0x100, &synaptics);
+    PtpDevice* a = r.insert(0x200, &apple);
+    REQUIRE(s->hasProfile);
+    REQUIRE(s->yScale.logicalRange == 800);
+    REQUIRE(s->yScale.axisScale == Approx(1.5f));
+    REQUIRE(s->sensitivity == Approx(0.8f));
+    REQUIRE_FALSE(s->invertNaturalScroll);
+    REQUIRE_FALSE(a->hasProfile);
+    REQUIRE(a->yScale.axisScale == Approx(1.0f));
+    REQUIRE(r.profileFor(0x06CB, 0x0001)->invertNaturalScroll);
+    REQUIRE(r.profileFor(0x05AC, 0x0265) == nullptr);
+
+    // New settings re-tune registered devices without touching their state.
+    s->remainder = 0.25f;
+    profiles[0].vendorId = 0x05AC;
+    profiles[0].productId = 0x0265;
+    r.setProfiles(profiles, 1);
+    REQUIRE_FALSE(s->hasProfile);
+    REQUIRE(s->sensitivity == Approx(1.0f));
+    REQUIRE(s->remainder == Approx(0.25f));
+    REQUIRE(a->hasProfile);
+    REQUIRE(a->yScale.axisScale == Approx(1.5f));
+
+    // Unusable entries never carry a profile.
+    REQUIRE_FALSE(r.insert(0x300, nullptr)->hasProfile);
+}
@@ -0,0 +1,305 @@
+// =============================================================================
+// Unit tests for PtpGestureRecognizer — Doc 3 §3.1, R-08
+// Contact streams are built as decoded frames (the decode path is covered by
+// test_PtpReportLayout.cpp): per-slot two-finger tracking, scroll vs. pinch
+// classification and its hysteresis, log-zoom and centroid output, palm
+// rejection, and a per-report cost benchmark. The pad matches the sample PTP
+// descriptor (X 0..1227, Y 0..749).
+// Pure logic — no Win32 API dependencies.
+// =============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_approx.hpp>
+#include "smoothzoom/input/PtpGestureRecognizer.h"
+#include <cmath>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+using namespace SmoothZoom;
+using Catch::Approx;
+
+namespace
+{
+
+constexpr int32_t kRangeX = 1227;
+constexpr int32_t kRangeY = 749;
+
+struct Touch
+{
+    int32_t x;
+    int32_t y;
+    bool tip = true;
+    bool confident = true;
+    uint32_t id = 0;
+};
+
+// One report: touches fill slots in order; contact count is the touches with
+// tip set unless given.
+PtpContactFrame frame(std::initializer_list<Touch> touches, int contactCount = -1)
+{
+    PtpContactFrame f;
+    f.numSlots = PtpContactFrame::kMaxSlots;
+    uint32_t down = 0;
+    int s = 0;
+    for (const Touch& t : touches)
+    {
+        f.slots[s].contactId = t.id;
+        f.slots[s].tip = t.tip;
+        f.slots[s].confident = t.confident;
+        f.slots[s].x = static_cast<uint32_t>(t.x);
+        f.slots[s].y = static_cast<uint32_t>(t.y);
+        down += t.tip ? 1 : 0;
+        ++s;
+    }
+    f.contactCount = contactCount < 0 ? down : static_cast<uint32_t>(contactCount);
+    return f;
+}
+
+// Two fingers side by side, `dist` apart, centered on (cx, cy).
+PtpContactFrame pair(float cx, float cy, float dist)
+{
+    const auto half = dist / 2.0f;
+    return frame({{static_cast<int32_t>(std::lround(cx - half)), static_cast<int32_t>(std::lround(cy))},
+                  {static_cast<int32_t>(std::lround(cx + half)), static_cast<int32_t>(std::lround(cy))}});
+}
+
+PtpGestureRecognizer recognizer()
+{
+    PtpReportLayout layout;
+    layout.logicalRangeX = kRangeX;
+    layout.logicalRangeY = kRangeY;
+    PtpGestureRecognizer g;
+    g.configure(layout);
+    return g;
+}
+
+} // namespace
+
+TEST_CASE("Two fingers moving together produce their average delta", "[PtpGestureRecognizer]")
+{
+    PtpGestureRecognizer g = recognizer();
+
+    // First frame: no previous Y yet.
+    REQUIRE(g.update(frame({{100, 300}, {200, 310}})).fingers == 0);
+
+    auto res = g.update(frame({{100, 310}, {200, 330}}));
+    REQUIRE(res.fingers == 2);
+    REQUIRE(res.avgDeltaY == 15);
+
+    res = g.update(frame({{100, 290}, {200, 320}}));
+    REQUIRE(res.avgDeltaY == -15);
+
+    // One finger lifts: no delta, and it needs a fresh sample when it returns.
+    res = g.update(frame({{100, 280}, {0, 0, false}}));
+    REQUIRE(res.fingers == 0);
+    REQUIRE(res.gesture == PtpGesture::None);
+    res = g.update(frame({{100, 270}, {200, 900}}));
+    REQUIRE(res.fingers == 1);
+    REQUIRE(res.avgDeltaY == 0);
+    res = g.update(frame({{100, 260}, {200, 890}}));
+    REQUIRE(res.fingers == 2);
+    REQUIRE(res.avgDeltaY == -10);
+
+    g.reset();
+    REQUIRE(g.update(frame({{100, 250}, {200, 880}})).fingers == 0);
+}
+
+TEST_CASE("An empty slot reporting contact ID 0 does not displace a finger", "[PtpGestureRecognizer]")
+{
+    // Synaptics/Elan: the finger holding ID 0 sits in slot 1; inactive slot 0
+    // also reports ID 0. Tracking is per slot, so both real fingers count.
+    PtpGestureRecognizer g = recognizer();
+    g.update(frame({{0, 0, false, true, 0}, {100, 200, true, true, 0}, {150, 220, true, true, 1}}));
+    const auto res =
+        g.update(frame({{0, 0, false, true, 0}, {100, 206, true, true, 0}, {150, 226, true, true, 1}}));
+    REQUIRE(res.fingers == 2);
+    REQUIRE(res.avgDeltaY == 6);
+}
+
+TEST_CASE("Vertical travel commits to scroll and releases the undecided travel", "[PtpGestureRecognizer]")
+{
+    // Enter threshold: 2% of 749 ≈ 15 units of net centroid travel.
+    PtpGestureRecognizer g = recognizer();
+    g.update(pair(600, 300, 300));
+
+    auto res = g.update(pair(600, 305, 300));
+    REQUIRE(res.gesture == PtpGesture::Undecided);
+    REQUIRE(res.scrollDeltaY == 0);
+    res = g.update(pair(600, 310, 300));
+    REQUIRE(res.gesture == PtpGesture::Undecided);
+
+    res = g.update(pair(600, 315, 300));
+    REQUIRE(res.gesture == PtpGesture::Scroll);
+    REQUIRE(res.scrollDeltaY == 15);
+    REQUIRE(res.logZoomDelta == 0.0f);
+
+    res = g.update(pair(600, 307, 300));
+    REQUIRE(res.gesture == PtpGesture::Scroll);
+    REQUIRE(res.scrollDeltaY == -8);
+}
+
+TEST_CASE("Spreading the fingers zooms by the log of their distance ratio", "[PtpGestureRecognizer]")
+{
+    PtpGestureRecognizer g = recognizer();
+    g.update(pair(600, 400, 200));
+
+    float logZoom = 0.0f;
+    int pinchReports = 0;
+    for (int i = 1; i <= 20; ++i)
+    {
+        const auto res = g.update(pair(600, 400, 200.0f + 10.0f * static_cast<float>(i)));
+        REQUIRE(res.scrollDeltaY == 0);
+        logZoom += res.logZoomDelta;
+        if (res.gesture == PtpGesture::Pinch)
+        {
+            ++pinchReports;
+            REQUIRE(res.logZoomDelta > 0.0f);
+            REQUIRE(res.anchorX == Approx(600.0 / kRangeX).margin(1e-3));
+            REQUIRE(res.anchorY == Approx(400.0 / kRangeY).margin(1e-3));
+        }
+    }
+    // Committed on the second report (20 units ≥ 15); the first one's travel
+    // is included, so 200 → 400 is exactly 2×.
+    REQUIRE(pinchReports == 19);
+    REQUIRE(logZoom == Approx(std::log(2.0)).margin(1e-4));
+
+    // Pinching back closes the loop.
+    for (int i = 19; i >= 0; --i)
+        logZoom += g.update(pair(600, 400, 200.0f + 10.0f * static_cast<float>(i))).logZoomDelta;
+    REQUIRE(logZoom == Approx(0.0).margin(1e-4));
+}
+
+TEST_CASE("The pinch anchor is the finger centroid on the pad", "[PtpGestureRecognizer]")
+{
+    PtpGestureRecognizer g = recognizer();
+    // One finger fixed near the top-left, the other moving away diagonally.
+    g.update(frame({{100, 100}, {300, 200}}));
+    g.update(frame({{100, 100}, {330, 215}}));
+    const auto res = g.update(frame({{100, 100}, {360, 230}}));
+    REQUIRE(res.gesture == PtpGesture::Pinch);
+    REQUIRE(res.anchorX == Approx(230.0 / kRangeX).margin(1e-3));
+    REQUIRE(res.anchorY == Approx(165.0 / kRangeY).margin(1e-3));
+}
+
+TEST_CASE("Ambiguous motion stays undecided", "[PtpGestureRecognizer]")
+{
+    // Moving down while spreading at the same rate: neither kind dominates.
+    PtpGestureRecognizer g = recognizer();
+    g.update(pair(600, 200, 200));
+    for (int i = 1; i <= 20; ++i)
+    {
+        const auto res = g.update(pair(600, 200.0f + 10.0f * static_cast<float>(i),
+                                       200.0f + 10.0f * static_cast<float>(i)));
+        REQUIRE(res.gesture == PtpGesture::Undecided);
+        REQUIRE(res.scrollDeltaY == 0);
+        REQUIRE(res.logZoomDelta == 0.0f);
+    }
+}
+
+TEST_CASE("A scroll with drifting fingers stays a scroll", "[PtpGestureRecognizer]")
+{
+    // The fingers slowly separate while scrolling (1 unit per report, 40 in
+    // all) — past the enter threshold, but never enough recent pinch evidence
+    // to break out.
+    PtpGestureRecognizer g = recognizer();
+    g.update(pair(600, 100, 300));
+    int32_t scrolled = 0;
+    for (int i = 1; i <= 40; ++i)
+    {
+        const auto res = g.update(pair(600, 100.0f + 8.0f * static_cast<float>(i),
+                                       300.0f + static_cast<float>(i)));
+        if (i >= 2)
+            REQUIRE(res.gesture == PtpGesture::Scroll);
+        REQUIRE(res.logZoomDelta == 0.0f);
+        scrolled += res.scrollDeltaY;
+    }
+    REQUIRE(scrolled == 320);
+}
+
+TEST_CASE("A sustained pinch breaks out of a scroll", "[PtpGestureRecognizer]")
+{
+    PtpGestureRecognizer g = recognizer();
+    g.update(pair(600, 300, 200));
+    g.update(pair(600, 310, 200));
+    REQUIRE(g.update(pair(600, 320, 200)).gesture == PtpGesture::Scroll);
+
+    // Spread in place, 10 units per report. The breakout threshold (6% of the
+    // pad) is three times the enter threshold, so it takes several reports.
+    int switchedAt = 0;
+    for (int i = 1; i <= 10 && switchedAt == 0; ++i)
+    {
+        const auto res = g.update(pair(600, 320, 200.0f + 10.0f * static_cast<float>(i)));
+        if (res.gesture == PtpGesture::Pinch)
+        {
+            switchedAt = i;
+            REQUIRE(res.logZoomDelta > 0.0f);
+        }
+        else
+        {
+            REQUIRE(res.gesture == PtpGesture::Scroll);
+            REQUIRE(res.scrollDeltaY == 0);
+        }
+    }
+    REQUIRE(switchedAt >= 4);
+    REQUIRE(switchedAt <= 8);
+}
+
+TEST_CASE("Low-confidence contacts are not fingers", "[PtpGestureRecognizer]")
+{
+    PtpGestureRecognizer g = recognizer();
+    // A finger scrolling next to a resting palm.
+    g.update(frame({{300, 300}, {900, 500, true, false}}, 2));
+    auto res = g.update(frame({{300, 320}, {900, 505, true, false}}, 2));
+    REQUIRE(res.fingers == 1);
+    REQUIRE(res.gesture == PtpGesture::None);
+
+    // Once the contact is confident it needs a fresh sample like a new touch.
+    res = g.update(frame({{300, 340}, {900, 510}}));
+    REQUIRE(res.fingers == 1);
+    res = g.update(frame({{300, 360}, {900, 530}}));
+    REQUIRE(res.fingers == 2);
+    REQUIRE(res.gesture == PtpGesture::Scroll);
+}
+
+TEST_CASE("Lifting a finger ends the gesture", "[PtpGestureRecognizer]")
+{
+    PtpGestureRecognizer g = recognizer();
+    g.update(pair(600, 400, 200));
+    g.update(pair(600, 400, 220));
+    REQUIRE(g.update(pair(600, 400, 240)).gesture == PtpGesture::Pinch);
+
+    REQUIRE(g.update(frame({{500, 400}, {0, 0, false}})).gesture == PtpGesture::None);
+    REQUIRE(g.gesture() == PtpGesture::None);
+
+    // Both fingers down again: a new pair, classified afresh.
+    g.update(pair(600, 400, 240));
+    const auto res = g.update(pair(600, 405, 240));
+    REQUIRE(res.gesture == PtpGesture::Undecided);
+    REQUIRE(res.logZoomDelta == 0.0f);
+}
+
+TEST_CASE("PTP gesture recognition cost per report", "[PtpGestureRecognizer][!benchmark]")
+{
+    // 256 reports alternating 32-report pinch and scroll strokes.
+    std::vector<PtpContactFrame> frames;
+    for (int i = 0; i < 256; ++i)
+    {
+        const float t = static_cast<float>(i % 32);
+        frames.push_back((i / 32) % 2 == 0 ? pair(600, 400, 200.0f + 8.0f * t)
+                                           : pair(600, 200.0f + 6.0f * t, 300));
+    }
+
+    BENCHMARK("update x256 (5 slots)")
+    {
+        PtpGestureRecognizer g = recognizer();
+        float sum = 0.0f;
+        for (const PtpContactFrame& f : frames)
+        {
+            const auto res = g.update(f);
+            sum += res.logZoomDelta + static_cast<float>(res.scrollDeltaY);
+        }
+        return sum;
+    };
+}
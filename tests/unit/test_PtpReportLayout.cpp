@@ -0,0 +1,320 @@
+// =============================================================================
+// Unit tests for PtpReportLayout — Doc 3 §3.1, R-08
+// Layout compilation from synthetic descriptors and bit extraction (byte-aligned
+// and packed fields, report end, foreign report IDs, confidence). Contact
+// tracking over report sequences is in test_PtpGestureRecognizer.cpp. The
+// descriptors mirror the Windows sample
+// PTP collection (report ID, per-finger confidence/tip bits, contact ID, 16-bit
+// X/Y, scan time, contact count); the reports are constructed, not captured.
+// Pure logic — no Win32 API dependencies.
+// =============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "smoothzoom/input/PtpReportLayout.h"
+#include <cstdint>
+#include <vector>
+
+using namespace SmoothZoom;
+
+namespace
+{
+
+constexpr uint8_t kReportId = 0x04;
+
+// Sample PTP layout, `fingers` contacts per report. Byte 0 is the report ID;
+// finger i occupies 6 bytes from 1 + 6i: [confidence:1 tip:1 pad:6][id:8]
+// [x:16][y:16]; then scan time (16) and contact count (8).
+struct SampleDevice
+{
+    int fingers;
+
+    int fingerBase(int i) const { return 8 * (1 + 6 * i); }
+    uint16_t confBit(int i) const { return static_cast<uint16_t>(fingerBase(i)); }
+    uint16_t tipBit(int i) const { return static_cast<uint16_t>(fingerBase(i) + 1); }
+    uint16_t idBit(int i) const { return static_cast<uint16_t>(fingerBase(i) + 8); }
+    uint16_t xBit(int i) const { return static_cast<uint16_t>(fingerBase(i) + 16); }
+    uint16_t yBit(int i) const { return static_cast<uint16_t>(fingerBase(i) + 32); }
+    uint16_t scanBit() const { return static_cast<uint16_t>(fingerBase(fingers)); }
+    uint16_t countBit() const { return static_cast<uint16_t>(scanBit() + 16); }
+    size_t bytes() const { return static_cast<size_t>(countBit() / 8 + 1); }
+
+    std::vector<PtpFieldDesc> fields() const
+    {
+        std::vector<PtpFieldDesc> f;
+        for (int i = 0; i < fingers; ++i)
+        {
+            const auto lc = static_cast<uint16_t>(i + 1);
+            f.push_back({kHidPageDigitizer, kHidUsageContactId, lc, kReportId, {idBit(i), 8}, 0, 255});
+            f.push_back({kHidPageGenericDesktop, kHidUsageX, lc, kReportId, {xBit(i), 16}, 0, 1227});
+            f.push_back({kHidPageGenericDesktop, kHidUsageY, lc, kReportId, {yBit(i), 16}, 0, 749});
+            f.push_back({kHidPageDigitizer, kHidUsageTipSwitch, lc, kReportId, {tipBit(i), 1}, 0, 1});
+            f.push_back({kHidPageDigitizer, kHidUsageConfidence, lc, kReportId, {confBit(i), 1}, 0, 1});
+        }
+        f.push_back({kHidPageDigitizer, 0x56 /* scan time */, 0, kReportId, {scanBit(), 16}, 0, 65535});
+        f.push_back({kHidPageDigitizer, kHidUsageContactCount, 0, kReportId, {countBit(), 8}, 0, 5});
+        return f;
+    }
+};
+
+struct Finger
+{
+    bool tip;
+    uint8_t id;
+    uint16_t x;
+    uint16_t y;
+    bool confident = true;
+};
+
+void putBits(std::vector<uint8_t>& r, unsigned bit, unsigned size, uint32_t v)
+{
+    for (unsigned i = 0; i < size; ++i, ++bit)
+    {
+        const uint8_t m = static_cast<uint8_t>(1u << (bit & 7));
+        if ((v >> i) & 1u)
+            r[bit / 8] |= m;
+        else
+            r[bit / 8] &= static_cast<uint8_t>(~m);
+    }
+}
+
+std::vector<uint8_t> report(const SampleDevice& d, std::vector<Finger> fingers, uint8_t contactCount)
+{
+    std::vector<uint8_t> r(d.bytes(), 0);
+    r[0] = kReportId;
+    for (int i = 0; i < static_cast<int>(fingers.size()); ++i)
+    {
+        putBits(r, d.confBit(i), 1, fingers[i].confident ? 1 : 0);
+        putBits(r, d.tipBit(i), 1, fingers[i].tip ? 1 : 0);
+        putBits(r, d.idBit(i), 8, fingers[i].id);
+        putBits(r, d.xBit(i), 16, fingers[i].x);
+        putBits(r, d.yBit(i), 16, fingers[i].y);
+    }
+    putBits(r, d.scanBit(), 16, 0xBEEF);
+    putBits(r, d.countBit(), 8, contactCount);
+    return r;
+}
+
+PtpReportLayout compiled(const SampleDevice& d)
+{
+    const auto f = d.fields();
+    PtpReportLayout l;
+    REQUIRE(l.compile(f.data(), f.size(), true));
+    return l;
+}
+
+} // namespace
+
+TEST_CASE("Compiles the sample PTP descriptor", "[PtpReportLayout]")
+{
+    const SampleDevice d{5};
+    const PtpReportLayout l = compiled(d);
+
+    REQUIRE(l.reportId == kReportId);
+    REQUIRE(l.numSlots == 5);
+    REQUIRE(l.contactCount.bitOffset == d.countBit());
+    REQUIRE(l.logicalRangeX == 1227);
+    REQUIRE(l.logicalRangeY == 749);
+    for (int i = 0; i < 5; ++i)
+    {
+        REQUIRE(l.slots[i].linkCollection == i + 1);
+        REQUIRE(l.slots[i].contactId.bitOffset == d.idBit(i));
+        REQUIRE(l.slots[i].tipSwitch.bitOffset == d.tipBit(i));
+        REQUIRE(l.slots[i].tipSwitch.bitSize == 1);
+        REQUIRE(l.slots[i].confidence.bitOffset == d.confBit(i));
+        REQUIRE(l.slots[i].x.bitOffset == d.xBit(i));
+        REQUIRE(l.slots[i].y.bitOffset == d.yBit(i));
+        REQUIRE(l.slots[i].y.bitSize == 16);
+    }
+}
+
+TEST_CASE("Compilation rejects descriptors without contacts", "[PtpReportLayout]")
+{
+    PtpReportLayout l;
+    auto f = SampleDevice{2}.fields();
+
+    SECTION("no contact count")
+    {
+        f.pop_back();
+        REQUIRE_FALSE(l.compile(f.data(), f.size(), true));
+    }
+    SECTION("no contact IDs")
+    {
+        std::vector<PtpFieldDesc> noIds;
+        for (const auto& x : f)
+            if (x.usage != kHidUsageContactId)
+                noIds.push_back(x);
+        REQUIRE_FALSE(l.compile(noIds.data(), noIds.size(), true));
+    }
+    SECTION("a plain mouse")
+    {
+        const PtpFieldDesc mouse[] = {
+            {kHidPageGenericDesktop, kHidUsageX, 0, 0, {8, 8}, -127, 127},
+            {kHidPageGenericDesktop, kHidUsageY, 0, 0, {16, 8}, -127, 127},
+        };
+        REQUIRE_FALSE(l.compile(mouse, 2, false));
+    }
+    REQUIRE_FALSE(l.valid);
+    std::vector<uint8_t> r(16, 0);
+    PtpContactFrame frame;
+    REQUIRE_FALSE(l.decode(r.data(), r.size(), frame));
+}
+
+TEST_CASE("More than five contact IDs are capped at five slots", "[PtpReportLayout]")
+{
+    const SampleDevice d{7};
+    const auto f = d.fields();
+    PtpReportLayout l;
+    REQUIRE(l.compile(f.data(), f.size(), true));
+    REQUIRE(l.numSlots == PtpReportLayout::kMaxSlots);
+    REQUIRE(l.slots[4].linkCollection == 5);
+}
+
+TEST_CASE("Decodes contacts from a sample report", "[PtpReportLayout]")
+{
+    const SampleDevice d{5};
+    const PtpReportLayout l = compiled(d);
+    const auto r = report(d, {{true, 3, 1000, 400}, {false, 0, 0, 0}, {true, 7, 65535, 749}}, 2);
+
+    PtpContactFrame frame;
+    REQUIRE(l.decode(r.data(), r.size(), frame));
+    REQUIRE(frame.contactCount == 2);
+    REQUIRE(frame.numSlots == 5);
+    REQUIRE(frame.slots[0].tip);
+    REQUIRE(frame.slots[0].contactId == 3);
+    REQUIRE(frame.slots[0].x == 1000);
+    REQUIRE(frame.slots[0].y == 400);
+    REQUIRE(frame.slots[0].confident);
+    REQUIRE_FALSE(frame.slots[1].tip); // confidence bit set, tip clear
+    REQUIRE(frame.slots[2].tip);
+    REQUIRE(frame.slots[2].contactId == 7);
+    REQUIRE(frame.slots[2].x == 65535);
+    REQUIRE(frame.slots[2].y == 749);
+    REQUIRE_FALSE(frame.slots[4].tip);
+}
+
+TEST_CASE("Reports with another ID are not decoded", "[PtpReportLayout]")
+{
+    const SampleDevice d{2};
+    const PtpReportLayout l = compiled(d);
+    auto r = report(d, {{true, 1, 10, 10}, {true, 2, 20, 20}}, 2);
+    r[0] = 0x03; // e.g. the device's mouse-mode or feature report
+
+    PtpContactFrame frame;
+    REQUIRE_FALSE(l.decode(r.data(), r.size(), frame));
+    REQUIRE_FALSE(l.decode(r.data(), 0, frame));
+}
+
+TEST_CASE("Devices without report IDs decode from byte 0", "[PtpReportLayout]")
+{
+    // Single-collection descriptor, no report ID: fields start at bit 0.
+    const PtpFieldDesc f[] = {
+        {kHidPageDigitizer, kHidUsageTipSwitch, 1, 0, {0, 1}, 0, 1},
+        {kHidPageDigitizer, kHidUsageContactId, 1, 0, {1, 7}, 0, 127},
+        {kHidPageGenericDesktop, kHidUsageY, 1, 0, {8, 16}, 0, 2000},
+        {kHidPageDigitizer, kHidUsageContactCount, 0, 0, {24, 8}, 0, 5},
+    };
+    PtpReportLayout l;
+    REQUIRE(l.compile(f, 4, false));
+    const uint8_t r[] = {0x0B /* tip, id 5 */, 0xD0, 0x07 /* 2000 */, 0x01};
+
+    PtpContactFrame frame;
+    REQUIRE(l.decode(r, sizeof(r), frame));
+    REQUIRE(frame.slots[0].tip);
+    REQUIRE(frame.slots[0].contactId == 5);
+    REQUIRE(frame.slots[0].y == 2000);
+    REQUIRE(frame.contactCount == 1);
+    REQUIRE(frame.slots[0].x == 0); // absent field reads 0
+}
+
+TEST_CASE("Packed fields extract across byte boundaries", "[PtpReportLayout]")
+{
+    std::vector<uint8_t> r(12, 0);
+    putBits(r, 3, 12, 0xABC);        // straddles bytes 0-1
+    putBits(r, 15, 4, 0x9);          // straddles bytes 1-2
+    putBits(r, 29, 32, 0xDEADBEEF);  // 32 bits at an odd offset, spans 5 bytes
+    putBits(r, 95, 1, 1);            // the report's last bit
+
+    std::vector<uint8_t> padded(r);
+    padded.resize(r.size() + 8, 0);
+    REQUIRE(PtpReportLayout::extract(padded.data(), {3, 12}) == 0xABC);
+    REQUIRE(PtpReportLayout::extract(padded.data(), {15, 4}) == 0x9);
+    REQUIRE(PtpReportLayout::extract(padded.data(), {29, 32}) == 0xDEADBEEF);
+    REQUIRE(PtpReportLayout::extract(padded.data(), {95, 1}) == 1);
+    REQUIRE(PtpReportLayout::extract(padded.data(), {29, 0}) == 0);
+}
+
+TEST_CASE("Fields beyond the decodable report size are ignored", "[PtpReportLayout]")
+{
+    auto f = SampleDevice{2}.fields();
+    for (auto& x : f)
+        if (x.usage == kHidUsageY && x.linkCollection == 2)
+            x.field.bitOffset = 8 * PtpReportLayout::kMaxReportBytes; // past the padded copy
+    PtpReportLayout l;
+    REQUIRE(l.compile(f.data(), f.size(), true));
+    REQUIRE_FALSE(l.slots[1].y.present());
+    REQUIRE(l.slots[0].y.present());
+    REQUIRE(l.spanBytes <= PtpReportLayout::kMaxReportBytes + 8);
+
+    f.back().field.bitSize = 40; // contact count wider than 32 bits
+    REQUIRE_FALSE(l.compile(f.data(), f.size(), true));
+}
+
+TEST_CASE("Fields past a short report read as zero", "[PtpReportLayout]")
+{
+    const SampleDevice d{2};
+    const PtpReportLayout l = compiled(d);
+    auto r = report(d, {{true, 1, 300, 500}, {true, 2, 310, 510}}, 2);
+    r.resize(7); // truncated after finger 0
+
+    PtpContactFrame frame;
+    REQUIRE(l.decode(r.data(), r.size(), frame));
+    REQUIRE(frame.slots[0].y == 500);
+    REQUIRE_FALSE(frame.slots[1].tip);
+    REQUIRE(frame.slots[1].y == 0);
+    REQUIRE(frame.contactCount == 0);
+}
+
+TEST_CASE("Cleared confidence marks a palm contact", "[PtpReportLayout]")
+{
+    const SampleDevice d{2};
+    const PtpReportLayout l = compiled(d);
+    PtpContactFrame frame;
+
+    auto r = report(d, {{true, 0, 100, 200}, {true, 1, 600, 500, false}}, 2);
+    REQUIRE(l.decode(r.data(), r.size(), frame));
+    REQUIRE(frame.slots[0].confident);
+    REQUIRE(frame.slots[1].tip);
+    REQUIRE_FALSE(frame.slots[1].confident);
+
+    // Without a confidence usage every contact is taken as intended.
+    std::vector<PtpFieldDesc> f;
+    for (const auto& x : d.fields())
+        if (x.usage != kHidUsageConfidence)
+            f.push_back(x);
+    PtpReportLayout noConf;
+    REQUIRE(noConf.compile(f.data(), f.size(), true));
+    REQUIRE_FALSE(noConf.slots[1].confidence.present());
+    REQUIRE(noConf.decode(r.data(), r.size(), frame));
+    REQUIRE(frame.slots[1].confident);
+}
+
+TEST_CASE("PTP report decode throughput", "[PtpReportLayout][!benchmark]")
+{
+    const SampleDevice d{5};
+    const PtpReportLayout l = compiled(d);
+    std::vector<std::vector<uint8_t>> reports;
+    for (uint16_t i = 0; i < 256; ++i)
+        reports.push_back(report(d, {{true, 0, 100, static_cast<uint16_t>(300 + i)},
+                                     {true, 1, 200, static_cast<uint16_t>(320 + i)}}, 2));
+
+    BENCHMARK("decode x256 (5 slots)")
+    {
+        PtpContactFrame frame;
+        uint32_t sum = 0;
+        for (const auto& r : reports)
+            if (l.decode(r.data(), r.size(), frame))
+                sum += frame.slots[1].y;
+        return sum;
+    };
+}
@@ -0,0 +1,642 @@
+// =============================================================================
+// Unit tests for RawInputProcessor — Doc 3 §3.1, R-08
+// Batches are built in the Win32 GetRawInputBuffer wire layout (RAWINPUTHEADER
+// + RAWMOUSE / RAWHID, 8-byte aligned packets) and replayed through the
+// processor: mouse wheel gating, relative motion, PTP device registration (arrival, removal,
+// switching, profiles), two-finger deltas, malformed packets, and a
+// packets-per-second benchmark.
+// Pure logic — no Win32 API dependencies.
+// =============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "smoothzoom/input/RawInputProcessor.h"
+#include "smoothzoom/input/ScrollNormalizer.h"
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace SmoothZoom;
+using Catch::Approx;
+
+namespace
+{
+
+constexpr uint64_t kMouse = 0x1000;
+constexpr uint64_t kTouchpad = 0x2000;
+constexpr uint64_t kOtherTouchpad = 0x3000;
+constexpr uint64_t kNotAPtp = 0x4000;
+constexpr uint8_t kReportId = 0x04;
+constexpr int32_t kRangeX = 1227;
+constexpr int32_t kRangeY = 749;
+constexpr uint16_t kTouchpadVid = 0x06CB;
+constexpr uint16_t kTouchpadPid = 0xCE78;
+
+// Two-finger PTP report: byte 0 report ID; finger i at 1 + 6i:
+// [tip:1 pad:7][id:8][y:16][x:16]; contact count at byte 13.
+constexpr size_t kReportBytes = 14;
+
+std::vector<PtpFieldDesc> touchpadFields()
+{
+    std::vector<PtpFieldDesc> f;
+    for (int i = 0; i < 2; ++i)
+    {
+        const auto lc = static_cast<uint16_t>(i + 1);
+        const auto base = static_cast<uint16_t>(8 * (1 + 6 * i));
+        f.push_back({kHidPageDigitizer, kHidUsageTipSwitch, lc, kReportId, {base, 1}, 0, 1});
+        f.push_back({kHidPageDigitizer, kHidUsageContactId, lc, kReportId,
+                     {static_cast<uint16_t>(base + 8), 8}, 0, 255});
+        f.push_back({kHidPageGenericDesktop, kHidUsageY, lc, kReportId,
+                     {static_cast<uint16_t>(base + 16), 16}, 0, kRangeY});
+        f.push_back({kHidPageGenericDesktop, kHidUsageX, lc, kReportId,
+                     {static_cast<uint16_t>(base + 32), 16}, 0, kRangeX});
+    }
+    f.push_back({kHidPageDigitizer, kHidUsageContactCount, 0, kReportId, {104, 8}, 0, 5});
+    return f;
+}
+
+std::vector<uint8_t> ptpReport(bool tip0, uint16_t y0, bool tip1, uint16_t y1,
+                               uint16_t x0 = 400, uint16_t x1 = 800)
+{
+    std::vector<uint8_t> r(kReportBytes, 0);
+    r[0] = kReportId;
+    r[1] = tip0 ? 1 : 0;
+    r[2] = 0;
+    std::memcpy(&r[3], &y0, 2);
+    std::memcpy(&r[5], &x0, 2);
+    r[7] = tip1 ? 1 : 0;
+    r[8] = 1;
+    std::memcpy(&r[9], &y1, 2);
+    std::memcpy(&r[11], &x1, 2);
+    r[13] = static_cast<uint8_t>((tip0 ? 1 : 0) + (tip1 ? 1 : 0));
+    return r;
+}
+
+// Two fingers side by side at y, `dist` apart, centered on the pad.
+std::vector<uint8_t> ptpPinch(uint16_t dist, uint16_t y = 400)
+{
+    const auto x0 = static_cast<uint16_t>(600 - dist / 2);
+    return ptpReport(true, y, true, y, x0, static_cast<uint16_t>(x0 + dist));
+}
+
+// Loader stand-in for loadPtpReportLayout + RIDI_DEVICEINFO: the two touchpads
+// compile, anything else is not a PTP.
+struct Devices
+{
+    int loads = 0;
+
+    static bool load(void* ctx, uint64_t device, PtpDeviceInfo& out)
+    {
+        auto* self = static_cast<Devices*>(ctx);
+        ++self->loads;
+        if (device != kTouchpad && device != kOtherTouchpad)
+            return false;
+        out.vendorId = device == kTouchpad ? kTouchpadVid : uint16_t{0x05AC};
+        out.productId = device == kTouchpad ? kTouchpadPid : uint16_t{0x0265};
+        const auto f = touchpadFields();
+        return out.layout.compile(f.data(), f.size(), true);
+    }
+};
+
+// GetRawInputBuffer-layout batch.
+struct Batch
+{
+    std::vector<uint8_t> bytes;
+    uint32_t count = 0;
+
+    uint8_t* begin(uint32_t type, uint32_t size, uint64_t device)
+    {
+        const size_t at = nextRawPacket(bytes.size(), 0);
+        bytes.resize(at + size, 0);
+        RawPacketHeader h{type, size, device, 0};
+        std::memcpy(&bytes[at], &h, sizeof(h));
+        ++count;
+        return &bytes[at];
+    }
+
+    void mouse(uint16_t buttonFlags, int16_t data, uint64_t device = kMouse)
+    {
+        RawMousePacket m{};
+        m.buttonFlags = buttonFlags;
+        m.buttonData = static_cast<uint16_t>(data);
+        uint8_t* p = begin(kRawTypeMouse, kRawMouseOffset + sizeof(m), device);
+        std::memcpy(p + kRawMouseOffset, &m, sizeof(m));
+    }
+
+    void wheel(int16_t delta) { mouse(kRawMouseWheel, delta); }
+
+    void move(int32_t dx, int32_t dy, uint16_t flags = 0)
+    {
+        RawMousePacket m{};
+        m.flags = flags;
+        m.lastX = dx;
+        m.lastY = dy;
+        uint8_t* p = begin(kRawTypeMouse, kRawMouseOffset + sizeof(m), kMouse);
+        std::memcpy(p + kRawMouseOffset, &m, sizeof(m));
+    }
+
+    void hid(uint64_t device, const std::vector<std::vector<uint8_t>>& reports)
+    {
+        const auto sizeHid = static_cast<uint32_t>(reports.empty() ? 0 : reports[0].size());
+        const RawHidPacket h{sizeHid, static_cast<uint32_t>(reports.size())};
+        uint8_t* p = begin(kRawTypeHid,
+                           static_cast<uint32_t>(kRawHidDataOffset + sizeHid * reports.size()), device);
+        std::memcpy(p + sizeof(RawPacketHeader), &h, sizeof(h));
+        for (size_t i = 0; i < reports.size(); ++i)
+            std::memcpy(p + kRawHidDataOffset + i * sizeHid, reports[i].data(), sizeHid);
+    }
+
+    RawInputBatchStats run(RawInputProcessor& p, const RawInputGate& gate) const
+    {
+        RawInputBatchStats stats;
+        p.process(bytes.data(), bytes.size(), count, gate, stats);
+        return stats;
+    }
+};
+
+constexpr int64_t kBatchTimeUs = 5000000;
+constexpr RawInputGate kHeld{true, false, kBatchTimeUs};
+constexpr RawInputGate kNotHeld{false, false, kBatchTimeUs};
+constexpr RawInputGate kHeldNatural{true, true, kBatchTimeUs};
+
+// Wheel-equivalent units the processor emits for one averaged device-unit delta.
+int32_t expectedWheel(int32_t avgDeltaY, bool natural = false, float axisScale = 1.0f)
+{
+    const float v = ptpDeltaToWheelEquiv(static_cast<float>(natural ? avgDeltaY : -avgDeltaY),
+                                         PtpAxisScale{kRangeY, axisScale});
+    return static_cast<int32_t>(v);
+}
+
+} // namespace
+
+TEST_CASE("Packets are walked at 8-byte alignment", "[RawInputProcessor]")
+{
+    REQUIRE(sizeof(RawPacketHeader) == 24);
+    REQUIRE(sizeof(RawMousePacket) == 24);
+    REQUIRE(kRawHidDataOffset == 32);
+    REQUIRE(nextRawPacket(0, 48) == 48);
+    REQUIRE(nextRawPacket(0, 42) == 48);
+    REQUIRE(nextRawPacket(48, 33) == 88);
+}
+
+TEST_CASE("Mouse wheel deltas are summed only while the modifier is held", "[RawInputProcessor]")
+{
+    RawInputProcessor p;
+    Batch b;
+    b.wheel(120);
+    b.wheel(-40);
+    b.mouse(kRawMouseHWheel, 60);
+    b.mouse(0x0001 /* left button down */, 0);
+    b.begin(kRawTypeKeyboard, 40, 0x5000);
+
+    auto s = b.run(p, kHeld);
+    REQUIRE(s.packets == 5);
+    REQUIRE(s.wheelPackets == 3);
+    REQUIRE(s.ignored == 1);
+    REQUIRE(s.scrollDelta == 140);
+
+    // One event per wheel packet, so each can be matched against the LL hook's
+    // copy of the same notch (ScrollDeduplicator).
+    REQUIRE(s.eventCount == 3);
+    REQUIRE(s.events[0].source == ScrollSource::RawMouse);
+    REQUIRE(s.events[0].device == kMouse);
+    REQUIRE(s.events[0].timeUs == kBatchTimeUs);
+    REQUIRE(s.events[0].delta == 120);
+    REQUIRE(s.events[1].delta == -40);
+    REQUIRE(s.events[2].delta == 60);
+
+    const auto gated = b.run(p, kNotHeld);
+    REQUIRE(gated.scrollDelta == 0);
+    REQUIRE(gated.eventCount == 0);
+}
+
+TEST_CASE("Relative motion is summed per batch for the pointer stream", "[RawInputProcessor]")
+{
+    RawInputProcessor p;
+    Batch b;
+    b.move(3, -1);
+    b.move(4, 2);
+    b.move(30000, 30000, kRawMouseMoveAbsolute); // tablet / remote session
+    b.wheel(120);
+    b.move(-2, 0);
+
+    RawInputGate gate = kHeld;
+    gate.pointerMotion = true;
+    const auto s = b.run(p, gate);
+    REQUIRE(s.motionPackets == 3);
+    REQUIRE(s.motionX == 5);
+    REQUIRE(s.motionY == 1);
+    REQUIRE(s.scrollDelta == 120);
+
+    const auto off = b.run(p, kHeld);
+    REQUIRE(off.motionPackets == 0);
+    REQUIRE(off.motionX == 0);
+}
+
+TEST_CASE("Wheel events past the batch event limit join the newest event", "[RawInputProcessor]")
+{
+    RawInputProcessor p;
+    Batch b;
+    for (int i = 0; i < RawInputBatchStats::kMaxEvents + 8; ++i)
+        b.wheel(120);
+    const auto s = b.run(p, kHeld);
+    REQUIRE(s.eventCount == RawInputBatchStats::kMaxEvents);
+    REQUIRE(s.scrollDelta == 120 * (RawInputBatchStats::kMaxEvents + 8));
+    REQUIRE(s.events[RawInputBatchStats::kMaxEvents - 1].delta == 120 * 9);
+}
+
+TEST_CASE("Two-finger PTP motion emits normalized wheel units", "[RawInputProcessor]")
+{
+    Devices devices;
+    RawInputProcessor p;
+    p.setDeviceLoader(&Devices::load, &devices);
+
+    Batch b;
+    b.hid(kTouchpad, {ptpReport(true, 300, true, 310)});
+    b.hid(kTouchpad, {ptpReport(true, 320, true, 330), ptpReport(true, 340, true, 350)});
+    const auto s = b.run(p, kHeld);
+
+    REQUIRE(devices.loads == 1);
+    REQUIRE(s.loadedCount == 1);
+    REQUIRE(s.loaded[0] == kTouchpad);
+    REQUIRE(p.ptpDevices().find(kTouchpad) != nullptr);
+    REQUIRE(p.ptpDevices().find(kTouchpad)->vendorId == kTouchpadVid);
+    REQUIRE(s.hidReports == 3);
+    REQUIRE(s.packets == 2);
+    // Two deltas of +20 device units (fingers moving down → zoom out).
+    REQUIRE(s.scrollDelta < 0);
+    REQUIRE(s.scrollDelta >= 2 * expectedWheel(20) - 1);
+    REQUIRE(s.scrollDelta <= 2 * expectedWheel(20));
+    // Consecutive touchpad packets form one event.
+    REQUIRE(s.eventCount == 1);
+    REQUIRE(s.events[0].source == ScrollSource::PtpHid);
+    REQUIRE(s.events[0].device == kTouchpad);
+    REQUIRE(s.events[0].delta == s.scrollDelta);
+}
+
+TEST_CASE("Spreading two fingers zooms in by the distance ratio", "[RawInputProcessor]")
+{
+    Devices devices;
+    RawInputProcessor p;
+    p.setDeviceLoader(&Devices::load, &devices);
+
+    // 200 → 400 units apart: 2× zoom, carried as log-zoom ln 2, not wheel units.
+    Batch b;
+    std::vector<std::vector<uint8_t>> reports;
+    for (uint16_t d = 200; d <= 400; d = static_cast<uint16_t>(d + 10))
+        reports.push_back(ptpPinch(d));
+    b.hid(kTouchpad, reports);
+    const float expected = std::log(2.0f);
+
+    SECTION("traditional scrolling")
+    {
+        const auto s = b.run(p, kHeld);
+        REQUIRE(s.pinchReports == 19);
+        REQUIRE(s.pinchLogZoom == Approx(expected));
+        REQUIRE(s.scrollDelta == 0);
+        REQUIRE(s.eventCount == 1);
+        REQUIRE(s.events[0].delta == 0);
+        REQUIRE(s.events[0].logZoom == Approx(expected));
+    }
+    SECTION("natural scrolling does not flip a pinch")
+    {
+        REQUIRE(b.run(p, kHeldNatural).pinchLogZoom == Approx(expected));
+    }
+    SECTION("the profile's scroll sensitivity does not scale a pinch")
+    {
+        PtpDeviceProfile prof;
+        prof.vendorId = kTouchpadVid;
+        prof.productId = kTouchpadPid;
+        prof.sensitivity = 0.5f;
+        p.setDeviceProfiles(&prof, 1);
+        REQUIRE(b.run(p, kHeld).pinchLogZoom == Approx(expected));
+    }
+    SECTION("gated")
+    {
+        const auto s = b.run(p, kNotHeld);
+        REQUIRE(s.pinchReports == 0);
+        REQUIRE(s.pinchLogZoom == 0.0f);
+        REQUIRE(s.eventCount == 0);
+    }
+
+    // Pinching back zooms out again.
+    Batch back;
+    reports.clear();
+    for (uint16_t d = 400; d >= 200; d = static_cast<uint16_t>(d - 10))
+        reports.push_back(ptpPinch(d));
+    back.hid(kTouchpad, reports);
+    REQUIRE(back.run(p, kHeld).pinchLogZoom == Approx(-expected));
+}
+
+TEST_CASE("Natural scrolling keeps the device's sign", "[RawInputProcessor]")
+{
+    Devices devices;
+    RawInputProcessor p;
+    p.setDeviceLoader(&Devices::load, &devices);
+
+    Batch b;
+    b.hid(kTouchpad, {ptpReport(true, 300, true, 300), ptpReport(true, 330, true, 330)});
+    REQUIRE(b.run(p, kHeldNatural).scrollDelta == expectedWheel(30, true));
+    REQUIRE(expectedWheel(30, true) > 0);
+}
+
+TEST_CASE("Contacts are tracked while gated", "[RawInputProcessor]")
+{
+    Devices devices;
+    RawInputProcessor p;
+    p.setDeviceLoader(&Devices::load, &devices);
+
+    // Fingers travel 200 units with the modifier up; pressing it must not
+    // release that travel as one jump.
+    Batch gated;
+    gated.hid(kTouchpad, {ptpReport(true, 100, true, 100), ptpReport(true, 300, true, 300)});
+    REQUIRE(gated.run(p, kNotHeld).scrollDelta == 0);
+
+    Batch held;
+    held.hid(kTouchpad, {ptpReport(true, 305, true, 305)});
+    REQUIRE(held.run(p, kHeld).scrollDelta == expectedWheel(5));
+}
+
+TEST_CASE("Characterization samples are capped per device", "[RawInputProcessor]")
+{
+    Devices devices;
+    RawInputProcessor p;
+    p.setDeviceLoader(&Devices::load, &devices);
+
+    Batch b;
+    for (uint16_t i = 0; i < 12; ++i)
+        b.hid(kTouchpad, {ptpReport(true, static_cast<uint16_t>(100 + 10 * i),
+                                    true, static_cast<uint16_t>(100 + 10 * i))});
+    auto s = b.run(p, kNotHeld); // sampled regardless of the modifier
+    REQUIRE(s.charSampleCount == RawInputProcessor::kCharSamplesPerDevice);
+    REQUIRE(s.charSamples[0].index == 1);
+    REQUIRE(s.charSamples[0].fingers == 2);
+    REQUIRE(s.charSamples[0].avgDeltaY == 10);
+    REQUIRE(s.charSamples[7].index == 8);
+    REQUIRE(b.run(p, kNotHeld).charSampleCount == 0);
+
+    // A new device is characterized afresh.
+    Batch other;
+    other.hid(kOtherTouchpad, {ptpReport(true, 100, true, 100), ptpReport(true, 90, true, 90)});
+    s = other.run(p, kNotHeld);
+    REQUIRE(s.loadedCount == 1);
+    REQUIRE(s.charSampleCount == 1);
+    REQUIRE(s.charSamples[0].device == kOtherTouchpad);
+    REQUIRE(s.charSamples[0].index == 1);
+}
+
+TEST_CASE("Switching devices keeps each pad's layout and contacts", "[RawInputProcessor]")
+{
+    Devices devices;
+    RawInputProcessor p;
+    p.setDeviceLoader(&Devices::load, &devices);
+
+    Batch b;
+    b.hid(kTouchpad, {ptpReport(true, 100, true, 100)});
+    b.hid(kOtherTouchpad, {ptpReport(true, 500, true, 500)}); // first report: no previous Y
+    b.hid(kTouchpad, {ptpReport(true, 140, true, 140)});     // continues from 100
+    const auto s = b.run(p, kHeld);
+    REQUIRE(devices.loads == 2);
+    REQUIRE(p.ptpDevices().size() == 2);
+    REQUIRE(s.scrollDelta == expectedWheel(40));
+
+    // Going back and forth again loads nothing.
+    REQUIRE(b.run(p, kHeld).loadedCount == 0);
+    REQUIRE(devices.loads == 2);
+}
+
+TEST_CASE("Devices are loaded on arrival and dropped on removal", "[RawInputProcessor]")
+{
+    Devices devices;
+    RawInputProcessor p;
+    p.setDeviceLoader(&Devices::load, &devices);
+
+    const PtpDevice* d = p.deviceArrived(kTouchpad);
+    REQUIRE(d != nullptr);
+    REQUIRE(d->usable);
+    REQUIRE(devices.loads == 1);
+
+    Batch b;
+    b.hid(kTouchpad, {ptpReport(true, 100, true, 100), ptpReport(true, 130, true, 130)});
+    auto s = b.run(p, kHeld);
+    REQUIRE(s.loadedCount == 0);
+    REQUIRE(s.scrollDelta == expectedWheel(30));
+
+    // A notification for a pad whose first packet came first reloads nothing.
+    REQUIRE(p.deviceArrived(kTouchpad) == d);
+    REQUIRE(devices.loads == 1);
+
+    p.deviceRemoved(kTouchpad);
+    REQUIRE(p.ptpDevices().find(kTouchpad) == nullptr);
+    s = b.run(p, kHeld); // the handle is loaded afresh
+    REQUIRE(devices.loads == 2);
+    REQUIRE(s.loadedCount == 1);
+}
+
+TEST_CASE("A device without a PTP layout is loaded once until it changes", "[RawInputProcessor]")
+{
+    Devices devices;
+    RawInputProcessor p;
+    p.setDeviceLoader(&Devices::load, &devices);
+
+    Batch b;
+    for (int i = 0; i < 5; ++i)
+        b.hid(kNotAPtp, {ptpReport(true, 100, true, 100)});
+    auto s = b.run(p, kHeld);
+    REQUIRE(devices.loads == 1);
+    REQUIRE(s.ignored == 5);
+    REQUIRE(s.hidReports == 0);
+
+    b.run(p, kHeld);
+    REQUIRE(devices.loads == 1); // remembered as unusable
+
+    // An arrival notification retries it; so does a re-plug.
+    p.deviceArrived(kNotAPtp);
+    REQUIRE(devices.loads == 2);
+    p.deviceRemoved(kNotAPtp);
+    b.run(p, kHeld);
+    REQUIRE(devices.loads == 3);
+
+    RawInputProcessor noLoader;
+    REQUIRE(b.run(noLoader, kHeld).ignored == 5);
+}
+
+TEST_CASE("A matching profile tunes only its device", "[RawInputProcessor]")
+{
+    Devices devices;
+    RawInputProcessor p;
+    p.setDeviceLoader(&Devices::load, &devices);
+
+    // Each batch is a fresh 60-unit swipe: lift, touch down, move.
+    const std::vector<std::vector<uint8_t>> swipe{
+        ptpReport(false, 0, false, 0), ptpReport(true, 300, true, 300), ptpReport(true, 360, true, 360)};
+    Batch b;
+    b.hid(kTouchpad, swipe);
+    Batch other;
+    other.hid(kOtherTouchpad, swipe);
+    b.run(p, kNotHeld);     // register both pads first
+    other.run(p, kNotHeld);
+
+    PtpDeviceProfile prof;
+    prof.vendorId = kTouchpadVid;
+    prof.productId = kTouchpadPid;
+
+    SECTION("axis scale")
+    {
+        prof.axisScale = 2.0f;
+        p.setDeviceProfiles(&prof, 1); // applies to the registered device at once
+        REQUIRE(p.ptpDevices().find(kTouchpad)->hasProfile);
+        REQUIRE(b.run(p, kHeld).scrollDelta == expectedWheel(60, false, 2.0f));
+        REQUIRE(other.run(p, kHeld).scrollDelta == expectedWheel(60));
+    }
+    SECTION("sensitivity")
+    {
+        prof.sensitivity = 0.5f;
+        p.setDeviceProfiles(&prof, 1);
+        const int32_t full = expectedWheel(60);
+        const int32_t half = b.run(p, kHeld).scrollDelta;
+        REQUIRE(half >= full / 2 - 1);
+        REQUIRE(half <= full / 2 + 1);
+    }
+    SECTION("natural-scroll quirk")
+    {
+        prof.invertNaturalScroll = true;
+        p.setDeviceProfiles(&prof, 1);
+        REQUIRE(b.run(p, kHeld).scrollDelta == expectedWheel(60, true));
+        REQUIRE(b.run(p, kHeldNatural).scrollDelta == expectedWheel(60));
+        REQUIRE(other.run(p, kHeldNatural).scrollDelta == expectedWheel(60, true));
+    }
+    SECTION("profiles survive a re-plug")
+    {
+        prof.axisScale = 2.0f;
+        p.setDeviceProfiles(&prof, 1);
+        p.deviceRemoved(kTouchpad);
+        REQUIRE_FALSE(p.ptpDevices().find(kTouchpad));
+        REQUIRE(p.deviceArrived(kTouchpad)->hasProfile);
+        REQUIRE(p.ptpDevices().find(kOtherTouchpad)->hasProfile == false);
+    }
+}
+
+TEST_CASE("Malformed packets are skipped without overrunning the batch", "[RawInputProcessor]")
+{
+    Devices devices;
+    RawInputProcessor p;
+    p.setDeviceLoader(&Devices::load, &devices);
+
+    SECTION("HID payload shorter than count x size")
+    {
+        Batch b;
+        b.hid(kTouchpad, {ptpReport(true, 100, true, 100), ptpReport(true, 110, true, 110)});
+        uint32_t bogusCount = 9;
+        std::memcpy(&b.bytes[sizeof(RawPacketHeader) + 4], &bogusCount, 4);
+        b.wheel(120);
+        const auto s = b.run(p, kHeld);
+        REQUIRE(s.packets == 2);
+        REQUIRE(s.hidReports == 0);
+        REQUIRE(s.scrollDelta == 120); // the next packet is still reached
+    }
+    SECTION("Packet size past the end of the batch")
+    {
+        Batch b;
+        b.wheel(120);
+        b.wheel(120);
+        const uint32_t huge = 4096;
+        std::memcpy(&b.bytes[48 + 4], &huge, 4);
+        const auto s = b.run(p, kHeld);
+        REQUIRE(s.packets == 1);
+        REQUIRE(s.ignored == 1);
+        REQUIRE(s.scrollDelta == 120);
+    }
+    SECTION("Count larger than the batch")
+    {
+        Batch b;
+        b.wheel(120);
+        RawInputBatchStats s;
+        p.process(b.bytes.data(), b.bytes.size(), 50, kHeld, s);
+        REQUIRE(s.packets == 1);
+    }
+    SECTION("Foreign report IDs inside a touchpad packet")
+    {
+        Batch b;
+        auto r = ptpReport(true, 100, true, 100);
+        r[0] = 0x03;
+        b.hid(kTouchpad, {r});
+        const auto s = b.run(p, kHeld);
+        REQUIRE(s.hidReports == 0);
+        REQUIRE(s.ignored == 1);
+    }
+}
+
+namespace
+{
+
+// Mixed replay: a two-finger pan (4 reports per packet, as PTP hybrid mode
+// batches them) interleaved with wheel packets.
+Batch syntheticRecording(int packets)
+{
+    Batch b;
+    uint16_t y = 100;
+    for (int i = 0; i < packets; ++i)
+    {
+        if (i % 8 == 7)
+        {
+            b.wheel(i % 16 == 7 ? 120 : -120);
+            continue;
+        }
+        std::vector<std::vector<uint8_t>> reports;
+        for (int r = 0; r < 4; ++r, y = static_cast<uint16_t>(100 + (y + 3) % 600))
+            reports.push_back(ptpReport(true, y, true, static_cast<uint16_t>(y + 20)));
+        b.hid(kTouchpad, reports);
+    }
+    return b;
+}
+
+} // namespace
+
+TEST_CASE("RawInputProcessor throughput", "[RawInputProcessor][!benchmark]")
+{
+    Devices devices;
+    RawInputProcessor p;
+    p.setDeviceLoader(&Devices::load, &devices);
+    const Batch b = syntheticRecording(512);
+
+    BENCHMARK("process 512 packets (PTP + wheel)")
+    {
+        return b.run(p, kHeld).scrollDelta;
+    };
+}
+
+// Packets and HID reports per second replaying a synthetic recording. Hidden;
+// run with:
+//   smoothzoom_tests "[.raw-input-report]"
+TEST_CASE("RawInputProcessor throughput report", "[.raw-input-report]")
+{
+    constexpr int kPackets = 4096;
+    constexpr int kPasses = 512; // ~2M packets
+    Devices devices;
+    RawInputProcessor p;
+    p.setDeviceLoader(&Devices::load, &devices);
+    const Batch b = syntheticRecording(kPackets);
+
+    uint64_t packets = 0;
+    uint64_t reports = 0;
+    int64_t delta = 0;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < kPasses; ++i)
+    {
+        const auto s = b.run(p, kHeld);
+        packets += s.packets;
+        reports += s.hidReports;
+        delta += s.scrollDelta;
+    }
+    const double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    std::printf("%12s %12s %12s %12s\n", "packets", "Mpackets/s", "Mreports/s", "ns/packet");
+    std::printf("%12llu %12.2f %12.2f %12.1f   (delta %lld)\n",
+                static_cast<unsigned long long>(packets), static_cast<double>(packets) / sec / 1e6,
+                static_cast<double>(reports) / sec / 1e6, sec / static_cast<double>(packets) * 1e9,
+                static_cast<long long>(delta));
+}
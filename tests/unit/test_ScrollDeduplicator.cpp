@@ -0,0 +1,272 @@
+// =============================================================================
+// Unit tests for ScrollDeduplicator — Doc 3 §3.1, R-08
+// Synthetic interleaved streams from the LL hook, Raw Input mouse and PTP HID
+// paths, submitted in time order as the render thread's queue merge does:
+// per-notch fingerprint matching in either arrival order (including skews far
+// below the old 15.6 ms tick), one source per touchpad gesture, handover when
+// the authority falls silent, gesture boundaries, and the stats invariant.
+// Pure logic — no Win32 API dependencies.
+// =============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "smoothzoom/logic/ScrollDeduplicator.h"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+using namespace SmoothZoom;
+using Catch::Approx;
+
+namespace
+{
+
+constexpr uint64_t kMouse = 0x1000;
+constexpr uint64_t kTouchpad = 0x2000;
+
+ScrollEvent hook(int64_t timeUs, int32_t delta)
+{
+    return {timeUs, 0, delta, ScrollSource::LLHook};
+}
+
+ScrollEvent rawMouse(int64_t timeUs, int32_t delta)
+{
+    return {timeUs, kMouse, delta, ScrollSource::RawMouse};
+}
+
+ScrollEvent ptp(int64_t timeUs, int32_t delta)
+{
+    return {timeUs, kTouchpad, delta, ScrollSource::PtpHid};
+}
+
+ScrollEvent pinch(int64_t timeUs, float logZoom)
+{
+    return {timeUs, kTouchpad, 0, ScrollSource::PtpHid, logZoom};
+}
+
+// Submit in time order (stable for equal stamps); returns the applied total.
+int32_t feed(ScrollDeduplicator& d, std::vector<ScrollEvent> events)
+{
+    std::stable_sort(events.begin(), events.end(),
+                     [](const ScrollEvent& a, const ScrollEvent& b) { return a.timeUs < b.timeUs; });
+    int32_t total = 0;
+    for (const ScrollEvent& e : events)
+        total += d.submit(e);
+    return total;
+}
+
+void requireConsistent(const ScrollDedupStats& s)
+{
+    REQUIRE(s.events == s.accepted + s.duplicates + s.suppressed);
+    REQUIRE(s.released <= s.accepted);
+}
+
+} // namespace
+
+TEST_CASE("A wheel notch seen by the LL hook and Raw Input counts once", "[ScrollDeduplicator]")
+{
+    ScrollDeduplicator d;
+    std::vector<ScrollEvent> events;
+    // 10 notches 20 ms apart; the copies land 300 µs apart — inside one
+    // GetTickCount64 tick, where a tick comparison cannot order them.
+    for (int i = 0; i < 10; ++i)
+    {
+        const int64_t t = 1000000 + i * 20000;
+        events.push_back(hook(t, 120));
+        events.push_back(rawMouse(t + 300, 120));
+    }
+    REQUIRE(feed(d, events) == 1200);
+    REQUIRE(d.stats().accepted == 10);
+    REQUIRE(d.stats().duplicates == 10);
+    REQUIRE(d.stats().suppressed == 0);
+    REQUIRE(d.stats().gestures == 1);
+    REQUIRE(d.authoritySource() == ScrollSource::LLHook);
+    requireConsistent(d.stats());
+}
+
+TEST_CASE("A copy arriving before the authority's event is matched late", "[ScrollDeduplicator]")
+{
+    ScrollDeduplicator d;
+    // The hook takes the gesture; afterwards each Raw Input copy comes first.
+    std::vector<ScrollEvent> events{hook(1000000, 120), rawMouse(1000400, 120)};
+    for (int i = 1; i < 6; ++i)
+    {
+        const int64_t t = 1000000 + i * 15000;
+        events.push_back(rawMouse(t - 2000, 120));
+        events.push_back(hook(t, 120));
+    }
+    REQUIRE(feed(d, events) == 720);
+    REQUIRE(d.stats().duplicates == 6);
+    REQUIRE(d.stats().suppressed == 0);
+    REQUIRE(d.stats().handovers == 0);
+    requireConsistent(d.stats());
+}
+
+TEST_CASE("Only the same sign and magnitude is a duplicate", "[ScrollDeduplicator]")
+{
+    ScrollDeduplicator d;
+    REQUIRE(d.submit(hook(1000000, 120)) == 120);
+    REQUIRE(d.submit(rawMouse(1000500, -120)) == 0); // not the same notch
+    REQUIRE(d.submit(rawMouse(1000600, 40)) == 0);
+    REQUIRE(d.submit(rawMouse(1000700, 120)) == 0);
+    REQUIRE(d.stats().duplicates == 1);
+    REQUIRE(d.stats().suppressed == 2);
+
+    // Each event matches once: a second copy of the same notch is not.
+    REQUIRE(d.submit(rawMouse(1000800, 120)) == 0);
+    REQUIRE(d.stats().duplicates == 1);
+    requireConsistent(d.stats());
+}
+
+TEST_CASE("A touchpad gesture keeps one source", "[ScrollDeduplicator]")
+{
+    // The driver's synthesized wheel messages and the HID-derived deltas never
+    // agree in magnitude; whichever path starts the gesture owns it.
+    ScrollDeduplicator d;
+    std::vector<ScrollEvent> events;
+    int32_t hookTotal = 0;
+    for (int i = 0; i < 30; ++i)
+    {
+        const int64_t t = 2000000 + i * 8000;
+        const int32_t wheel = 20 + i % 7;
+        events.push_back(hook(t, wheel));
+        events.push_back(ptp(t + 3000, 33));
+        hookTotal += wheel;
+    }
+    REQUIRE(feed(d, events) == hookTotal);
+    REQUIRE(d.stats().accepted == 30);
+    REQUIRE(d.stats().suppressed == 30);
+    REQUIRE(d.stats().handovers == 0);
+
+    SECTION("or the HID path, when it is first")
+    {
+        ScrollDeduplicator first;
+        events.push_back(ptp(2000000 - 1000, 33));
+        REQUIRE(feed(first, events) == 31 * 33);
+        REQUIRE(first.authoritySource() == ScrollSource::PtpHid);
+        requireConsistent(first.stats());
+    }
+}
+
+TEST_CASE("Authority hands over when its source falls silent", "[ScrollDeduplicator]")
+{
+    // 100 ms with both paths, then the hook stops seeing the gesture (focus
+    // moved to a window that swallows wheel messages) while HID continues.
+    ScrollDeduplicator d;
+    std::vector<ScrollEvent> events;
+    int64_t lastHook = 0;
+    for (int64_t t = 3000000; t < 3100000; t += 8000)
+    {
+        events.push_back(hook(t, 25));
+        events.push_back(ptp(t + 3000, 30));
+        lastHook = t;
+    }
+    int32_t hidAfterHook = 0;
+    for (int64_t t = 3100000 + 3000; t < 3300000; t += 8000)
+    {
+        events.push_back(ptp(t, 30));
+        hidAfterHook += 30;
+    }
+    // The HID event 3 ms after the hook's last one also counts: from then on
+    // the hook delivered nothing.
+    hidAfterHook += 30;
+
+    const int32_t hookTotal = 25 * 13;
+    REQUIRE(lastHook == 3096000);
+    REQUIRE(feed(d, events) == hookTotal + hidAfterHook);
+    REQUIRE(d.stats().handovers == 1);
+    REQUIRE(d.stats().released >= 1);
+    REQUIRE(d.authoritySource() == ScrollSource::PtpHid);
+    requireConsistent(d.stats());
+}
+
+TEST_CASE("A pause starts a new gesture with a fresh authority", "[ScrollDeduplicator]")
+{
+    ScrollDeduplicator d;
+    REQUIRE(feed(d, {hook(1000000, 120), rawMouse(1000500, 120)}) == 120);
+    REQUIRE(d.authoritySource() == ScrollSource::LLHook);
+
+    // 200 ms later Raw Input is first: it owns the new gesture, and an
+    // unmatched hook event stays suppressed — no handover needed.
+    REQUIRE(feed(d, {rawMouse(1200500, 120), hook(1201000, 120), hook(1210000, 60)}) == 120);
+    REQUIRE(d.authoritySource() == ScrollSource::RawMouse);
+    REQUIRE(d.authorityDevice() == kMouse);
+    REQUIRE(d.stats().gestures == 2);
+    REQUIRE(d.stats().suppressed == 1);
+
+    d.reset();
+    REQUIRE_FALSE(d.hasAuthority());
+    REQUIRE(d.submit(hook(1210500, 120)) == 120);
+    REQUIRE(d.stats().gestures == 3);
+}
+
+TEST_CASE("A pinch's log-zoom follows its event", "[ScrollDeduplicator]")
+{
+    ScrollDeduplicator d;
+    float logZoom = 0.0f;
+    for (int i = 0; i < 10; ++i)
+        REQUIRE(d.submit(pinch(5000000 + i * 8000, 0.05f), &logZoom) == 0);
+    REQUIRE(logZoom == Approx(0.5f));
+    REQUIRE(d.stats().accepted == 10);
+
+    // Pinch-only events never match each other or a wheel copy by fingerprint.
+    REQUIRE(d.stats().duplicates == 0);
+
+    SECTION("held while another source owns the gesture, released on handover")
+    {
+        ScrollDeduplicator h;
+        float z = 0.0f;
+        h.submit(hook(6000000, 120), &z);
+        h.submit(pinch(6010000, 0.1f), &z);
+        REQUIRE(z == 0.0f);
+        REQUIRE(h.stats().suppressed == 1);
+        h.submit(pinch(6100000, 0.1f), &z); // hook silent past handoverUs
+        REQUIRE(z == Approx(0.2f));
+        REQUIRE(h.stats().released == 2); // the held pinch and the one that took over
+        requireConsistent(h.stats());
+    }
+}
+
+TEST_CASE("A single source passes through untouched", "[ScrollDeduplicator]")
+{
+    ScrollDeduplicator d;
+    std::vector<ScrollEvent> events;
+    int32_t total = 0;
+    for (int i = 0; i < 50; ++i)
+    {
+        events.push_back(ptp(4000000 + i * 4000, (i % 3) - 1 + 10));
+        total += (i % 3) - 1 + 10;
+    }
+    REQUIRE(feed(d, events) == total);
+    REQUIRE(d.stats().accepted == 50);
+    REQUIRE(d.stats().duplicates + d.stats().suppressed == 0);
+}
+
+TEST_CASE("Randomly interleaved wheel copies count each notch once", "[ScrollDeduplicator]")
+{
+    // Notches 5–140 ms apart (fast spins to slow clicks that hand over every
+    // notch), each seen by both paths with up to ±5 ms skew either way.
+    uint32_t seed = 12345;
+    auto next = [&seed](uint32_t n) {
+        seed = seed * 1664525u + 1013904223u;
+        return (seed >> 8) % n;
+    };
+    for (int run = 0; run < 50; ++run)
+    {
+        ScrollDeduplicator d;
+        std::vector<ScrollEvent> events;
+        int64_t t = 1000000;
+        int32_t truth = 0;
+        for (int i = 0; i < 40; ++i)
+        {
+            t += 5000 + static_cast<int64_t>(next(135000));
+            const int32_t notch = next(4) == 0 ? -120 : 120;
+            events.push_back(hook(t, notch));
+            events.push_back(rawMouse(t - 5000 + static_cast<int64_t>(next(10001)), notch));
+            truth += notch;
+        }
+        REQUIRE(feed(d, events) == truth);
+        REQUIRE(d.stats().duplicates == 40);
+        requireConsistent(d.stats());
+    }
+}
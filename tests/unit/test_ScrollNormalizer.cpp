@@ -43,6 +43,14 @@ TEST_CASE("ptpUnitsPerNotch falls back when derived units < 1", "[ScrollNormaliz
     REQUIRE(ptpUnitsPerNotch(tiny) == Approx(kPtpFallbackUnitsPerNotch));
 }
 
+TEST_CASE("ptpUnitsPerNotch applies a profile's axis scale", "[ScrollNormalizer]")
+{
+    REQUIRE(ptpUnitsPerNotch(PtpAxisScale{2600, 2.0f})
+            == Approx(2 * 2600 * kPtpSurfaceFractionPerNotch));
+    REQUIRE(ptpUnitsPerNotch(PtpAxisScale{0, 0.5f}) == Approx(0.5f * kPtpFallbackUnitsPerNotch));
+    REQUIRE(ptpUnitsPerNotch(PtpAxisScale{2600, 0.0f}) == Approx(2600 * kPtpSurfaceFractionPerNotch));
+}
+
 // ── PTP delta → wheel-equivalent, device-independent ─────────────────────────
 
 TEST_CASE("ptpDeltaToWheelEquiv: same swipe fraction → same zoom on any device", "[ScrollNormalizer]")
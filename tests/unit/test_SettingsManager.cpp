@@ -449,3 +449,400 @@ TEST_CASE("defaultZoomLevel out of range for custom bounds → keeps default", "
     REQUIRE(snap->maxZoom == Approx(3.0f));
     REQUIRE(snap->defaultZoomLevel == Approx(2.0f)); // 5.0 > 3.0 → kept default
 }
+
+// =============================================================================
+// Resting-zoom quantization: zoomQuantization + quantizeIntegerTolerance
+// =============================================================================
+
+TEST_CASE("zoomQuantization defaults off", "[SettingsManager][Quantize]")
+{
+    SettingsManager mgr;
+    auto snap = mgr.snapshot();
+    REQUIRE(snap->zoomQuantization == false);
+    REQUIRE(snap->quantizeIntegerTolerance == Approx(0.05f));
+}
+
+TEST_CASE("zoomQuantization load + round-trip", "[SettingsManager][Quantize]")
+{
+    auto path = writeTempFile(R"({"zoomQuantization": true, "quantizeIntegerTolerance": 0.2})",
+                              "quantize_load.json");
+    SettingsManager mgr;
+    REQUIRE(mgr.loadFromFile(path.c_str()));
+    REQUIRE(mgr.snapshot()->zoomQuantization == true);
+    REQUIRE(mgr.snapshot()->quantizeIntegerTolerance == Approx(0.2f));
+
+    std::string rt = (std::filesystem::temp_directory_path() / "smoothzoom_test_quantize_rt.json").string();
+    REQUIRE(mgr.saveToFile(rt.c_str()));
+    SettingsManager mgr2;
+    REQUIRE(mgr2.loadFromFile(rt.c_str()));
+    REQUIRE(mgr2.snapshot()->zoomQuantization == true);
+    REQUIRE(mgr2.snapshot()->quantizeIntegerTolerance == Approx(0.2f));
+}
+
+TEST_CASE("quantizeIntegerTolerance out of range → keeps default", "[SettingsManager][Quantize]")
+{
+    auto path = writeTempFile(R"({"quantizeIntegerTolerance": 0.9})", "quantize_hi.json");
+    SettingsManager mgr;
+    REQUIRE(mgr.loadFromFile(path.c_str()));
+    REQUIRE(mgr.snapshot()->quantizeIntegerTolerance == Approx(0.05f));
+}
+
+// =============================================================================
+// Zoom presets (Modifier+Numpad1..6 / Numpad0 cycle)
+// =============================================================================
+
+TEST_CASE("zoomPresets default to 1, 2.5, 6", "[SettingsManager][Presets]")
+{
+    SettingsManager mgr;
+    auto snap = mgr.snapshot();
+    REQUIRE(snap->zoomPresetCount == 3);
+    REQUIRE(snap->zoomPresets[0] == Approx(1.0f));
+    REQUIRE(snap->zoomPresets[1] == Approx(2.5f));
+    REQUIRE(snap->zoomPresets[2] == Approx(6.0f));
+}
+
+TEST_CASE("zoomPresets load + round-trip", "[SettingsManager][Presets]")
+{
+    auto path = writeTempFile(R"({"zoomPresets": [1.5, 3.0, 4.5, 8.0]})", "presets_load.json");
+    SettingsManager mgr;
+    REQUIRE(mgr.loadFromFile(path.c_str()));
+    REQUIRE(mgr.snapshot()->zoomPresetCount == 4);
+    REQUIRE(mgr.snapshot()->zoomPresets[3] == Approx(8.0f));
+
+    std::string rt = (std::filesystem::temp_directory_path() / "smoothzoom_test_presets_rt.json").string();
+    REQUIRE(mgr.saveToFile(rt.c_str()));
+    SettingsManager mgr2;
+    REQUIRE(mgr2.loadFromFile(rt.c_str()));
+    REQUIRE(mgr2.snapshot()->zoomPresetCount == 4);
+    REQUIRE(mgr2.snapshot()->zoomPresets[0] == Approx(1.5f));
+    REQUIRE(mgr2.snapshot()->zoomPresets[3] == Approx(8.0f));
+}
+
+TEST_CASE("zoomPresets skips invalid entries and caps at six", "[SettingsManager][Presets]")
+{
+    auto path = writeTempFile(
+        R"({"zoomPresets": [2.0, "x", 0.5, 11.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0]})",
+        "presets_invalid.json");
+    SettingsManager mgr;
+    REQUIRE(mgr.loadFromFile(path.c_str()));
+    auto snap = mgr.snapshot();
+    REQUIRE(snap->zoomPresetCount == kMaxZoomPresets);
+    REQUIRE(snap->zoomPresets[0] == Approx(2.0f));
+    REQUIRE(snap->zoomPresets[1] == Approx(3.0f));
+    REQUIRE(snap->zoomPresets[5] == Approx(7.0f));
+}
+
+TEST_CASE("zoomPresets with no valid entry keeps defaults", "[SettingsManager][Presets]")
+{
+    auto path = writeTempFile(R"({"zoomPresets": [0.2, "a"]})", "presets_empty.json");
+    SettingsManager mgr;
+    REQUIRE(mgr.loadFromFile(path.c_str()));
+    REQUIRE(mgr.snapshot()->zoomPresetCount == 3);
+    REQUIRE(mgr.snapshot()->zoomPresets[1] == Approx(2.5f));
+}
+
+// =============================================================================
+// Notched-wheel smoothing: smoothWheelZoom + wheelSmoothingLatencyMs
+// =============================================================================
+
+TEST_CASE("smoothWheelZoom defaults off with a 33 ms budget", "[SettingsManager][WheelSmoothing]")
+{
+    SettingsManager mgr;
+    auto snap = mgr.snapshot();
+    REQUIRE(snap->smoothWheelZoom == false);
+    REQUIRE(snap->wheelSmoothingLatencyMs == 33);
+}
+
+TEST_CASE("smoothWheelZoom load + round-trip", "[SettingsManager][WheelSmoothing]")
+{
+    auto path = writeTempFile(R"({"smoothWheelZoom": true, "wheelSmoothingLatencyMs": 16})",
+                              "wheel_load.json");
+    SettingsManager mgr;
+    REQUIRE(mgr.loadFromFile(path.c_str()));
+    REQUIRE(mgr.snapshot()->smoothWheelZoom == true);
+    REQUIRE(mgr.snapshot()->wheelSmoothingLatencyMs == 16);
+
+    std::string rt = (std::filesystem::temp_directory_path() / "smoothzoom_test_wheel_rt.json").string();
+    REQUIRE(mgr.saveToFile(rt.c_str()));
+    SettingsManager mgr2;
+    REQUIRE(mgr2.loadFromFile(rt.c_str()));
+    REQUIRE(mgr2.snapshot()->smoothWheelZoom == true);
+    REQUIRE(mgr2.snapshot()->wheelSmoothingLatencyMs == 16);
+}
+
+TEST_CASE("wheelSmoothingLatencyMs out of range → keeps default", "[SettingsManager][WheelSmoothing]")
+{
+    auto path = writeTempFile(R"({"wheelSmoothingLatencyMs": 200})", "wheel_hi.json");
+    SettingsManager mgr;
+    REQUIRE(mgr.loadFromFile(path.c_str()));
+    REQUIRE(mgr.snapshot()->wheelSmoothingLatencyMs == 33);
+}
+
+// ─── Pointer tracking mode (edge push) ──────────────────────────────────────
+
+TEST_CASE("Pointer tracking defaults to continuous", "[SettingsManager][EdgePush]")
+{
+    SettingsManager mgr;
+    auto snap = mgr.snapshot();
+    REQUIRE(snap->pointerTrackingMode == 0);
+    REQUIRE(snap->edgePushMarginPct == 10);
+    REQUIRE(snap->edgePushSpeedPx == 2000);
+    REQUIRE(snap->centeredFollowMs == 120);
+}
+
+TEST_CASE("pointerTracking string + edge push params round-trip", "[SettingsManager][EdgePush]")
+{
+    auto path = writeTempFile(
+        R"({"pointerTracking": "Edge", "edgePushMarginPct": 20, "edgePushSpeedPx": 800})",
+        "edge_load.json");
+    SettingsManager mgr;
+    REQUIRE(mgr.loadFromFile(path.c_str()));
+    REQUIRE(mgr.snapshot()->pointerTrackingMode == 1);
+    REQUIRE(mgr.snapshot()->edgePushMarginPct == 20);
+    REQUIRE(mgr.snapshot()->edgePushSpeedPx == 800);
+
+    std::string rt = (std::filesystem::temp_directory_path() / "smoothzoom_test_edge_rt.json").string();
+    REQUIRE(mgr.saveToFile(rt.c_str()));
+    SettingsManager mgr2;
+    REQUIRE(mgr2.loadFromFile(rt.c_str()));
+    REQUIRE(mgr2.snapshot()->pointerTrackingMode == 1);
+    REQUIRE(mgr2.snapshot()->edgePushMarginPct == 20);
+    REQUIRE(mgr2.snapshot()->edgePushSpeedPx == 800);
+}
+
+TEST_CASE("pointerTracking accepts an integer; invalid values keep defaults",
+          "[SettingsManager][EdgePush]")
+{
+    {
+        auto path = writeTempFile(R"({"pointerTracking": 1})", "edge_int.json");
+        SettingsManager mgr;
+        REQUIRE(mgr.loadFromFile(path.c_str()));
+        REQUIRE(mgr.snapshot()->pointerTrackingMode == 1);
+    }
+    {
+        auto path = writeTempFile(
+            R"({"pointerTracking": "wobbly", "edgePushMarginPct": 90, "edgePushSpeedPx": 5})",
+            "edge_bad.json");
+        SettingsManager mgr;
+        REQUIRE(mgr.loadFromFile(path.c_str()));
+        REQUIRE(mgr.snapshot()->pointerTrackingMode == 0);
+        REQUIRE(mgr.snapshot()->edgePushMarginPct == 10);
+        REQUIRE(mgr.snapshot()->edgePushSpeedPx == 2000);
+    }
+}
+
+TEST_CASE("pointerTracking centered + follow time round-trip", "[SettingsManager][Centered]")
+{
+    auto path = writeTempFile(R"({"pointerTracking": "CENTERED", "centeredFollowMs": 0})",
+                              "centered_load.json");
+    SettingsManager mgr;
+    REQUIRE(mgr.loadFromFile(path.c_str()));
+    REQUIRE(mgr.snapshot()->pointerTrackingMode == 2);
+    REQUIRE(mgr.snapshot()->centeredFollowMs == 0);
+
+    std::string rt = (std::filesystem::temp_directory_path() / "smoothzoom_test_centered_rt.json").string();
+    REQUIRE(mgr.saveToFile(rt.c_str()));
+    SettingsManager mgr2;
+    REQUIRE(mgr2.loadFromFile(rt.c_str()));
+    REQUIRE(mgr2.snapshot()->pointerTrackingMode == 2);
+    REQUIRE(mgr2.snapshot()->centeredFollowMs == 0);
+
+    auto bad = writeTempFile(R"({"pointerTracking": 3, "centeredFollowMs": 900})",
+                             "centered_bad.json");
+    SettingsManager mgr3;
+    REQUIRE(mgr3.loadFromFile(bad.c_str()));
+    REQUIRE(mgr3.snapshot()->pointerTrackingMode == 0);
+    REQUIRE(mgr3.snapshot()->centeredFollowMs == 120);
+}
+
+// =============================================================================
+// R-19 pointer damping: pointerDamping
+// =============================================================================
+
+TEST_CASE("pointerDamping defaults off and round-trips", "[SettingsManager][PointerDamper]")
+{
+    SettingsManager defaults;
+    REQUIRE(defaults.snapshot()->pointerDamping == false);
+
+    auto path = writeTempFile(R"({"pointerDamping": true})", "damping_load.json");
+    SettingsManager mgr;
+    REQUIRE(mgr.loadFromFile(path.c_str()));
+    REQUIRE(mgr.snapshot()->pointerDamping == true);
+
+    std::string rt = (std::filesystem::temp_directory_path() / "smoothzoom_test_damping_rt.json").string();
+    REQUIRE(mgr.saveToFile(rt.c_str()));
+    SettingsManager mgr2;
+    REQUIRE(mgr2.loadFromFile(rt.c_str()));
+    REQUIRE(mgr2.snapshot()->pointerDamping == true);
+}
+
+// =============================================================================
+// Pointer sample stream: pointerSampleStream
+// =============================================================================
+
+TEST_CASE("pointerSampleStream defaults off and round-trips", "[SettingsManager][PointerSampleRing]")
+{
+    SettingsManager defaults;
+    REQUIRE(defaults.snapshot()->pointerSampleStream == false);
+
+    auto path = writeTempFile(R"({"pointerSampleStream": true})", "sample_stream_load.json");
+    SettingsManager mgr;
+    REQUIRE(mgr.loadFromFile(path.c_str()));
+    REQUIRE(mgr.snapshot()->pointerSampleStream == true);
+
+    std::string rt = (std::filesystem::temp_directory_path() / "smoothzoom_test_sample_stream_rt.json").string();
+    REQUIRE(mgr.saveToFile(rt.c_str()));
+    SettingsManager mgr2;
+    REQUIRE(mgr2.loadFromFile(rt.c_str()));
+    REQUIRE(mgr2.snapshot()->pointerSampleStream == true);
+}
+
+// =============================================================================
+// Zoom scope: zoomScope
+// =============================================================================
+
+TEST_CASE("zoomScope defaults to unified, parses and round-trips", "[SettingsManager][ZoomScope]")
+{
+    SettingsManager defaults;
+    REQUIRE(defaults.snapshot()->zoomScope == 0);
+
+    auto path = writeTempFile(R"({"zoomScope": "Active"})", "scope_load.json");
+    SettingsManager mgr;
+    REQUIRE(mgr.loadFromFile(path.c_str()));
+    REQUIRE(mgr.snapshot()->zoomScope == 1);
+
+    std::string rt = (std::filesystem::temp_directory_path() / "smoothzoom_test_scope_rt.json").string();
+    REQUIRE(mgr.saveToFile(rt.c_str()));
+    SettingsManager mgr2;
+    REQUIRE(mgr2.loadFromFile(rt.c_str()));
+    REQUIRE(mgr2.snapshot()->zoomScope == 1);
+
+    auto bad = writeTempFile(R"({"zoomScope": 7})", "scope_bad.json");
+    SettingsManager mgr3;
+    REQUIRE(mgr3.loadFromFile(bad.c_str()));
+    REQUIRE(mgr3.snapshot()->zoomScope == 0);
+}
+
+TEST_CASE("ptpDeviceProfiles parse, validate and round-trip", "[SettingsManager][PtpProfiles]")
+{
+    SettingsManager defaults;
+    REQUIRE(defaults.snapshot()->ptpDeviceProfileCount == 0);
+
+    auto path = writeTempFile(R"({"ptpDeviceProfiles": [
+        {"vendorId": "0x06CB", "productId": "ce78", "axisScale": 1.5, "sensitivity": 0.8},
+        {"vendorId": 1452, "productId": 613, "invertNaturalScroll": true, "axisScale": 9.0},
+        {"vendorId": "0x06CB", "productId": "0xCE78", "sensitivity": 2.0},
+        {"vendorId": "0xZZZZ", "productId": 1},
+        {"vendorId": 70000, "productId": 1},
+        {"productId": 1},
+        {"vendorId": 0, "productId": 0},
+        "not an object"
+    ]})", "ptp_profiles.json");
+    SettingsManager mgr;
+    REQUIRE(mgr.loadFromFile(path.c_str()));
+    auto snap = mgr.snapshot();
+    REQUIRE(snap->ptpDeviceProfileCount == 2); // duplicate and invalid IDs skipped
+    REQUIRE(snap->ptpDeviceProfiles[0].vendorId == 0x06CB);
+    REQUIRE(snap->ptpDeviceProfiles[0].productId == 0xCE78);
+    REQUIRE(snap->ptpDeviceProfiles[0].axisScale == Approx(1.5f));
+    REQUIRE(snap->ptpDeviceProfiles[0].sensitivity == Approx(0.8f));
+    REQUIRE_FALSE(snap->ptpDeviceProfiles[0].invertNaturalScroll);
+    REQUIRE(snap->ptpDeviceProfiles[1].vendorId == 1452);
+    REQUIRE(snap->ptpDeviceProfiles[1].axisScale == Approx(1.0f)); // out of range → default
+    REQUIRE(snap->ptpDeviceProfiles[1].invertNaturalScroll);
+
+    std::string rt = (std::filesystem::temp_directory_path() / "smoothzoom_test_ptp_profiles_rt.json").string();
+    REQUIRE(mgr.saveToFile(rt.c_str()));
+    {
+        std::ifstream f(rt);
+        std::stringstream ss;
+        ss << f.rdbuf();
+        REQUIRE(ss.str().find("\"0x06CB\"") != std::string::npos); // IDs saved as hex
+    }
+    SettingsManager mgr2;
+    REQUIRE(mgr2.loadFromFile(rt.c_str()));
+    auto snap2 = mgr2.snapshot();
+    REQUIRE(snap2->ptpDeviceProfileCount == 2);
+    REQUIRE(snap2->ptpDeviceProfiles[0].productId == 0xCE78);
+    REQUIRE(snap2->ptpDeviceProfiles[0].sensitivity == Approx(0.8f));
+    REQUIRE(snap2->ptpDeviceProfiles[1].productId == 613);
+    REQUIRE(snap2->ptpDeviceProfiles[1].invertNaturalScroll);
+}
+
+TEST_CASE("keyBindings replace listed commands and round-trip", "[SettingsManager][KeyBindings]")
+{
+    SettingsManager defaults;
+    REQUIRE(defaults.snapshot()->keyBindingCount == kDefaultKeyBindingCount);
+    REQUIRE(defaults.snapshot()->keyBindings[0] == kDefaultKeyBindings[0]);
+
+    auto path = writeTempFile(R"({"keyBindings": {
+        "zoomIn": ["Modifier+Plus", "Ctrl+Alt+Up", "Plus", 42],
+        "toggleInvert": [],
+        "openSettings": "Win+Ctrl+M",
+        "toggleEngage": ["Ctrl+E"]
+    }})", "key_bindings.json");
+    SettingsManager mgr;
+    REQUIRE(mgr.loadFromFile(path.c_str()));
+    auto snap = mgr.snapshot();
+    auto count = [&](const SettingsSnapshot& s, ZoomCommand c) {
+        int n = 0;
+        for (int i = 0; i < s.keyBindingCount; ++i)
+            n += s.keyBindings[i].command == c ? 1 : 0;
+        return n;
+    };
+    REQUIRE(count(*snap, ZoomCommand::ZoomIn) == 2);      // invalid chords skipped
+    REQUIRE(count(*snap, ZoomCommand::ToggleInvert) == 0); // unbound
+    REQUIRE(count(*snap, ZoomCommand::OpenSettings) == 1); // not an array: default kept
+    REQUIRE(count(*snap, ZoomCommand::ZoomOut) == 2);      // unlisted: defaults
+    REQUIRE(snap->keyBindingCount == kDefaultKeyBindingCount - 1);
+
+    std::string rt = (std::filesystem::temp_directory_path() / "smoothzoom_test_key_bindings_rt.json").string();
+    REQUIRE(mgr.saveToFile(rt.c_str()));
+    {
+        std::ifstream f(rt);
+        std::stringstream ss;
+        ss << f.rdbuf();
+        REQUIRE(ss.str().find("\"Ctrl+Alt+Up\"") != std::string::npos);
+    }
+    SettingsManager mgr2;
+    REQUIRE(mgr2.loadFromFile(rt.c_str()));
+    auto snap2 = mgr2.snapshot();
+    REQUIRE(snap2->keyBindingCount == snap->keyBindingCount);
+    REQUIRE(count(*snap2, ZoomCommand::ToggleInvert) == 0);
+    for (int i = 0; i < snap->keyBindingCount; ++i)
+    {
+        bool found = false;
+        for (int k = 0; k < snap2->keyBindingCount; ++k)
+            found = found || snap2->keyBindings[k] == snap->keyBindings[i];
+        REQUIRE(found);
+    }
+}
+
+TEST_CASE("hookSlowThresholdsMs validates and round-trips", "[SettingsManager]")
+{
+    SettingsManager defaults;
+    REQUIRE(defaults.snapshot()->hookSlowThresholdCount == 3);
+    REQUIRE(defaults.snapshot()->hookSlowThresholdsMs[2] == 100);
+
+    auto path = writeTempFile(R"({"hookSlowThresholdsMs": [50, 0, 5, 5, "x", 2.5, 2000, 250]})",
+                              "hook_thresholds.json");
+    SettingsManager mgr;
+    REQUIRE(mgr.loadFromFile(path.c_str()));
+    auto snap = mgr.snapshot();
+    REQUIRE(snap->hookSlowThresholdCount == 3); // sorted, invalid and repeated skipped
+    REQUIRE(snap->hookSlowThresholdsMs[0] == 5);
+    REQUIRE(snap->hookSlowThresholdsMs[1] == 50);
+    REQUIRE(snap->hookSlowThresholdsMs[2] == 250);
+
+    std::string rt = (std::filesystem::temp_directory_path() / "smoothzoom_test_hook_thresholds_rt.json").string();
+    REQUIRE(mgr.saveToFile(rt.c_str()));
+    SettingsManager mgr2;
+    REQUIRE(mgr2.loadFromFile(rt.c_str()));
+    REQUIRE(mgr2.snapshot()->hookSlowThresholdCount == 3);
+    REQUIRE(mgr2.snapshot()->hookSlowThresholdsMs[1] == 50);
+
+    auto none = writeTempFile(R"({"hookSlowThresholdsMs": [0, 5000]})", "hook_thresholds_none.json");
+    SettingsManager mgr3;
+    REQUIRE(mgr3.loadFromFile(none.c_str()));
+    REQUIRE(mgr3.snapshot()->hookSlowThresholdCount == 3);
+}
@@ -0,0 +1,236 @@
+// =============================================================================
+// Unit tests for SourceArbiter — Doc 3 §3.4, AC-2.5.x, AC-2.6.x
+// The default policy table must reproduce the legacy Caret > Focus > Pointer
+// chain exactly; scripted candidate streams replayed frame by frame check
+// hand-offs, hysteresis and per-policy overrides.
+// Pure logic — no Win32 API dependencies.
+// =============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_message.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "smoothzoom/logic/SourceArbiter.h"
+#include <vector>
+
+using namespace SmoothZoom;
+
+namespace
+{
+
+// Legacy if-chain, kept verbatim as the equivalence oracle.
+TrackingSource legacyDetermine(int64_t now, int64_t lastPointer, int64_t lastFocus,
+                               int64_t lastKb, bool focusValid, bool caretValid)
+{
+    if (caretValid && lastKb > 0 && (now - lastKb) < kCaretIdleTimeoutMs)
+        return TrackingSource::Caret;
+    if (focusValid && lastFocus > 0 && lastFocus > lastPointer &&
+        (now - lastFocus) >= kFocusDebounceMs)
+        return TrackingSource::Focus;
+    return TrackingSource::Pointer;
+}
+
+// One scripted change to a source's candidate at time `t`.
+struct ScriptStep
+{
+    int64_t t;
+    TrackingSource source;
+    int64_t timestampMs;
+    float confidence;
+};
+
+// Replay `steps` at 60 Hz from t=1000 to `endMs` through `arb`; returns the
+// active source per frame.
+std::vector<TrackingSource> replay(SourceArbiter& arb, const std::vector<ScriptStep>& steps,
+                                   int64_t endMs)
+{
+    std::vector<TrackingSource> out;
+    size_t next = 0;
+    for (int64_t now = 1000; now <= endMs; now += 16)
+    {
+        while (next < steps.size() && steps[next].t <= now)
+        {
+            const ScriptStep& s = steps[next++];
+            arb.publish(s.source, {{0, 0, 10, 10}, s.timestampMs, s.confidence});
+        }
+        out.push_back(arb.arbitrate(now));
+    }
+    return out;
+}
+
+int switches(const std::vector<TrackingSource>& trace)
+{
+    int n = 0;
+    for (size_t i = 1; i < trace.size(); ++i)
+        n += trace[i] != trace[i - 1];
+    return n;
+}
+
+TrackingSource at(const std::vector<TrackingSource>& trace, int64_t t)
+{
+    return trace[static_cast<size_t>((t - 1000) / 16)];
+}
+
+} // namespace
+
+TEST_CASE("Default policy matches the legacy priority chain", "[SourceArbiter]")
+{
+    const int64_t now = 10000;
+    const int64_t times[] = {0, 1, now - 5000, now - 600, now - kCaretIdleTimeoutMs,
+                             now - 499, now - 200, now - kFocusDebounceMs, now - 99,
+                             now - 50, now, now + 20};
+    int checked = 0;
+    for (int64_t ptr : times)
+        for (int64_t focus : times)
+            for (int64_t kb : times)
+                for (int valid = 0; valid < 4; ++valid)
+                {
+                    const bool focusValid = valid & 1, caretValid = valid & 2;
+                    SourceArbiter arb;
+                    arb.publish(TrackingSource::Pointer, {{}, ptr, 1.0f});
+                    arb.publish(TrackingSource::Focus, {{}, focus, focusValid ? 1.0f : 0.0f});
+                    arb.publish(TrackingSource::Caret, {{}, kb, caretValid ? 1.0f : 0.0f});
+                    INFO("ptr " << ptr << " focus " << focus << " kb " << kb << " valid " << valid);
+                    REQUIRE(arb.evaluate(now)
+                            == legacyDetermine(now, ptr, focus, kb, focusValid, caretValid));
+                    // Stateful arbitration from a fresh arbiter agrees too.
+                    REQUIRE(arb.arbitrate(now) == arb.evaluate(now));
+                    ++checked;
+                }
+    REQUIRE(checked == 12 * 12 * 12 * 4);
+}
+
+TEST_CASE("Scripted session: type, tab away, move the mouse", "[SourceArbiter]")
+{
+    SourceArbiter arb;
+    std::vector<ScriptStep> script = {
+        {1000, TrackingSource::Pointer, 900, 1.0f},
+        {1200, TrackingSource::Caret, 1200, 1.0f},  // keystroke
+        {1400, TrackingSource::Caret, 1400, 1.0f},  // keystroke
+        {2000, TrackingSource::Focus, 2000, 1.0f},  // Tab to a button
+        {2000, TrackingSource::Caret, 1400, 0.0f},  // caret gone with it
+        {3000, TrackingSource::Pointer, 3000, 1.0f}, // mouse moves
+    };
+    auto trace = replay(arb, script, 3500);
+
+    REQUIRE(at(trace, 1100) == TrackingSource::Pointer);
+    REQUIRE(at(trace, 1300) == TrackingSource::Caret);
+    REQUIRE(at(trace, 1850) == TrackingSource::Caret);   // < 500 ms since last keystroke
+    REQUIRE(at(trace, 1950) == TrackingSource::Pointer); // caret idle, focus not yet changed
+    REQUIRE(at(trace, 2050) == TrackingSource::Pointer); // focus inside debounce
+    REQUIRE(at(trace, 2150) == TrackingSource::Focus);
+    REQUIRE(at(trace, 2950) == TrackingSource::Focus);
+    REQUIRE(at(trace, 3020) == TrackingSource::Pointer); // intent: mouse moved after focus
+    REQUIRE(switches(trace) == 4);
+}
+
+TEST_CASE("Hysteresis: near-equal sources don't flap", "[SourceArbiter]")
+{
+    // Focus and caret at nearly equal priority with noisy confidences (e.g. a
+    // flaky UIA provider): without a margin the winner flips on every wobble.
+    SourcePolicy focus = kDefaultSourcePolicy[static_cast<size_t>(TrackingSource::Focus)];
+    focus.priority = 3.0f;
+    focus.settleMs = 0;
+    focus.yieldsToPointer = false;
+    SourcePolicy caret = kDefaultSourcePolicy[static_cast<size_t>(TrackingSource::Caret)];
+    caret.expireMs = 0;
+
+    std::vector<ScriptStep> script;
+    for (int i = 0; i < 60; ++i)
+    {
+        const int64_t t = 1000 + i * 50;
+        const bool odd = i & 1;
+        script.push_back({t, TrackingSource::Focus, 1000, odd ? 0.98f : 0.94f});
+        script.push_back({t, TrackingSource::Caret, 1000, odd ? 0.94f : 0.98f});
+    }
+
+    auto run = [&](float margin) {
+        SourceArbiter arb;
+        arb.setPolicy(TrackingSource::Focus, focus);
+        arb.setPolicy(TrackingSource::Caret, caret);
+        arb.setParams({margin, 0});
+        return switches(replay(arb, script, 4000));
+    };
+    REQUIRE(run(0.0f) > 40);
+    REQUIRE(run(0.25f) == 0); // first winner is held throughout
+}
+
+TEST_CASE("Hysteresis: dwell holds an eligible source, never a stale one",
+          "[SourceArbiter]")
+{
+    SourceArbiter arb;
+    arb.setParams({0.25f, 300});
+    arb.publish(TrackingSource::Pointer, {{}, 500, 1.0f});
+    arb.publish(TrackingSource::Focus, {{}, 1000, 1.0f});
+    REQUIRE(arb.arbitrate(1200) == TrackingSource::Focus);
+
+    // A keystroke right after: caret outscores focus but focus holds for 300 ms.
+    arb.publish(TrackingSource::Caret, {{}, 1250, 1.0f});
+    REQUIRE(arb.arbitrate(1300) == TrackingSource::Focus);
+    REQUIRE(arb.arbitrate(1499) == TrackingSource::Focus);
+    REQUIRE(arb.arbitrate(1500) == TrackingSource::Caret);
+
+    // Caret goes stale: replaced immediately regardless of dwell.
+    arb.publish(TrackingSource::Caret, {{}, 1250, 0.0f});
+    REQUIRE(arb.arbitrate(1510) == TrackingSource::Focus);
+    // Mouse moves: focus yields at once.
+    arb.publish(TrackingSource::Pointer, {{}, 1520, 1.0f});
+    REQUIRE(arb.arbitrate(1520) == TrackingSource::Pointer);
+}
+
+TEST_CASE("Low confidence loses to the pointer fallback", "[SourceArbiter]")
+{
+    SourceArbiter arb;
+    arb.publish(TrackingSource::Pointer, {{}, 500, 1.0f});
+    arb.publish(TrackingSource::Focus, {{}, 1000, 0.4f}); // 0.4·(2 + bonus) < 1
+    REQUIRE(arb.score(TrackingSource::Focus, 2000) > 0.0f);
+    REQUIRE(arb.evaluate(2000) == TrackingSource::Pointer);
+
+    arb.publish(TrackingSource::Focus, {{}, 1000, 0.9f});
+    REQUIRE(arb.evaluate(2000) == TrackingSource::Focus);
+}
+
+TEST_CASE("Policy rows override behavior without code changes", "[SourceArbiter]")
+{
+    // Per-application override: in a terminal, keep following focus (e.g. a
+    // popup) over the caret, and let the caret persist for 2 s after typing.
+    SourceArbiter arb;
+    SourcePolicy caret = arb.policy(TrackingSource::Caret);
+    caret.priority = 1.5f;
+    caret.expireMs = 2000;
+    arb.setPolicy(TrackingSource::Caret, caret);
+
+    arb.publish(TrackingSource::Pointer, {{}, 100, 1.0f});
+    arb.publish(TrackingSource::Caret, {{}, 1000, 1.0f});
+    REQUIRE(arb.evaluate(2500) == TrackingSource::Caret); // past the default 500 ms
+    arb.publish(TrackingSource::Focus, {{}, 1200, 1.0f});
+    REQUIRE(arb.evaluate(2500) == TrackingSource::Focus);
+    REQUIRE(arb.evaluate(3100) == TrackingSource::Focus);
+}
+
+TEST_CASE("Winner's candidate rect is available to the caller", "[SourceArbiter]")
+{
+    SourceArbiter arb;
+    arb.publish(TrackingSource::Pointer, {{5, 5, 6, 6}, 100, 1.0f});
+    arb.publish(TrackingSource::Caret, {{300, 200, 302, 220}, 1000, 1.0f});
+    const TrackingSource s = arb.arbitrate(1100);
+    REQUIRE(s == TrackingSource::Caret);
+    REQUIRE(arb.candidate(s).rect.left == 300);
+    REQUIRE(arb.candidate(s).rect.bottom == 220);
+}
+
+TEST_CASE("SourceArbiter per-frame cost", "[SourceArbiter][!benchmark]")
+{
+    SourceArbiter arb;
+    BENCHMARK("publish x3 + arbitrate")
+    {
+        int64_t sum = 0;
+        for (int64_t now = 1000; now < 2000; ++now)
+        {
+            arb.publish(TrackingSource::Pointer, {{}, now - 300, 1.0f});
+            arb.publish(TrackingSource::Focus, {{}, now - 200, 1.0f});
+            arb.publish(TrackingSource::Caret, {{}, now - (now % 700), 1.0f});
+            sum += static_cast<int64_t>(arb.arbitrate(now));
+        }
+        return sum;
+    };
+}
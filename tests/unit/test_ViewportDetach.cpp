@@ -0,0 +1,151 @@
+// =============================================================================
+// Unit tests for ViewportDetach — docs/research Priority 7
+// Freeze / re-attach decisions frame by frame (including a detach requested
+// mid-animation), and the re-attach glide RenderLoop builds from them
+// (PanAnimator from the frozen offset to a pointer that keeps moving).
+// Pure logic — no Win32 API dependencies.
+// =============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "smoothzoom/logic/ViewportDetach.h"
+#include "smoothzoom/logic/ViewportTracker.h"
+#include "smoothzoom/logic/ZoomController.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace SmoothZoom;
+using Catch::Approx;
+using Frame = ViewportDetach::Frame;
+
+TEST_CASE("Detach is ignored at 1.0x", "[ViewportDetach]")
+{
+    ViewportDetach d;
+    REQUIRE_FALSE(d.toggle(1.0f));
+    REQUIRE_FALSE(d.detached());
+    REQUIRE(d.frame(1.0f) == Frame::Tracking);
+}
+
+TEST_CASE("Toggle freezes until toggled again, then re-attaches once", "[ViewportDetach]")
+{
+    ViewportDetach d;
+    REQUIRE(d.frame(3.0f) == Frame::Tracking);
+    REQUIRE(d.toggle(3.0f));
+    for (int i = 0; i < 100; ++i)
+        REQUIRE(d.frame(3.0f) == Frame::Frozen);
+
+    REQUIRE(d.toggle(3.0f)); // request: still detached until the next frame
+    REQUIRE(d.frame(3.0f) == Frame::Reattach);
+    REQUIRE_FALSE(d.detached());
+    REQUIRE(d.frame(3.0f) == Frame::Tracking);
+    REQUIRE(d.frame(3.0f) == Frame::Tracking);
+}
+
+TEST_CASE("Any zoom change re-attaches", "[ViewportDetach]")
+{
+    ViewportDetach d;
+    REQUIRE(d.toggle(4.0f));
+    REQUIRE(d.frame(4.0f) == Frame::Frozen);
+    REQUIRE(d.frame(4.05f) == Frame::Reattach); // scroll / step / preset / reset
+    REQUIRE(d.frame(4.2f) == Frame::Tracking);
+
+    // Detach again at the new level.
+    REQUIRE(d.toggle(4.2f));
+    REQUIRE(d.frame(4.2f) == Frame::Frozen);
+}
+
+TEST_CASE("A detach during a zoom animation waits for it to settle", "[ViewportDetach][ZoomController]")
+{
+    ZoomController zc;
+    ViewportDetach d;
+    const float dt = 1.0f / 60.0f;
+    const auto settled = [&] { return zc.mode() == ZoomController::Mode::Idle; };
+
+    zc.animateToZoom(4.0f);
+    zc.tick(dt);
+    zc.tick(dt);
+    REQUIRE(zc.currentZoom() > 1.0f);
+    REQUIRE(zc.currentZoom() < 4.0f);
+    REQUIRE(d.toggle(zc.currentZoom(), settled())); // pending, not frozen
+    REQUIRE_FALSE(d.detached());
+    REQUIRE(d.pending());
+
+    // The animation runs to its end on screen; its steps never re-attach.
+    int frames = 0;
+    while (!settled())
+    {
+        zc.tick(dt);
+        REQUIRE(d.frame(zc.currentZoom(), settled()) == Frame::Tracking);
+        REQUIRE(++frames < 600);
+    }
+    REQUIRE(d.detached());
+    REQUIRE(zc.currentZoom() == 4.0f);
+    for (int i = 0; i < 100; ++i)
+        REQUIRE(d.frame(zc.currentZoom(), settled()) == Frame::Frozen);
+
+    // A zoom change after the detach still re-attaches.
+    zc.applyKeyboardStep(+1);
+    zc.tick(dt);
+    REQUIRE(d.frame(zc.currentZoom(), settled()) == Frame::Reattach);
+
+    SECTION("a second toggle cancels the pending detach")
+    {
+        ViewportDetach c;
+        REQUIRE(c.toggle(2.5f, false));
+        REQUIRE_FALSE(c.toggle(2.6f, false));
+        REQUIRE_FALSE(c.pending());
+        REQUIRE(c.frame(4.0f, true) == Frame::Tracking);
+        REQUIRE(c.frame(4.0f, true) == Frame::Tracking);
+    }
+    SECTION("a pending detach settling at 1.0x is dropped")
+    {
+        ViewportDetach c;
+        REQUIRE(c.toggle(2.0f, false)); // mid reset animation
+        REQUIRE(c.frame(1.0f, true) == Frame::Tracking);
+        REQUIRE_FALSE(c.detached());
+        REQUIRE_FALSE(c.pending());
+    }
+}
+
+TEST_CASE("Re-attach glides from the frozen view to a moving pointer",
+          "[ViewportDetach][PanAnimator]")
+{
+    const float zoom = 6.0f;
+    const int32_t w = 1920, h = 1080;
+    const float dt = 1.0f / 144.0f;
+
+    // Frozen with the pointer at the left; it has since moved right and keeps
+    // moving at 600 px/s during the glide.
+    const ViewportTracker::Offset frozen =
+        ViewportTracker::computePointerOffset(200, 500, zoom, w, h);
+    float px = 1500.0f;
+    auto target = ViewportTracker::computePointerOffset(1500, 500, zoom, w, h);
+
+    ViewportTracker::PanAnimator pan;
+    pan.begin(frozen, target, zoom);
+    REQUIRE(pan.velocity().x == 0.0f); // starts from rest: velocity-continuous
+
+    ViewportTracker::Offset prev = frozen;
+    float prevStep = 0.0f, maxAccel = 0.0f;
+    const float dist = target.x - frozen.x;
+    int frames = 0;
+    while (pan.active())
+    {
+        px += 600.0f * dt;
+        target = ViewportTracker::computePointerOffset(
+            static_cast<int32_t>(std::lround(px)), 500, zoom, w, h);
+        const auto p = pan.advance(target, dt);
+        const float step = p.x - prev.x;
+        if (frames == 0)
+            REQUIRE(step < 0.01f * dist); // no jump on the first frame
+        maxAccel = std::max(maxAccel, std::abs(step - prevStep));
+        REQUIRE(p.y == Approx(frozen.y));
+        prevStep = step;
+        prev = p;
+        ++frames;
+    }
+    // Lands on the live pointer target, and no frame-to-frame jerk along the way.
+    REQUIRE(prev.x == target.x);
+    REQUIRE(maxAccel < 0.05f * dist);
+    REQUIRE(frames * dt * 1000.0f == Approx(pan.durationMs()).margin(dt * 1000.0f));
+}
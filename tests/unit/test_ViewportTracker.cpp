@@ -6,7 +6,9 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_message.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include "smoothzoom/logic/ViewportTracker.h"
+#include <cmath>
 
 using namespace SmoothZoom;
 using Catch::Approx;
@@ -642,3 +644,476 @@ TEST_CASE("Multi-monitor: default origin (0,0) matches single-monitor behavior",
     REQUIRE(withOrigin.x == Approx(withoutOrigin.x));
     REQUIRE(withOrigin.y == Approx(withoutOrigin.y));
 }
+
+// ─── Edge-push tracking (research §3.5) ─────────────────────────────────────
+
+namespace
+{
+
+// Screen position of a desktop pointer under an applied offset.
+float physOf(int32_t p, float off, float zoom) { return (static_cast<float>(p) - off) * zoom; }
+
+ViewportTracker::EdgePushParams edgeParams(float margin = 0.1f, float speed = 2000.0f)
+{
+    ViewportTracker::EdgePushParams e;
+    e.marginFraction = margin;
+    e.pushSpeedPx = speed;
+    return e;
+}
+
+} // namespace
+
+TEST_CASE("Edge push: viewport holds still while the pointer stays inside the band",
+          "[ViewportTracker][EdgePush]")
+{
+    const float zoom = 4.0f;
+    ViewportTracker::Offset cur{700.0f, 400.0f};
+    // Visible desktop x ∈ [700, 1180); inner band ∈ [700 + 192/4, 1180 − 192/4]
+    for (int32_t px = 760; px <= 1120; px += 40)
+    {
+        auto off = ViewportTracker::computeEdgePushOffset(cur, px, 540, zoom, edgeParams(),
+                                                          1.0f / 60.0f, kScreenW, kScreenH);
+        INFO("px=" << px);
+        REQUIRE(off.x == cur.x);
+        REQUIRE(off.y == cur.y);
+    }
+}
+
+TEST_CASE("Edge push: pushing into the band pans until the pointer is back on its edge",
+          "[ViewportTracker][EdgePush]")
+{
+    const float zoom = 4.0f;
+    const float margin = 0.1f * kScreenW;
+    ViewportTracker::Offset cur{700.0f, 400.0f};
+    const int32_t px = 1170; // physX = 1880, 88 px past the inner edge (1728)
+
+    float prevX = cur.x;
+    int frames = 0;
+    for (; frames < 600; ++frames)
+    {
+        auto off = ViewportTracker::computeEdgePushOffset(cur, px, 540, zoom, edgeParams(),
+                                                          1.0f / 144.0f, kScreenW, kScreenH);
+        REQUIRE(off.x >= prevX);                      // monotonic toward the pointer
+        REQUIRE(off.y == cur.y);
+        prevX = off.x;
+        if (off.x == cur.x && frames > 0)
+            break;
+        cur = off;
+    }
+    REQUIRE(frames < 600);
+    // Came to rest on the inner band edge.
+    REQUIRE(physOf(px, cur.x, zoom) == Approx(kScreenW - margin).margin(0.01));
+}
+
+TEST_CASE("Edge push: a flick past the screen edge never loses the pointer",
+          "[ViewportTracker][EdgePush]")
+{
+    const float zoom = 8.0f;
+    ViewportTracker::Offset cur{800.0f, 400.0f};
+    for (int32_t px : {300, 1700, 1000, 810, 1900})
+    {
+        auto off = ViewportTracker::computeEdgePushOffset(cur, px, 470, zoom, edgeParams(),
+                                                          1.0f / 60.0f, kScreenW, kScreenH);
+        INFO("px=" << px);
+        REQUIRE(physOf(px, off.x, zoom) >= -1.0f);
+        REQUIRE(physOf(px, off.x, zoom) <= kScreenW + zoom);
+        cur = off;
+    }
+}
+
+TEST_CASE("Edge push: result stays inside the valid offset range",
+          "[ViewportTracker][EdgePush]")
+{
+    const float zoom = 3.0f;
+    ViewportTracker::Offset cur{0.0f, 0.0f};
+    // Pointer hard against the top-left desktop corner: cannot pan past 0.
+    auto off = ViewportTracker::computeEdgePushOffset(cur, 0, 0, zoom, edgeParams(),
+                                                      1.0f, kScreenW, kScreenH);
+    REQUIRE(off.x == 0.0f);
+    REQUIRE(off.y == 0.0f);
+
+    cur = {kScreenW * (1.0f - 1.0f / zoom), kScreenH * (1.0f - 1.0f / zoom)};
+    off = ViewportTracker::computeEdgePushOffset(cur, kScreenW - 1, kScreenH - 1, zoom,
+                                                 edgeParams(), 1.0f, kScreenW, kScreenH);
+    REQUIRE(off.x <= kScreenW * (1.0f - 1.0f / zoom));
+    REQUIRE(off.y <= kScreenH * (1.0f - 1.0f / zoom));
+}
+
+TEST_CASE("Edge push: pan over a fixed time is refresh-rate independent",
+          "[ViewportTracker][EdgePush]")
+{
+    const float zoom = 2.0f;
+    auto runFor = [&](float hz) {
+        ViewportTracker::Offset cur{500.0f, 270.0f};
+        const int32_t px = 1450; // physX = 1900 → deep in the right band
+        for (int i = 0; i < static_cast<int>(0.05f * hz + 0.5f); ++i)
+            cur = ViewportTracker::computeEdgePushOffset(cur, px, 540, zoom, edgeParams(),
+                                                         1.0f / hz, kScreenW, kScreenH);
+        return cur.x;
+    };
+    const float ref = runFor(240.0f);
+    for (float hz : {20.0f, 60.0f, 120.0f, 200.0f}) // whole frames in 50 ms
+    {
+        INFO("hz=" << hz);
+        REQUIRE(runFor(hz) == Approx(ref).margin(0.01));
+    }
+}
+
+TEST_CASE("Edge push: zero margin drags the viewport with the pointer at the edge",
+          "[ViewportTracker][EdgePush]")
+{
+    const float zoom = 4.0f;
+    ViewportTracker::Offset cur{700.0f, 400.0f};
+    auto off = ViewportTracker::computeEdgePushOffset(cur, 1200, 540, zoom, edgeParams(0.0f),
+                                                      1.0f / 60.0f, kScreenW, kScreenH);
+    REQUIRE(physOf(1200, off.x, zoom) == Approx(static_cast<float>(kScreenW)));
+}
+
+TEST_CASE("trackPointer: EdgePush emits whole source pixels but pans exactly",
+          "[ViewportTracker][EdgePush]")
+{
+    ViewportTracker vt;
+    vt.setPointerTracking(PointerTrackingMode::EdgePush, edgeParams());
+    const float zoom = 4.0f;
+    ViewportTracker::Offset applied{700.0f, 400.0f};
+    ViewportTracker::Offset exact = applied;
+    for (int i = 0; i < 120; ++i)
+    {
+        auto off = vt.trackPointer(1170, 540, zoom, applied, zoom, 1.0f / 144.0f,
+                                   kScreenW, kScreenH);
+        exact = ViewportTracker::computeEdgePushOffset(exact, 1170, 540, zoom, edgeParams(),
+                                                       1.0f / 144.0f, kScreenW, kScreenH);
+        REQUIRE(off.x == std::round(off.x));
+        REQUIRE(off.x == std::round(exact.x));
+        applied = off;
+    }
+}
+
+TEST_CASE("reanchorOffset keeps the pointer's screen position across a zoom change",
+          "[ViewportTracker][EdgePush]")
+{
+    ViewportTracker::Offset cur{600.0f, 300.0f};
+    const int32_t px = 900, py = 500;
+    const float before = physOf(px, cur.x, 3.0f);
+    auto off = ViewportTracker::reanchorOffset(cur, px, py, 3.0f, 5.0f);
+    REQUIRE(physOf(px, off.x, 5.0f) == Approx(before));
+    REQUIRE(physOf(py, off.y, 5.0f) == Approx(physOf(py, cur.y, 3.0f)));
+
+    // From 1.0× (offset 0) it lands on the proportional mapping.
+    auto first = ViewportTracker::reanchorOffset({0.0f, 0.0f}, px, py, 1.0f, 2.0f);
+    auto prop = ViewportTracker::computePointerOffset(px, py, 2.0f, kScreenW, kScreenH);
+    REQUIRE(first.x == Approx(prop.x));
+    REQUIRE(first.y == Approx(prop.y));
+
+    auto home = ViewportTracker::reanchorOffset(cur, px, py, 3.0f, 1.0f);
+    REQUIRE(home.x == 0.0f);
+    REQUIRE(home.y == 0.0f);
+}
+
+TEST_CASE("trackPointer: Continuous mode is the proportional mapping",
+          "[ViewportTracker][EdgePush]")
+{
+    ViewportTracker vt;
+    REQUIRE(vt.pointerTrackingMode() == PointerTrackingMode::Continuous);
+    auto a = vt.trackPointer(1234, 567, 3.0f, {10.0f, 20.0f}, 2.0f, 1.0f / 60.0f,
+                             kScreenW, kScreenH);
+    auto b = ViewportTracker::computePointerOffset(1234, 567, 3.0f, kScreenW, kScreenH);
+    REQUIRE(a.x == b.x);
+    REQUIRE(a.y == b.y);
+}
+
+TEST_CASE("trackPointer: EdgePush pivots a zoom change about the pointer",
+          "[ViewportTracker][EdgePush]")
+{
+    ViewportTracker vt;
+    vt.setPointerTracking(PointerTrackingMode::EdgePush, edgeParams());
+    // Pointer mid-screen at 2× → 2.2×: the pivot keeps it mid-screen, well
+    // inside the band, so the re-anchored offset is the whole answer.
+    ViewportTracker::Offset applied{480.0f, 270.0f};
+    auto off = vt.trackPointer(960, 540, 2.2f, applied, 2.0f, 1.0f / 60.0f,
+                               kScreenW, kScreenH);
+    REQUIRE(physOf(960, off.x, 2.2f) == Approx(physOf(960, applied.x, 2.0f)).margin(2.2f));
+    REQUIRE(physOf(540, off.y, 2.2f) == Approx(physOf(540, applied.y, 2.0f)).margin(2.2f));
+}
+
+// ─── Keep-pointer-centered tracking (research §3.5) ─────────────────────────
+
+namespace
+{
+
+ViewportTracker::CenteredParams centeredParams(float followSec = 0.12f)
+{
+    ViewportTracker::CenteredParams c;
+    c.followSec = followSec;
+    return c;
+}
+
+ViewportTracker::FollowState followFor(int32_t px, int32_t py, float zoom, float followSec,
+                                       float seconds, float hz,
+                                       ViewportTracker::FollowState st = {},
+                                       const ScreenRect* monitor = nullptr)
+{
+    for (int i = 0; i < static_cast<int>(seconds * hz + 0.5f); ++i)
+        st = ViewportTracker::computeCenteredOffset(st, px, py, zoom, centeredParams(followSec),
+                                                    1.0f / hz, kScreenW, kScreenH, 0, 0,
+                                                    monitor);
+    return st;
+}
+
+} // namespace
+
+TEST_CASE("Centered: locked follow puts the pointer at the screen center",
+          "[ViewportTracker][Centered]")
+{
+    auto st = ViewportTracker::computeCenteredOffset({}, 1000, 600, 4.0f, centeredParams(0.0f),
+                                                     1.0f / 60.0f, kScreenW, kScreenH);
+    REQUIRE(physOf(1000, st.offset.x, 4.0f) == Approx(960.0f));
+    REQUIRE(physOf(600, st.offset.y, 4.0f) == Approx(540.0f));
+    REQUIRE(st.velocity.x == 0.0f);
+}
+
+TEST_CASE("Centered: follow reaches 95% of a step in followSec without overshoot",
+          "[ViewportTracker][Centered]")
+{
+    const float zoom = 4.0f;
+    ViewportTracker::FollowState start;
+    start.offset = {1000.0f - 960.0f / zoom, 540.0f - 540.0f / zoom}; // centered on x=1000
+    const float goal = 1100.0f - 960.0f / zoom;                      // pointer jumps 100 px
+
+    auto st = followFor(1100, 540, zoom, 0.12f, 0.12f, 600.0f, start);
+    REQUIRE((st.offset.x - start.offset.x) / (goal - start.offset.x) == Approx(0.95f).margin(0.01));
+
+    ViewportTracker::FollowState cur = start;
+    for (int i = 0; i < 600; ++i)
+    {
+        cur = ViewportTracker::computeCenteredOffset(cur, 1100, 540, zoom, centeredParams(),
+                                                     1.0f / 600.0f, kScreenW, kScreenH);
+        REQUIRE(cur.offset.x <= goal + 1e-3f);
+    }
+    REQUIRE(cur.offset.x == Approx(goal).margin(0.01));
+}
+
+TEST_CASE("Centered: follow is refresh-rate independent", "[ViewportTracker][Centered]")
+{
+    // View centered on (1000, 540); pointer moves to (1300, 700).
+    ViewportTracker::FollowState start;
+    start.offset = {1000.0f - 320.0f, 540.0f - 180.0f};
+    const auto ref = followFor(1300, 700, 3.0f, 0.12f, 0.1f, 600.0f, start).offset;
+    for (float hz : {30.0f, 60.0f, 120.0f, 150.0f, 300.0f}) // whole frames in 100 ms
+    {
+        INFO("hz=" << hz);
+        const auto off = followFor(1300, 700, 3.0f, 0.12f, 0.1f, hz, start).offset;
+        REQUIRE(off.x == Approx(ref.x).margin(0.01));
+        REQUIRE(off.y == Approx(ref.y).margin(0.01));
+    }
+}
+
+TEST_CASE("Centered: clamps to the desktop edge and drops velocity there",
+          "[ViewportTracker][Centered]")
+{
+    const float zoom = 2.0f;
+    auto st = followFor(40, 20, zoom, 0.0f, 0.1f, 60.0f);
+    REQUIRE(st.offset.x == 0.0f);
+    REQUIRE(st.offset.y == 0.0f);
+
+    ViewportTracker::FollowState moving;
+    moving.offset = {5.0f, 5.0f};
+    moving.velocity = {-5000.0f, -5000.0f};
+    st = ViewportTracker::computeCenteredOffset(moving, 40, 20, zoom, centeredParams(),
+                                                1.0f / 60.0f, kScreenW, kScreenH);
+    REQUIRE(st.offset.x == 0.0f);
+    REQUIRE(st.velocity.x == 0.0f);
+    REQUIRE(st.velocity.y == 0.0f);
+
+    auto far = followFor(1900, 1070, zoom, 0.0f, 0.1f, 60.0f);
+    REQUIRE(far.offset.x == Approx(kScreenW * (1.0f - 1.0f / zoom)));
+    REQUIRE(far.offset.y == Approx(kScreenH * (1.0f - 1.0f / zoom)));
+}
+
+TEST_CASE("Centered: centers on the pointer's monitor and stays inside it",
+          "[ViewportTracker][Centered]")
+{
+    // Virtual screen 3840 wide: primary [0,1920), secondary [1920,3840).
+    const ScreenRect secondary{1920, 0, 3840, 1080};
+    const float zoom = 2.0f;
+    auto centered = [&](int32_t px, int32_t py) {
+        return ViewportTracker::computeCenteredOffset({}, px, py, zoom, centeredParams(0.0f),
+                                                      0.0f, 3840, kScreenH, 0, 0, &secondary);
+    };
+
+    auto mid = centered(2880, 540);
+    REQUIRE(physOf(2880, mid.offset.x, zoom) == Approx(2880.0f));
+
+    // Near the secondary's left edge the primary's content must not show.
+    auto edge = centered(1930, 540);
+    auto mb = ViewportTracker::offsetBounds(zoom, 1920, kScreenH, 1920, 0);
+    REQUIRE(edge.offset.x == Approx(mb.minX));
+}
+
+TEST_CASE("Centered: a lagging follow never loses the pointer off screen",
+          "[ViewportTracker][Centered]")
+{
+    const float zoom = 8.0f;
+    ViewportTracker::FollowState st;
+    st.offset = {960.0f - 960.0f / zoom, 540.0f - 540.0f / zoom};
+    // Flick 600 px in one frame with a slow follow.
+    st = ViewportTracker::computeCenteredOffset(st, 1560, 540, zoom, centeredParams(0.5f),
+                                                1.0f / 144.0f, kScreenW, kScreenH);
+    REQUIRE(physOf(1560, st.offset.x, zoom) <= static_cast<float>(kScreenW) + 1e-3f);
+    REQUIRE(physOf(1560, st.offset.x, zoom) >= 0.0f);
+}
+
+TEST_CASE("trackPointer: Centered continues its follow across frames",
+          "[ViewportTracker][Centered]")
+{
+    ViewportTracker vt;
+    vt.setPointerTracking(PointerTrackingMode::Centered, edgeParams());
+    vt.setCenteredFollow(centeredParams());
+    const float zoom = 4.0f;
+    ViewportTracker::Offset applied{1000.0f - 240.0f, 540.0f - 135.0f};
+    ViewportTracker::FollowState exact{applied, {0.0f, 0.0f}};
+    for (int i = 0; i < 60; ++i)
+    {
+        auto off = vt.trackPointer(1100, 540, zoom, applied, zoom, 1.0f / 144.0f,
+                                   kScreenW, kScreenH);
+        exact = ViewportTracker::computeCenteredOffset(exact, 1100, 540, zoom, centeredParams(),
+                                                       1.0f / 144.0f, kScreenW, kScreenH);
+        REQUIRE(off.x == std::round(exact.offset.x));
+        applied = off;
+    }
+
+    // A zoom change with the pointer centered lands centered at the new zoom.
+    auto z = vt.trackPointer(1100, 540, 5.0f, applied, zoom, 1.0f / 144.0f,
+                             kScreenW, kScreenH);
+    REQUIRE(physOf(1100, z.x, 5.0f) == Approx(960.0f).margin(5.0f));
+}
+
+TEST_CASE("trackPointer per-frame cost by mode", "[ViewportTracker][Centered][!benchmark]")
+{
+    auto bench = [](PointerTrackingMode mode) {
+        ViewportTracker vt;
+        vt.setPointerTracking(mode, ViewportTracker::EdgePushParams{});
+        vt.setCenteredFollow(ViewportTracker::CenteredParams{});
+        ViewportTracker::Offset applied{720.0f, 405.0f};
+        for (int i = 0; i < 1000; ++i)
+        {
+            int32_t px = 960 + (i * 37) % 400 - 200;
+            int32_t py = 540 + (i * 23) % 240 - 120;
+            applied = vt.trackPointer(px, py, 4.0f, applied, 4.0f, 1.0f / 144.0f,
+                                      kScreenW, kScreenH);
+        }
+        return applied.x + applied.y;
+    };
+
+    BENCHMARK("Continuous x1000") { return bench(PointerTrackingMode::Continuous); };
+    BENCHMARK("EdgePush x1000")   { return bench(PointerTrackingMode::EdgePush); };
+    BENCHMARK("Centered x1000")   { return bench(PointerTrackingMode::Centered); };
+}
+
+// ─── Source-transition pan (Doc 3 §3.4) ─────────────────────────────────────
+
+TEST_CASE("Pan duration grows with the log of the on-screen distance",
+          "[ViewportTracker][PanAnimator]")
+{
+    using PA = ViewportTracker::PanAnimator;
+    REQUIRE(PA::durationForDistance(0.0f) == Approx(PA::kMinDurationMs));
+    REQUIRE(PA::durationForDistance(20.0f) < 120.0f);   // short hop: snappy
+    REQUIRE(PA::durationForDistance(200.0f) == Approx(207.0f).margin(2.0f));
+    REQUIRE(PA::durationForDistance(5000.0f) < PA::kMaxDurationMs);
+    REQUIRE(PA::durationForDistance(1e6f) == Approx(PA::kMaxDurationMs));
+
+    // Each doubling of distance adds a constant, not a proportional, amount.
+    const float a = PA::durationForDistance(1000.0f) - PA::durationForDistance(500.0f);
+    const float b = PA::durationForDistance(4000.0f) - PA::durationForDistance(2000.0f);
+    REQUIRE(a == Approx(b).margin(1.5f));
+
+    // Distance is measured on screen: the same offset delta pans longer at 4×.
+    PA lo, hi;
+    lo.begin({0.0f, 0.0f}, {100.0f, 0.0f}, 1.0f);
+    hi.begin({0.0f, 0.0f}, {100.0f, 0.0f}, 4.0f);
+    REQUIRE(hi.durationMs() > lo.durationMs());
+}
+
+TEST_CASE("Pan from rest lands on the target without overshoot",
+          "[ViewportTracker][PanAnimator]")
+{
+    ViewportTracker::PanAnimator pan;
+    const ViewportTracker::Offset target{800.0f, -300.0f};
+    pan.begin({0.0f, 0.0f}, target, 2.0f);
+    REQUIRE(pan.active());
+
+    const float dt = 1.0f / 144.0f;
+    float prevX = 0.0f, t = 0.0f;
+    ViewportTracker::Offset p{};
+    while (pan.active())
+    {
+        p = pan.advance(target, dt);
+        t += dt;
+        REQUIRE(p.x >= prevX);
+        REQUIRE(p.x <= target.x);
+        REQUIRE(p.y >= target.y);
+        prevX = p.x;
+    }
+    REQUIRE(p.x == target.x);
+    REQUIRE(p.y == target.y);
+    REQUIRE(t * 1000.0f == Approx(pan.durationMs()).margin(dt * 1000.0f));
+    REQUIRE(pan.velocity().x == 0.0f);
+}
+
+TEST_CASE("Interrupting a pan carries its velocity over",
+          "[ViewportTracker][PanAnimator]")
+{
+    const float dt = 1.0f / 240.0f;
+    ViewportTracker::PanAnimator pan;
+    const ViewportTracker::Offset first{1000.0f, 0.0f};
+    pan.begin({0.0f, 0.0f}, first, 1.0f);
+    ViewportTracker::Offset p{};
+    for (int i = 0; i < 30; ++i) // ~40% through
+        p = pan.advance(first, dt);
+    const auto v = pan.velocity();
+    REQUIRE(v.x > 1000.0f);
+
+    // New target further along: position and velocity are continuous.
+    const ViewportTracker::Offset second{1600.0f, 0.0f};
+    pan.begin(p, second, 1.0f);
+    REQUIRE(pan.velocity().x == Approx(v.x).epsilon(0.01));
+    auto next = pan.advance(second, dt);
+    REQUIRE(next.x - p.x == Approx(v.x * dt).epsilon(0.05));
+
+    // Without carry-over the view would have stalled.
+    ViewportTracker::PanAnimator fresh;
+    fresh.begin(p, second, 1.0f);
+    REQUIRE(fresh.advance(second, dt).x - p.x < 0.1f * v.x * dt);
+
+    // Reversing: velocity away from the new target is dropped, never carried
+    // backward past the start.
+    pan.begin(next, {0.0f, 0.0f}, 1.0f);
+    float prev = next.x;
+    while (pan.active())
+    {
+        const float x = pan.advance({0.0f, 0.0f}, dt).x;
+        REQUIRE(x <= prev);
+        prev = x;
+    }
+}
+
+TEST_CASE("Carried velocity never overshoots a close target",
+          "[ViewportTracker][PanAnimator]")
+{
+    const float dt = 1.0f / 144.0f;
+    ViewportTracker::PanAnimator pan;
+    pan.begin({0.0f, 0.0f}, {3000.0f, 0.0f}, 1.0f);
+    ViewportTracker::Offset p{};
+    for (int i = 0; i < 20; ++i)
+        p = pan.advance({3000.0f, 0.0f}, dt);
+    REQUIRE(pan.velocity().x > 5000.0f);
+
+    // Fast pan retargeted to a point just ahead: monotone, stops on it.
+    const ViewportTracker::Offset near{p.x + 30.0f, 0.0f};
+    pan.begin(p, near, 1.0f);
+    while (pan.active())
+    {
+        const auto q = pan.advance(near, dt);
+        REQUIRE(q.x <= near.x + 1e-3f);
+    }
+}
@@ -0,0 +1,284 @@
+// =============================================================================
+// Unit tests for the ViewportTracker batch kernels — Doc 3 §3.6
+// Every batch result must be bit-identical to the scalar function for the same
+// element: random points / rects (negative origins, zero-width carets, rects
+// off the monitor and larger than the viewport) at batch sizes that exercise
+// full vectors and scalar remainders. Benchmarks compare the throughput of a
+// scalar loop with the batch kernel.
+// Pure logic — no Win32 API dependencies.
+// =============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_message.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "smoothzoom/logic/ViewportTracker.h"
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace SmoothZoom;
+using VT = ViewportTracker;
+
+namespace
+{
+
+struct Lcg
+{
+    uint64_t s;
+    uint32_t next()
+    {
+        s = s * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<uint32_t>(s >> 33);
+    }
+    int32_t range(int32_t lo, int32_t hi) // inclusive
+    {
+        return lo + static_cast<int32_t>(next() % static_cast<uint32_t>(hi - lo + 1));
+    }
+};
+
+struct Region
+{
+    int32_t w, h, ox, oy;
+};
+
+// SoA rect storage with views for the kernels.
+struct Rects
+{
+    std::vector<int32_t> l, t, r, b;
+    VT::RectBatch view() const { return {l.data(), t.data(), r.data(), b.data(), l.size()}; }
+    ScreenRect at(size_t i) const { return {l[i], t[i], r[i], b[i]}; }
+};
+
+Region randomRegion(Lcg& rng)
+{
+    static constexpr int32_t kSizes[][2] = {
+        {1920, 1080}, {2560, 1440}, {3840, 2160}, {1080, 1920}, {5760, 1080}};
+    const auto& sz = kSizes[rng.range(0, 4)];
+    return {sz[0], sz[1], rng.range(-6000, 4000), rng.range(-2500, 1500)};
+}
+
+Rects randomRects(Lcg& rng, size_t n, const Region& g)
+{
+    Rects rs;
+    for (size_t i = 0; i < n; ++i)
+    {
+        const int32_t x = rng.range(g.ox - 300, g.ox + g.w + 300);
+        const int32_t y = rng.range(g.oy - 300, g.oy + g.h + 300);
+        int32_t w = 0;
+        switch (rng.range(0, 3))
+        {
+        case 0: w = 0; break;                          // caret
+        case 1: w = rng.range(1, 60); break;           // small control
+        case 2: w = rng.range(60, 800); break;         // field / panel
+        default: w = rng.range(800, 2 * g.w); break;   // larger than the viewport
+        }
+        const int32_t h = rng.range(1, rng.range(0, 5) == 0 ? 2 * g.h : 200);
+        rs.l.push_back(x);
+        rs.t.push_back(y);
+        rs.r.push_back(x + w);
+        rs.b.push_back(y + h);
+    }
+    return rs;
+}
+
+float randomZoom(Lcg& rng)
+{
+    switch (rng.range(0, 5))
+    {
+    case 0: return 1.0f;                                    // identity early-out
+    case 1: return 1.0f + 1e-6f * static_cast<float>(rng.range(1, 100));
+    default: return 1.0f + static_cast<float>(rng.range(1, 1500)) / 100.0f;
+    }
+}
+
+bool sameBits(float a, float b)
+{
+    return std::memcmp(&a, &b, sizeof(float)) == 0;
+}
+
+constexpr size_t kSizes[] = {0, 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 33, 256};
+
+} // namespace
+
+TEST_CASE("Batch kernels report their instruction set", "[ViewportTracker][Batch]")
+{
+    const std::string isa = VT::batchKernelIsa();
+    INFO("isa " << isa);
+    REQUIRE((isa == "avx2" || isa == "sse2" || isa == "scalar"));
+}
+
+TEST_CASE("Batch pointer offsets are bit-identical to computePointerOffset",
+          "[ViewportTracker][Batch]")
+{
+    for (uint64_t seed = 1; seed <= 40; ++seed)
+        for (size_t n : kSizes)
+        {
+            Lcg rng{seed * 131 + n};
+            const Region g = randomRegion(rng);
+            const float zoom = randomZoom(rng);
+            std::vector<int32_t> xs, ys;
+            for (size_t i = 0; i < n; ++i)
+            {
+                xs.push_back(rng.range(g.ox - 200, g.ox + g.w + 200));
+                ys.push_back(rng.range(g.oy - 200, g.oy + g.h + 200));
+            }
+            std::vector<float> ox(n, -1.0f), oy(n, -1.0f);
+            VT::computePointerOffsets({xs.data(), ys.data(), n}, zoom, g.w, g.h, g.ox, g.oy,
+                                      {ox.data(), oy.data()});
+            for (size_t i = 0; i < n; ++i)
+            {
+                const auto s = VT::computePointerOffset(xs[i], ys[i], zoom, g.w, g.h, g.ox, g.oy);
+                INFO("seed " << seed << " n " << n << " i " << i << " zoom " << zoom);
+                REQUIRE(sameBits(ox[i], s.x));
+                REQUIRE(sameBits(oy[i], s.y));
+            }
+        }
+}
+
+TEST_CASE("Batch element, focus and caret offsets are bit-identical to the scalar functions",
+          "[ViewportTracker][Batch]")
+{
+    for (uint64_t seed = 1; seed <= 40; ++seed)
+        for (size_t n : kSizes)
+        {
+            Lcg rng{seed * 7 + n * 1009};
+            const Region g = randomRegion(rng);
+            const float zoom = randomZoom(rng);
+            const Rects rs = randomRects(rng, n, g);
+            // Current viewport anywhere in (and slightly past) its valid range.
+            const auto bounds = VT::offsetBounds(zoom, g.w, g.h, g.ox, g.oy);
+            const float curX = bounds.minX + (bounds.maxX - bounds.minX + 200.0f)
+                             * static_cast<float>(rng.range(0, 1000)) / 1000.0f - 100.0f;
+            const float curY = bounds.minY + (bounds.maxY - bounds.minY)
+                             * static_cast<float>(rng.range(0, 1000)) / 1000.0f;
+
+            std::vector<float> ex(n), ey(n), fx(n), fy(n), cx(n), cy(n);
+            VT::computeElementOffsets(rs.view(), zoom, g.w, g.h, g.ox, g.oy, {ex.data(), ey.data()});
+            VT::computeFocusOffsets(curX, curY, rs.view(), zoom, g.w, g.h, g.ox, g.oy,
+                                    {fx.data(), fy.data()});
+            VT::computeCaretOffsets(rs.view(), zoom, g.w, g.h, g.ox, g.oy, {cx.data(), cy.data()});
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                INFO("seed " << seed << " n " << n << " i " << i << " zoom " << zoom);
+                const ScreenRect r = rs.at(i);
+                const auto e = VT::computeElementOffset(r, zoom, g.w, g.h, g.ox, g.oy);
+                REQUIRE(sameBits(ex[i], e.x));
+                REQUIRE(sameBits(ey[i], e.y));
+                const auto f = VT::computeFocusOffset(curX, curY, r, zoom, g.w, g.h, g.ox, g.oy);
+                REQUIRE(sameBits(fx[i], f.x));
+                REQUIRE(sameBits(fy[i], f.y));
+                const auto c = VT::computeCaretOffset(r, zoom, g.w, g.h, g.ox, g.oy);
+                REQUIRE(sameBits(cx[i], c.x));
+                REQUIRE(sameBits(cy[i], c.y));
+            }
+        }
+}
+
+TEST_CASE("Batch focus kernel covers every scalar branch", "[ViewportTracker][Batch]")
+{
+    // Hand-placed rects hitting visible / clipped-low / clipped-high / too-big
+    // on both axes within one vector, at 4x on a 1920x1080 monitor left of the
+    // primary. Viewport at offset (−1000, 200) shows [−1480, −1000) × [200, 470).
+    const Region g{1920, 1080, -1920, 0};
+    Rects rs;
+    auto add = [&](int32_t l, int32_t t, int32_t r, int32_t b) {
+        rs.l.push_back(l); rs.t.push_back(t); rs.r.push_back(r); rs.b.push_back(b);
+    };
+    add(-1300, 250, -1200, 300);  // fully visible: no pan
+    add(-1550, 250, -1450, 300);  // clipped low
+    add(-1050, 250, -950, 300);   // clipped high
+    add(-1900, 250, -100, 300);   // wider than the viewport: centered
+    add(-1300, 100, -1200, 150);  // clipped top
+    add(-1300, 440, -1200, 500);  // clipped bottom
+    add(-1300, 0, -1200, 1080);   // taller than the viewport
+    add(-1300, 250, -1300, 270);  // zero-width caret, visible
+    std::vector<float> fx(rs.l.size()), fy(rs.l.size());
+    VT::computeFocusOffsets(-1000.0f, 200.0f, rs.view(), 4.0f, g.w, g.h, g.ox, g.oy,
+                            {fx.data(), fy.data()});
+    for (size_t i = 0; i < rs.l.size(); ++i)
+    {
+        INFO("rect " << i);
+        const auto f = VT::computeFocusOffset(-1000.0f, 200.0f, rs.at(i), 4.0f,
+                                              g.w, g.h, g.ox, g.oy);
+        REQUIRE(sameBits(fx[i], f.x));
+        REQUIRE(sameBits(fy[i], f.y));
+    }
+    REQUIRE(fx[0] == -1000.0f);
+    REQUIRE(fx[1] < -1000.0f);
+    REQUIRE(fx[2] > -1000.0f);
+}
+
+TEST_CASE("Batch kernel throughput vs scalar loop", "[ViewportTracker][Batch][!benchmark]")
+{
+    constexpr size_t kN = 4096;
+    Lcg rng{42};
+    const Region g{2560, 1440, -2560, -200};
+    const Rects rs = randomRects(rng, kN, g);
+    std::vector<float> ox(kN), oy(kN);
+    const VT::OffsetBatch out{ox.data(), oy.data()};
+    const float zoom = 4.5f;
+
+    BENCHMARK("pointer scalar x4096")
+    {
+        for (size_t i = 0; i < kN; ++i)
+        {
+            const auto o = VT::computePointerOffset(rs.l[i], rs.t[i], zoom, g.w, g.h, g.ox, g.oy);
+            ox[i] = o.x;
+            oy[i] = o.y;
+        }
+        return ox[kN - 1];
+    };
+    BENCHMARK("pointer batch x4096")
+    {
+        VT::computePointerOffsets({rs.l.data(), rs.t.data(), kN}, zoom, g.w, g.h, g.ox, g.oy, out);
+        return ox[kN - 1];
+    };
+    BENCHMARK("element scalar x4096")
+    {
+        for (size_t i = 0; i < kN; ++i)
+        {
+            const auto o = VT::computeElementOffset(rs.at(i), zoom, g.w, g.h, g.ox, g.oy);
+            ox[i] = o.x;
+            oy[i] = o.y;
+        }
+        return ox[kN - 1];
+    };
+    BENCHMARK("element batch x4096")
+    {
+        VT::computeElementOffsets(rs.view(), zoom, g.w, g.h, g.ox, g.oy, out);
+        return ox[kN - 1];
+    };
+    BENCHMARK("focus scalar x4096")
+    {
+        for (size_t i = 0; i < kN; ++i)
+        {
+            const auto o = VT::computeFocusOffset(-1500.0f, 100.0f, rs.at(i), zoom,
+                                                  g.w, g.h, g.ox, g.oy);
+            ox[i] = o.x;
+            oy[i] = o.y;
+        }
+        return ox[kN - 1];
+    };
+    BENCHMARK("focus batch x4096")
+    {
+        VT::computeFocusOffsets(-1500.0f, 100.0f, rs.view(), zoom, g.w, g.h, g.ox, g.oy, out);
+        return ox[kN - 1];
+    };
+    BENCHMARK("caret scalar x4096")
+    {
+        for (size_t i = 0; i < kN; ++i)
+        {
+            const auto o = VT::computeCaretOffset(rs.at(i), zoom, g.w, g.h, g.ox, g.oy);
+            ox[i] = o.x;
+            oy[i] = o.y;
+        }
+        return ox[kN - 1];
+    };
+    BENCHMARK("caret batch x4096")
+    {
+        VT::computeCaretOffsets(rs.view(), zoom, g.w, g.h, g.ox, g.oy, out);
+        return ox[kN - 1];
+    };
+}
@@ -5,7 +5,9 @@
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include "smoothzoom/logic/ZoomController.h"
+#include "smoothzoom/logic/ZoomCurve.h"
 #include <cmath>
 
 using namespace SmoothZoom;
@@ -801,6 +803,28 @@ TEST_CASE("Non-positive scroll sensitivity is rejected (A3 defense-in-depth)", "
     REQUIRE(zc.currentZoom() == Approx(1.1f).margin(0.001f));
 }
 
+TEST_CASE("Pinch log-zoom is the zoom ratio, whatever the scroll sensitivity", "[ZoomController][Interop]")
+{
+    ZoomController zc;
+    zc.applySettings(1.0f, 10.0f, 0.25f, 2.0f, 1, 3.0f);
+    zc.setWheelSmoothing(true, 0.03f);
+
+    zc.applyPinchLogZoom(std::log(2.0f));
+    REQUIRE(zc.currentZoom() == Approx(2.0f));
+    REQUIRE(zc.mode() == ZoomController::Mode::Scrolling);
+
+    // No soft-margin attenuation approaching the maximum, only the hard clamp.
+    zc.applyPinchLogZoom(std::log(4.5f));
+    REQUIRE(zc.currentZoom() == Approx(9.0f));
+    zc.applyPinchLogZoom(std::log(2.0f));
+    REQUIRE(zc.currentZoom() == 10.0f);
+
+    zc.applyPinchLogZoom(-std::log(20.0f));
+    REQUIRE(zc.currentZoom() == 1.0f);
+    zc.endScroll();
+    REQUIRE(zc.mode() == ZoomController::Mode::Idle);
+}
+
 // =============================================================================
 // Phase 5C: Tray Toggle tests (AC-2.9.15)
 // =============================================================================
@@ -885,3 +909,329 @@ TEST_CASE("trayToggle does not interfere with hold-to-peek toggle state", "[Zoom
     REQUIRE(zc.isToggled());
     REQUIRE(zc.targetZoom() == Approx(1.0f));
 }
+
+// =============================================================================
+// Zoom presets: planned multi-level jumps (beginAnimation shared path)
+// =============================================================================
+
+// Frames until Idle at a fixed rate (returns maxFrames if it never settles).
+static int framesToSettle(ZoomController& zc, float hz, int maxFrames = 2000)
+{
+    int frames = 0;
+    while (zc.mode() != ZoomController::Mode::Idle && frames < maxFrames)
+    {
+        zc.tick(1.0f / hz);
+        ++frames;
+    }
+    return frames;
+}
+
+TEST_CASE("jumpToPreset lands exactly on the preset", "[ZoomController][Presets]")
+{
+    ZoomController zc;
+    zc.jumpToPreset(2); // default table {1, 2.5, 6}
+    REQUIRE(zc.mode() == ZoomController::Mode::Animating);
+    REQUIRE(zc.targetZoom() == Approx(6.0f));
+    runToIdle(zc);
+    REQUIRE(zc.currentZoom() == 6.0f);
+}
+
+TEST_CASE("Preset jump settles in its planned duration", "[ZoomController][Presets]")
+{
+    for (float hz : {60.0f, 144.0f})
+    {
+        ZoomController zc;
+        float planned = planDurationSec(1.0f, 6.0f, 1);
+        zc.jumpToPreset(2);
+        int frames = framesToSettle(zc, hz);
+        float settleSec = frames / hz;
+        INFO("hz=" << hz);
+        REQUIRE(settleSec >= planned);
+        REQUIRE(settleSec <= planned + 1.0f / hz + 1e-4f);
+    }
+}
+
+TEST_CASE("Preset jump duration scales with log-distance", "[ZoomController][Presets]")
+{
+    float shortJump = planDurationSec(2.0f, 2.5f, 1);
+    float longJump  = planDurationSec(1.0f, 6.0f, 1);
+    REQUIRE(shortJump < longJump);
+    // Symmetric in direction
+    REQUIRE(planDurationSec(6.0f, 1.0f, 1) == Approx(longJump));
+    // Speed setting scales it
+    REQUIRE(planDurationSec(1.0f, 6.0f, 0) > longJump);
+    REQUIRE(planDurationSec(1.0f, 6.0f, 2) < longJump);
+}
+
+TEST_CASE("Planned jump is faster than the equivalent keyboard steps", "[ZoomController][Presets]")
+{
+    ZoomController planned;
+    planned.jumpToPreset(2); // 1× → 6×
+    int plannedFrames = framesToSettle(planned, 60.0f);
+
+    // 1.25^8 ≈ 5.96: eight key presses, one per 100 ms (key repeat pace)
+    ZoomController stepped;
+    int steppedFrames = 0;
+    for (int press = 0; press < 8; ++press)
+    {
+        stepped.applyKeyboardStep(+1);
+        for (int f = 0; f < 6; ++f, ++steppedFrames)
+            stepped.tick(1.0f / 60.0f);
+    }
+    steppedFrames += framesToSettle(stepped, 60.0f);
+
+    REQUIRE(plannedFrames < steppedFrames);
+}
+
+TEST_CASE("Planned jump is monotonic (no overshoot)", "[ZoomController][Presets]")
+{
+    ZoomController zc;
+    zc.jumpToPreset(2);
+    float prev = zc.currentZoom();
+    while (zc.mode() != ZoomController::Mode::Idle)
+    {
+        zc.tick(1.0f / 144.0f);
+        REQUIRE(zc.currentZoom() >= prev);
+        REQUIRE(zc.currentZoom() <= 6.0f);
+        prev = zc.currentZoom();
+    }
+}
+
+TEST_CASE("Repeated preset command does not restart the plan", "[ZoomController][Presets]")
+{
+    ZoomController zc;
+    zc.jumpToPreset(2);
+    for (int i = 0; i < 5; ++i)
+        zc.tick(1.0f / 60.0f);
+    float mid = zc.currentZoom();
+    zc.jumpToPreset(2); // key auto-repeat
+    zc.tick(1.0f / 60.0f);
+    REQUIRE(zc.currentZoom() > mid);
+}
+
+TEST_CASE("Keyboard step cancels a plan into exponential ease", "[ZoomController][Presets]")
+{
+    ZoomController zc;
+    zc.jumpToPreset(2);
+    for (int i = 0; i < 5; ++i)
+        zc.tick(1.0f / 60.0f);
+    float target = zc.targetZoom();
+    zc.applyKeyboardStep(-1);
+    REQUIRE(zc.targetZoom() == Approx(target / 1.25f));
+    runToIdle(zc);
+    REQUIRE(zc.currentZoom() == Approx(target / 1.25f));
+}
+
+TEST_CASE("Scroll interrupts a planned jump", "[ZoomController][Presets]")
+{
+    ZoomController zc;
+    zc.jumpToPreset(2);
+    zc.tick(1.0f / 60.0f);
+    float z = zc.currentZoom();
+    zc.applyScrollDelta(120);
+    REQUIRE(zc.mode() == ZoomController::Mode::Scrolling);
+    REQUIRE(zc.currentZoom() == Approx(z * 1.1f));
+    zc.tick(1.0f / 60.0f);
+    zc.endScroll();
+    REQUIRE(zc.mode() == ZoomController::Mode::Idle);
+}
+
+TEST_CASE("animateToZoom keeps exponential ease (shared path, no plan)", "[ZoomController][Presets]")
+{
+    ZoomController zc;
+    zc.animateToZoom(6.0f);
+    zc.tick(1.0f / 60.0f);
+    // First exponential frame at normal speed: alpha = 0.15
+    REQUIRE(zc.currentZoom() == Approx(1.0f + 5.0f * 0.15f).margin(1e-4));
+}
+
+TEST_CASE("cyclePreset walks the table and wraps", "[ZoomController][Presets]")
+{
+    ZoomController zc;
+    const float presets[] = {1.0f, 2.5f, 6.0f};
+    zc.setZoomPresets(presets, 3);
+
+    // At 1.0× (= preset 0) → 2.5 → 6 → 1
+    zc.cyclePreset(); runToIdle(zc);
+    REQUIRE(zc.currentZoom() == Approx(2.5f));
+    zc.cyclePreset(); runToIdle(zc);
+    REQUIRE(zc.currentZoom() == Approx(6.0f));
+    zc.cyclePreset(); runToIdle(zc);
+    REQUIRE(zc.currentZoom() == Approx(1.0f));
+}
+
+TEST_CASE("cyclePreset from between presets picks the next one up", "[ZoomController][Presets]")
+{
+    ZoomController zc;
+    for (int i = 0; i < 4; ++i)
+        zc.applyScrollDelta(120); // ≈1.46
+    zc.cyclePreset();
+    REQUIRE(zc.targetZoom() == Approx(2.5f));
+}
+
+TEST_CASE("Presets respect zoom bounds and invalid indices", "[ZoomController][Presets]")
+{
+    ZoomController zc;
+    zc.applySettings(1.0f, 4.0f, 0.25f, 2.0f, 1);
+    zc.jumpToPreset(2); // 6 → clamped to max 4
+    REQUIRE(zc.targetZoom() == Approx(4.0f));
+
+    ZoomController zc2;
+    zc2.jumpToPreset(5);  // beyond count
+    zc2.jumpToPreset(-1);
+    REQUIRE(zc2.mode() == ZoomController::Mode::Idle);
+}
+
+TEST_CASE("Preset jump updates toggle and last-used bookkeeping", "[ZoomController][Presets]")
+{
+    ZoomController zc;
+    zc.jumpToPreset(1); // 2.5
+    runToIdle(zc);
+    zc.trayToggle();    // → 1.0, remembers 2.5
+    runToIdle(zc);
+    zc.trayToggle();
+    REQUIRE(zc.targetZoom() == Approx(2.5f));
+}
+
+TEST_CASE("Preset settle-time benchmarks", "[ZoomController][Presets][!benchmark]")
+{
+    BENCHMARK("Planned 1x -> 6x to settle @144Hz")
+    {
+        ZoomController zc;
+        zc.jumpToPreset(2);
+        return framesToSettle(zc, 144.0f);
+    };
+
+    BENCHMARK("Exponential 1x -> 6x to settle @144Hz")
+    {
+        ZoomController zc;
+        zc.animateToZoom(6.0f);
+        return framesToSettle(zc, 144.0f);
+    };
+}
+
+// =============================================================================
+// Notched-wheel smoothing (optional glide toward an accumulating target)
+// =============================================================================
+
+TEST_CASE("Wheel smoothing off: notch is applied in one frame", "[ZoomController][WheelSmoothing]")
+{
+    ZoomController zc;
+    zc.applyScrollDelta(120);
+    REQUIRE(zc.currentZoom() == Approx(1.1f));
+}
+
+TEST_CASE("Wheel smoothing: notch glides to its target", "[ZoomController][WheelSmoothing]")
+{
+    ZoomController zc;
+    zc.setWheelSmoothing(true, 0.033f);
+    zc.applyScrollDelta(120);
+    REQUIRE(zc.currentZoom() == 1.0f);          // nothing shown yet
+    REQUIRE(zc.targetZoom() == Approx(1.1f));
+    REQUIRE(zc.mode() == ZoomController::Mode::Scrolling);
+
+    float prev = zc.currentZoom();
+    for (int i = 0; i < 30 && zc.mode() != ZoomController::Mode::Idle; ++i)
+    {
+        zc.tick(1.0f / 144.0f);
+        zc.endScroll();
+        REQUIRE(zc.currentZoom() >= prev);      // monotonic, no overshoot
+        REQUIRE(zc.currentZoom() <= zc.targetZoom());
+        prev = zc.currentZoom();
+    }
+    REQUIRE(zc.mode() == ZoomController::Mode::Idle);
+    REQUIRE(zc.currentZoom() == zc.targetZoom());
+}
+
+TEST_CASE("Wheel smoothing: added latency stays within the budget", "[ZoomController][WheelSmoothing]")
+{
+    for (float budget : {0.008f, 0.033f, 0.050f})
+    {
+        for (float hz : {30.0f, 60.0f, 144.0f, 240.0f})
+        {
+            ZoomController zc;
+            zc.setWheelSmoothing(true, budget);
+            zc.applyScrollDelta(120);
+            const float logStep = std::log(zc.targetZoom());
+
+            float t = 0.0f;
+            float errAtBudget = -1.0f;
+            int frames = 0;
+            while (zc.mode() != ZoomController::Mode::Idle && frames < 1000)
+            {
+                zc.tick(1.0f / hz);
+                zc.endScroll();
+                t += 1.0f / hz;
+                ++frames;
+                if (errAtBudget < 0.0f && t >= budget - 1e-6f)
+                    errAtBudget = (std::log(zc.targetZoom()) - std::log(zc.currentZoom())) / logStep;
+            }
+            INFO("budget=" << budget << " hz=" << hz);
+            if (errAtBudget >= 0.0f)
+                REQUIRE(errAtBudget <= 0.055f);     // ≥ ~95% of the notch shown by the budget
+            REQUIRE(t <= budget * 1.5f + 1.0f / hz); // fully settled shortly after
+        }
+    }
+}
+
+TEST_CASE("Wheel smoothing: trajectory is refresh-rate independent", "[ZoomController][WheelSmoothing]")
+{
+    ZoomController a, b;
+    a.setWheelSmoothing(true, 0.05f);
+    b.setWheelSmoothing(true, 0.05f);
+    a.applyScrollDelta(360);
+    b.applyScrollDelta(360);
+
+    // Sample at common instants: 60 Hz vs 240 Hz (4 sub-frames per sample)
+    for (int k = 0; k < 6; ++k)
+    {
+        a.tick(1.0f / 60.0f);
+        for (int j = 0; j < 4; ++j)
+            b.tick(1.0f / 240.0f);
+        INFO("sample " << k);
+        REQUIRE(a.currentZoom() == Approx(b.currentZoom()).margin(0.006));
+    }
+}
+
+TEST_CASE("Wheel smoothing: notches accumulate into the target", "[ZoomController][WheelSmoothing]")
+{
+    ZoomController zc;
+    zc.setWheelSmoothing(true, 0.033f);
+    zc.applyScrollDelta(120);
+    zc.tick(1.0f / 144.0f);
+    zc.applyScrollDelta(120);
+    REQUIRE(zc.targetZoom() == Approx(1.21f));
+    REQUIRE(zc.currentZoom() < 1.1f);
+}
+
+TEST_CASE("Wheel smoothing: sub-notch touchpad deltas stay direct", "[ZoomController][WheelSmoothing]")
+{
+    ZoomController zc;
+    zc.setWheelSmoothing(true, 0.033f);
+    zc.applyScrollDelta(40);
+    REQUIRE(zc.currentZoom() > 1.0f);
+    REQUIRE(zc.currentZoom() == zc.targetZoom());
+    zc.tick(1.0f / 60.0f);
+    zc.endScroll();
+    REQUIRE(zc.mode() == ZoomController::Mode::Idle);
+}
+
+TEST_CASE("Wheel smoothing: endScroll waits for the glide", "[ZoomController][WheelSmoothing]")
+{
+    ZoomController zc;
+    zc.setWheelSmoothing(true, 0.05f);
+    zc.applyScrollDelta(120);
+    zc.tick(1.0f / 144.0f);
+    zc.endScroll();
+    REQUIRE(zc.mode() == ZoomController::Mode::Scrolling);
+}
+
+TEST_CASE("Wheel smoothing: latency budget is clamped", "[ZoomController][WheelSmoothing]")
+{
+    // 1 s budget is clamped to 50 ms → settles well within 0.1 s
+    ZoomController zc;
+    zc.setWheelSmoothing(true, 1.0f);
+    zc.applyScrollDelta(120);
+    for (int i = 0; i < 6; ++i) { zc.tick(1.0f / 60.0f); zc.endScroll(); }
+    REQUIRE(zc.mode() == ZoomController::Mode::Idle);
+}
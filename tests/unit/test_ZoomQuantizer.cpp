@@ -0,0 +1,212 @@
+// =============================================================================
+// Unit tests for ZoomQuantizer + ZoomController resting quantization — Doc 3 §3.5
+// Pure logic — no Win32 API dependencies.
+// =============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "smoothzoom/logic/ZoomQuantizer.h"
+#include "smoothzoom/logic/ZoomController.h"
+#include <cmath>
+
+using namespace SmoothZoom;
+using Catch::Approx;
+
+// ─── Pure grid math ──────────────────────────────────────────────────────────
+
+TEST_CASE("Quantizer prefers integer factor within tolerance", "[ZoomQuantizer]")
+{
+    REQUIRE(quantizeZoom(2.97f, 1920, 0.05f, 1.0f, 10.0f) == 3.0f);
+    REQUIRE(quantizeZoom(4.04f, 2560, 0.05f, 1.0f, 10.0f) == 4.0f);
+}
+
+TEST_CASE("Quantizer outside tolerance → whole-pixel source span", "[ZoomQuantizer]")
+{
+    const int32_t extent = 1920;
+    float z = quantizeZoom(3.4172f, extent, 0.05f, 1.0f, 10.0f);
+
+    // Visible source span is a whole number of pixels (rational px mapping)
+    float span = static_cast<float>(extent) / z;
+    REQUIRE(span == Approx(std::round(span)).margin(1e-3));
+    // ...and it's the nearest such span
+    REQUIRE(std::abs(std::round(span) - extent / 3.4172f) <= 0.5f + 1e-3f);
+    REQUIRE(z == Approx(3.4172f).margin(0.01));
+}
+
+TEST_CASE("Quantizer leaves 1.0x and degenerate extents alone", "[ZoomQuantizer]")
+{
+    REQUIRE(quantizeZoom(1.0f, 1920, 0.05f, 1.0f, 10.0f) == 1.0f);
+    REQUIRE(quantizeZoom(2.3f, 0, 0.05f, 1.0f, 10.0f) == 2.3f);
+}
+
+TEST_CASE("Quantizer result stays within zoom bounds", "[ZoomQuantizer]")
+{
+    // Integer 5 is out of [1, 4.98] → falls back to the pixel grid below max
+    float z = quantizeZoom(4.97f, 1920, 0.05f, 1.0f, 4.98f);
+    REQUIRE(z <= 4.98f);
+    REQUIRE(z >= 1.0f);
+
+    for (float zoom = 1.01f; zoom < 10.0f; zoom += 0.137f)
+    {
+        float q = quantizeZoom(zoom, 1366, 0.1f, 1.0f, 10.0f);
+        INFO("zoom=" << zoom);
+        REQUIRE(q >= 1.0f);
+        REQUIRE(q <= 10.0f);
+    }
+}
+
+TEST_CASE("Quantizer is idempotent on grid values", "[ZoomQuantizer]")
+{
+    for (float zoom = 1.1f; zoom < 10.0f; zoom += 0.29f)
+    {
+        float q = quantizeZoom(zoom, 2560, 0.05f, 1.0f, 10.0f);
+        INFO("zoom=" << zoom);
+        REQUIRE(quantizeZoom(q, 2560, 0.05f, 1.0f, 10.0f) == Approx(q));
+    }
+}
+
+TEST_CASE("Glide step never moves a pixel more than the limit", "[ZoomQuantizer]")
+{
+    for (int32_t extent : {1366, 1920, 2560, 3840})
+    {
+        for (float from : {1.3f, 2.04f, 3.4172f, 6.66f, 9.51f})
+        {
+            float grid = quantizeZoom(from, extent, 0.1f, 1.0f, 10.0f);
+            float z = from;
+            int frames = 0;
+            while (z != grid && frames < 100000)
+            {
+                float next = quantizeStepToward(z, grid, extent);
+                INFO("extent=" << extent << " from=" << from << " frame " << frames);
+                REQUIRE(quantizeDisplacementPx(z, next, extent) <= kQuantizeMaxStepPx * 1.001f);
+                z = next;
+                ++frames;
+            }
+            REQUIRE(z == grid);
+        }
+    }
+}
+
+TEST_CASE("Offset quantization matches what MagBridge applies", "[ZoomQuantizer]")
+{
+    // MagBridge casts to int (truncation) — snapping must not move the image.
+    for (float off : {0.0f, 12.7f, 511.2f, -3.9f, -1920.4f})
+        REQUIRE(quantizeOffset(off) == static_cast<float>(static_cast<int>(off)));
+}
+
+// ─── ZoomController integration ──────────────────────────────────────────────
+
+namespace
+{
+
+// Scroll to a resting non-grid zoom and return the controller Idle.
+void settleAt(ZoomController& zc, int notches)
+{
+    for (int i = 0; i < notches; ++i)
+        zc.applyScrollDelta(120);
+    zc.tick(1.0f / 60.0f);
+    zc.endScroll();
+}
+
+} // namespace
+
+TEST_CASE("Quantization is off by default", "[ZoomQuantizer][ZoomController]")
+{
+    ZoomController zc;
+    settleAt(zc, 13);
+    float z = zc.currentZoom();
+    for (int i = 0; i < 600; ++i)
+        REQUIRE_FALSE(zc.tickQuantize(1.0f / 60.0f, 1920));
+    REQUIRE(zc.currentZoom() == z);
+    REQUIRE_FALSE(zc.isQuantized());
+}
+
+TEST_CASE("Quantization waits for the settle delay, then glides onto the grid",
+          "[ZoomQuantizer][ZoomController]")
+{
+    ZoomController zc;
+    zc.setQuantization(true, 0.05f);
+    settleAt(zc, 13); // 1.1^13 ≈ 3.45
+    const float rest = zc.currentZoom();
+    const float grid = quantizeZoom(rest, 1920, 0.05f, 1.0f, 10.0f);
+    REQUIRE(grid != rest);
+
+    // Inside the settle delay nothing moves
+    REQUIRE_FALSE(zc.tickQuantize(0.1f, 1920));
+    REQUIRE(zc.currentZoom() == rest);
+
+    float prev = zc.currentZoom();
+    int frames = 0;
+    while (!zc.isQuantized() && frames < 10000)
+    {
+        zc.tickQuantize(1.0f / 60.0f, 1920);
+        REQUIRE(quantizeDisplacementPx(prev, zc.currentZoom(), 1920) <= kQuantizeMaxStepPx * 1.001f);
+        prev = zc.currentZoom();
+        ++frames;
+    }
+    REQUIRE(zc.isQuantized());
+    REQUIRE(zc.currentZoom() == grid);
+    REQUIRE(zc.targetZoom() == grid);
+    REQUIRE(zc.mode() == ZoomController::Mode::Idle);
+}
+
+TEST_CASE("Quantization never runs during scroll or animation", "[ZoomQuantizer][ZoomController]")
+{
+    ZoomController zc;
+    zc.setQuantization(true, 0.05f);
+
+    zc.applyScrollDelta(120 * 13);
+    float z = zc.currentZoom();
+    REQUIRE_FALSE(zc.tickQuantize(1.0f, 1920));   // Scrolling
+    REQUIRE(zc.currentZoom() == z);
+
+    zc.tick(1.0f / 60.0f);
+    zc.endScroll();
+    zc.applyKeyboardStep(+1);                     // Animating
+    REQUIRE_FALSE(zc.tickQuantize(1.0f, 1920));
+    REQUIRE_FALSE(zc.isQuantized());
+}
+
+TEST_CASE("Input during a quantization glide cancels it", "[ZoomQuantizer][ZoomController]")
+{
+    ZoomController zc;
+    zc.setQuantization(true, 0.3f);
+    settleAt(zc, 12); // ≈3.14 → integer 3 is within 0.3
+    zc.tickQuantize(kQuantizeSettleDelaySec, 1920);
+    zc.tickQuantize(1.0f / 60.0f, 1920);
+    REQUIRE_FALSE(zc.isQuantized());
+
+    zc.applyScrollDelta(120);
+    float z = zc.currentZoom();
+    REQUIRE_FALSE(zc.tickQuantize(1.0f / 60.0f, 1920));
+    REQUIRE(zc.currentZoom() == z);
+}
+
+TEST_CASE("Quantization keeps 1.0x untouched", "[ZoomQuantizer][ZoomController]")
+{
+    ZoomController zc;
+    zc.setQuantization(true, 0.05f);
+    zc.tickQuantize(1.0f, 1920);
+    REQUIRE_FALSE(zc.tickQuantize(1.0f / 60.0f, 1920));
+    REQUIRE(zc.currentZoom() == 1.0f);
+    REQUIRE(zc.isQuantized());
+}
+
+TEST_CASE("Monitor change re-targets the grid immediately", "[ZoomQuantizer][ZoomController]")
+{
+    ZoomController zc;
+    zc.setQuantization(true, 0.0f);
+    settleAt(zc, 13);
+    zc.tickQuantize(kQuantizeSettleDelaySec, 1920);
+    while (!zc.isQuantized())
+        zc.tickQuantize(1.0f / 60.0f, 1920);
+    float on1920 = zc.currentZoom();
+
+    // Same zoom is generally off-grid for a 2560-wide monitor
+    zc.tickQuantize(1.0f / 60.0f, 2560);
+    while (!zc.isQuantized())
+        zc.tickQuantize(1.0f / 60.0f, 2560);
+    float span = 2560.0f / zc.currentZoom();
+    REQUIRE(span == Approx(std::round(span)).margin(1e-3));
+    REQUIRE(zc.currentZoom() == Approx(on1920).margin(0.01));
+}
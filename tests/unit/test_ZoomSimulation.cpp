@@ -0,0 +1,226 @@
+// =============================================================================
+// Unit tests for ZoomSimulation — Doc 3 §3.5
+// The batch simulator must reproduce ZoomController exactly for the settings
+// the controller exposes, so curves tuned offline ship unchanged.
+// Pure logic — no Win32 API dependencies.
+// =============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "smoothzoom/logic/ZoomSimulation.h"
+#include "smoothzoom/logic/ZoomController.h"
+#include <cmath>
+#include <vector>
+
+using namespace SmoothZoom;
+using Catch::Approx;
+
+namespace
+{
+
+// Drive a live controller through the same per-frame sequence as RenderLoop.
+std::vector<float> runController(const std::vector<ZoomSimEvent>& events,
+                                 float minZoom, float maxZoom, float keyboardStep,
+                                 float defaultZoom, int animationSpeed, float sensitivity,
+                                 float wheelSmoothingSec = 0.0f)
+{
+    ZoomController zc;
+    zc.applySettings(minZoom, maxZoom, keyboardStep, defaultZoom, animationSpeed, sensitivity);
+    zc.setWheelSmoothing(wheelSmoothingSec > 0.0f, wheelSmoothingSec);
+
+    std::vector<float> out;
+    float prev = 0.0f;
+    for (const auto& ev : events)
+    {
+        float dt = ev.timeSec - prev;
+        prev = ev.timeSec;
+        if (dt > 0.1f) dt = 0.1f;
+        if (dt < 0.0f) dt = 0.0f;
+
+        if (ev.keyStep != 0)
+            zc.applyKeyboardStep(ev.keyStep > 0 ? +1 : -1);
+        if (ev.commands & kZoomSimReset)
+            zc.animateToZoom(1.0f);
+        if (ev.commands & kZoomSimToggleEngage)
+            zc.engageToggle();
+        if (ev.commands & kZoomSimToggleRelease)
+            zc.releaseToggle();
+        if (ev.commands & kZoomSimTrayToggle)
+            zc.trayToggle();
+        if (ev.scrollDelta != 0)
+            zc.applyScrollDelta(ev.scrollDelta);
+        zc.tick(dt);
+        if (ev.scrollDelta == 0)
+            zc.endScroll();
+        out.push_back(zc.currentZoom());
+    }
+    return out;
+}
+
+// A mixed session at a given frame rate: scroll in, keyboard steps, toggle
+// peek, tray toggle, scroll out to the floor, reset.
+std::vector<ZoomSimEvent> mixedSession(float hz)
+{
+    std::vector<ZoomSimEvent> ev;
+    const float dt = 1.0f / hz;
+    float t = 0.0f;
+    auto frame = [&](int32_t scroll, int8_t key, uint8_t cmd) {
+        t += dt;
+        ZoomSimEvent e;
+        e.timeSec = t;
+        e.scrollDelta = scroll;
+        e.keyStep = key;
+        e.commands = cmd;
+        ev.push_back(e);
+    };
+    auto idle = [&](int frames) { for (int i = 0; i < frames; ++i) frame(0, 0, kZoomSimNone); };
+
+    for (int i = 0; i < 12; ++i) { frame(120, 0, kZoomSimNone); idle(2); }
+    for (int i = 0; i < 5; ++i) frame(40, 0, kZoomSimNone);   // sub-notch PTP deltas
+    idle(30);
+    frame(0, +1, kZoomSimNone); idle(20);
+    frame(0, +1, kZoomSimNone); idle(60);
+    frame(0, 0, kZoomSimToggleEngage); idle(40);
+    frame(0, 0, kZoomSimToggleRelease); idle(60);
+    frame(0, 0, kZoomSimTrayToggle); idle(60);
+    frame(0, 0, kZoomSimTrayToggle); idle(60);
+    for (int i = 0; i < 40; ++i) frame(-120, 0, kZoomSimNone);
+    idle(10);
+    frame(0, -1, kZoomSimNone); idle(5);
+    frame(0, 0, kZoomSimReset); idle(90);
+    return ev;
+}
+
+} // namespace
+
+TEST_CASE("Simulated lane matches ZoomController frame-for-frame", "[ZoomSimulation]")
+{
+    for (float hz : {60.0f, 144.0f})
+    {
+        auto events = mixedSession(hz);
+        ZoomSimParams p;  // shipped defaults
+        std::vector<float> traj(events.size());
+        simulateZoomBatch(events.data(), events.size(), &p, 1, traj.data());
+
+        auto ref = runController(events, 1.0f, 10.0f, 0.25f, 2.0f, 1, 1.0f);
+        REQUIRE(traj.size() == ref.size());
+        for (size_t i = 0; i < ref.size(); ++i)
+        {
+            INFO("hz=" << hz << " frame " << i);
+            REQUIRE(traj[i] == ref[i]);
+        }
+    }
+}
+
+TEST_CASE("Each batch lane matches a controller with its settings", "[ZoomSimulation]")
+{
+    auto events = mixedSession(60.0f);
+
+    struct Cfg { float minZ, maxZ, step, def; int speed; float sens; float glide; };
+    const Cfg cfgs[] = {
+        {1.0f, 10.0f, 0.25f, 2.0f, 1, 1.0f, 0.0f},
+        {1.0f, 5.0f,  0.50f, 3.0f, 0, 0.5f, 0.0f},
+        {1.5f, 20.0f, 0.10f, 2.0f, 2, 2.0f, 0.0f},
+        {1.0f, 8.0f,  0.25f, 4.0f, 1, 1.5f, 0.0f},
+        {1.0f, 10.0f, 0.25f, 2.0f, 1, 1.0f, 0.033f},  // notched-wheel smoothing
+        {1.0f, 6.0f,  0.25f, 2.0f, 2, 1.0f, 0.008f},
+    };
+    constexpr size_t kLanes = sizeof(cfgs) / sizeof(cfgs[0]);
+
+    std::vector<ZoomSimParams> params(kLanes);
+    for (size_t l = 0; l < kLanes; ++l)
+    {
+        params[l].curve.minZoom = cfgs[l].minZ;
+        params[l].curve.maxZoom = cfgs[l].maxZ;
+        params[l].curve.keyboardStep = cfgs[l].step;
+        params[l].curve.easeOutRate = easeOutRateForSpeed(cfgs[l].speed);
+        params[l].curve.scrollSensitivity = cfgs[l].sens;
+        params[l].curve.wheelSmoothingSec = cfgs[l].glide;
+        params[l].defaultZoomLevel = cfgs[l].def;
+    }
+
+    std::vector<float> traj(events.size() * kLanes);
+    simulateZoomBatch(events.data(), events.size(), params.data(), kLanes, traj.data());
+
+    for (size_t l = 0; l < kLanes; ++l)
+    {
+        const Cfg& c = cfgs[l];
+        auto ref = runController(events, c.minZ, c.maxZ, c.step, c.def, c.speed, c.sens, c.glide);
+        for (size_t f = 0; f < events.size(); ++f)
+        {
+            INFO("lane " << l << " frame " << f);
+            REQUIRE(traj[f * kLanes + l] == ref[f]);
+        }
+    }
+}
+
+TEST_CASE("Curve-only parameters change the trajectory", "[ZoomSimulation]")
+{
+    std::vector<ZoomSimEvent> events;
+    for (int i = 1; i <= 5; ++i)
+        events.push_back({i / 60.0f, 120, 0, kZoomSimNone});
+
+    ZoomSimParams params[2];
+    params[1].curve.scrollZoomBase = 1.2f;
+
+    float traj[5 * 2];
+    simulateZoomBatch(events.data(), events.size(), params, 2, traj);
+
+    // Five notches from 1.0× (well clear of the soft margin at 10×)
+    REQUIRE(traj[4 * 2 + 0] == Approx(std::pow(1.1f, 5.0f)).margin(0.01));
+    REQUIRE(traj[4 * 2 + 1] == Approx(std::pow(1.2f, 5.0f)).margin(0.01));
+}
+
+TEST_CASE("Trajectory metrics: settle time, peak, max step", "[ZoomSimulation]")
+{
+    // One keyboard step at frame 0, then 2 s of idle at 60 Hz.
+    std::vector<ZoomSimEvent> events;
+    events.push_back({1.0f / 60.0f, 0, +1, kZoomSimNone});
+    for (int i = 2; i <= 120; ++i)
+        events.push_back({i / 60.0f, 0, 0, kZoomSimNone});
+
+    ZoomSimParams params[2];
+    params[0].curve.easeOutRate = kEaseOutRateSlow;
+    params[1].curve.easeOutRate = kEaseOutRateFast;
+
+    std::vector<float> traj(events.size() * 2);
+    simulateZoomBatch(events.data(), events.size(), params, 2, traj.data());
+
+    auto slow = summarizeZoomTrajectory(events.data(), events.size(), traj.data(), 2, 0);
+    auto fast = summarizeZoomTrajectory(events.data(), events.size(), traj.data(), 2, 1);
+
+    REQUIRE(slow.finalZoom == Approx(1.25f));
+    REQUIRE(fast.finalZoom == Approx(1.25f));
+    REQUIRE(slow.peakZoom == Approx(1.25f));
+    REQUIRE(fast.settleTimeSec > 0.0f);
+    REQUIRE(fast.settleTimeSec < slow.settleTimeSec);
+    REQUIRE(fast.maxFrameLogStep > slow.maxFrameLogStep);
+}
+
+TEST_CASE("Empty inputs are a no-op", "[ZoomSimulation]")
+{
+    ZoomSimParams p;
+    float out = -1.0f;
+    simulateZoomBatch(nullptr, 0, &p, 1, &out);
+    REQUIRE(out == -1.0f);
+
+    auto m = summarizeZoomTrajectory(nullptr, 0, nullptr, 1, 0);
+    REQUIRE(m.finalZoom == 1.0f);
+}
+
+TEST_CASE("Batch simulation throughput", "[ZoomSimulation][!benchmark]")
+{
+    auto events = mixedSession(144.0f);
+    std::vector<ZoomSimParams> params(256);
+    for (size_t l = 0; l < params.size(); ++l)
+        params[l].curve.scrollZoomBase = 1.05f + 0.001f * static_cast<float>(l);
+    std::vector<float> traj(events.size() * params.size());
+
+    BENCHMARK("256 parameter sets, mixed session @144Hz")
+    {
+        simulateZoomBatch(events.data(), events.size(), params.data(), params.size(),
+                          traj.data());
+        return traj.back();
+    };
+}